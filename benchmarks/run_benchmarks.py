@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Performance regression benchmark runner.
+
+Downloads the pinned model set described by a YAML config, runs benchmark_app
+for each model/device/mode combination with fixed settings, and compares the
+measured throughput and median latency against the committed baselines with
+per-run tolerance gates. Returns a non-zero exit code when any run regresses,
+so the suite can gate release adoption in CI.
+"""
+
+import argparse
+import hashlib
+import json
+import logging
+import re
+import subprocess
+import sys
+import urllib.request
+
+from pathlib import Path
+
+import yaml
+
+THROUGHPUT_RE = re.compile(r"Throughput:\s*([0-9.]+)\s*FPS")
+MEDIAN_LATENCY_RE = re.compile(r"Median:\s*([0-9.]+)\s*ms")
+
+# Fixed per-mode benchmark_app settings: the suite measures regressions between
+# releases, so the configs must stay constant rather than track the best flags.
+MODE_ARGS = {
+    "latency": ["-api", "sync", "-niter", "100"],
+    "throughput": ["-api", "async", "-niter", "200"],
+}
+
+DEFAULT_TOLERANCE = 0.10
+
+
+def sha256sum(path: Path):
+    """Compute the SHA-256 digest of a file"""
+    digest = hashlib.sha256()
+    with open(path, "rb") as file:
+        for chunk in iter(lambda: file.read(1 << 20), b""):
+            digest.update(chunk)
+    return digest.hexdigest()
+
+
+def fetch_file(url: str, expected_sha256, models_dir: Path):
+    """Download a model file into the cache directory and verify its pin.
+
+    The URL itself is pinned to an immutable release tag; the optional SHA-256
+    adds an integrity check on top and is always verified when present, even
+    for an already cached file.
+    """
+    path = models_dir / url.rsplit("/", 1)[-1]
+    if not path.exists():
+        logging.info("Downloading %s", url)
+        models_dir.mkdir(parents=True, exist_ok=True)
+        tmp_path = path.with_suffix(path.suffix + ".part")
+        urllib.request.urlretrieve(url, tmp_path)
+        tmp_path.rename(path)
+    if expected_sha256:
+        actual = sha256sum(path)
+        if actual != expected_sha256:
+            raise RuntimeError(
+                "Checksum mismatch for {}: expected {}, got {}".format(path, expected_sha256, actual))
+    return path
+
+
+def fetch_model(model: dict, models_dir: Path):
+    """Download the IR pair of a config entry and return the path to the .xml"""
+    source = model["source"]
+    model_dir = models_dir / model["name"] / model.get("precision", "FP32")
+    xml_path = fetch_file(source["xml"], source.get("xml_sha256"), model_dir)
+    fetch_file(source["bin"], source.get("bin_sha256"), model_dir)
+    return xml_path
+
+
+def run_benchmark_app(executable: Path, model_xml: Path, device: str, mode: str):
+    """Run one benchmark_app configuration and parse its summary metrics"""
+    cmd = [str(executable), "-m", str(model_xml), "-d", device] + MODE_ARGS[mode]
+    logging.info("Running: %s", " ".join(cmd))
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    if result.returncode != 0:
+        logging.error(result.stdout)
+        raise RuntimeError("benchmark_app failed with code {}".format(result.returncode))
+
+    throughput = THROUGHPUT_RE.search(result.stdout)
+    latency = MEDIAN_LATENCY_RE.search(result.stdout)
+    if not throughput or not latency:
+        logging.error(result.stdout)
+        raise RuntimeError("Cannot parse benchmark_app output")
+    return {
+        "throughput_fps": float(throughput.group(1)),
+        "median_latency_ms": float(latency.group(1)),
+    }
+
+
+def load_baselines(baselines_dir: Path, device: str):
+    """Load the committed baseline metrics for a device, empty if none yet"""
+    path = baselines_dir / "{}.json".format(device)
+    if not path.exists():
+        return {}
+    with open(path) as file:
+        return json.load(file)
+
+
+def save_baselines(baselines_dir: Path, device: str, baselines: dict):
+    """Write updated baseline metrics for a device"""
+    baselines_dir.mkdir(parents=True, exist_ok=True)
+    path = baselines_dir / "{}.json".format(device)
+    with open(path, "w") as file:
+        json.dump(baselines, file, indent=4, sort_keys=True)
+        file.write("\n")
+    logging.info("Baselines written to %s", path)
+
+
+def check_against_baseline(run_key: str, measured: dict, baseline: dict, tolerance: float):
+    """Compare one run against its baseline. Returns the list of violations.
+
+    Throughput may not drop below baseline * (1 - tolerance) and median latency
+    may not grow above baseline * (1 + tolerance); improvements always pass.
+    """
+    violations = []
+    min_fps = baseline["throughput_fps"] * (1.0 - tolerance)
+    if measured["throughput_fps"] < min_fps:
+        violations.append("{}: throughput {:.2f} FPS is below the gate {:.2f} FPS (baseline {:.2f})".format(
+            run_key, measured["throughput_fps"], min_fps, baseline["throughput_fps"]))
+    max_latency = baseline["median_latency_ms"] * (1.0 + tolerance)
+    if measured["median_latency_ms"] > max_latency:
+        violations.append("{}: median latency {:.2f} ms is above the gate {:.2f} ms (baseline {:.2f})".format(
+            run_key, measured["median_latency_ms"], max_latency, baseline["median_latency_ms"]))
+    return violations
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Run the performance regression benchmark suite",
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument("--benchmark_app", required=True, type=Path,
+                        help="path to the benchmark_app executable")
+    parser.add_argument("--config", required=True, type=Path,
+                        help="path to the YAML config with the pinned model set")
+    parser.add_argument("--baselines", required=True, type=Path,
+                        help="directory with the committed per-device baseline files")
+    parser.add_argument("--models_dir", required=True, type=Path,
+                        help="directory to cache the downloaded models")
+    parser.add_argument("--devices", default="",
+                        help="comma-separated device filter; empty runs every device from the config")
+    parser.add_argument("--update_baselines", action="store_true",
+                        help="record the measured values as the new baselines instead of gating")
+    parser.add_argument("--strict", action="store_true",
+                        help="treat runs without a committed baseline as failures")
+    args = parser.parse_args()
+
+    logging.basicConfig(format="[ %(levelname)s ] %(message)s", level=logging.INFO, stream=sys.stdout)
+
+    with open(args.config) as file:
+        models = yaml.safe_load(file)
+
+    device_filter = set(filter(None, args.devices.split(",")))
+
+    measured_by_device = {}
+    violations = []
+    missing_baselines = []
+    for model in models:
+        model_xml = None
+        for run in model["runs"]:
+            device = run["device"]
+            if device_filter and device not in device_filter:
+                continue
+            if model_xml is None:
+                model_xml = fetch_model(model, args.models_dir)
+
+            mode = run["mode"]
+            run_key = "{}/{}".format(model["name"], mode)
+            measured = run_benchmark_app(args.benchmark_app, model_xml, device, mode)
+            logging.info("%s on %s: %.2f FPS, median latency %.2f ms", run_key, device,
+                         measured["throughput_fps"], measured["median_latency_ms"])
+            measured_by_device.setdefault(device, {})[run_key] = measured
+
+            if args.update_baselines:
+                continue
+            baseline = load_baselines(args.baselines, device).get(run_key)
+            if baseline is None:
+                missing_baselines.append("{} on {}".format(run_key, device))
+                continue
+            violations += check_against_baseline(run_key, measured, baseline,
+                                                 run.get("tolerance", DEFAULT_TOLERANCE))
+
+    if args.update_baselines:
+        for device, measured in measured_by_device.items():
+            baselines = load_baselines(args.baselines, device)
+            baselines.update(measured)
+            save_baselines(args.baselines, device, baselines)
+        return 0
+
+    for entry in missing_baselines:
+        logging.warning("No committed baseline for %s; run with --update_baselines to record one", entry)
+    for violation in violations:
+        logging.error("REGRESSION %s", violation)
+
+    if violations or (args.strict and missing_baselines):
+        return 1
+    logging.info("All runs are within the tolerance gates")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "samples/slog.hpp"
+
+#include "utils.hpp"
+// clang-format on
+
+/// @brief A model executed concurrently with the benchmarked one to create interference
+/// (cache, memory bandwidth, executor contention) that single-model numbers hide.
+///
+/// The model is compiled through the shared ov::Core, so plugin-level resources (streams
+/// executor, weight caches) are contended the same way they are in a multi-model process.
+/// Each infer request re-submits itself from its own completion callback, so the load
+/// needs no scheduler thread and stays saturated at the configured concurrency.
+class BackgroundLoad {
+public:
+    using Ptr = std::shared_ptr<BackgroundLoad>;
+
+    BackgroundLoad(ov::Core& core,
+                   const std::string& modelPath,
+                   const std::string& device,
+                   const std::string& nstreams,
+                   size_t nireq)
+        : _modelPath(modelPath),
+          _device(device) {
+        ov::AnyMap deviceConfig;
+        if (!nstreams.empty()) {
+            deviceConfig[device_type_from_name(device) + "_THROUGHPUT_STREAMS"] = nstreams;
+        }
+        _model = core.compile_model(modelPath, device, deviceConfig);
+
+        for (const auto& input : _model.inputs()) {
+            if (input.get_partial_shape().is_dynamic()) {
+                throw std::logic_error("Background model " + modelPath +
+                                       " has a dynamic input; only static background models are supported.");
+            }
+        }
+
+        for (size_t id = 0; id < nireq; id++) {
+            _requests.push_back(_model.create_infer_request());
+            auto& request = _requests.back();
+            // The auto-allocated input memory is uninitialized; zero it once so the load
+            // doesn't run on denormals/NaNs with a different timing profile.
+            for (const auto& input : _model.inputs()) {
+                auto tensor = request.get_tensor(input);
+                std::memset(tensor.data(), 0, tensor.get_byte_size());
+            }
+            request.set_callback([this, id](const std::exception_ptr& ptr) {
+                _iterations++;
+                if (!_stop) {
+                    _requests[id].start_async();
+                }
+            });
+        }
+    }
+
+    void start() {
+        _stop = false;
+        _iterations = 0;
+        _startTime = Time::now();
+        for (auto& request : _requests) {
+            request.start_async();
+        }
+    }
+
+    void stop() {
+        _stop = true;
+        for (auto& request : _requests) {
+            request.wait();
+        }
+        _durationMs = std::chrono::duration_cast<ns>(Time::now() - _startTime).count() * 0.000001;
+    }
+
+    size_t iterations() const {
+        return _iterations;
+    }
+
+    double throughput() const {
+        return _durationMs > 0 ? 1000.0 * _iterations / _durationMs : 0.0;
+    }
+
+    const std::string& model_path() const {
+        return _modelPath;
+    }
+
+    const std::string& device() const {
+        return _device;
+    }
+
+    size_t nireq() const {
+        return _requests.size();
+    }
+
+private:
+    static std::string device_type_from_name(std::string device) {
+        return device.substr(0, device.find_first_of(".("));
+    }
+
+    std::string _modelPath;
+    std::string _device;
+    ov::CompiledModel _model;
+    std::vector<ov::InferRequest> _requests;
+    std::atomic<bool> _stop {true};
+    std::atomic<size_t> _iterations {0};
+    Time::time_point _startTime;
+    double _durationMs = 0.0;
+};
@@ -83,6 +83,51 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for the open-loop target load
+static const char target_qps_message[] =
+    "Optional. Run in the open-loop mode: submit inference requests at the given fixed rate (requests per second) "
+    "instead of as fast as possible, and measure latency from the scheduled submission time to avoid coordinated "
+    "omission. Requires async API. The default value is 0 (closed loop).";
+
+/// @brief message for the latency histogram export
+static const char latency_export_message[] =
+    "Optional. Path to a file to export the per-stage (preprocess/enqueue/execute) latency histograms to. "
+    "The format is chosen by the extension: .json or .csv.";
+
+/// @brief message for the resource monitoring
+static const char resource_monitor_message[] =
+    "Optional. Sample process resource usage (peak/steady RSS, per-NUMA-node memory, CPU utilization per core "
+    "class and, where resctrl MBM is available, memory bandwidth) during the measured window and report a "
+    "summary next to the throughput numbers. Linux only.";
+
+/// @brief message for the resource timeline export
+static const char resource_export_message[] =
+    "Optional. Path to a .csv file to export the sampled resource timeline to; sample timestamps are relative "
+    "to the start of the measured window, so rows correlate with the latency timeline. Implies -resource_monitor.";
+
+/// @brief message for the concurrent background models
+static const char bg_models_message[] =
+    "Optional. Comma-separated paths to additional models executed concurrently with the benchmarked one "
+    "through the shared runtime, to measure the interference (cache, bandwidth, executor contention) that "
+    "single-model numbers hide. Only the primary model is measured and reported in detail; per-background-model "
+    "throughput is printed at the end.";
+
+/// @brief message for the background model devices
+static const char bg_devices_message[] =
+    "Optional. Comma-separated target devices for the background models (one per -bg_m entry). "
+    "The default is the primary -d device.";
+
+/// @brief message for the background model streams
+static const char bg_nstreams_message[] =
+    "Optional. Comma-separated stream counts for the background models (one per -bg_m entry, "
+    "an empty entry keeps the device default).";
+
+/// @brief message for the traffic mix ratio
+static const char traffic_mix_message[] =
+    "Optional. Colon-separated relative load weights for the primary and background models, e.g. 4:1:1. "
+    "The weights scale the number of parallel infer requests each background model keeps in flight "
+    "relative to the primary one. The default is 1 for every model.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -271,6 +316,30 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Target request rate for the open-loop mode (0 - closed loop)
+DEFINE_double(target_qps, 0, target_qps_message);
+
+/// @brief Path to the file with the exported latency histograms
+DEFINE_string(latency_export, "", latency_export_message);
+
+/// @brief Enables resource usage sampling during the measured window
+DEFINE_bool(resource_monitor, false, resource_monitor_message);
+
+/// @brief Path to the file with the exported resource timeline
+DEFINE_string(resource_export, "", resource_export_message);
+
+/// @brief Additional models executed concurrently with the benchmarked one
+DEFINE_string(bg_m, "", bg_models_message);
+
+/// @brief Target devices for the background models
+DEFINE_string(bg_d, "", bg_devices_message);
+
+/// @brief Stream counts for the background models
+DEFINE_string(bg_nstreams, "", bg_nstreams_message);
+
+/// @brief Relative load weights for the primary and background models
+DEFINE_string(traffic_mix, "", traffic_mix_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -381,6 +450,11 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -target_qps               " << target_qps_message << std::endl;
+    std::cout << "    -bg_m \"<path1,path2>\"     " << bg_models_message << std::endl;
+    std::cout << "    -bg_d \"<dev1,dev2>\"       " << bg_devices_message << std::endl;
+    std::cout << "    -bg_nstreams \"<n1,n2>\"    " << bg_nstreams_message << std::endl;
+    std::cout << "    -traffic_mix \"<w0:w1:..>\" " << traffic_mix_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -396,6 +470,9 @@ static void show_usage() {
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
+    std::cout << "    -latency_export           " << latency_export_message << std::endl;
+    std::cout << "    -resource_monitor         " << resource_monitor_message << std::endl;
+    std::cout << "    -resource_export          " << resource_export_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
     std::cout << "    -qb                       " << gna_qb_message << std::endl;
     std::cout << "    -ip                          <value>     " << inputs_precision_message << std::endl;
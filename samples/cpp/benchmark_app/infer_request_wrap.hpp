@@ -18,12 +18,15 @@
 
 // clang-format off
 
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, size_t group_id, const double latency, const double enqueueTime,
+                           const double executeTime)>
+    QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
 /// time.
@@ -42,13 +45,18 @@ public:
         _request.set_callback([&](const std::exception_ptr& ptr) {
             // TODO: Add exception ptr rethrow in proper thread
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_latency_in_milliseconds(),
+                           to_milliseconds(_enqueueEndTime - _startTime),
+                           to_milliseconds(_endTime - _enqueueEndTime));
         });
     }
 
     void start_async() {
         _startTime = Time::now();
         _request.start_async();
+        _enqueueEndTime = Time::now();
     }
 
     void wait() {
@@ -57,9 +65,14 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _enqueueEndTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds());
+        _callbackQueue(_id,
+                       _lat_group_id,
+                       get_latency_in_milliseconds(),
+                       0.0,
+                       to_milliseconds(_endTime - _startTime));
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -84,6 +97,19 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    /// @brief Latency as the consumer observed it: measured from the scheduled arrival in the
+    /// open-loop mode (so the time an overloaded pipeline makes the sample wait for an idle
+    /// request is not silently dropped - the coordinated omission problem), otherwise from the
+    /// actual submission.
+    double get_latency_in_milliseconds() const {
+        return to_milliseconds(_endTime - (_hasScheduledTime ? _scheduledTime : _startTime));
+    }
+
+    void set_scheduled_time(Time::time_point scheduledTime) {
+        _scheduledTime = scheduledTime;
+        _hasScheduledTime = true;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,9 +122,16 @@ public:
     }
 
 private:
+    static double to_milliseconds(const Time::duration& duration) {
+        return static_cast<double>(std::chrono::duration_cast<ns>(duration).count()) * 0.000001;
+    }
+
     ov::InferRequest _request;
     Time::time_point _startTime;
+    Time::time_point _enqueueEndTime;
     Time::time_point _endTime;
+    Time::time_point _scheduledTime;
+    bool _hasScheduledTime = false;
     size_t _id;
     size_t _lat_group_id;
     QueueCallbackFunction _callbackQueue;
@@ -116,7 +149,9 @@ public:
                                                                         this,
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
-                                                                        std::placeholders::_3)));
+                                                                        std::placeholders::_3,
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -140,15 +175,26 @@ public:
         for (auto& group : _latency_groups) {
             group.clear();
         }
+        _totalHistogram.clear();
+        _preprocessHistogram.clear();
+        _enqueueHistogram.clear();
+        _executeHistogram.clear();
     }
 
     double get_duration_in_milliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
-    void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
+    void put_idle_request(size_t id,
+                          size_t lat_group_id,
+                          const double latency,
+                          const double enqueueTime,
+                          const double executeTime) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _totalHistogram.record(latency);
+        _enqueueHistogram.record(enqueueTime);
+        _executeHistogram.record(executeTime);
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -183,6 +229,29 @@ public:
         return _latency_groups;
     }
 
+    // The preprocess stage (input filling) runs in the caller thread, not in the request
+    // callback, so it is recorded separately.
+    void add_preprocess_time(const double preprocessTime) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _preprocessHistogram.record(preprocessTime);
+    }
+
+    const LatencyHistogram& get_total_histogram() const {
+        return _totalHistogram;
+    }
+
+    const LatencyHistogram& get_preprocess_histogram() const {
+        return _preprocessHistogram;
+    }
+
+    const LatencyHistogram& get_enqueue_histogram() const {
+        return _enqueueHistogram;
+    }
+
+    const LatencyHistogram& get_execute_histogram() const {
+        return _executeHistogram;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -193,5 +262,9 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    LatencyHistogram _totalHistogram;
+    LatencyHistogram _preprocessHistogram;
+    LatencyHistogram _enqueueHistogram;
+    LatencyHistogram _executeHistogram;
     bool enable_lat_groups;
 };
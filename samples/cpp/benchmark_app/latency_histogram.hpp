@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/slog.hpp"
+
+#include "utils.hpp"
+// clang-format on
+
+/// @brief HDR-style log-linear latency histogram.
+///
+/// Values are bucketed with microsecond resolution below 64 us and a relative error
+/// bounded by 1/64 (~1.6%) above it, which is enough to report tail percentiles up
+/// to p99.99. All buckets are pre-allocated at construction, so recording is a pure
+/// arithmetic operation and never allocates inside the measurement loop.
+class LatencyHistogram {
+public:
+    LatencyHistogram() : counts(bucketCount, 0) {}
+
+    void record(double latency_ms) {
+        const uint64_t us = latency_ms <= 0 ? 0 : static_cast<uint64_t>(std::llround(latency_ms * 1000.0));
+        size_t index = bucket_index(us);
+        if (index >= counts.size())
+            index = counts.size() - 1;
+        counts[index]++;
+        total++;
+        min_ms = std::min(min_ms, latency_ms);
+        max_ms = std::max(max_ms, latency_ms);
+    }
+
+    void clear() {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        min_ms = std::numeric_limits<double>::max();
+        max_ms = 0.0;
+    }
+
+    uint64_t count() const {
+        return total;
+    }
+
+    double min() const {
+        return total ? min_ms : 0.0;
+    }
+
+    double max() const {
+        return max_ms;
+    }
+
+    /// @brief Returns the upper bound (in ms) of the bucket holding the p-th percentile,
+    /// so the reported value never understates the tail.
+    double percentile(double p) const {
+        if (total == 0)
+            return 0.0;
+        const uint64_t rank = static_cast<uint64_t>(std::ceil(total * p / 100.0));
+        uint64_t seen = 0;
+        for (size_t index = 0; index < counts.size(); index++) {
+            seen += counts[index];
+            if (seen >= rank && counts[index] > 0)
+                return std::min(bucket_end_ms(index), max_ms);
+        }
+        return max_ms;
+    }
+
+    void log_percentiles() const {
+        for (double p : {50.0, 90.0, 99.0, 99.9, 99.99}) {
+            slog::info << "\tp" << p << ":   " << double_to_string(percentile(p)) << " ms" << slog::endl;
+        }
+        slog::info << "\tMax:     " << double_to_string(max()) << " ms" << slog::endl;
+    }
+
+    /// @brief Non-empty buckets as (start_ms, end_ms, count) tuples, for exporting.
+    struct Bucket {
+        double start_ms;
+        double end_ms;
+        uint64_t count;
+    };
+    std::vector<Bucket> buckets() const {
+        std::vector<Bucket> result;
+        for (size_t index = 0; index < counts.size(); index++) {
+            if (counts[index] > 0)
+                result.push_back({bucket_start_ms(index), bucket_end_ms(index), counts[index]});
+        }
+        return result;
+    }
+
+private:
+    // 64 linear sub-buckets per power of two; buckets cover up to ~1.2 hours in us
+    static constexpr int subBucketBits = 6;
+    static constexpr uint64_t subBucketCount = 1ull << subBucketBits;
+    static constexpr size_t bucketCount = 32 * subBucketCount;
+
+    static size_t bucket_index(uint64_t us) {
+        if (us < subBucketCount)
+            return static_cast<size_t>(us);
+        int msb = 0;
+        for (uint64_t v = us; v >>= 1;)
+            msb++;
+        const int shift = msb - subBucketBits;
+        return static_cast<size_t>(((static_cast<uint64_t>(shift) + 1) << subBucketBits) +
+                                   ((us >> shift) - subBucketCount));
+    }
+
+    static double bucket_start_ms(size_t index) {
+        const uint64_t group = index >> subBucketBits;
+        if (group == 0)
+            return index / 1000.0;
+        const uint64_t sub = index & (subBucketCount - 1);
+        return static_cast<double>((subBucketCount + sub) << (group - 1)) / 1000.0;
+    }
+
+    static double bucket_end_ms(size_t index) {
+        const uint64_t group = index >> subBucketBits;
+        const uint64_t width = group == 0 ? 1 : (1ull << (group - 1));
+        return bucket_start_ms(index) + width / 1000.0;
+    }
+
+    std::vector<uint64_t> counts;
+    uint64_t total = 0;
+    double min_ms = std::numeric_limits<double>::max();
+    double max_ms = 0.0;
+};
+
+/// @brief Stores the named histograms to a .csv or .json file (chosen by the extension).
+static inline void dump_latency_histograms(const std::string& path,
+                                           const std::vector<std::pair<std::string, const LatencyHistogram*>>& stages) {
+    std::ofstream file(path);
+    if (!file)
+        throw std::runtime_error("Can't open file for latency export: " + path);
+
+    const bool json = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+    if (json) {
+        file << "{\n";
+        for (size_t s = 0; s < stages.size(); s++) {
+            const auto& histogram = *stages[s].second;
+            file << "  \"" << stages[s].first << "\": {\n";
+            file << "    \"count\": " << histogram.count() << ",\n";
+            file << "    \"min_ms\": " << histogram.min() << ",\n";
+            file << "    \"max_ms\": " << histogram.max() << ",\n";
+            file << "    \"percentiles_ms\": {";
+            const double percentiles[] = {50.0, 90.0, 99.0, 99.9, 99.99};
+            for (size_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++) {
+                file << (p ? ", " : "") << "\"p" << percentiles[p] << "\": " << histogram.percentile(percentiles[p]);
+            }
+            file << "},\n";
+            file << "    \"buckets\": [";
+            const auto buckets = histogram.buckets();
+            for (size_t b = 0; b < buckets.size(); b++) {
+                file << (b ? ", " : "") << "[" << buckets[b].start_ms << ", " << buckets[b].end_ms << ", "
+                     << buckets[b].count << "]";
+            }
+            file << "]\n";
+            file << "  }" << (s + 1 < stages.size() ? "," : "") << "\n";
+        }
+        file << "}\n";
+    } else {
+        file << "stage;bucket_start_ms;bucket_end_ms;count;cumulative_percent\n";
+        for (const auto& stage : stages) {
+            const auto& histogram = *stage.second;
+            uint64_t seen = 0;
+            for (const auto& bucket : histogram.buckets()) {
+                seen += bucket.count;
+                file << stage.first << ";" << bucket.start_ms << ";" << bucket.end_ms << ";" << bucket.count << ";"
+                     << (100.0 * seen / histogram.count()) << "\n";
+            }
+        }
+    }
+}
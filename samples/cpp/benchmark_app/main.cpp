@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -22,6 +24,8 @@
 #include "samples/common.hpp"
 #include "samples/slog.hpp"
 
+#include "background_load.hpp"
+#include "resource_monitor.hpp"
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
@@ -56,6 +60,15 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_target_qps < 0) {
+        throw std::logic_error("Incorrect target rate. The -target_qps option value must be non-negative.");
+    }
+    if (FLAGS_target_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop mode (-target_qps) is supported for the async API only.");
+    }
+    if (FLAGS_bg_m.empty() && (!FLAGS_bg_d.empty() || !FLAGS_bg_nstreams.empty() || !FLAGS_traffic_mix.empty())) {
+        throw std::logic_error("The -bg_d, -bg_nstreams and -traffic_mix options require -bg_m to be set.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
@@ -653,6 +666,45 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // Background models: compiled through the same core, so the per-plugin resources are
+        // contended the way they are when several models share one process
+        std::vector<BackgroundLoad::Ptr> backgroundLoads;
+        if (!FLAGS_bg_m.empty()) {
+            const auto bgModels = split(FLAGS_bg_m, ',');
+            const auto bgDevices = FLAGS_bg_d.empty() ? std::vector<std::string>{} : split(FLAGS_bg_d, ',');
+            const auto bgStreams = FLAGS_bg_nstreams.empty() ? std::vector<std::string>{} : split(FLAGS_bg_nstreams, ',');
+            if (!bgDevices.empty() && bgDevices.size() != bgModels.size()) {
+                throw std::logic_error("Number of -bg_d entries must match the number of -bg_m entries.");
+            }
+            if (!bgStreams.empty() && bgStreams.size() != bgModels.size()) {
+                throw std::logic_error("Number of -bg_nstreams entries must match the number of -bg_m entries.");
+            }
+            std::vector<double> mixWeights(bgModels.size() + 1, 1.0);
+            if (!FLAGS_traffic_mix.empty()) {
+                const auto weights = split(FLAGS_traffic_mix, ':');
+                if (weights.size() != bgModels.size() + 1) {
+                    throw std::logic_error("The -traffic_mix option must list one weight for the primary model "
+                                           "and one per -bg_m entry.");
+                }
+                for (size_t i = 0; i < weights.size(); i++) {
+                    mixWeights[i] = std::stod(weights[i]);
+                    if (mixWeights[i] <= 0) {
+                        throw std::logic_error("The -traffic_mix weights must be positive.");
+                    }
+                }
+            }
+            for (size_t i = 0; i < bgModels.size(); i++) {
+                const auto& bgDevice = bgDevices.empty() ? device_name : bgDevices[i];
+                const auto& bgNstreams = bgStreams.empty() ? std::string{} : bgStreams[i];
+                const auto bgNireq =
+                    std::max<size_t>(1, static_cast<size_t>(std::lround(nireq * mixWeights[i + 1] / mixWeights[0])));
+                slog::info << "Loading background model " << bgModels[i] << " to " << bgDevice << " (" << bgNireq
+                           << " parallel requests)" << slog::endl;
+                backgroundLoads.push_back(
+                    std::make_shared<BackgroundLoad>(core, bgModels[i], bgDevice, bgNstreams, bgNireq));
+            }
+        }
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
@@ -876,7 +928,30 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
+        // the background load covers the whole measured window
+        for (auto& backgroundLoad : backgroundLoads) {
+            backgroundLoad->start();
+        }
+
+        ResourceMonitor resourceMonitor;
+        const bool monitorResources = FLAGS_resource_monitor || !FLAGS_resource_export.empty();
+        if (monitorResources) {
+            if (!ResourceMonitor::supported()) {
+                slog::warn << "Resource monitoring was requested but is not supported on this platform" << slog::endl;
+            }
+            resourceMonitor.start();
+        }
+
         size_t processedFramesN = 0;
+        const bool openLoop = FLAGS_target_qps > 0;
+        const auto arrivalPeriod =
+            openLoop ? std::chrono::duration_cast<Time::duration>(
+                           std::chrono::duration<double>(1.0 / FLAGS_target_qps))
+                     : Time::duration::zero();
+        if (openLoop) {
+            slog::info << "Open-loop mode: submitting requests at " << FLAGS_target_qps
+                       << " QPS, latency is measured from the scheduled submission time" << slog::endl;
+        }
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
@@ -887,12 +962,27 @@ int main(int argc, char* argv[]) {
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
+            if (openLoop) {
+                // The sample "arrives" at a fixed rate regardless of how fast the pipeline drains;
+                // sleeping to the schedule before (not after) waiting for an idle request makes the
+                // wait time part of the measured latency, so an overloaded pipeline cannot
+                // coordinate with the load generator and hide its backlog.
+                const auto scheduledTime = startTime + arrivalPeriod * iteration;
+                std::this_thread::sleep_until(scheduledTime);
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
+                inferRequest->set_scheduled_time(scheduledTime);
+            } else {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
             }
 
             if (!inferenceOnly) {
+                auto preprocessStart = Time::now();
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
                 if (FLAGS_pcseq) {
@@ -926,6 +1016,8 @@ int main(int argc, char* argv[]) {
                         inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
                     }
                 }
+                inferRequestsQueue.add_preprocess_time(
+                    std::chrono::duration_cast<ns>(Time::now() - preprocessStart).count() * 0.000001);
             }
 
             if (FLAGS_api == "sync") {
@@ -961,6 +1053,10 @@ int main(int argc, char* argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.wait_all();
+        resourceMonitor.stop();
+        for (auto& backgroundLoad : backgroundLoads) {
+            backgroundLoad->stop();
+        }
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies());
         std::vector<LatencyMetrics> groupLatencies = {};
@@ -1043,6 +1139,33 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {{"throughput", double_to_string(fps)}});
+            for (auto& backgroundLoad : backgroundLoads) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {{"background throughput (" + backgroundLoad->model_path() + ")",
+                      double_to_string(backgroundLoad->throughput())}});
+            }
+            if (monitorResources && !resourceMonitor.samples().empty()) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {
+                        {"peak RSS (MB)", double_to_string(resourceMonitor.peak_rss_kb() / 1024.0)},
+                        {"steady RSS (MB)", double_to_string(resourceMonitor.steady_rss_kb() / 1024.0)},
+                    });
+                const auto& classNames = resourceMonitor.cpu_class_names();
+                for (size_t cpuClass = 0; cpuClass < classNames.size(); cpuClass++) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {{"CPU utilization (" + classNames[cpuClass] + ") (%)",
+                          double_to_string(resourceMonitor.average_cpu_percent(cpuClass))}});
+                }
+                if (resourceMonitor.average_memory_bw_mb_s() >= 0) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {{"memory bandwidth (MB/s)",
+                          double_to_string(resourceMonitor.average_memory_bw_mb_s())}});
+                }
+            }
         }
         progressBar.finish();
 
@@ -1107,8 +1230,37 @@ int main(int argc, char* argv[]) {
                     groupLatencies[i].log_total(FLAGS_latency_percentile);
                 }
             }
+            if (openLoop || !FLAGS_latency_export.empty()) {
+                slog::info << "Latency distribution:" << slog::endl;
+                inferRequestsQueue.get_total_histogram().log_percentiles();
+            }
+        }
+        if (!FLAGS_latency_export.empty()) {
+            dump_latency_histograms(FLAGS_latency_export,
+                                    {{"total", &inferRequestsQueue.get_total_histogram()},
+                                     {"preprocess", &inferRequestsQueue.get_preprocess_histogram()},
+                                     {"enqueue", &inferRequestsQueue.get_enqueue_histogram()},
+                                     {"execute", &inferRequestsQueue.get_execute_histogram()}});
+            slog::info << "Latency histograms were dumped to " << FLAGS_latency_export << slog::endl;
         }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
+        if (monitorResources) {
+            slog::info << "Resource usage:" << slog::endl;
+            resourceMonitor.log_summary();
+            if (!FLAGS_resource_export.empty()) {
+                resourceMonitor.dump_timeline(FLAGS_resource_export);
+                slog::info << "Resource timeline was dumped to " << FLAGS_resource_export << slog::endl;
+            }
+        }
+        if (!backgroundLoads.empty()) {
+            slog::info << "Background models:" << slog::endl;
+            for (auto& backgroundLoad : backgroundLoads) {
+                slog::info << "  " << backgroundLoad->model_path() << " (" << backgroundLoad->device() << ", "
+                           << backgroundLoad->nireq() << " requests): " << backgroundLoad->iterations()
+                           << " iterations, " << double_to_string(backgroundLoad->throughput()) << " FPS"
+                           << slog::endl;
+            }
+        }
 
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -0,0 +1,373 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#    include <dirent.h>
+#    include <unistd.h>
+#endif
+
+// clang-format off
+#include "samples/slog.hpp"
+
+#include "utils.hpp"
+// clang-format on
+
+/// @brief Samples process and system resource usage on a background thread while the
+/// measurement loop runs, so a single benchmark run reports the footprint that has to be
+/// provisioned next to the throughput.
+///
+/// Each sample is timestamped relative to start(), which the app aligns with the start of
+/// the measured window, so exported rows correlate with the latency timeline. Collected
+/// per sample: process RSS (plus the kernel-tracked peak), the per-NUMA-node split of the
+/// resident pages, CPU utilization grouped by core class (cores binned by their maximum
+/// frequency, which separates P/E cores on hybrid parts), and - when the resctrl
+/// filesystem with MBM monitoring is mounted - memory bandwidth. Everything is read from
+/// procfs/sysfs, so the monitor is Linux-only and degrades to a no-op elsewhere.
+class ResourceMonitor {
+public:
+    struct Sample {
+        double time_ms;
+        uint64_t rss_kb;
+        std::vector<uint64_t> numa_rss_kb;
+        std::vector<double> cpu_class_percent;
+        double memory_bw_mb_s;  // negative when the platform exposes no bandwidth counters
+    };
+
+    explicit ResourceMonitor(int64_t interval_ms = 200) : _intervalMs(interval_ms) {}
+
+    ~ResourceMonitor() {
+        stop();
+    }
+
+    static bool supported() {
+#if defined(__linux__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void start() {
+#if defined(__linux__)
+        if (_running)
+            return;
+        _samples.clear();
+        _cpuClasses = read_cpu_classes();
+        _running = true;
+        _startTime = Time::now();
+        _thread = std::thread([this] {
+            auto prevCpu = read_cpu_times();
+            auto prevBandwidthBytes = read_mbm_bytes();
+            auto prevTime = _startTime;
+            while (_running) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(_intervalMs));
+                const auto now = Time::now();
+                const double elapsed_s = std::chrono::duration_cast<ns>(now - prevTime).count() * 1e-9;
+                Sample sample;
+                sample.time_ms = std::chrono::duration_cast<ns>(now - _startTime).count() * 1e-6;
+                read_rss(sample.rss_kb, _peakRssKb);
+                sample.numa_rss_kb = read_numa_rss();
+                auto cpu = read_cpu_times();
+                sample.cpu_class_percent = cpu_class_utilization(prevCpu, cpu);
+                prevCpu = std::move(cpu);
+                const int64_t bandwidthBytes = read_mbm_bytes();
+                if (bandwidthBytes >= 0 && prevBandwidthBytes >= 0 && elapsed_s > 0) {
+                    sample.memory_bw_mb_s = (bandwidthBytes - prevBandwidthBytes) / elapsed_s / (1024.0 * 1024.0);
+                } else {
+                    sample.memory_bw_mb_s = -1.0;
+                }
+                prevBandwidthBytes = bandwidthBytes;
+                prevTime = now;
+                _samples.push_back(std::move(sample));
+            }
+        });
+#else
+        slog::warn << "Resource monitoring is only supported on Linux, no samples will be collected" << slog::endl;
+#endif
+    }
+
+    void stop() {
+        _running = false;
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    const std::vector<Sample>& samples() const {
+        return _samples;
+    }
+
+    uint64_t peak_rss_kb() const {
+        return _peakRssKb;
+    }
+
+    /// @brief Median RSS over the second half of the run, after allocation ramp-up.
+    uint64_t steady_rss_kb() const {
+        if (_samples.empty())
+            return 0;
+        std::vector<uint64_t> tail;
+        for (size_t index = _samples.size() / 2; index < _samples.size(); index++)
+            tail.push_back(_samples[index].rss_kb);
+        std::sort(tail.begin(), tail.end());
+        return tail[tail.size() / 2];
+    }
+
+    size_t numa_node_count() const {
+        size_t nodes = 0;
+        for (const auto& sample : _samples)
+            nodes = std::max(nodes, sample.numa_rss_kb.size());
+        return nodes;
+    }
+
+    const std::vector<std::string>& cpu_class_names() const {
+        return _cpuClasses.names;
+    }
+
+    double average_cpu_percent(size_t cpu_class) const {
+        double sum = 0;
+        size_t count = 0;
+        for (const auto& sample : _samples) {
+            if (cpu_class < sample.cpu_class_percent.size()) {
+                sum += sample.cpu_class_percent[cpu_class];
+                count++;
+            }
+        }
+        return count ? sum / count : 0.0;
+    }
+
+    double average_memory_bw_mb_s() const {
+        double sum = 0;
+        size_t count = 0;
+        for (const auto& sample : _samples) {
+            if (sample.memory_bw_mb_s >= 0) {
+                sum += sample.memory_bw_mb_s;
+                count++;
+            }
+        }
+        return count ? sum / count : -1.0;
+    }
+
+    void log_summary() const {
+        if (_samples.empty()) {
+            slog::info << "No resource samples were collected" << slog::endl;
+            return;
+        }
+        slog::info << "Peak RSS:    " << double_to_string(peak_rss_kb() / 1024.0) << " MB" << slog::endl;
+        slog::info << "Steady RSS:  " << double_to_string(steady_rss_kb() / 1024.0) << " MB" << slog::endl;
+        const auto& last = _samples.back();
+        for (size_t node = 0; node < last.numa_rss_kb.size(); node++) {
+            slog::info << "\tNUMA node " << node << " RSS: " << double_to_string(last.numa_rss_kb[node] / 1024.0)
+                       << " MB" << slog::endl;
+        }
+        for (size_t cpu_class = 0; cpu_class < _cpuClasses.names.size(); cpu_class++) {
+            slog::info << "CPU utilization (" << _cpuClasses.names[cpu_class]
+                       << "): " << double_to_string(average_cpu_percent(cpu_class)) << " %" << slog::endl;
+        }
+        const double bandwidth = average_memory_bw_mb_s();
+        if (bandwidth >= 0) {
+            slog::info << "Memory bandwidth: " << double_to_string(bandwidth) << " MB/s" << slog::endl;
+        } else {
+            slog::info << "Memory bandwidth: not available (resctrl MBM monitoring is not mounted)" << slog::endl;
+        }
+    }
+
+    /// @brief Stores the sample timeline as .csv; time_ms is relative to the start of the
+    /// measured window, so rows line up with the exported latency data.
+    void dump_timeline(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file)
+            throw std::runtime_error("Can't open file for resource timeline export: " + path);
+        const size_t nodes = numa_node_count();
+        file << "time_ms;rss_kb";
+        for (size_t node = 0; node < nodes; node++)
+            file << ";numa" << node << "_rss_kb";
+        for (const auto& name : _cpuClasses.names)
+            file << ";cpu_" << name << "_percent";
+        file << ";memory_bw_mb_s\n";
+        for (const auto& sample : _samples) {
+            file << sample.time_ms << ";" << sample.rss_kb;
+            for (size_t node = 0; node < nodes; node++)
+                file << ";" << (node < sample.numa_rss_kb.size() ? sample.numa_rss_kb[node] : 0);
+            for (size_t cpu_class = 0; cpu_class < _cpuClasses.names.size(); cpu_class++)
+                file << ";"
+                     << (cpu_class < sample.cpu_class_percent.size() ? sample.cpu_class_percent[cpu_class] : 0.0);
+            file << ";" << sample.memory_bw_mb_s << "\n";
+        }
+    }
+
+private:
+    struct CpuClasses {
+        std::vector<std::string> names;   // one per class, e.g. "3800MHz_cores"
+        std::vector<size_t> cpu_to_class; // indexed by cpu id
+    };
+
+    struct CpuTimes {
+        std::vector<uint64_t> busy;
+        std::vector<uint64_t> total;
+    };
+
+#if defined(__linux__)
+    static void read_rss(uint64_t& rss_kb, std::atomic<uint64_t>& peak_kb) {
+        rss_kb = 0;
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            uint64_t value = 0;
+            if (line.compare(0, 6, "VmRSS:") == 0 && std::sscanf(line.c_str(), "VmRSS: %lu", &value) == 1) {
+                rss_kb = value;
+            } else if (line.compare(0, 6, "VmHWM:") == 0 && std::sscanf(line.c_str(), "VmHWM: %lu", &value) == 1) {
+                if (value > peak_kb)
+                    peak_kb = value;
+            }
+        }
+    }
+
+    static std::vector<uint64_t> read_numa_rss() {
+        std::vector<uint64_t> nodes;
+        std::ifstream maps("/proc/self/numa_maps");
+        if (!maps)
+            return nodes;
+        const uint64_t page_kb = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+        std::string line;
+        while (std::getline(maps, line)) {
+            std::istringstream tokens(line);
+            std::string token;
+            while (tokens >> token) {
+                unsigned node = 0;
+                uint64_t pages = 0;
+                if (std::sscanf(token.c_str(), "N%u=%lu", &node, &pages) == 2) {
+                    if (nodes.size() <= node)
+                        nodes.resize(node + 1, 0);
+                    nodes[node] += pages * page_kb;
+                }
+            }
+        }
+        return nodes;
+    }
+
+    static CpuClasses read_cpu_classes() {
+        CpuClasses classes;
+        std::vector<uint64_t> class_khz;
+        for (unsigned cpu = 0;; cpu++) {
+            std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/cpuinfo_max_freq");
+            uint64_t khz = 0;
+            if (!file)
+                break;
+            file >> khz;
+            auto found = std::find(class_khz.begin(), class_khz.end(), khz);
+            if (found == class_khz.end()) {
+                class_khz.push_back(khz);
+                classes.names.push_back(std::to_string(khz / 1000) + "MHz_cores");
+                found = class_khz.end() - 1;
+            }
+            classes.cpu_to_class.push_back(static_cast<size_t>(found - class_khz.begin()));
+        }
+        if (classes.names.empty()) {
+            // no cpufreq (e.g. some VMs) - treat all cores as one class
+            classes.names.push_back("all_cores");
+        }
+        return classes;
+    }
+
+    CpuTimes read_cpu_times() const {
+        CpuTimes times;
+        std::ifstream stat("/proc/stat");
+        std::string line;
+        while (std::getline(stat, line)) {
+            if (line.compare(0, 3, "cpu") != 0 || line.size() < 4 || !::isdigit(line[3]))
+                continue;
+            std::istringstream tokens(line);
+            std::string cpu;
+            tokens >> cpu;
+            uint64_t value = 0, total = 0, idle = 0;
+            for (int field = 0; tokens >> value; field++) {
+                total += value;
+                if (field == 3 || field == 4)  // idle + iowait
+                    idle += value;
+            }
+            times.busy.push_back(total - idle);
+            times.total.push_back(total);
+        }
+        return times;
+    }
+
+    std::vector<double> cpu_class_utilization(const CpuTimes& prev, const CpuTimes& curr) const {
+        std::vector<uint64_t> busy(_cpuClasses.names.size(), 0);
+        std::vector<uint64_t> total(_cpuClasses.names.size(), 0);
+        const size_t cpus = std::min(prev.busy.size(), curr.busy.size());
+        for (size_t cpu = 0; cpu < cpus; cpu++) {
+            const size_t cpu_class = cpu < _cpuClasses.cpu_to_class.size() ? _cpuClasses.cpu_to_class[cpu] : 0;
+            busy[cpu_class] += curr.busy[cpu] - prev.busy[cpu];
+            total[cpu_class] += curr.total[cpu] - prev.total[cpu];
+        }
+        std::vector<double> percent(_cpuClasses.names.size(), 0.0);
+        for (size_t cpu_class = 0; cpu_class < percent.size(); cpu_class++)
+            percent[cpu_class] = total[cpu_class] ? 100.0 * busy[cpu_class] / total[cpu_class] : 0.0;
+        return percent;
+    }
+
+    /// @brief Total memory traffic in bytes from resctrl MBM counters, -1 when unavailable.
+    static int64_t read_mbm_bytes() {
+        DIR* mon = opendir("/sys/fs/resctrl/mon_data");
+        if (!mon)
+            return -1;
+        int64_t bytes = 0;
+        bool found = false;
+        while (auto* entry = readdir(mon)) {
+            const std::string name = entry->d_name;
+            if (name.compare(0, 7, "mon_L3_") != 0)
+                continue;
+            std::ifstream file("/sys/fs/resctrl/mon_data/" + name + "/mbm_total_bytes");
+            uint64_t value = 0;
+            if (file >> value) {
+                bytes += static_cast<int64_t>(value);
+                found = true;
+            }
+        }
+        closedir(mon);
+        return found ? bytes : -1;
+    }
+#else
+    static void read_rss(uint64_t& rss_kb, std::atomic<uint64_t>&) {
+        rss_kb = 0;
+    }
+    static std::vector<uint64_t> read_numa_rss() {
+        return {};
+    }
+    static CpuClasses read_cpu_classes() {
+        return {};
+    }
+    CpuTimes read_cpu_times() const {
+        return {};
+    }
+    std::vector<double> cpu_class_utilization(const CpuTimes&, const CpuTimes&) const {
+        return {};
+    }
+    static int64_t read_mbm_bytes() {
+        return -1;
+    }
+#endif
+
+    int64_t _intervalMs;
+    CpuClasses _cpuClasses;
+    std::vector<Sample> _samples;
+    std::atomic<bool> _running {false};
+    std::atomic<uint64_t> _peakRssKb {0};
+    Time::time_point _startTime;
+    std::thread _thread;
+};
@@ -57,6 +57,7 @@ typedef struct ie_core ie_core_t;
 typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
+typedef struct ie_prepared_infer ie_prepared_infer_t;
 typedef struct ie_blob ie_blob_t;
 
 /**
@@ -705,6 +706,66 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Resolves the named input and output blobs of the request once and returns an opaque prepared
+ * call handle for the repeated-inference hot path. The blob lookups, validation and the per-blob
+ * allocations which ie_infer_request_get_blob() performs on every call happen here a single time;
+ * afterwards ie_infer_prepared() and the buffer accessors are allocation-free. The handle shares the
+ * request, so the request must not be freed before the handle.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param input_names Names of the input blobs to resolve.
+ * @param input_num Number of names in input_names.
+ * @param output_names Names of the output blobs to resolve.
+ * @param output_num Number of names in output_names.
+ * @param prepared A pointer to the newly created ie_prepared_infer_t instance.
+ * Use the ie_prepared_infer_free() method to free memory.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_prepare(ie_infer_request_t *infer_request,
+        const char **input_names, size_t input_num, const char **output_names, size_t output_num,
+        ie_prepared_infer_t **prepared);
+
+/**
+ * @brief Returns the raw buffer of an input blob resolved at preparation time. The pointer stays valid
+ * for the lifetime of the handle, so it can be fetched once and filled in place before every call.
+ * @ingroup InferRequest
+ * @param prepared A pointer to ie_prepared_infer_t instance.
+ * @param idx Index of the input in the input_names order passed to ie_infer_request_prepare().
+ * @param buffer A pointer to the writable input data.
+ * @param byte_size Size of the input data in bytes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_prepared_infer_input_buffer(ie_prepared_infer_t *prepared, size_t idx, void **buffer, size_t *byte_size);
+
+/**
+ * @brief Returns the raw buffer of an output blob resolved at preparation time. The pointer stays valid
+ * for the lifetime of the handle; the data is overwritten by every inference.
+ * @ingroup InferRequest
+ * @param prepared A pointer to ie_prepared_infer_t instance.
+ * @param idx Index of the output in the output_names order passed to ie_infer_request_prepare().
+ * @param buffer A pointer to the read-only output data.
+ * @param byte_size Size of the output data in bytes.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_prepared_infer_output_buffer(ie_prepared_infer_t *prepared, size_t idx, const void **buffer, size_t *byte_size);
+
+/**
+ * @brief Starts synchronous inference through the prepared call handle. No lookups, locks or
+ * allocations happen on this path besides the inference itself.
+ * @ingroup InferRequest
+ * @param prepared A pointer to ie_prepared_infer_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_prepared(ie_prepared_infer_t *prepared);
+
+/**
+ * @brief Releases memory occupied by ie_prepared_infer_t instance. The underlying request is not affected.
+ * @ingroup InferRequest
+ * @param prepared A pointer to the ie_prepared_infer_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_prepared_infer_free(ie_prepared_infer_t **prepared);
+
 /** @} */ // end of InferRequest
 
 // Network
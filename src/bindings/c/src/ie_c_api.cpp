@@ -54,6 +54,20 @@ struct ie_blob {
     IE::Blob::Ptr object;
 };
 
+/**
+ * @struct ie_prepared_infer
+ * @brief This struct represents an inference call with blobs resolved ahead of time
+ */
+struct ie_prepared_infer {
+    IE::InferRequest object;
+    // the blob references keep the buffers alive, the raw pointers and sizes are
+    // cached at preparation time so the accessors do not allocate or lock
+    std::vector<IE::Blob::Ptr> inputs;
+    std::vector<IE::Blob::Ptr> outputs;
+    std::vector<std::pair<void *, size_t>> input_buffers;
+    std::vector<std::pair<const void *, size_t>> output_buffers;
+};
+
 /**
  * @struct ie_network
  * @brief This is the main interface to describe the NN topology
@@ -1273,6 +1287,84 @@ IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     return status;
 }
 
+IEStatusCode ie_infer_request_prepare(ie_infer_request_t *infer_request,
+        const char **input_names, size_t input_num, const char **output_names, size_t output_num,
+        ie_prepared_infer_t **prepared) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || prepared == nullptr ||
+        (input_num > 0 && input_names == nullptr) || (output_num > 0 && output_names == nullptr)) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        std::unique_ptr<ie_prepared_infer_t> prepared_result(new ie_prepared_infer_t);
+        prepared_result->object = infer_request->object;
+        for (size_t i = 0; i < input_num; ++i) {
+            if (input_names[i] == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            IE::Blob::Ptr blob = prepared_result->object.GetBlob(input_names[i]);
+            prepared_result->input_buffers.emplace_back(blob->buffer().as<void *>(), blob->byteSize());
+            prepared_result->inputs.push_back(std::move(blob));
+        }
+        for (size_t i = 0; i < output_num; ++i) {
+            if (output_names[i] == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            IE::Blob::Ptr blob = prepared_result->object.GetBlob(output_names[i]);
+            prepared_result->output_buffers.emplace_back(blob->cbuffer().as<const void *>(), blob->byteSize());
+            prepared_result->outputs.push_back(std::move(blob));
+        }
+        *prepared = prepared_result.release();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+IEStatusCode ie_prepared_infer_input_buffer(ie_prepared_infer_t *prepared, size_t idx, void **buffer, size_t *byte_size) {
+    if (prepared == nullptr || buffer == nullptr || byte_size == nullptr || idx >= prepared->input_buffers.size()) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *buffer = prepared->input_buffers[idx].first;
+    *byte_size = prepared->input_buffers[idx].second;
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_prepared_infer_output_buffer(ie_prepared_infer_t *prepared, size_t idx, const void **buffer, size_t *byte_size) {
+    if (prepared == nullptr || buffer == nullptr || byte_size == nullptr || idx >= prepared->output_buffers.size()) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *buffer = prepared->output_buffers[idx].first;
+    *byte_size = prepared->output_buffers[idx].second;
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_infer_prepared(ie_prepared_infer_t *prepared) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (prepared == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        prepared->object.Infer();
+    } CATCH_IE_EXCEPTIONS
+
+    return status;
+}
+
+void ie_prepared_infer_free(ie_prepared_infer_t **prepared) {
+    if (prepared) {
+        delete *prepared;
+        *prepared = NULL;
+    }
+}
+
 IEStatusCode ie_infer_request_infer_async(ie_infer_request_t *infer_request) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -44,6 +44,8 @@ PyAny from_ov_any(const ov::Any& any);
 
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
+py::array array_from_tensor(ov::Tensor&& t);
+
 py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
 
 // Use only with classes that are not creatable by users on Python's side, because
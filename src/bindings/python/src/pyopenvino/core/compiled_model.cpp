@@ -33,7 +33,11 @@ void regclass_CompiledModel(py::module m) {
             auto request = self.create_infer_request();
             // Update inputs if there are any
             Common::set_request_tensors(request, inputs);
-            request.infer();
+            {
+                // the blocking inference runs without the GIL (see InferRequest.infer)
+                py::gil_scoped_release release;
+                request.infer();
+            }
             return Common::outputs_to_dict(self.outputs(), request);
         },
         py::arg("inputs"));
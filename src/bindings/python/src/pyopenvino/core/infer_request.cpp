@@ -61,10 +61,14 @@ void regclass_InferRequest(py::module m) {
         [](InferRequestWrapper& self, const py::dict& inputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
-            // Call Infer function
-            self._start_time = Time::now();
-            self._request.infer();
-            self._end_time = Time::now();
+            {
+                // the whole blocking inference runs without the GIL, so other Python
+                // threads keep submitting while this one executes
+                py::gil_scoped_release release;
+                self._start_time = Time::now();
+                self._request.infer();
+                self._end_time = Time::now();
+            }
             return Common::outputs_to_dict(self._outputs, self._request);
         },
         py::arg("inputs"));
@@ -19,7 +19,10 @@ void regclass_Tensor(py::module m) {
                 return Common::tensor_from_numpy(array, shared_memory);
             }),
             py::arg("array"),
-            py::arg("shared_memory") = false);
+            py::arg("shared_memory") = false,
+            // with shared_memory the tensor references the numpy buffer directly, so the array
+            // must be kept alive at least as long as the Tensor object that wraps it
+            py::keep_alive<1, 2>());
 
     cls.def(py::init<const ov::element::Type, const ov::Shape>(), py::arg("type"), py::arg("shape"));
 
@@ -2,6 +2,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from copy import deepcopy
+import gc
 import numpy as np
 import os
 import pytest
@@ -561,3 +562,42 @@ def test_invalid_inputs_container(device):
     with pytest.raises(TypeError) as e:
         request.infer(inputs)
     assert "Inputs should be either list or dict! Current type:" in str(e.value)
+
+
+def test_infer_output_is_view_with_base(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer([arr_1, arr_2])
+    out = res[request.model_outputs[0]]
+
+    # the array shares the output tensor memory instead of owning a copy,
+    # so the tensor is installed as the base keeping the blob alive
+    assert out.base is not None
+    del request, res
+    gc.collect()
+    assert np.array_equal(out, arr_1 + arr_2)
+
+
+def test_second_infer_overwrites_returned_output(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    out = request.infer([arr_1, arr_2])[request.model_outputs[0]]
+    assert np.array_equal(out, arr_1 + arr_2)
+
+    request.infer([arr_2, arr_2])
+
+    # the previously returned array is a view into the request's output
+    # tensor, so the next inference overwrites it in place
+    assert np.array_equal(out, arr_2 + arr_2)
+
+
+def test_copied_output_survives_next_infer(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    out = request.infer([arr_1, arr_2])[request.model_outputs[0]]
+    snapshot = out.copy()
+
+    request.infer([arr_2, arr_2])
+
+    assert np.array_equal(snapshot, arr_1 + arr_2)
+    assert not np.array_equal(snapshot, out)
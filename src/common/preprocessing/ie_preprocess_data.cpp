@@ -36,6 +36,9 @@ public:
 
     void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
 
+    void executeBatch(const std::vector<Blob::Ptr> &srcBlobs, std::vector<Blob::Ptr> &preprocessedBlobs,
+                      const PreProcessInfo &info, bool serial) override;
+
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
 };
 
@@ -71,6 +74,31 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
     _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
 }
 
+void PreProcessData::executeBatch(const std::vector<Blob::Ptr> &srcBlobs, std::vector<Blob::Ptr> &preprocessedBlobs,
+        const PreProcessInfo &info, bool serial) {
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "BatchedPreprocessing");
+
+    auto algorithm = info.getResizeAlgorithm();
+    auto fmt = info.getColorFormat();
+
+    for (const auto& blob : srcBlobs) {
+        if (blob == nullptr) {
+            IE_THROW() << "Batched input pre-processing is called with a null source blob";
+        }
+    }
+    for (const auto& blob : preprocessedBlobs) {
+        if (blob == nullptr) {
+            IE_THROW() << "Batched input pre-processing is called with a null output blob";
+        }
+    }
+
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine);
+    }
+
+    _preproc->preprocessBatchWithGAPI(srcBlobs, preprocessedBlobs, algorithm, fmt, serial);
+}
+
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
     PreprocEngine::checkApplicabilityGAPI(src, dst);
 }
@@ -7,6 +7,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/util/file_util.hpp"
@@ -44,6 +45,18 @@ public:
      */
     virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
 
+    /**
+     * @brief Executes input pre-processing for several frames with a single graph dispatch.
+     * All frames must share the same descriptors; the pipeline is compiled once and the work
+     * is threaded across frames, amortizing the per-frame dispatch overhead.
+     * @param srcBlobs source (ROI) blobs, one per frame.
+     * @param preprocessedBlobs pre-processed output blobs to be used for inference, one per frame.
+     * @param info pre-processing info that specifies resize algorithm and color format.
+     * @param serial disable OpenMP threading if the value set to true.
+     */
+    virtual void executeBatch(const std::vector<Blob::Ptr>& srcBlobs, std::vector<Blob::Ptr>& preprocessedBlobs,
+                              const PreProcessInfo& info, bool serial) = 0;
+
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 
 protected:
@@ -104,6 +117,11 @@ public:
         OV_PREPROC_PLUGIN_CALL_STATEMENT(_ptr->execute(preprocessedBlob, info, serial, batchSize));
     }
 
+    void executeBatch(const std::vector<Blob::Ptr>& srcBlobs, std::vector<Blob::Ptr>& preprocessedBlobs,
+                      const PreProcessInfo& info, bool serial) {
+        OV_PREPROC_PLUGIN_CALL_STATEMENT(_ptr->executeBatch(srcBlobs, preprocessedBlobs, info, serial));
+    }
+
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
         OV_PREPROC_PLUGIN_CALL_STATEMENT(_ptr->isApplicable(src, dst));
     }
@@ -977,6 +977,100 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         omp_serial, update);
 }
 
+template<typename BlobTypePtr>
+void PreprocEngine::preprocessBlobBatch(const std::vector<BlobTypePtr> &inBlobs,
+    std::vector<MemoryBlob::Ptr> &outBlobs, ResizeAlgorithm algorithm,
+    ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial) {
+
+    for (const auto& inBlob : inBlobs) {
+        validateBlob(inBlob);
+    }
+
+    auto desc_and_layout = getTensorDescAndLayout(inBlobs.front());
+
+    const auto& in_desc_ie = desc_and_layout.first;
+    const auto  in_layout  = desc_and_layout.second;
+
+    const auto& out_desc_ie = outBlobs.front()->getTensorDesc();
+    validateTensorDesc(in_desc_ie);
+    validateTensorDesc(out_desc_ie);
+
+    // all frames run through one compiled pipeline, so they must be fully homogeneous
+    for (size_t i = 1; i < inBlobs.size(); ++i) {
+        if (!(getTensorDescAndLayout(inBlobs[i]).first == in_desc_ie) ||
+            !(outBlobs[i]->getTensorDesc() == out_desc_ie)) {
+            IE_THROW() << "Batched pre-processing requires all frames to have identical"
+                       << " input and output descriptors, frame " << i << " differs";
+        }
+    }
+
+    const auto out_layout = out_desc_ie.getLayout();
+
+    const G::Desc
+        in_desc =  G::decompose(in_desc_ie),
+        out_desc = G::decompose(out_desc_ie);
+
+    if (in_desc.d.N != out_desc.d.N) {
+        IE_THROW()  << "Input blob batch size is invalid: (input blob) "
+                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+    }
+
+    CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_layout,
+                                            in_desc_ie.getDims(),
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_desc_ie.getDims(),
+                                            out_fmt },
+                                  algorithm };
+
+    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+        //if requested output parameters match input blob no need to do anything
+        IE_THROW()  << "No job to do in the PreProcessing ?";
+    }
+
+    const Update update = needUpdate(thisCall);
+
+    Opt<cv::GComputation> _lastComputation;
+    if (Update::REBUILD == update || Update::RESHAPE == update) {
+        _lastCall = cv::util::make_optional(std::move(thisCall));
+
+        if (Update::REBUILD == update) {
+            //  rebuild the graph
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            auto custom_desc = getGDesc(in_desc, inBlobs.front());
+            _lastComputation = cv::util::make_optional(
+                buildGraph(custom_desc,
+                           out_desc,
+                           in_layout,
+                           out_layout,
+                           algorithm,
+                           in_fmt,
+                           out_fmt));
+        }
+    }
+
+    // concatenate every frame's planes into one batch: executeGraph compiles (or reshapes)
+    // once and its per-slice loop then walks all frames, threading the work across them
+    const int frame_batch = getCorrectBatchSize(-1, inBlobs.front());
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats;
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_output_plane_mats;
+    batched_input_plane_mats.reserve(inBlobs.size() * frame_batch);
+    batched_output_plane_mats.reserve(outBlobs.size() * frame_batch);
+    for (size_t i = 0; i < inBlobs.size(); ++i) {
+        auto input_plane_mats  = bind_to_blob(inBlobs[i],  frame_batch);
+        auto output_plane_mats = bind_to_blob(outBlobs[i], frame_batch);
+        std::move(input_plane_mats.begin(), input_plane_mats.end(),
+                  std::back_inserter(batched_input_plane_mats));
+        std::move(output_plane_mats.begin(), output_plane_mats.end(),
+                  std::back_inserter(batched_output_plane_mats));
+    }
+
+    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats,
+        static_cast<int>(batched_input_plane_mats.size()), omp_serial, update);
+}
+
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
@@ -1020,4 +1114,75 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             batch_size);
     }
 }
+
+void PreprocEngine::preprocessBatchWithGAPI(const std::vector<Blob::Ptr> &inBlobs, std::vector<Blob::Ptr> &outBlobs,
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial) {
+    if (inBlobs.empty() || inBlobs.size() != outBlobs.size()) {
+        IE_THROW()  << "Batched pre-processing is called with mismatched frame lists: "
+                            << inBlobs.size() << " inputs vs " << outBlobs.size() << " outputs";
+    }
+
+    if (inBlobs.size() == 1) {
+        // nothing to amortize for a single frame
+        return preprocessWithGAPI(inBlobs.front(), outBlobs.front(), algorithm, in_fmt, omp_serial,
+            getCorrectBatchSize(-1, inBlobs.front()));
+    }
+
+    const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
+
+    // output is always a memory blob
+    std::vector<MemoryBlob::Ptr> outMemoryBlobs;
+    outMemoryBlobs.reserve(outBlobs.size());
+    for (const auto& outBlob : outBlobs) {
+        auto outMemoryBlob = as<MemoryBlob>(outBlob);
+        if (!outMemoryBlob) {
+            IE_THROW()  << "Unsupported network's input blob type: expected MemoryBlob";
+        }
+        outMemoryBlobs.push_back(std::move(outMemoryBlob));
+    }
+
+    // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
+    switch (in_fmt) {
+    case ColorFormat::NV12: {
+        std::vector<NV12Blob::Ptr> inNV12Blobs;
+        inNV12Blobs.reserve(inBlobs.size());
+        for (const auto& inBlob : inBlobs) {
+            auto inNV12Blob = as<NV12Blob>(inBlob);
+            if (!inNV12Blob) {
+                IE_THROW()  << "Unsupported input blob for color format " << in_fmt
+                                    << ": expected NV12Blob";
+            }
+            inNV12Blobs.push_back(std::move(inNV12Blob));
+        }
+        return preprocessBlobBatch(inNV12Blobs, outMemoryBlobs, algorithm, in_fmt, out_fmt, omp_serial);
+    }
+    case ColorFormat::I420: {
+        std::vector<I420Blob::Ptr> inI420Blobs;
+        inI420Blobs.reserve(inBlobs.size());
+        for (const auto& inBlob : inBlobs) {
+            auto inI420Blob = as<I420Blob>(inBlob);
+            if (!inI420Blob) {
+                IE_THROW()  << "Unsupported input blob for color format " << in_fmt
+                                    << ": expected I420Blob";
+            }
+            inI420Blobs.push_back(std::move(inI420Blob));
+        }
+        return preprocessBlobBatch(inI420Blobs, outMemoryBlobs, algorithm, in_fmt, out_fmt, omp_serial);
+    }
+
+    default: {
+        std::vector<MemoryBlob::Ptr> inMemoryBlobs;
+        inMemoryBlobs.reserve(inBlobs.size());
+        for (const auto& inBlob : inBlobs) {
+            auto inMemoryBlob = as<MemoryBlob>(inBlob);
+            if (!inMemoryBlob) {
+                IE_THROW()  << "Unsupported input blob for color format " << in_fmt
+                                    << ": expected MemoryBlob";
+            }
+            inMemoryBlobs.push_back(std::move(inMemoryBlob));
+        }
+        return preprocessBlobBatch(inMemoryBlobs, outMemoryBlobs, algorithm, in_fmt, out_fmt, omp_serial);
+    }
+    }
+}
 }  // namespace InferenceEngine
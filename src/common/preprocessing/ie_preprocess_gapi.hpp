@@ -48,12 +48,21 @@ class PreprocEngine {
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
         int batch_size);
 
+    template<typename BlobTypePtr>
+    void preprocessBlobBatch(const std::vector<BlobTypePtr> &inBlobs, std::vector<MemoryBlob::Ptr> &outBlobs,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial);
+
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
         ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+    // Processes several homogeneous frames with a single graph dispatch: the pipeline is
+    // compiled (or reshaped) once and all frames are fed through it, so the per-frame
+    // dispatch overhead is amortized and work is threaded across frames
+    void preprocessBatchWithGAPI(const std::vector<Blob::Ptr> &inBlobs, std::vector<Blob::Ptr> &outBlobs,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, bool omp_serial);
 };
 
 }  // namespace InferenceEngine
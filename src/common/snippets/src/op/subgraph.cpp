@@ -160,18 +160,43 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
     // TODO: store blocking into to Parameter's rt_info for future propagation
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
         auto param = m_body->get_parameters()[i];
+        if (param->get_element_type() != std::get<2>(input_shapes[i])) {
+            // The plugin may feed bf16 tensors into a subgraph captured in f32: loads and stores
+            // convert on the fly while the computation itself stays in f32, so here the body is
+            // only relabeled to reflect the in-memory type. Any other mismatch is still illegal.
+            if (param->get_element_type() != ngraph::element::f32 || std::get<2>(input_shapes[i]) != ngraph::element::bf16) {
+                throw ngraph::ngraph_error("changes in presision. Is it legal??");
+            }
+        }
         if (param->get_shape().size() < 4) {
             std::vector<size_t> shape(4, 1);
             std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
+            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), ngraph::Shape(shape)));
         } else if (param->get_shape().size() >= 4) {
-            if (param->get_element_type() != std::get<2>(input_shapes[i])) {
-                throw ngraph::ngraph_error("changes in presision. Is it legal??");
-            }
             m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), std::get<0>(input_shapes[i])));
         }
     }
 
+    // If parameters were relabeled to bf16, f32 scalars have to follow, otherwise type propagation
+    // would fail on mixed-type elementwise ops
+    bool has_bf16_parameters = false;
+    for (const auto& param : m_body->get_parameters()) {
+        has_bf16_parameters = has_bf16_parameters || (param->get_element_type() == ngraph::element::bf16);
+    }
+    if (has_bf16_parameters) {
+        for (auto op : m_body->get_ordered_ops()) {
+            if (auto scalar = ngraph::as_type_ptr<snippets::op::Scalar>(op)) {
+                if (scalar->get_element_type() == ngraph::element::f32) {
+                    auto relabeled = std::make_shared<snippets::op::Scalar>(
+                        ngraph::element::bf16, scalar->get_shape(), scalar->cast_vector<float>());
+                    relabeled->set_friendly_name(scalar->get_friendly_name());
+                    ngraph::copy_runtime_info(scalar, relabeled);
+                    ngraph::replace_node(scalar, relabeled);
+                }
+            }
+        }
+    }
+
     m_body->validate_nodes_and_infer_types();
 
     for (size_t i = 0; i < m_body->get_results().size(); i++) {
@@ -84,6 +84,11 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     };
 
     auto is_layout_oblivious_unary = [](const std::shared_ptr<const Node> &n) -> bool {
+        // only the half-to-even rounding mode has a target code emitter
+        auto is_supported_round = [](const std::shared_ptr<const Node> &n) -> bool {
+            const auto round = ov::as_type_ptr<const ngraph::op::v5::Round>(n);
+            return round && round->get_mode() == ngraph::op::v5::Round::RoundMode::HALF_TO_EVEN;
+        };
         return ov::is_type<opset1::Abs>(n)
             || ov::is_type<opset1::Clamp>(n)
             || ov::is_type<opset1::Elu>(n)
@@ -97,7 +102,10 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
             || ov::is_type<opset1::Tanh>(n)
             || ov::is_type<ngraph::op::v0::Gelu>(n)
             || ov::is_type<ngraph::op::v7::Gelu>(n)
-            || ov::is_type<ngraph::op::v4::HSwish>(n);
+            || ov::is_type<ngraph::op::v4::HSwish>(n)
+            || ov::is_type<ngraph::op::v4::Mish>(n)
+            || ov::is_type<ngraph::op::v4::SoftPlus>(n)
+            || is_supported_round(n);
     };
     return is_layout_oblivious_unary(n) || is_layout_oblivious_binary(n);
 }
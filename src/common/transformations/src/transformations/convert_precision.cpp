@@ -16,6 +16,7 @@
 
 #include "itt.hpp"
 #include "ngraph_ops/type_relaxed.hpp"
+#include "openvino/pass/constant_folding.hpp"
 
 using namespace ngraph;
 
@@ -100,6 +101,15 @@ void validate_nodes_and_infer_types(const std::vector<std::shared_ptr<Node>>& op
     }
 }
 
+bool constant_feeds_disabled_converts_only(const std::vector<Input<Node>>& consumers) {
+    for (const auto& input : consumers) {
+        const auto node = input.get_node()->shared_from_this();
+        if (!ov::as_type_ptr<opset4::Convert>(node) || !ov::pass::constant_folding_is_disabled(node))
+            return false;
+    }
+    return !consumers.empty();
+}
+
 bool convert_precision(pass::PassBase& pass,
                        const std::shared_ptr<ngraph::Function>& f,
                        const type_to_fuse_map& type_to_fuse,
@@ -129,6 +139,11 @@ bool convert_precision(pass::PassBase& pass,
                 // Function object
                 auto it = const_to_internal_output.find(node.get());
                 if (it != const_to_internal_output.end()) {
+                    // Compressed fp16 weights whose decompression Converts are excluded from
+                    // folding stay in fp16: the Convert already produces the requested type,
+                    // while upgrading the Constant would just double its size
+                    if (from == element::f16 && constant_feeds_disabled_converts_only(it->second))
+                        return false;
                     return fuse_type_to_constant(node, to, it->second);
                 }
 
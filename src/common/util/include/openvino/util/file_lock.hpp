@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for advisory file locking
+ * @file file_lock.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief Holds an advisory lock on a file for inter-process coordination.
+/// The lock is released together with the object. Advisory locks only
+/// order the processes which take them; they do not prevent plain reads
+/// or writes of the file.
+class FileLock {
+public:
+    virtual ~FileLock() = default;
+};
+
+/// \brief Takes an advisory lock on a file, creating the file when it is absent,
+/// and blocks until the lock is granted. A shared lock is held by any number of
+/// processes at once, an exclusive one excludes both kinds.
+/// \param path Path to the file to lock
+/// \param exclusive true for an exclusive (writer) lock, false for a shared (reader) one
+/// \return An object holding the lock, never nullptr
+std::shared_ptr<FileLock> lock_file(const std::string& path, bool exclusive);
+
+}  // namespace util
+}  // namespace ov
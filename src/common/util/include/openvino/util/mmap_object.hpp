@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for memory-mapped file handling
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief Holds a file mapped into the process address space.
+/// The mapping is released together with the object, so any buffer
+/// which aliases the mapped pages must keep a reference to it.
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /// \return A pointer to the beginning of the mapped region
+    virtual char* data() noexcept = 0;
+
+    /// \return Size of the mapped region in bytes
+    virtual size_t size() const noexcept = 0;
+};
+
+/// \brief Maps a whole file into memory in read-only mode.
+/// \param path Path to a file to map
+/// \return An object holding the mapping, never nullptr
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
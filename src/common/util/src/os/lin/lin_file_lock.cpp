@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_lock.hpp"
+
+namespace ov {
+namespace util {
+
+class LockHolder : public FileLock {
+public:
+    LockHolder() = default;
+
+    ~LockHolder() override {
+        if (m_handle != -1) {
+            // closing the descriptor also drops the flock
+            close(m_handle);
+        }
+    }
+
+    void set(const std::string& path, bool exclusive) {
+        m_handle = open(path.c_str(), O_RDWR | O_CREAT, 0660);
+        if (m_handle == -1) {
+            throw_error("Can not open file " + path + " for locking.");
+        }
+        while (flock(m_handle, exclusive ? LOCK_EX : LOCK_SH) == -1) {
+            if (errno != EINTR) {
+                throw_error("Can not lock file " + path);
+            }
+        }
+    }
+
+private:
+    [[noreturn]] static void throw_error(const std::string& message) {
+        std::stringstream ss;
+        ss << message << " Error: " << strerror(errno);
+        throw std::runtime_error(ss.str());
+    }
+
+    int m_handle = -1;
+};
+
+std::shared_ptr<FileLock> lock_file(const std::string& path, bool exclusive) {
+    auto holder = std::make_shared<LockHolder>();
+    holder->set(path, exclusive);
+    return holder;
+}
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <stdexcept>
+#include <string>
+
+#include "openvino/util/file_lock.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace ov {
+namespace util {
+
+class LockHolder : public FileLock {
+public:
+    LockHolder() = default;
+
+    ~LockHolder() override {
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            ::UnlockFileEx(m_handle, 0, 1, 0, &overlapped);
+            ::CloseHandle(m_handle);
+        }
+    }
+
+    void set(const std::string& path, bool exclusive) {
+        m_handle = ::CreateFileA(path.c_str(),
+                                 GENERIC_READ | GENERIC_WRITE,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                 0,
+                                 OPEN_ALWAYS,
+                                 FILE_ATTRIBUTE_NORMAL,
+                                 0);
+        if (m_handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Can not open file " + path + " for locking.");
+        }
+        OVERLAPPED overlapped = {};
+        if (!::LockFileEx(m_handle, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, 1, 0, &overlapped)) {
+            throw std::runtime_error("Can not lock file " + path);
+        }
+    }
+
+private:
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+};
+
+std::shared_ptr<FileLock> lock_file(const std::string& path, bool exclusive) {
+    auto holder = std::make_shared<LockHolder>();
+    holder->set(path, exclusive);
+    return holder;
+}
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <stdexcept>
+#include <string>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace ov {
+namespace util {
+
+class HandleHolder {
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+
+    void reset() {
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_handle);
+            m_handle = INVALID_HANDLE_VALUE;
+        }
+    }
+
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    HandleHolder(HandleHolder&& other) noexcept : m_handle(other.m_handle) {
+        other.m_handle = INVALID_HANDLE_VALUE;
+    }
+    HandleHolder& operator=(HandleHolder&& other) noexcept {
+        if (this != &other) {
+            reset();
+            m_handle = other.m_handle;
+            other.m_handle = INVALID_HANDLE_VALUE;
+        }
+        return *this;
+    }
+
+    ~HandleHolder() {
+        reset();
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    void set(const std::string& path) {
+        auto h = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+        map(path, h);
+    }
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    void set(const std::wstring& path) {
+        auto h = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+        map(ov::util::wstring_to_string(path), h);
+    }
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+    char* data() noexcept override {
+        return static_cast<char*>(m_data);
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    void map(const std::string& path, HANDLE h) {
+        if (h == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Can not open file " + path + " for mapping.");
+        }
+        m_handle = HandleHolder(h);
+
+        LARGE_INTEGER file_size = {};
+        if (!::GetFileSizeEx(m_handle.get(), &file_size)) {
+            throw std::runtime_error("Can not get file size for " + path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size > 0) {
+            m_mapping = HandleHolder(::CreateFileMapping(m_handle.get(), 0, PAGE_READONLY, 0, 0, NULL));
+            if (m_mapping.get() == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Can not create file mapping for " + path);
+            }
+
+            m_data = ::MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, m_size);
+            if (m_data == nullptr) {
+                throw std::runtime_error("Can not create map view for " + path);
+            }
+        }
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_handle;
+    HandleHolder m_mapping;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Binary encoding of a pugixml document, shared by ov::pass::Serialize and the IR frontend
+ *
+ * The format stores the same element/attribute tree an IR xml file describes, but pre-parsed:
+ * a deduplicated string table followed by length-prefixed records referring into it. Reading
+ * it back only rebuilds the DOM, without the text tokenization which dominates read_model on
+ * xml files with tens of thousands of layers. Attribute values keep their textual form, so the
+ * existing xml-based deserializer consumes the decoded document unchanged.
+ *
+ * Layout (all integers are uint32_t written natively; the encoding targets the little-endian
+ * hosts the product runs on and is not an interchange form between hosts of different
+ * endianness - the xml form remains the interchange format):
+ *   magic 'O' 'V' 'B' 'X'
+ *   codec version
+ *   'version' attribute of the root element (0 when absent), so readers can dispatch on the
+ *     IR version from a header prefix without decoding the document
+ *   string count, then per string: length, bytes
+ *   root element, recursively:
+ *     name index, attribute count, per attribute: name index, value index,
+ *     child count, per child: kind byte (0 - element, 1 - text), followed by an element
+ *     record or a text value index
+ *
+ * @file binary_xml_codec.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <pugixml.hpp>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace binary_xml {
+
+constexpr const char codec_magic[4] = {'O', 'V', 'B', 'X'};
+constexpr uint32_t codec_version = 1;
+constexpr size_t codec_header_size = sizeof(codec_magic) + 2 * sizeof(uint32_t);
+
+/// \brief Tells whether a buffer starts with the magic of an encoded document
+inline bool has_codec_magic(const char* data, size_t size) {
+    return size >= sizeof(codec_magic) && std::memcmp(data, codec_magic, sizeof(codec_magic)) == 0;
+}
+
+namespace detail {
+
+inline void write_u32(std::ostream& out, uint32_t value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline uint32_t read_u32(std::istream& in) {
+    uint32_t value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!in)
+        throw std::runtime_error("Unexpected end of a binary IR document");
+    return value;
+}
+
+class StringTable {
+public:
+    uint32_t intern(const char* value) {
+        auto it = m_indices.find(value);
+        if (it != m_indices.end())
+            return it->second;
+        const auto index = static_cast<uint32_t>(m_strings.size());
+        m_strings.emplace_back(value);
+        m_indices.emplace(m_strings.back(), index);
+        return index;
+    }
+
+    const std::vector<std::string>& strings() const {
+        return m_strings;
+    }
+
+private:
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, uint32_t> m_indices;
+};
+
+inline void collect_strings(const pugi::xml_node& node, StringTable& table) {
+    table.intern(node.name());
+    for (auto attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        table.intern(attr.name());
+        table.intern(attr.value());
+    }
+    for (const auto& child : node.children()) {
+        if (child.type() == pugi::node_element) {
+            collect_strings(child, table);
+        } else if (child.type() == pugi::node_pcdata || child.type() == pugi::node_cdata) {
+            table.intern(child.value());
+        }
+    }
+}
+
+inline void encode_node(std::ostream& out, const pugi::xml_node& node, StringTable& table) {
+    write_u32(out, table.intern(node.name()));
+    uint32_t attr_count = 0;
+    for (auto attr = node.first_attribute(); attr; attr = attr.next_attribute())
+        ++attr_count;
+    write_u32(out, attr_count);
+    for (auto attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        write_u32(out, table.intern(attr.name()));
+        write_u32(out, table.intern(attr.value()));
+    }
+    uint32_t child_count = 0;
+    for (const auto& child : node.children()) {
+        if (child.type() == pugi::node_element || child.type() == pugi::node_pcdata ||
+            child.type() == pugi::node_cdata)
+            ++child_count;
+    }
+    write_u32(out, child_count);
+    for (const auto& child : node.children()) {
+        if (child.type() == pugi::node_element) {
+            out.put(0);
+            encode_node(out, child, table);
+        } else if (child.type() == pugi::node_pcdata || child.type() == pugi::node_cdata) {
+            out.put(1);
+            write_u32(out, table.intern(child.value()));
+        }
+    }
+}
+
+inline const char* string_at(const std::vector<std::string>& strings, uint32_t index) {
+    if (index >= strings.size())
+        throw std::runtime_error("Corrupted binary IR document: a string index is out of range");
+    return strings[index].c_str();
+}
+
+inline void decode_node(std::istream& in, pugi::xml_node node, const std::vector<std::string>& strings) {
+    node.set_name(string_at(strings, read_u32(in)));
+    const auto attr_count = read_u32(in);
+    for (uint32_t i = 0; i < attr_count; ++i) {
+        const auto name = string_at(strings, read_u32(in));
+        node.append_attribute(name).set_value(string_at(strings, read_u32(in)));
+    }
+    const auto child_count = read_u32(in);
+    for (uint32_t i = 0; i < child_count; ++i) {
+        const auto kind = in.get();
+        if (kind == 0) {
+            decode_node(in, node.append_child(), strings);
+        } else if (kind == 1) {
+            node.append_child(pugi::node_pcdata).set_value(string_at(strings, read_u32(in)));
+        } else {
+            throw std::runtime_error("Corrupted binary IR document: an unknown node kind");
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Returns the root 'version' attribute recorded in the header of an encoded document,
+/// 0 when the buffer is not an encoded document or is shorter than the header
+inline uint32_t decode_document_version(const char* data, size_t size) {
+    if (!has_codec_magic(data, size) || size < codec_header_size)
+        return 0;
+    uint32_t version = 0;
+    std::memcpy(&version, data + sizeof(codec_magic) + sizeof(uint32_t), sizeof(version));
+    return version;
+}
+
+/// \brief Writes the root element of a document to a stream in the binary form
+inline void encode(const pugi::xml_document& doc, std::ostream& out) {
+    const auto root = doc.document_element();
+    detail::StringTable table;
+    detail::collect_strings(root, table);
+    out.write(codec_magic, sizeof(codec_magic));
+    detail::write_u32(out, codec_version);
+    detail::write_u32(out, root.attribute("version").as_uint(0));
+    detail::write_u32(out, static_cast<uint32_t>(table.strings().size()));
+    for (const auto& value : table.strings()) {
+        detail::write_u32(out, static_cast<uint32_t>(value.size()));
+        out.write(value.data(), value.size());
+    }
+    detail::encode_node(out, root, table);
+}
+
+/// \brief Rebuilds a document from its binary form
+/// \throws std::runtime_error when the stream does not hold a well-formed encoded document
+inline void decode(std::istream& in, pugi::xml_document& doc) {
+    char magic[sizeof(codec_magic)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || !has_codec_magic(magic, sizeof(magic)))
+        throw std::runtime_error("The stream does not hold a binary IR document");
+    if (detail::read_u32(in) != codec_version)
+        throw std::runtime_error("Unsupported binary IR document version");
+    detail::read_u32(in);  // the document version hint is not needed for a full decode
+    const auto string_count = detail::read_u32(in);
+    std::vector<std::string> strings;
+    // do not trust the count from the stream for the upfront allocation
+    strings.reserve(std::min<uint32_t>(string_count, 1u << 20));
+    for (uint32_t i = 0; i < string_count; ++i) {
+        const auto length = detail::read_u32(in);
+        std::string value(length, '\0');
+        if (length != 0) {
+            in.read(&value[0], length);
+            if (!in)
+                throw std::runtime_error("Unexpected end of a binary IR document");
+        }
+        strings.push_back(std::move(value));
+    }
+    detail::decode_node(in, doc.append_child(), strings);
+}
+
+}  // namespace binary_xml
+}  // namespace ov
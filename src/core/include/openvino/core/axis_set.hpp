@@ -23,10 +23,14 @@ public:
 
     OPENVINO_API AxisSet(const std::set<size_t>& axes);
 
+    OPENVINO_API AxisSet(std::set<size_t>&& axes);
+
     OPENVINO_API AxisSet(const std::vector<size_t>& axes);
 
     OPENVINO_API AxisSet(const AxisSet& axes);
 
+    OPENVINO_API AxisSet(AxisSet&& axes);
+
     OPENVINO_API AxisSet& operator=(const AxisSet& v);
 
     OPENVINO_API AxisSet& operator=(AxisSet&& v) noexcept;
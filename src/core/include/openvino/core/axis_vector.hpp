@@ -20,8 +20,12 @@ public:
 
     OPENVINO_API AxisVector(const std::vector<size_t>& axes);
 
+    OPENVINO_API AxisVector(std::vector<size_t>&& axes) noexcept;
+
     OPENVINO_API AxisVector(const AxisVector& axes);
 
+    OPENVINO_API AxisVector(AxisVector&& axes) noexcept;
+
     OPENVINO_API explicit AxisVector(size_t n);
 
     template <class InputIterator>
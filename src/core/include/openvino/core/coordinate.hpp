@@ -22,8 +22,12 @@ public:
 
     OPENVINO_API Coordinate(const std::vector<size_t>& axes);
 
+    OPENVINO_API Coordinate(std::vector<size_t>&& axes) noexcept;
+
     OPENVINO_API Coordinate(const Coordinate& axes);
 
+    OPENVINO_API Coordinate(Coordinate&& axes) noexcept;
+
     OPENVINO_API Coordinate(size_t n, size_t initial_value = 0);
 
     OPENVINO_API ~Coordinate();
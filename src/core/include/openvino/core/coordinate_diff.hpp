@@ -20,8 +20,12 @@ public:
 
     OPENVINO_API CoordinateDiff(const std::vector<std::ptrdiff_t>& diffs);
 
+    OPENVINO_API CoordinateDiff(std::vector<std::ptrdiff_t>&& diffs) noexcept;
+
     OPENVINO_API CoordinateDiff(const CoordinateDiff& diffs);
 
+    OPENVINO_API CoordinateDiff(CoordinateDiff&& diffs) noexcept;
+
     OPENVINO_API explicit CoordinateDiff(size_t n, std::ptrdiff_t initial_value = 0);
 
     template <class InputIterator>
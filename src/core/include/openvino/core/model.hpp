@@ -10,6 +10,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/core/core_visibility.hpp"
@@ -101,6 +102,12 @@ public:
     Model(const ov::OutputVector& results, const ov::SinkVector& sinks, const std::string& name = "");
 
     virtual ~Model() = default;
+
+    /// \brief Returns a copy of the model with its own node objects.
+    ///        Node structure is copied, while constant data buffers are shared with the
+    ///        original, so cloning a model does not duplicate its weights.
+    std::shared_ptr<Model> clone() const;
+
     /// Return the number of outputs for this function.
     size_t get_output_size() const;
 
@@ -164,6 +171,22 @@ public:
 
     std::vector<std::shared_ptr<ov::Node>> get_ops() const;
     std::vector<std::shared_ptr<ov::Node>> get_ordered_ops() const;
+
+    /// \brief Returns the nodes whose type matches (directly or via the type hierarchy) any of
+    ///        the given type infos, in topological order. The result is served from a type index
+    ///        which is maintained together with the topological cache, so repeated queries do not
+    ///        rescan the graph.
+    /// \param types Type infos to look up; a node matches when one of them is found on its
+    ///        DiscreteTypeInfo parent chain.
+    std::vector<std::shared_ptr<ov::Node>> get_ordered_ops_by_types(const std::vector<DiscreteTypeInfo>& types) const;
+
+    /// \brief Returns the cached topological order as weak pointers, without materializing a
+    ///        shared_ptr per node the way get_ordered_ops() does. Intended for the pass
+    ///        infrastructure, which keeps weak queues of its own and locks a node only right
+    ///        before touching it; the cache is rebuilt first when graph mutations have
+    ///        invalidated it.
+    std::vector<std::weak_ptr<ov::Node>> get_ordered_ops_weak() const;
+
     void map_unordered_ops(std::function<void(ov::Node*)> f) const;
 
     // updates graph and m_results list
@@ -327,6 +350,10 @@ private:
     /// function and registers them, otherwise checks all the Parameters are registered.
     void prerequirements(bool detect_variables, bool detect_parameters);
 
+    /// \brief Re-sorts the graph and refills m_cached_ordered_ops together with the per-type
+    /// index. Must be called under m_topological_sort_mutex.
+    void rebuild_topological_cache() const;
+
     static std::atomic<size_t> m_next_instance_id;
     std::string m_name;
     const std::string m_unique_name;
@@ -346,6 +373,10 @@ private:
     // node has no consumers but still exists in a graph.
     mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
 
+    // Positions in m_cached_ordered_ops grouped by node type; invalidated and rebuilt together
+    // with the ordered cache so typed lookups stay consistent with the topological order.
+    mutable std::unordered_map<DiscreteTypeInfo, std::vector<size_t>> m_cached_ops_by_type;
+
     // Private runtime info which is shared across nodes and used only
     // for internal purposes.
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
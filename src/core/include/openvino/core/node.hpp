@@ -277,6 +277,20 @@ public:
     virtual void revalidate_and_infer_types() {
         invalidate_values();
         validate_and_infer_types();
+        m_validation_required = false;
+    }
+
+    /// \brief Marks whether the node has to be revisited by the next Model validation sweep.
+    ///        The flag is raised automatically when the node's inputs are re-wired; op
+    ///        implementations which mutate attributes in place after construction should raise
+    ///        it explicitly.
+    void set_validation_required(bool required) {
+        m_validation_required = required;
+    }
+    /// \brief Returns true when the node's inputs or attributes changed since it was last
+    ///        validated. New nodes start in this state.
+    bool get_validation_required() const {
+        return m_validation_required;
     }
     /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
     ///        The class name, must not contain spaces as it is used for codegen.
@@ -516,6 +530,10 @@ private:
     // update of this field by having specific method with mutex.
     void insert_info(std::shared_ptr<SharedRTInfo> info);
     std::mutex m_insert_mutex;
+
+    // Raised on construction and on every input re-wire so that Model validation sweeps
+    // can skip nodes which did not change since they were validated last time.
+    bool m_validation_required = true;
 };
 
 using NodeTypeInfo = Node::type_info_t;
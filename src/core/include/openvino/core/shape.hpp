@@ -23,8 +23,12 @@ public:
 
     OPENVINO_API Shape(const std::vector<size_t>& axis_lengths);
 
+    OPENVINO_API Shape(std::vector<size_t>&& axis_lengths) noexcept;
+
     OPENVINO_API Shape(const Shape& axis_lengths);
 
+    OPENVINO_API Shape(Shape&& axis_lengths) noexcept;
+
     OPENVINO_API explicit Shape(size_t n, size_t initial_value = 0);
 
     OPENVINO_API ~Shape();
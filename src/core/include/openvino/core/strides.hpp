@@ -22,8 +22,12 @@ public:
 
     OPENVINO_API Strides(const std::vector<size_t>& axis_strides);
 
+    OPENVINO_API Strides(std::vector<size_t>&& axis_strides) noexcept;
+
     OPENVINO_API Strides(const Strides& axis_strides);
 
+    OPENVINO_API Strides(Strides&& axis_strides) noexcept;
+
     OPENVINO_API explicit Strides(size_t n, size_t initial_value = 0);
 
     template <class InputIterator>
@@ -31,12 +31,14 @@ public:
     }
     void set_destination_type(const element::Type& destination_type) {
         m_destination_type = destination_type;
+        set_validation_required(true);
     }
     const element::Type& get_convert_element_type() const {
         return m_destination_type;
     }
     void set_convert_element_type(const element::Type& destination_type) {
         m_destination_type = destination_type;
+        set_validation_required(true);
     }
 
     OPENVINO_SUPPRESS_DEPRECATED_START
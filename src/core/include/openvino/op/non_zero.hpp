@@ -53,6 +53,7 @@ public:
     }
     void set_output_type(element::Type output_type) {
         m_output_type = output_type;
+        set_validation_required(true);
     }
     // Overload collision with method on Node
     using Node::set_output_type;
@@ -44,12 +44,14 @@ public:
     }
     void set_partial_shape(const PartialShape& partial_shape) {
         m_partial_shape = partial_shape;
+        set_validation_required(true);
     }
     const element::Type& get_element_type() const {
         return m_element_type;
     }
     void set_element_type(const element::Type& element_type) {
         m_element_type = element_type;
+        set_validation_required(true);
     }
 
     /// \brief Returns current layout, or empty Layout if it is not set
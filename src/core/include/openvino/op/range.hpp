@@ -38,6 +38,7 @@ public:
     bool has_evaluate() const override;
     void set_output_type(element::Type output_type) {
         m_output_type = output_type;
+        set_validation_required(true);
     }
 
     const element::Type& get_output_type() const {
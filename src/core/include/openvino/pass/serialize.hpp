@@ -21,6 +21,9 @@ namespace pass {
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - a model path with a '.bir' extension emits the topology in a binary
+ * pre-parsed form instead of xml; it reads back noticeably faster on very
+ * large graphs, while the xml form remains the interchange format
  */
 class OPENVINO_API Serialize : public ov::pass::ModelPass {
 public:
@@ -148,6 +148,29 @@ public:
     explicit operator bool() const noexcept;
 };
 
+/**
+ * @brief Creates an allocator which aligns every allocation to at least the given boundary.
+ *
+ * Useful when tensor data has to satisfy the alignment expectations of an external consumer
+ * (vectorized kernels, DMA engines), which the default `new`-based allocator does not guarantee.
+ *
+ * @param alignment The minimal alignment in bytes, must be a power of two
+ * @return Allocator serving aligned system memory
+ */
+OPENVINO_API Allocator make_aligned_allocator(size_t alignment);
+
+/**
+ * @brief Creates an allocator backed by huge memory pages where the platform provides them.
+ *
+ * On Linux the memory is mapped with 2 MB pages (explicit huge pages when available, transparent
+ * huge pages otherwise), which reduces the TLB pressure for large tensors; on other platforms the
+ * allocator falls back to aligned system memory. The returned storage is always aligned to the
+ * huge page size.
+ *
+ * @return Allocator serving huge-page backed memory
+ */
+OPENVINO_API Allocator make_huge_page_allocator();
+
 namespace runtime {
 using ov::Allocator;
 using ov::AllocatorImpl;
@@ -23,6 +23,7 @@ class Blob;
 
 namespace ov {
 
+class CompiledModel;
 class Core;
 class InferRequest;
 class RemoteContext;
@@ -46,6 +47,7 @@ protected:
      */
     Tensor(const std::shared_ptr<InferenceEngine::Blob>& impl, const std::shared_ptr<void>& so);
 
+    friend class ov::CompiledModel;
     friend class ov::Core;
     friend class ov::InferRequest;
     friend class ov::RemoteContext;
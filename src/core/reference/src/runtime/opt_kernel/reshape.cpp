@@ -5,6 +5,7 @@
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 
 #include "ngraph/check.hpp"
@@ -206,6 +207,76 @@ bool no_axis_reordering(const AxisVector& axis_order) {
     tmp.erase(std::unique(begin(tmp), end(tmp)), end(tmp));
     return tmp == axis_order;
 }
+
+// Drops the size-1 axes and merges the adjacent input axes which the permutation keeps
+// adjacent. The merged blocks then move with one bulk copy each instead of per-element
+// memcpy calls, which is what makes transposing large constants bearable.
+void coalesce_axes(const Shape& in_shape,
+                   const AxisVector& in_axis_order,
+                   Shape& squeezed_shape,
+                   AxisVector& squeezed_order) {
+    Shape shape_no_ones;
+    std::vector<size_t> axis_remap(in_shape.size(), SIZE_MAX);
+    for (size_t axis = 0; axis < in_shape.size(); ++axis) {
+        if (in_shape[axis] != 1) {
+            axis_remap[axis] = shape_no_ones.size();
+            shape_no_ones.push_back(in_shape[axis]);
+        }
+    }
+    AxisVector order_no_ones;
+    for (const auto axis : in_axis_order) {
+        if (axis_remap[axis] != SIZE_MAX) {
+            order_no_ones.push_back(axis_remap[axis]);
+        }
+    }
+
+    // group the axes that stay adjacent, in the output order
+    std::vector<std::pair<size_t, size_t>> groups;  // [first, last] input axis of a block
+    for (const auto axis : order_no_ones) {
+        if (!groups.empty() && axis == groups.back().second + 1) {
+            groups.back().second = axis;
+        } else {
+            groups.emplace_back(axis, axis);
+        }
+    }
+
+    // the groups ordered by their first input axis define the new input axes
+    auto sorted_groups = groups;
+    std::sort(sorted_groups.begin(), sorted_groups.end());
+    std::vector<size_t> group_index(shape_no_ones.size(), SIZE_MAX);
+    squeezed_shape.clear();
+    for (const auto& group : sorted_groups) {
+        size_t merged = 1;
+        for (size_t axis = group.first; axis <= group.second; ++axis) {
+            merged *= shape_no_ones[axis];
+        }
+        group_index[group.first] = squeezed_shape.size();
+        squeezed_shape.push_back(merged);
+    }
+    squeezed_order.clear();
+    for (const auto& group : groups) {
+        squeezed_order.push_back(group_index[group.first]);
+    }
+}
+
+template <typename T>
+void transpose_2d(const char* in, char* out, size_t rows, size_t cols) {
+    // tiled so both the row-wise reads and the strided writes stay within the caches
+    constexpr size_t tile = 16;
+    const T* src = reinterpret_cast<const T*>(in);
+    T* dst = reinterpret_cast<T*>(out);
+    for (size_t row_begin = 0; row_begin < rows; row_begin += tile) {
+        const size_t row_end = std::min(rows, row_begin + tile);
+        for (size_t col_begin = 0; col_begin < cols; col_begin += tile) {
+            const size_t col_end = std::min(cols, col_begin + tile);
+            for (size_t row = row_begin; row < row_end; ++row) {
+                for (size_t col = col_begin; col < col_end; ++col) {
+                    dst[col * rows + row] = src[row * cols + col];
+                }
+            }
+        }
+    }
+}
 }  // namespace
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
@@ -218,30 +289,63 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
-    switch (in_shape.size()) {
-    case 0:
-        reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
-    case 1:
-        reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
+    Shape squeezed_shape;
+    AxisVector squeezed_order;
+    coalesce_axes(in_shape, in_axis_order, squeezed_shape, squeezed_order);
+    size_t block_size = elem_size;
+    if (!squeezed_order.empty() && squeezed_order.back() == squeezed_shape.size() - 1) {
+        // the innermost axis stays innermost - fold it into the moved element
+        block_size *= squeezed_shape.back();
+        squeezed_shape.pop_back();
+        squeezed_order.pop_back();
+    }
+    if (squeezed_shape.size() <= 1) {
+        // after coalescing the whole tensor is one contiguous block
+        std::memcpy(out, in, shape_size(in_shape) * elem_size);
+        return;
+    }
+    if (squeezed_shape.size() == 2) {
+        // a pure 2D transpose, e.g. a folded embedding matrix; copy typed where possible
+        switch (block_size) {
+        case 1:
+            transpose_2d<uint8_t>(in, out, squeezed_shape[0], squeezed_shape[1]);
+            return;
+        case 2:
+            transpose_2d<uint16_t>(in, out, squeezed_shape[0], squeezed_shape[1]);
+            return;
+        case 4:
+            transpose_2d<uint32_t>(in, out, squeezed_shape[0], squeezed_shape[1]);
+            return;
+        case 8:
+            transpose_2d<uint64_t>(in, out, squeezed_shape[0], squeezed_shape[1]);
+            return;
+        default:
+            break;
+        }
+    }
+    Shape squeezed_out_shape(squeezed_shape.size());
+    for (size_t i = 0; i < squeezed_shape.size(); ++i) {
+        squeezed_out_shape[i] = squeezed_shape[squeezed_order[i]];
+    }
+
+    switch (squeezed_shape.size()) {
     case 2:
-        reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in2(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     case 3:
-        reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in3(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     case 4:
-        reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in4(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     case 5:
-        reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in5(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     case 6:
-        reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in6(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     default:
-        reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reference::reshape(in, out, squeezed_shape, squeezed_order, squeezed_out_shape, block_size);
         break;
     }
 }
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/concat.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+template <class T>
+void shape_infer(const Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    auto& output_shape = output_shapes[0];
+
+    output_shape = input_shapes[0];
+    const auto rank = output_shape.rank();
+    if (rank.is_dynamic()) {
+        output_shape = PartialShape::dynamic();
+        return;
+    }
+    const auto axis = op->get_axis() < 0 ? op->get_axis() + rank.get_length() : op->get_axis();
+    NODE_VALIDATION_CHECK(op,
+                          axis >= 0 && axis < rank.get_length(),
+                          "Concatenation axis is out of bounds: ",
+                          op->get_axis());
+
+    DimType concatenated = output_shape[axis];
+    for (size_t i = 1; i < input_shapes.size(); ++i) {
+        const auto& input_shape = input_shapes[i];
+        if (input_shape.rank().is_dynamic()) {
+            output_shape = PartialShape::dynamic();
+            return;
+        }
+        NODE_VALIDATION_CHECK(op,
+                              input_shape.rank().compatible(rank),
+                              "Argument shapes are inconsistent; they must have the same rank.");
+        for (int64_t dim = 0; dim < rank.get_length(); ++dim) {
+            if (dim == axis) {
+                concatenated += input_shape[dim];
+            } else {
+                NODE_VALIDATION_CHECK(op,
+                                      DimType::merge(output_shape[dim], output_shape[dim], input_shape[dim]),
+                                      "Argument shapes are inconsistent; they must be equal except the "
+                                      "concatenation axis.");
+            }
+        }
+    }
+    output_shape[axis] = concatenated;
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
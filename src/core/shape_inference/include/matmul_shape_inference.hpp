@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/matmul.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+template <class T>
+void shape_infer(const MatMul* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    auto& output_shape = output_shapes[0];
+
+    if (input_shapes[0].rank().is_dynamic() || input_shapes[1].rank().is_dynamic()) {
+        output_shape = PartialShape::dynamic();
+        return;
+    }
+
+    // 1-D tensors are promoted to matrices (and squeezed back at the end),
+    // transposition attributes only apply to the genuine matrices
+    std::vector<DimType> arg0_dims(input_shapes[0].begin(), input_shapes[0].end());
+    std::vector<DimType> arg1_dims(input_shapes[1].begin(), input_shapes[1].end());
+    const bool arg0_is_vector = arg0_dims.size() == 1;
+    const bool arg1_is_vector = arg1_dims.size() == 1;
+    if (arg0_is_vector) {
+        arg0_dims.insert(arg0_dims.begin(), DimType(1));
+    } else if (op->get_transpose_a() && arg0_dims.size() >= 2) {
+        std::swap(arg0_dims[arg0_dims.size() - 2], arg0_dims[arg0_dims.size() - 1]);
+    }
+    if (arg1_is_vector) {
+        arg1_dims.push_back(DimType(1));
+    } else if (op->get_transpose_b() && arg1_dims.size() >= 2) {
+        std::swap(arg1_dims[arg1_dims.size() - 2], arg1_dims[arg1_dims.size() - 1]);
+    }
+
+    NODE_VALIDATION_CHECK(
+        op,
+        DimType::merge(arg0_dims[arg0_dims.size() - 1], arg0_dims[arg0_dims.size() - 1], arg1_dims[arg1_dims.size() - 2]),
+        "Incompatible MatMul matrix dimensions.");
+
+    // broadcast the batch dimensions the NumPy way
+    const auto output_rank = std::max(arg0_dims.size(), arg1_dims.size());
+    std::vector<DimType> output_dims(output_rank);
+    for (size_t i = 0; i + 2 < output_rank; ++i) {
+        const auto arg0_offset =
+            static_cast<int64_t>(i) + static_cast<int64_t>(arg0_dims.size()) - static_cast<int64_t>(output_rank);
+        const auto arg1_offset =
+            static_cast<int64_t>(i) + static_cast<int64_t>(arg1_dims.size()) - static_cast<int64_t>(output_rank);
+        const DimType arg0_dim = arg0_offset < 0 ? DimType(1) : arg0_dims[arg0_offset];
+        const DimType arg1_dim = arg1_offset < 0 ? DimType(1) : arg1_dims[arg1_offset];
+        NODE_VALIDATION_CHECK(op,
+                              DimType::broadcast_merge(output_dims[i], arg0_dim, arg1_dim),
+                              "Incompatible MatMul batch dimensions.");
+    }
+    output_dims[output_rank - 2] = arg0_dims[arg0_dims.size() - 2];
+    output_dims[output_rank - 1] = arg1_dims[arg1_dims.size() - 1];
+
+    // squeeze the dimensions the 1-D arguments were promoted with
+    if (arg1_is_vector) {
+        output_dims.erase(output_dims.end() - 1);
+    }
+    if (arg0_is_vector) {
+        output_dims.erase(output_dims.end() - (arg1_is_vector ? 1 : 2));
+    }
+    output_shape = T(std::move(output_dims));
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
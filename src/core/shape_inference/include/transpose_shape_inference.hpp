@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+#include <openvino/op/transpose.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v1 {
+
+template <class T>
+void shape_infer(const Transpose* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& arg_shape = input_shapes[0];
+    auto& output_shape = output_shapes[0];
+
+    std::vector<int64_t> axes;
+    const bool axes_are_known = get_data_as_int64<T>(1, op, axes, constant_data);
+    if (arg_shape.rank().is_dynamic() || !axes_are_known) {
+        output_shape = PartialShape::dynamic();
+        return;
+    }
+
+    const auto rank = arg_shape.size();
+    if (axes.empty()) {
+        // an empty order means the reversed order of the input dimensions
+        output_shape.resize(rank);
+        for (size_t i = 0; i < rank; ++i) {
+            output_shape[i] = arg_shape[rank - 1 - i];
+        }
+        return;
+    }
+
+    NODE_VALIDATION_CHECK(op,
+                          axes.size() == rank,
+                          "Input order must have the same number of elements as the input rank.");
+    output_shape.resize(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        const auto axis = axes[i] < 0 ? axes[i] + static_cast<int64_t>(rank) : axes[i];
+        NODE_VALIDATION_CHECK(op,
+                              axis >= 0 && axis < static_cast<int64_t>(rank),
+                              "Input order contains an axis out of range: ",
+                              axes[i]);
+        output_shape[i] = arg_shape[axis];
+    }
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
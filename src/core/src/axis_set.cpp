@@ -12,17 +12,21 @@ ov::AxisSet::AxisSet(const std::initializer_list<size_t>& axes) : std::set<size_
 
 ov::AxisSet::AxisSet(const std::set<size_t>& axes) : std::set<size_t>(axes) {}
 
+ov::AxisSet::AxisSet(std::set<size_t>&& axes) : std::set<size_t>(std::move(axes)) {}
+
 ov::AxisSet::AxisSet(const std::vector<size_t>& axes) : std::set<size_t>(axes.begin(), axes.end()) {}
 
 ov::AxisSet::AxisSet(const AxisSet& axes) : std::set<size_t>(axes) {}
 
+ov::AxisSet::AxisSet(AxisSet&& axes) = default;
+
 ov::AxisSet& ov::AxisSet::operator=(const AxisSet& v) {
     static_cast<std::set<size_t>*>(this)->operator=(v);
     return *this;
 }
 
 ov::AxisSet& ov::AxisSet::operator=(AxisSet&& v) noexcept {
-    static_cast<std::set<size_t>*>(this)->operator=(v);
+    static_cast<std::set<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -17,8 +17,12 @@ ov::AxisVector::AxisVector(const std::initializer_list<size_t>& axes) : std::vec
 
 ov::AxisVector::AxisVector(const std::vector<size_t>& axes) : std::vector<size_t>(axes) {}
 
+ov::AxisVector::AxisVector(std::vector<size_t>&& axes) noexcept : std::vector<size_t>(std::move(axes)) {}
+
 ov::AxisVector::AxisVector(const AxisVector& axes) : std::vector<size_t>(axes) {}
 
+ov::AxisVector::AxisVector(AxisVector&& axes) noexcept = default;
+
 ov::AxisVector::AxisVector(size_t n) : std::vector<size_t>(n) {}
 
 ov::AxisVector::AxisVector() {}
@@ -31,7 +35,7 @@ ov::AxisVector& ov::AxisVector::operator=(const AxisVector& v) {
 }
 
 ov::AxisVector& ov::AxisVector::operator=(AxisVector&& v) noexcept {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -24,8 +24,12 @@ ov::Coordinate::Coordinate(const ngraph::Shape& shape)
 
 ov::Coordinate::Coordinate(const std::vector<size_t>& axes) : std::vector<size_t>(axes) {}
 
+ov::Coordinate::Coordinate(std::vector<size_t>&& axes) noexcept : std::vector<size_t>(std::move(axes)) {}
+
 ov::Coordinate::Coordinate(const Coordinate& axes) = default;
 
+ov::Coordinate::Coordinate(Coordinate&& axes) noexcept = default;
+
 ov::Coordinate::Coordinate(size_t n, size_t initial_value) : std::vector<size_t>(n, initial_value) {}
 
 ov::Coordinate::~Coordinate() = default;
@@ -36,7 +40,7 @@ ov::Coordinate& ov::Coordinate::operator=(const Coordinate& v) {
 }
 
 ov::Coordinate& ov::Coordinate::operator=(Coordinate&& v) noexcept {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
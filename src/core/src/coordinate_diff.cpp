@@ -21,8 +21,13 @@ ov::CoordinateDiff::CoordinateDiff(const std::initializer_list<std::ptrdiff_t>&
 
 ov::CoordinateDiff::CoordinateDiff(const std::vector<std::ptrdiff_t>& diffs) : std::vector<std::ptrdiff_t>(diffs) {}
 
+ov::CoordinateDiff::CoordinateDiff(std::vector<std::ptrdiff_t>&& diffs) noexcept
+    : std::vector<std::ptrdiff_t>(std::move(diffs)) {}
+
 ov::CoordinateDiff::CoordinateDiff(const CoordinateDiff& diffs) = default;
 
+ov::CoordinateDiff::CoordinateDiff(CoordinateDiff&& diffs) noexcept = default;
+
 ov::CoordinateDiff::CoordinateDiff(size_t n, std::ptrdiff_t initial_value)
     : std::vector<std::ptrdiff_t>(n, initial_value) {}
 
@@ -36,7 +41,7 @@ ov::CoordinateDiff& ov::CoordinateDiff::operator=(const CoordinateDiff& v) {
 }
 
 ov::CoordinateDiff& ov::CoordinateDiff::operator=(CoordinateDiff&& v) noexcept {
-    static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(v);
+    static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -53,6 +53,8 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
              [](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
              });
+    // The consumer got a new producer, so it has to be revisited by the next validation sweep.
+    m_node->set_validation_required(true);
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
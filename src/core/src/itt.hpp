@@ -24,6 +24,7 @@ OV_ITT_DOMAIN(ngraph_op, "nGraph::Op");
 }  // namespace itt
 }  // namespace ov
 OV_CC_DOMAINS(ngraph_op);
+OV_CC_DOMAINS(ov_opset);
 OV_ITT_DOMAIN(SIMPLE_ngraph_pass);
 
 #if defined(SELECTIVE_BUILD_ANALYZER)
@@ -187,6 +187,10 @@ ov::Model::Model(const ngraph::OutputVector& results, const ngraph::SinkVector&
 
 ov::Model::Model(const OutputVector& results, const string& name) : Model(results, ngraph::SinkVector{}, name) {}
 
+std::shared_ptr<ov::Model> ov::Model::clone() const {
+    return ov::clone_model(*this);
+}
+
 void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::prerequirements");
 
@@ -216,8 +220,31 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
+    // Tensors whose type or shape changed during this sweep; their consumers have to be
+    // revalidated even if they were not touched since the previous sweep, so the walk covers
+    // the transitive closure of the modified nodes and nothing else.
+    std::unordered_set<const ov::descriptor::Tensor*> changed_tensors;
+    std::vector<std::pair<ov::element::Type, ov::PartialShape>> old_outputs;
+
     for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+        bool validation_required = node->get_validation_required();
+        for (size_t i = 0; !validation_required && i < node->get_input_size(); ++i) {
+            validation_required = changed_tensors.count(&node->get_input_tensor(i));
+        }
+        if (validation_required) {
+            old_outputs.clear();
+            for (const auto& output : node->outputs()) {
+                old_outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+            }
+            node->revalidate_and_infer_types();
+            for (const auto& output : node->outputs()) {
+                const auto& old_output = old_outputs[output.get_index()];
+                if (old_output.first != output.get_element_type() ||
+                    old_output.second != output.get_partial_shape()) {
+                    changed_tensors.insert(&output.get_tensor());
+                }
+            }
+        }
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -255,20 +282,8 @@ void ov::Model::validate_nodes_and_infer_types() const {
                             "network.");
 }
 
-std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
-    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops");
-    lock_guard<mutex> lock(m_topological_sort_mutex);
-
+void ov::Model::rebuild_topological_cache() const {
     NodeVector nodes;
-    if (m_shared_rt_info->get_use_topological_cache()) {
-        for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
-                nodes.emplace_back(locked_node);
-            }
-        }
-        return nodes;
-    }
-
     for (const auto& r : get_results()) {
         nodes.emplace_back(r);
     }
@@ -284,13 +299,76 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
+    m_cached_ops_by_type.clear();
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
+        m_cached_ops_by_type[node->get_type_info()].push_back(m_cached_ordered_ops.size());
         m_cached_ordered_ops.push_back(node);
         node->insert_info(m_shared_rt_info);
     });
     m_shared_rt_info->set_use_topological_cache(true);
+}
+
+std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops");
+    lock_guard<mutex> lock(m_topological_sort_mutex);
+
+    if (!m_shared_rt_info->get_use_topological_cache()) {
+        rebuild_topological_cache();
+    }
+
+    NodeVector nodes;
+    nodes.reserve(m_cached_ordered_ops.size());
+    for (const auto& node : m_cached_ordered_ops) {
+        if (auto locked_node = node.lock()) {
+            nodes.emplace_back(locked_node);
+        }
+    }
+    return nodes;
+}
+
+std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops_by_types(const std::vector<DiscreteTypeInfo>& types) const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops_by_types");
+    lock_guard<mutex> lock(m_topological_sort_mutex);
+
+    if (!m_shared_rt_info->get_use_topological_cache()) {
+        rebuild_topological_cache();
+    }
+
+    // The index holds one bucket per concrete node type, so matching against the requested
+    // types walks each bucket's type hierarchy once instead of every node's.
+    std::vector<size_t> positions;
+    for (const auto& bucket : m_cached_ops_by_type) {
+        const DiscreteTypeInfo* type_info = &bucket.first;
+        bool matches = false;
+        while (type_info && !matches) {
+            matches = std::find(types.begin(), types.end(), *type_info) != types.end();
+            type_info = type_info->parent;
+        }
+        if (matches) {
+            positions.insert(positions.end(), bucket.second.begin(), bucket.second.end());
+        }
+    }
+    sort(positions.begin(), positions.end());
+
+    NodeVector nodes;
+    nodes.reserve(positions.size());
+    for (const auto pos : positions) {
+        if (auto locked_node = m_cached_ordered_ops[pos].lock()) {
+            nodes.emplace_back(locked_node);
+        }
+    }
+    return nodes;
+}
+
+std::vector<std::weak_ptr<ov::Node>> ov::Model::get_ordered_ops_weak() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops_weak");
+    lock_guard<mutex> lock(m_topological_sort_mutex);
+
+    if (!m_shared_rt_info->get_use_topological_cache()) {
+        rebuild_topological_cache();
+    }
 
-    return order;
+    return m_cached_ordered_ops;
 }
 
 void ov::Model::map_unordered_ops(std::function<void(Node*)> f) const {
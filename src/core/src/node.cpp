@@ -180,6 +180,7 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
     for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
         info->set_use_topological_cache(false);
     });
+    m_validation_required = true;
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
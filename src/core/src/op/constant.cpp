@@ -209,6 +209,8 @@ ov::op::v0::Constant::Constant(const element::Type& type, const ov::Shape& shape
 ov::op::v0::Constant::Constant(const Constant& other) {
     m_element_type = other.m_element_type;
     m_shape = other.m_shape;
+    // the data buffer is shared, not copied: cloning a model must not duplicate its weights,
+    // and constants are never mutated in place
     m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
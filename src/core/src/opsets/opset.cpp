@@ -4,9 +4,16 @@
 
 #include "ngraph/opsets/opset.hpp"
 
+#include "itt.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 
+// Registration of an op in an opset is wrapped into a conditional compilation scope, so a
+// selective build keeps only the ops of the profiled models registered and lets the linker
+// drop the rest of the op code.
+#define INSERT_OP(OPSET_NAME, OP_NAME, OP_NAMESPACE) \
+    OV_SCOPE(ov_opset, OV_PP_CAT3(OPSET_NAME, _, OP_NAME)) { opset.insert<OP_NAMESPACE::OP_NAME>(); }
+
 ngraph::OpSet::OpSet(const ov::OpSet& opset) : ov::OpSet(opset) {}
 
 std::mutex& ov::OpSet::get_mutex() {
@@ -33,7 +40,7 @@ const ov::OpSet& ov::get_opset1() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset1, NAME, NAMESPACE)
 #include "openvino/opsets/opset1_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -44,7 +51,7 @@ const ov::OpSet& ov::get_opset2() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset2, NAME, NAMESPACE)
 #include "openvino/opsets/opset2_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -55,7 +62,7 @@ const ov::OpSet& ov::get_opset3() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset3, NAME, NAMESPACE)
 #include "openvino/opsets/opset3_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -66,7 +73,7 @@ const ov::OpSet& ov::get_opset4() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset4, NAME, NAMESPACE)
 #include "openvino/opsets/opset4_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -77,7 +84,7 @@ const ov::OpSet& ov::get_opset5() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset5, NAME, NAMESPACE)
 #include "openvino/opsets/opset5_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -88,7 +95,7 @@ const ov::OpSet& ov::get_opset6() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset6, NAME, NAMESPACE)
 #include "openvino/opsets/opset6_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -99,7 +106,7 @@ const ov::OpSet& ov::get_opset7() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset7, NAME, NAMESPACE)
 #include "openvino/opsets/opset7_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
@@ -110,7 +117,7 @@ const ov::OpSet& ov::get_opset8() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
-#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset8, NAME, NAMESPACE)
 #include "openvino/opsets/opset8_tbl.hpp"
 #undef _OPENVINO_OP_REG
     });
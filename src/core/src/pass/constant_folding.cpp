@@ -4,55 +4,201 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
 #include <ngraph/op/constant.hpp>
+#include <thread>
+#include <unordered_set>
 
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/squeeze.hpp"
+#include "ngraph/op/transpose.hpp"
+#include "ngraph/op/unsqueeze.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
 #include "ngraph/validation_util.hpp"
 
 using namespace std;
 
+namespace {
+// Folds that only reinterpret the data of a producer Constant are replaced with a view sharing
+// the original buffer (Constant keeps m_data by shared_ptr), so large precomputed tables are not
+// duplicated during compilation. Everything else goes through the generic evaluate-and-copy path.
+std::shared_ptr<ngraph::op::Constant> try_fold_by_aliasing(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_output_size() != 1 || node->get_output_partial_shape(0).is_dynamic())
+        return nullptr;
+    if (node->get_rt_info().count(ov::pass::DisableConstantFolding::get_type_info_static()))
+        return nullptr;
+    const auto constant = ov::as_type_ptr<ngraph::op::Constant>(node->input_value(0).get_node_shared_ptr());
+    if (!constant)
+        return nullptr;
+    if (node->get_output_element_type(0) != constant->get_element_type())
+        return nullptr;
+
+    bool reinterpret_only = false;
+    if (ov::is_type<ngraph::op::v1::Reshape>(node) || ov::is_type<ngraph::op::v0::Squeeze>(node) ||
+        ov::is_type<ngraph::op::v0::Unsqueeze>(node) || ov::is_type<ngraph::op::v0::Convert>(node)) {
+        reinterpret_only = true;
+    } else if (ov::is_type<ngraph::op::v1::Transpose>(node)) {
+        // a transpose cannot permute anything when the data is at most one-dimensional
+        reinterpret_only = constant->get_shape().size() <= 1;
+    }
+    if (!reinterpret_only)
+        return nullptr;
+
+    return std::make_shared<ngraph::op::Constant>(*constant, node->get_output_shape(0));
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& f) {
     bool rewritten = pre_calculated_values_folding(f);
 
+    auto apply_replacements = [&](const std::shared_ptr<Node>& node, OutputVector& replacements) {
+        NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                     "constant_fold_default returned incorrect number of replacements for ",
+                     node);
+
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            auto node_output = node->output(i);
+            auto replacement = replacements.at(i);
+            if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+                if (replacements.size() == 1) {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+                } else {
+                    replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
+                                                                         std::to_string(i));
+                }
+                node_output.replace(replacement);
+                // Propagate runtime info attributes to replacement consumer nodes
+                copy_runtime_info_to_target_inputs(node, replacement);
+
+                rewritten = true;
+            }
+        }
+    };
+
+    auto fold_subgraphs = [&](const std::shared_ptr<Node>& node) {
+        // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
+            size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
+            for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
+                rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
+            }
+        }
+    };
+
+    // Nodes whose inputs are all Constants evaluate independently of each other, so consecutive
+    // ones are collected into a batch and evaluated concurrently; the graph mutations (output
+    // replacement and rt_info propagation) stay on this thread. The batch is flushed as soon as
+    // some node consumes a batched result, which keeps the walk semantically identical to the
+    // sequential one: chains degenerate to batches of one, while wide fan-outs of precomputed
+    // tables - where the folding wall time is actually spent - evaluate in parallel.
+    std::vector<std::shared_ptr<Node>> batch;
+    std::unordered_set<ov::Node*> batch_members;
+
+    auto flush_batch = [&]() {
+        if (batch.empty())
+            return;
+
+        std::vector<OutputVector> replacements(batch.size());
+        std::vector<char> folded(batch.size(), 0);
+        auto evaluate_range = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                replacements[i].resize(batch[i]->get_output_size());
+                folded[i] = batch[i]->constant_fold(replacements[i], batch[i]->input_values());
+            }
+        };
+
+        // spawning threads only pays off when there is enough independent work per thread:
+        // batches below the threshold (the common case) are evaluated inline and never spawn,
+        // and the rare large batches amortize thread startup over at least folds_per_thread
+        // tensor evaluations each, so a pool persisting across flushes is not worth carrying
+        constexpr size_t folds_per_thread = 4;
+        const size_t max_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        const size_t num_threads = std::min(max_threads, batch.size() / folds_per_thread);
+        if (num_threads < 2) {
+            evaluate_range(0, batch.size());
+        } else {
+            std::vector<std::thread> workers;
+            // an exception escaping a thread callable would terminate the process, so workers
+            // park it and the calling thread rethrows after the join, as the sequential path
+            // would have reported it
+            std::vector<std::exception_ptr> errors(num_threads);
+            workers.reserve(num_threads);
+            const size_t chunk = (batch.size() + num_threads - 1) / num_threads;
+            for (size_t t = 0; t < num_threads; ++t) {
+                const size_t begin = t * chunk;
+                const size_t end = std::min(begin + chunk, batch.size());
+                workers.emplace_back([&, t, begin, end] {
+                    try {
+                        evaluate_range(begin, end);
+                    } catch (...) {
+                        errors[t] = std::current_exception();
+                    }
+                });
+            }
+            for (auto& worker : workers)
+                worker.join();
+            for (auto& error : errors) {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (folded[i]) {
+                apply_replacements(batch[i], replacements[i]);
+            } else {
+                fold_subgraphs(batch[i]);
+            }
+        }
+        batch.clear();
+        batch_members.clear();
+    };
+
     for (const auto& node : f->get_ordered_ops()) {
+        bool depends_on_batch = false;
+        for (const auto& input_value : node->input_values()) {
+            if (batch_members.count(input_value.get_node())) {
+                depends_on_batch = true;
+                break;
+            }
+        }
+        if (depends_on_batch)
+            flush_batch();
+
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
+        if (auto aliased = try_fold_by_aliasing(node)) {
+            aliased->set_friendly_name(node->get_friendly_name());
+            node->output(0).replace(aliased);
+            copy_runtime_info_to_target_inputs(node, aliased);
+            rewritten = true;
+            continue;
+        }
+
+        const auto& input_values = node->input_values();
+        const bool all_constant_inputs =
+            !input_values.empty() &&
+            std::all_of(input_values.begin(), input_values.end(), [](const Output<Node>& input) {
+                return ov::is_type<ngraph::op::Constant>(input.get_node());
+            });
+        if (all_constant_inputs) {
+            batch.push_back(node);
+            batch_members.insert(node.get());
+            continue;
+        }
+
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values())) {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    if (replacements.size() == 1) {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
-                    } else {
-                        replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name() + "." +
-                                                                             std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+            apply_replacements(node, replacements);
         } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ngraph::op::util::MultiSubGraphOp>(node)) {
-                size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
-                for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
-                    rewritten |= run_on_model(sub_graph_node->get_function(sub_graph_ind));
-                }
-            }
+            fold_subgraphs(node);
         }
     }
+    flush_batch();
 
     return rewritten;
 }
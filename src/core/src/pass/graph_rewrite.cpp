@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <iterator>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
 #include <unordered_set>
@@ -57,47 +58,21 @@ PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
-}  // namespace
-}  // namespace pass
-}  // namespace ov
-
-bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    // Initialize execution queue with nodes in topological order
-    std::deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
-        nodes_to_run.emplace_front(node);
-    }
-    return apply_matcher_passes(f, std::move(nodes_to_run));
-}
-
-bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
-    // Initialize execution queue with nodes in topological order
-    std::deque<std::weak_ptr<Node>> nodes_to_run;
-    for (auto& node : f->get_ordered_ops()) {
-        nodes_to_run.emplace_back(node);
-    }
-    return apply_matcher_passes(f, std::move(nodes_to_run));
-}
 
-bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
-                                                  std::deque<std::weak_ptr<Node>> nodes_to_run) {
-    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
-
-    bool rewritten = false;
-    const auto& pass_config = get_pass_config();
-
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
-    for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+// Collects root node types of the registered (and enabled) MatcherPasses into type_to_matcher.
+// Returns false when some matcher root has no extractable type, in which case every matcher has
+// to be tried on every node and the map content is meaningless.
+bool build_type_to_matcher(const std::vector<std::shared_ptr<MatcherPass>>& matchers,
+                           const std::shared_ptr<PassConfig>& pass_config,
+                           std::unordered_map<NodeTypeInfo, std::vector<size_t>>& type_to_matcher) {
+    for (size_t matcher_index = 0; matcher_index < matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
-        if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
+        if (pass_config->is_disabled(matchers[matcher_index]->get_type_info()))
             continue;
 
-        auto matcher = m_matchers[matcher_index]->get_matcher();
+        auto matcher = matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            return false;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -117,8 +92,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
-                break;
+                return false;
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
@@ -127,6 +101,64 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
         // including ones triggered by parent type info.
     }
+    return true;
+}
+}  // namespace
+}  // namespace pass
+}  // namespace ov
+
+bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    // Initialize execution queue with nodes in topological order; the queue holds weak
+    // pointers anyway, so the order is taken from the Model's cache without locking a
+    // shared_ptr per node in between
+    auto ordered_ops = f->get_ordered_ops_weak();
+    std::deque<std::weak_ptr<Node>> nodes_to_run(std::make_move_iterator(ordered_ops.rbegin()),
+                                                 std::make_move_iterator(ordered_ops.rend()));
+    return apply_matcher_passes(f, std::move(nodes_to_run));
+}
+
+bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    // When every enabled matcher has a type based root node only nodes of those types (and their
+    // derived types) can trigger a match, so the execution queue is seeded from the Model's type
+    // index instead of the full graph. Sub-graph based nodes are always kept in the queue to not
+    // lose the recursive processing of their bodies. The shape inference mode still needs to
+    // revalidate every node and keeps the full traversal.
+    if (!m_enable_shape_inference) {
+        std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+        if (build_type_to_matcher(m_matchers, get_pass_config(), type_to_matcher)) {
+            std::vector<NodeTypeInfo> types;
+            types.reserve(type_to_matcher.size() + 1);
+            for (const auto& it : type_to_matcher) {
+                types.push_back(it.first);
+            }
+            types.push_back(ngraph::op::util::MultiSubGraphOp::get_type_info_static());
+
+            std::deque<std::weak_ptr<Node>> nodes_to_run;
+            for (auto& node : f->get_ordered_ops_by_types(types)) {
+                nodes_to_run.emplace_back(node);
+            }
+            return apply_matcher_passes(f, std::move(nodes_to_run));
+        }
+    }
+
+    // Initialize execution queue with nodes in topological order; as above, the weak
+    // pointers are taken straight from the Model's cache
+    auto ordered_ops = f->get_ordered_ops_weak();
+    std::deque<std::weak_ptr<Node>> nodes_to_run(std::make_move_iterator(ordered_ops.begin()),
+                                                 std::make_move_iterator(ordered_ops.end()));
+    return apply_matcher_passes(f, std::move(nodes_to_run));
+}
+
+bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
+                                                  std::deque<std::weak_ptr<Node>> nodes_to_run) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
+
+    bool rewritten = false;
+    const auto& pass_config = get_pass_config();
+
+    // Check that all Matchers in MatcherPasses has type bases root node
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    const bool all_roots_has_type = build_type_to_matcher(m_matchers, pass_config, type_to_matcher);
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
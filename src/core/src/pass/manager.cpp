@@ -5,11 +5,18 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
 
 #include "itt.hpp"
 #include "ngraph/function.hpp"
@@ -32,6 +39,51 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+// resident set size as a cheap allocation-volume proxy; hooking the allocator itself would
+// distort exactly the compile times being measured
+size_t current_rss_kb() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * (getpagesize() / 1024);
+#else
+    return 0;
+#endif
+}
+
+struct PassProfileEntry {
+    std::string name;
+    double milliseconds;
+    size_t nodes_before;
+    size_t nodes_after;
+    long long rss_delta_kb;
+};
+
+void dump_pass_profile_json(const std::string& prefix,
+                            const std::string& model_name,
+                            double total_milliseconds,
+                            const std::vector<PassProfileEntry>& entries) {
+    // one file per run_passes call, so concurrently compiled models do not interleave
+    static std::atomic<size_t> run_counter{0};
+    const std::string path = prefix + "_" + std::to_string(run_counter++) + ".json";
+    std::ofstream file(path);
+    if (!file) {
+        NGRAPH_DEBUG << "Cannot open pass profile report file " << path;
+        return;
+    }
+    file << "{\n\"model\": \"" << model_name << "\",\n";
+    file << "\"total_ms\": " << total_milliseconds << ",\n";
+    file << "\"passes\": [\n";
+    for (size_t i = 0; i < entries.size(); i++) {
+        const auto& entry = entries[i];
+        file << "{\"name\": \"" << entry.name << "\", \"ms\": " << entry.milliseconds
+             << ", \"nodes_before\": " << entry.nodes_before << ", \"nodes_after\": " << entry.nodes_after
+             << ", \"rss_delta_kb\": " << entry.rss_delta_kb << "}" << (i + 1 < entries.size() ? "," : "") << "\n";
+    }
+    file << "]\n}\n";
+}
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -53,6 +105,10 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "pass::Manager::run_passes");
 
     static bool profile_enabled = ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    // per-pass wall time, node-count delta and RSS delta, dumped as <prefix>_<n>.json
+    static const std::string profile_json_prefix = ov::util::getenv_string("NGRAPH_PROFILE_PASS_JSON");
+    const bool profile_json_enabled = !profile_json_prefix.empty();
+    std::vector<PassProfileEntry> profile_entries;
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
@@ -67,6 +123,9 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
 
+        const size_t nodes_before = profile_json_enabled ? func->get_ops().size() : 0;
+        const size_t rss_before_kb = profile_json_enabled ? current_rss_kb() : 0;
+
         pass_timer.start();
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
@@ -127,9 +186,22 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
+        if (profile_json_enabled) {
+            profile_entries.push_back({pass->get_name(),
+                                       static_cast<double>(pass_timer.get_microseconds()) / 1000.0,
+                                       nodes_before,
+                                       func->get_ops().size(),
+                                       static_cast<long long>(current_rss_kb()) - static_cast<long long>(rss_before_kb)});
+        }
     }
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
+    if (profile_json_enabled) {
+        dump_pass_profile_json(profile_json_prefix,
+                               func->get_name(),
+                               static_cast<double>(overall_timer.get_microseconds()) / 1000.0,
+                               profile_entries);
+    }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
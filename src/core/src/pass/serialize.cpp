@@ -12,7 +12,9 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "binary_xml_codec.hpp"
 #include "itt.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset.hpp"
 #include "ngraph/opsets/opset1.hpp"
@@ -86,11 +88,26 @@ public:
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_write_aligned(ngraph::getenv_bool("OV_SERIALIZE_ALIGNED_WEIGHTS")),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+        FilePosition write_pos = m_binary_output.tellp();
+        auto offset = write_pos - m_blob_offset;
+        if (m_write_aligned) {
+            // Pad the blob so each constant starts on a 64-byte boundary: readers
+            // which map the .bin file can then reference constants in place without
+            // violating alignment expected by vectorized kernels. Offsets recorded
+            // in the XML already account for the padding, so the format stays
+            // compatible with existing loaders.
+            static const char zeros[alignment] = {};
+            const auto padding = (alignment - offset % alignment) % alignment;
+            if (padding) {
+                m_binary_output.write(zeros, padding);
+                write_pos += padding;
+                offset += padding;
+            }
+        }
         if (!m_enable_compression) {
             m_binary_output.write(ptr, size);
             return offset;
@@ -113,12 +130,17 @@ public:
     }
 
 private:
+    static constexpr size_t alignment = 64;
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_write_aligned;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
+constexpr size_t ConstantWriter::alignment;
+
 void ngfunction_2_ir(pugi::xml_node& node,
                      const ngraph::Function& f,
                      const std::map<std::string, ngraph::OpSet>& custom_opsets,
@@ -952,13 +974,18 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
     }
 }
 
+bool is_binary_ir_path(const std::string& path) {
+    const char* const extension = ".bir";
+    return path.length() > 4 && path.rfind(extension) == path.size() - std::strlen(extension);
+}
+
 std::string valid_xml_path(const std::string& path) {
     NGRAPH_CHECK(path.length() > 4, "Path for xml file is to short: \"" + path + "\"");
 
     const char* const extension = ".xml";
     const bool has_xml_extension = path.rfind(extension) == path.size() - std::strlen(extension);
-    NGRAPH_CHECK(has_xml_extension,
-                 "Path for xml file doesn't contains file name with 'xml' extension: \"" + path + "\"");
+    NGRAPH_CHECK(has_xml_extension || is_binary_ir_path(path),
+                 "Path for model file doesn't contain a file name with an 'xml' or 'bir' extension: \"" + path + "\"");
     return path;
 }
 
@@ -979,7 +1006,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool binary_topology = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1004,7 +1032,12 @@ void serializeFunc(std::ostream& xml_file,
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
-    xml_doc.save(xml_file);
+    if (binary_topology) {
+        // pre-parsed form of the same document: reading it back skips the xml tokenization
+        ov::binary_xml::encode(xml_doc, xml_file);
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1019,12 +1052,13 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
         std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
-        // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        // create xml file; a '.bir' path selects the binary pre-parsed topology form
+        const bool binary_topology = is_binary_ir_path(m_xmlPath);
+        std::ofstream xml_file(m_xmlPath, binary_topology ? std::ios::out | std::ios::binary : std::ios::out);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets);
+            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets, false, binary_topology);
         } catch (const ngraph::CheckFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
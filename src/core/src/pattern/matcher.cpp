@@ -49,7 +49,10 @@ MatcherState::~MatcherState() {
                                                   m_pattern_value_maps.end());
         }
 
-        m_matcher->m_pattern_map = m_pattern_value_map;
+        // The snapshot is not used after restoration, so move it back instead of
+        // copying: match failures are the common case and used to pay one heap
+        // allocation per captured value here.
+        m_matcher->m_pattern_map = std::move(m_pattern_value_map);
     }
 }
 
@@ -77,9 +80,9 @@ Output<Node> Matcher::get_match_value() {
     return m_match_root;
 }
 void Matcher::capture(const std::set<Node*>& static_nodes) {
-    m_pattern_value_maps.push_back(m_pattern_map);
+    m_pattern_value_maps.push_back(std::move(m_pattern_map));
     m_pattern_map.clear();
-    for (auto key_value : m_pattern_value_maps.back()) {
+    for (const auto& key_value : m_pattern_value_maps.back()) {
         if (static_nodes.count(key_value.first.get()) > 0) {
             m_pattern_map.insert(key_value);
         }
@@ -133,37 +136,46 @@ bool Matcher::match_permutation(const OutputVector& pattern_args, const OutputVe
 bool Matcher::match_arguments(Node* pattern_node, const std::shared_ptr<Node>& graph_node) {
     NGRAPH_DEBUG << "[MATCHER] Match arguments at " << *graph_node << " for pattern " << *pattern_node;
 
-    auto args = graph_node->input_values();
-    auto pattern_args = pattern_node->input_values();
-
-    if (args.size() != pattern_args.size()) {
+    if (graph_node->get_input_size() != pattern_node->get_input_size()) {
         NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
         return false;
     }
 
-    if (ngraph::op::is_commutative(graph_node)) {
-        // TODO: [nikolayk] we don't really have to use lexicographically-based perms,
-        // heap's algo should be faster
-        std::sort(begin(pattern_args),
-                  end(pattern_args),
-                  [](const ngraph::Output<ngraph::Node>& n1, const ngraph::Output<ngraph::Node>& n2) {
-                      return n1 < n2;
-                  });
-        do {
-            auto saved = start_match();
-            if (match_permutation(pattern_args, args)) {
-                return saved.finish(true);
+    if (!ngraph::op::is_commutative(graph_node)) {
+        // Avoid materializing argument vectors on this hot path: matching runs once
+        // per node per registered pattern, so these two copies used to dominate the
+        // transient allocations of a GraphRewrite scan.
+        for (size_t i = 0; i < graph_node->get_input_size(); i++) {
+            if (!match_value(pattern_node->input_value(i), graph_node->input_value(i))) {
+                NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
+                return false;
             }
-        } while (
-            std::next_permutation(begin(pattern_args),
-                                  end(pattern_args),
-                                  [](const ngraph::Output<ngraph::Node>& n1, const ngraph::Output<ngraph::Node>& n2) {
-                                      return n1 < n2;
-                                  }));
-    } else {
-        return match_permutation(pattern_args, args);
+        }
+        return true;
     }
 
+    auto args = graph_node->input_values();
+    auto pattern_args = pattern_node->input_values();
+
+    // TODO: [nikolayk] we don't really have to use lexicographically-based perms,
+    // heap's algo should be faster
+    std::sort(begin(pattern_args),
+              end(pattern_args),
+              [](const ngraph::Output<ngraph::Node>& n1, const ngraph::Output<ngraph::Node>& n2) {
+                  return n1 < n2;
+              });
+    do {
+        auto saved = start_match();
+        if (match_permutation(pattern_args, args)) {
+            return saved.finish(true);
+        }
+    } while (
+        std::next_permutation(begin(pattern_args),
+                              end(pattern_args),
+                              [](const ngraph::Output<ngraph::Node>& n1, const ngraph::Output<ngraph::Node>& n2) {
+                                  return n1 < n2;
+                              }));
+
     NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
     return false;
 }
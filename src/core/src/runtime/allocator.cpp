@@ -4,13 +4,105 @@
 
 #include "openvino/runtime/allocator.hpp"
 
+#include <algorithm>
+#include <cstdint>
+
 #include "blob_allocator.hpp"
 #include "ie_allocator.hpp"
 #include "ie_common.h"
 #include "openvino/core/except.hpp"
 
+#ifdef __linux__
+#    include <sys/mman.h>
+#endif
+
 namespace ov {
 
+namespace {
+
+struct AlignedSystemAllocator : public AllocatorImpl {
+    explicit AlignedSystemAllocator(size_t alignment) : m_alignment{alignment} {
+        OPENVINO_ASSERT(m_alignment != 0 && (m_alignment & (m_alignment - 1)) == 0,
+                        "Alignment must be a power of two, got ",
+                        m_alignment);
+    }
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        size_t align = std::max({m_alignment, alignment, alignof(void*)});
+        OPENVINO_ASSERT((align & (align - 1)) == 0, "Alignment must be a power of two, got ", align);
+        // over-allocate and stash the raw pointer right before the aligned block
+        auto raw = reinterpret_cast<uintptr_t>(::operator new(bytes + align + sizeof(void*)));
+        auto aligned = (raw + sizeof(void*) + align - 1) & ~(align - 1);
+        reinterpret_cast<void**>(aligned)[-1] = reinterpret_cast<void*>(raw);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void deallocate(void* handle, const size_t, size_t) override {
+        ::operator delete(static_cast<void**>(handle)[-1]);
+    }
+
+    bool is_equal(const AllocatorImpl& other) const override {
+        // the raw pointer is recovered from the block itself, so any instance can free it
+        return dynamic_cast<const AlignedSystemAllocator*>(&other) != nullptr;
+    }
+
+private:
+    size_t m_alignment;
+};
+
+#ifdef __linux__
+
+struct HugePageAllocator : public AllocatorImpl {
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        OPENVINO_ASSERT(alignment <= huge_page_size, "Unsupported alignment for huge pages: ", alignment);
+        const size_t length = round_up(bytes);
+#    ifdef MAP_HUGETLB
+        void* handle =
+            mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (handle != MAP_FAILED)
+            return handle;
+#    endif
+        // no explicit huge pages reserved - take regular pages and ask for transparent ones
+        void* handle2 = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        OPENVINO_ASSERT(handle2 != MAP_FAILED, "Can not allocate storage for at least ", bytes, " bytes");
+#    ifdef MADV_HUGEPAGE
+        madvise(handle2, length, MADV_HUGEPAGE);
+#    endif
+        return handle2;
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t) override {
+        munmap(handle, round_up(bytes));
+    }
+
+    bool is_equal(const AllocatorImpl& other) const override {
+        return dynamic_cast<const HugePageAllocator*>(&other) != nullptr;
+    }
+
+private:
+    static size_t round_up(size_t bytes) {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+};
+
+#endif  // __linux__
+
+}  // namespace
+
+Allocator make_aligned_allocator(size_t alignment) {
+    return Allocator{std::make_shared<AlignedSystemAllocator>(alignment)};
+}
+
+Allocator make_huge_page_allocator() {
+#ifdef __linux__
+    return Allocator{std::make_shared<HugePageAllocator>()};
+#else
+    return Allocator{std::make_shared<AlignedSystemAllocator>(2 * 1024 * 1024)};
+#endif
+}
+
 Allocator::Allocator() : _impl{std::make_shared<BlobAllocator>()} {}
 
 Allocator::~Allocator() {
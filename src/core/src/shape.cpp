@@ -21,8 +21,12 @@ ov::Shape::Shape(const std::initializer_list<size_t>& axis_lengths) : std::vecto
 
 ov::Shape::Shape(const std::vector<size_t>& axis_lengths) : std::vector<size_t>(axis_lengths) {}
 
+ov::Shape::Shape(std::vector<size_t>&& axis_lengths) noexcept : std::vector<size_t>(std::move(axis_lengths)) {}
+
 ov::Shape::Shape(const Shape& axis_lengths) = default;
 
+ov::Shape::Shape(Shape&& axis_lengths) noexcept = default;
+
 ov::Shape::Shape(size_t n, size_t initial_value) : std::vector<size_t>(n, initial_value) {}
 
 ov::Shape::~Shape() = default;
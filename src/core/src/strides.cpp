@@ -19,8 +19,12 @@ ov::Strides::Strides(const std::initializer_list<size_t>& axis_strides) : std::v
 
 ov::Strides::Strides(const std::vector<size_t>& axis_strides) : std::vector<size_t>(axis_strides) {}
 
+ov::Strides::Strides(std::vector<size_t>&& axis_strides) noexcept : std::vector<size_t>(std::move(axis_strides)) {}
+
 ov::Strides::Strides(const Strides& axis_strides) : std::vector<size_t>(axis_strides) {}
 
+ov::Strides::Strides(Strides&& axis_strides) noexcept = default;
+
 ov::Strides::Strides(size_t n, size_t initial_value) : std::vector<size_t>(n, initial_value) {}
 
 ov::Strides& ov::Strides::operator=(const Strides& v) {
@@ -29,7 +33,7 @@ ov::Strides& ov::Strides::operator=(const Strides& v) {
 }
 
 ov::Strides& ov::Strides::operator=(Strides&& v) noexcept {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -3262,3 +3262,182 @@ TEST(constant_folding, constant_loop) {
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, fold_batch_of_independent_nodes) {
+    // a wide fan-out of independent constant expressions is collected into one batch and
+    // evaluated concurrently; every fold must land on its own result with its own name
+    const size_t num_folds = 32;
+    ResultVector results;
+    for (size_t i = 0; i < num_folds; ++i) {
+        auto a = op::Constant::create(element::f32,
+                                      Shape{2},
+                                      {static_cast<float>(i), static_cast<float>(i) + 0.5f});
+        auto b = op::Constant::create(element::f32, Shape{2}, {1.0f, 2.0f});
+        auto add = make_shared<opset5::Add>(a, b);
+        add->set_friendly_name("add_" + std::to_string(i));
+        results.push_back(make_shared<opset5::Result>(add));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<opset5::Add>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), num_folds);
+    for (size_t i = 0; i < num_folds; ++i) {
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results().at(i)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        EXPECT_EQ(new_const->get_friendly_name(), "add_" + std::to_string(i));
+        const vector<float> expected{static_cast<float>(i) + 1.0f, static_cast<float>(i) + 2.5f};
+        EXPECT_TRUE(test::all_close_f(expected, new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST(constant_folding, fold_batch_flushed_before_consumer) {
+    // a chain of dependent folds forces the pending batch to be flushed before each consumer,
+    // while the independent expressions around the chain still fold in batches
+    auto c1 = op::Constant::create(element::f32, Shape{2}, {1.0f, 2.0f});
+    auto c2 = op::Constant::create(element::f32, Shape{2}, {3.0f, 4.0f});
+    auto c3 = op::Constant::create(element::f32, Shape{2}, {5.0f, 6.0f});
+    auto c4 = op::Constant::create(element::f32, Shape{2}, {7.0f, 8.0f});
+    auto add1 = make_shared<opset5::Add>(c1, c2);
+    auto add2 = make_shared<opset5::Add>(add1, c3);
+    auto add3 = make_shared<opset5::Add>(add2, c4);
+    add3->set_friendly_name("chain");
+
+    ResultVector results{make_shared<opset5::Result>(add3)};
+    const size_t num_independent = 8;
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto a = op::Constant::create(element::f32, Shape{2}, {static_cast<float>(i), 0.0f});
+        auto b = op::Constant::create(element::f32, Shape{2}, {0.0f, static_cast<float>(i)});
+        results.push_back(make_shared<opset5::Result>(make_shared<opset5::Add>(a, b)));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<opset5::Add>(f), 0);
+
+    auto chain_const = ov::as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(chain_const);
+    EXPECT_EQ(chain_const->get_friendly_name(), "chain");
+    const vector<float> expected_chain{16.0f, 20.0f};
+    EXPECT_TRUE(test::all_close_f(expected_chain, chain_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto new_const =
+            ov::as_type_ptr<op::Constant>(f->get_results().at(i + 1)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        const vector<float> expected{static_cast<float>(i), static_cast<float>(i)};
+        EXPECT_TRUE(test::all_close_f(expected, new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST(constant_folding, fold_batch_with_constant_loop) {
+    // a subgraph op whose inputs are all constants lands inside a batch together with the
+    // surrounding independent folds and must evaluate there like in the sequential walk
+    auto X = make_shared<opset5::Constant>(element::f32, Shape{2, 1, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
+    auto Y = make_shared<opset5::Constant>(element::f32, Shape{1, 1, 3}, std::vector<int64_t>{1, 2, 3});
+
+    auto Xi = make_shared<opset5::Parameter>(element::f32, PartialShape::dynamic());
+    auto Yi = make_shared<opset5::Parameter>(element::f32, PartialShape::dynamic());
+    auto body_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+
+    auto trip_count = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, 2);
+    auto exec_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+    auto sum = make_shared<ngraph::opset5::Add>(Xi, Yi);
+    auto body = make_shared<ngraph::Function>(OutputVector{body_condition, sum}, ParameterVector{Xi, Yi});
+    auto loop = make_shared<opset5::Loop>(trip_count, exec_condition);
+    loop->set_function(body);
+    loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 0});
+
+    loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    loop->set_invariant_input(Yi, Y);
+
+    auto out = loop->get_concatenated_slices(sum, 0, 1, 1, -1, 0);
+
+    ResultVector results{make_shared<opset5::Result>(out)};
+    const size_t num_independent = 8;
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto a = op::Constant::create(element::f32, Shape{2}, {static_cast<float>(i), 0.0f});
+        auto b = op::Constant::create(element::f32, Shape{2}, {0.0f, static_cast<float>(i)});
+        results.push_back(make_shared<opset5::Result>(make_shared<opset5::Add>(a, b)));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<ngraph::opset5::Loop>(f), 0);
+
+    auto loop_const = ov::as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(loop_const);
+    ASSERT_EQ(Shape({2, 1, 3}), loop_const->get_output_shape(0));
+    std::vector<float> expected_loop{1, 3, 5, 4, 6, 8};
+    range_test_check(loop_const->cast_vector<float>(), expected_loop);
+
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto new_const =
+            ov::as_type_ptr<op::Constant>(f->get_results().at(i + 1)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        const vector<float> expected{static_cast<float>(i), static_cast<float>(i)};
+        EXPECT_TRUE(test::all_close_f(expected, new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST(constant_folding, fold_batch_failed_fold_recurses_into_subgraph) {
+    // a batched node whose own folding fails (here: disabled on a Loop) must survive the batch
+    // untouched, and the pass must still recurse into its body to fold what it can there
+    auto X = make_shared<opset5::Constant>(element::f32, Shape{2, 1, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
+
+    auto Xi = make_shared<opset5::Parameter>(element::f32, PartialShape::dynamic());
+    auto body_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+
+    auto trip_count = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, 2);
+    auto exec_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+    // the body contains its own foldable constant expression
+    auto body_a = op::Constant::create(element::f32, Shape{1, 1, 3}, {1.0f, 1.0f, 1.0f});
+    auto body_b = op::Constant::create(element::f32, Shape{1, 1, 3}, {0.0f, 1.0f, 2.0f});
+    auto body_offset = make_shared<opset5::Add>(body_a, body_b);
+    auto sum = make_shared<ngraph::opset5::Add>(Xi, body_offset);
+    auto body = make_shared<ngraph::Function>(OutputVector{body_condition, sum}, ParameterVector{Xi});
+    auto loop = make_shared<opset5::Loop>(trip_count, exec_condition);
+    loop->set_function(body);
+    loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 0});
+    loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    loop->get_rt_info()[ov::pass::DisableConstantFolding::get_type_info_static()];
+
+    auto out = loop->get_concatenated_slices(sum, 0, 1, 1, -1, 0);
+
+    ResultVector results{make_shared<opset5::Result>(out)};
+    const size_t num_independent = 8;
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto a = op::Constant::create(element::f32, Shape{2}, {static_cast<float>(i), 0.0f});
+        auto b = op::Constant::create(element::f32, Shape{2}, {0.0f, static_cast<float>(i)});
+        results.push_back(make_shared<opset5::Result>(make_shared<opset5::Add>(a, b)));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // the disabled Loop is kept, the sibling folds went through
+    ASSERT_EQ(count_ops_of_type<ngraph::opset5::Loop>(f), 1);
+    EXPECT_EQ(count_ops_of_type<opset5::Add>(f), 0);
+
+    // the constant expression inside the body was folded while the data-dependent one remains
+    EXPECT_EQ(count_ops_of_type<opset5::Add>(loop->get_function()), 1);
+
+    for (size_t i = 0; i < num_independent; ++i) {
+        auto new_const =
+            ov::as_type_ptr<op::Constant>(f->get_results().at(i + 1)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        const vector<float> expected{static_cast<float>(i), static_cast<float>(i)};
+        EXPECT_TRUE(test::all_close_f(expected, new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
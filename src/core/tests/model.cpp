@@ -1523,3 +1523,78 @@ TEST(model, set_batch_size_validation_throw) {
         FAIL() << "Expected ov::Exception";
     }
 }
+
+TEST(model, clone_shares_constant_data) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+    auto constant = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, 3}, {1, 2, 3});
+    auto add = std::make_shared<ov::opset8::Add>(arg0, constant);
+    auto model = std::make_shared<ov::Model>(add, ov::ParameterVector{arg0});
+
+    auto cloned = model->clone();
+
+    std::shared_ptr<ov::opset8::Constant> cloned_constant;
+    for (const auto& op : cloned->get_ops()) {
+        if (auto c = std::dynamic_pointer_cast<ov::opset8::Constant>(op))
+            cloned_constant = c;
+    }
+    ASSERT_NE(cloned_constant, nullptr);
+    // cloning copies the node but not the data: both constants must point at the same buffer
+    EXPECT_EQ(cloned_constant->get_data_ptr(), constant->get_data_ptr());
+}
+
+TEST(model, clone_structure_is_isolated) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto model = std::make_shared<ov::Model>(relu, ov::ParameterVector{arg0});
+
+    auto cloned = model->clone();
+
+    std::shared_ptr<ov::opset8::Relu> cloned_relu;
+    for (const auto& op : cloned->get_ops()) {
+        if (auto r = std::dynamic_pointer_cast<ov::opset8::Relu>(op))
+            cloned_relu = r;
+    }
+    ASSERT_NE(cloned_relu, nullptr);
+    EXPECT_NE(cloned_relu, relu);
+
+    auto sigmoid = std::make_shared<ov::opset8::Sigmoid>(cloned_relu->input_value(0));
+    cloned->replace_node(cloned_relu, sigmoid);
+    cloned->validate_nodes_and_infer_types();
+
+    auto count_ops = [](const std::shared_ptr<ov::Model>& m, const ov::DiscreteTypeInfo& type) {
+        size_t count = 0;
+        for (const auto& op : m->get_ops())
+            count += (op->get_type_info() == type);
+        return count;
+    };
+    // the clone was rewritten, the original must be untouched
+    EXPECT_EQ(count_ops(cloned, ov::opset8::Sigmoid::get_type_info_static()), 1);
+    EXPECT_EQ(count_ops(cloned, ov::opset8::Relu::get_type_info_static()), 0);
+    EXPECT_EQ(count_ops(model, ov::opset8::Relu::get_type_info_static()), 1);
+    EXPECT_EQ(count_ops(model, ov::opset8::Sigmoid::get_type_info_static()), 0);
+}
+
+TEST(model, revalidation_picks_up_parameter_mutation) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto model = std::make_shared<ov::Model>(relu, ov::ParameterVector{arg0});
+    EXPECT_EQ(model->output(0).get_partial_shape(), (ov::PartialShape{1, 3}));
+
+    // in-place attribute mutation must be propagated by the next validation sweep
+    arg0->set_partial_shape(ov::PartialShape{2, 5});
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(model->output(0).get_partial_shape(), (ov::PartialShape{2, 5}));
+
+    arg0->set_element_type(ov::element::f16);
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(model->output(0).get_element_type(), ov::element::f16);
+}
+
+TEST(model, reshape_propagates_to_results) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 224, 224});
+    auto relu = std::make_shared<ov::opset8::Relu>(arg0);
+    auto model = std::make_shared<ov::Model>(relu, ov::ParameterVector{arg0});
+
+    model->reshape(ov::PartialShape{2, 3, 112, 112});
+    EXPECT_EQ(model->output(0).get_partial_shape(), (ov::PartialShape{2, 3, 112, 112}));
+}
@@ -5,13 +5,17 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <future>
 #include <vector>
 
+#include "binary_xml_codec.hpp"
 #include "input_model.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "so_extension.hpp"
 #include "xml_parse_utils.h"
 
@@ -39,6 +43,11 @@ size_t GetIRVersion(std::istream& model) {
     model.clear();
     model.seekg(0, model.beg);
 
+    if (ov::binary_xml::has_codec_magic(header.data(), header.size())) {
+        // the binary topology form carries the IR version in its header
+        return ov::binary_xml::decode_document_version(header.data(), header.size());
+    }
+
     pugi::xml_document doc;
     auto res =
         doc.load_buffer(header.data(), header.size(), pugi::parse_default | pugi::parse_fragment, pugi::encoding_utf8);
@@ -115,6 +124,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ngraph::runtime::AlignedBuffer> weights;
+    std::shared_future<std::shared_ptr<ngraph::runtime::AlignedBuffer>> weights_future;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -127,9 +137,14 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 
     auto create_input_model = [&]() -> std::shared_ptr<InputModel> {
         if (provided_model_stream) {
+            if (weights_future.valid())
+                return std::make_shared<InputModel>(*provided_model_stream, weights_future, create_extensions_map());
             return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map());
         } else if (local_model_stream.is_open()) {
-            auto input_model = std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
+            auto input_model =
+                weights_future.valid()
+                    ? std::make_shared<InputModel>(local_model_stream, weights_future, create_extensions_map())
+                    : std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
             local_model_stream.close();
             return input_model;
         }
@@ -199,27 +214,50 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
+        // The .bin content is not needed before the constants are deserialized, so the
+        // load runs on a background thread and overlaps with the xml parse below; the
+        // model conversion joins the future (and re-throws any I/O error) on first use.
+        weights_future =
+            std::async(std::launch::async,
+                       [weights_path]() -> std::shared_ptr<ngraph::runtime::AlignedBuffer> {
+                           if (ov::util::getenv_bool("OV_IR_MMAP_WEIGHTS", true)) {
+                               // Zero-copy mode: constants wrap file-backed pages directly, so reading
+                               // a model does not duplicate the .bin content on the heap. The mapping
+                               // is kept alive by the shared buffer which outlives all constants.
+                               auto mapped_memory = ov::util::load_mmap_object(weights_path);
+                               return std::make_shared<
+                                   ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                                   mapped_memory->data(),
+                                   mapped_memory->size(),
+                                   mapped_memory);
+                           }
+
+                           std::ifstream bin_stream;
+                           bin_stream.open(weights_path, std::ios::binary);
+                           if (!bin_stream.is_open())
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
+                               IE_THROW()
+                                   << "Weights file " + ov::util::wstring_to_string(weights_path) +
+                                          " cannot be opened!";
 #else
-            IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
+                               IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
 #endif
 
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
-
-        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+                           bin_stream.seekg(0, std::ios::end);
+                           size_t file_size = bin_stream.tellg();
+                           bin_stream.seekg(0, std::ios::beg);
+
+                           auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
+                           bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+                           bin_stream.close();
+
+                           return std::make_shared<
+                               ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                               aligned_weights_buffer->get_ptr<char>(),
+                               aligned_weights_buffer->size(),
+                               aligned_weights_buffer);
+                       })
+                .share();
     }
 
     return create_input_model();
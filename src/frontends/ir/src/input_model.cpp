@@ -11,6 +11,7 @@
 #include <openvino/op/util/framework_node.hpp>
 #include <pugixml.hpp>
 
+#include "binary_xml_codec.hpp"
 #include "openvino/core/validation_util.hpp"
 
 using namespace ngraph;
@@ -190,6 +191,7 @@ namespace ir {
 
 class InputModel::InputModelIRImpl {
     std::shared_ptr<ngraph::runtime::AlignedBuffer> m_weights;
+    std::shared_future<std::shared_ptr<ngraph::runtime::AlignedBuffer>> m_weights_future;
     std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> m_extensions;
     std::unordered_map<std::string, ngraph::OpSet> m_opsets;
     pugi::xml_node m_root;
@@ -201,9 +203,22 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            IE_THROW() << res.description() << " at offset " << res.offset;
+        char magic[sizeof(ov::binary_xml::codec_magic)] = {};
+        stream.read(magic, sizeof(magic));
+        stream.clear();
+        stream.seekg(0, stream.beg);
+        if (ov::binary_xml::has_codec_magic(magic, sizeof(magic))) {
+            // the binary topology form: the DOM is rebuilt directly, no xml parsing involved
+            try {
+                ov::binary_xml::decode(stream, m_xml_doc);
+            } catch (const std::exception& e) {
+                IE_THROW() << e.what();
+            }
+        } else {
+            pugi::xml_parse_result res = m_xml_doc.load(stream);
+            if (res.status != pugi::status_ok) {
+                IE_THROW() << res.description() << " at offset " << res.offset;
+            }
         }
         m_root = m_xml_doc.document_element();
         m_opsets["opset1"] = ngraph::get_opset1();
@@ -216,6 +231,13 @@ public:
         m_opsets["opset8"] = ngraph::get_opset8();
     }
 
+    InputModelIRImpl(std::istream& stream,
+                     std::shared_future<std::shared_ptr<ngraph::runtime::AlignedBuffer>> weights,
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : InputModelIRImpl(stream, std::shared_ptr<ngraph::runtime::AlignedBuffer>{}, extensions) {
+        m_weights_future = std::move(weights);
+    }
+
     std::shared_ptr<Function> convert();
 };
 
@@ -225,6 +247,12 @@ InputModel::InputModel(std::istream& stream,
     _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
 }
 
+InputModel::InputModel(std::istream& stream,
+                       std::shared_future<std::shared_ptr<ngraph::runtime::AlignedBuffer>> weights,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
+    _impl = std::make_shared<InputModelIRImpl>(stream, std::move(weights), extensions);
+}
+
 std::shared_ptr<Function> InputModel::convert() {
     return _impl->convert();
 }
@@ -232,6 +260,12 @@ std::shared_ptr<Function> InputModel::convert() {
 std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
 
+    // Join the background weights load (if any); errors from the loader re-throw here
+    if (m_weights_future.valid()) {
+        m_weights = m_weights_future.get();
+        m_weights_future = {};
+    }
+
     // Load default opsets
     size_t version = XMLParseUtils::GetUIntAttr(m_root, "version", 0);
     ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <istream>
 #include <memory>
 
@@ -25,6 +26,12 @@ public:
                const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
 
+    /// The overload for a weights buffer that is still being loaded in the background:
+    /// the xml parsing proceeds immediately, the future is resolved on the first convert() call.
+    InputModel(std::istream& stream,
+               std::shared_future<std::shared_ptr<ngraph::runtime::AlignedBuffer>> weights,
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
     std::shared_ptr<Model> convert();
 };
 
@@ -9,6 +9,8 @@
 #include "ie_ngraph_utils.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/util/env_util.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -16,6 +18,37 @@
 
 using namespace ov;
 
+namespace {
+
+// The trusted load skips the per-node attribute validation and shape inference and
+// restores the output types and shapes directly from the serialized ports. It is meant
+// for IRs produced by a pipeline which owns and integrity-checks its artifacts, e.g.
+// warm restarts from a model cache, where re-inferring every shape only burns time.
+bool is_trusted_load_enabled() {
+    static const bool enabled = ov::util::getenv_bool("OV_IR_TRUSTED_LOAD");
+    return enabled;
+}
+
+bool can_restore_ports_directly(const std::shared_ptr<ngraph::Node>& node, const GenericLayerParams& params) {
+    // sub-graph ops (TensorIterator, Loop, If) compute internal execution state
+    // during validation, so they always take the validating path
+    if (std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+        return false;
+    }
+    // nodes without serialized output ports (e.g. Result) get their outputs from validation
+    if (params.outputPorts.empty()) {
+        return false;
+    }
+    for (const auto& port : params.outputPorts) {
+        if (port.precision == ov::element::Type_t::undefined) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -677,12 +710,24 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
 
-        if (ngraphNode->visit_attributes(visitor)) {
-            ngraphNode->constructor_validate_and_infer_types();
-        }
+        const bool attributes_visited = ngraphNode->visit_attributes(visitor);
+        if (attributes_visited && is_trusted_load_enabled() && can_restore_ports_directly(ngraphNode, params)) {
+            // Trusted fast path: the output types and shapes come straight from the
+            // serialized ports, and the defaults-restoring clone (which re-runs the
+            // validation from the constructor) is not needed for an IR serialized by
+            // the same version
+            for (size_t i = 0; i < params.outputPorts.size(); ++i) {
+                const auto& port = params.outputPorts[i];
+                ngraphNode->set_output_type(i, port.precision, ngraph::PartialShape(port.dims));
+            }
+        } else {
+            if (attributes_visited) {
+                ngraphNode->constructor_validate_and_infer_types();
+            }
 
-        // To be sure that all default values will be initialized:
-        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+            // To be sure that all default values will be initialized:
+            ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+        }
     }
     if (!ngraphNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
         ngraphNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
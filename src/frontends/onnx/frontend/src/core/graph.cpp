@@ -6,6 +6,7 @@
 
 #include <exception>
 #include <functional>
+#include <future>
 #include <numeric>
 #include <sstream>
 
@@ -17,6 +18,8 @@
 #include "onnx_framework_node.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/core/null_node.hpp"
+#include "ie_system_conf.h"
+#include "threading/ie_executor_manager.hpp"
 #include "utils/common.hpp"
 
 namespace ngraph {
@@ -64,14 +67,51 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
       m_extensions{std::move(extensions)} {
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
+    // Process all initializers in the graph. The Constants are independent of each other,
+    // so they are decoded on all cores; the warnings, the fallbacks and the cache updates
+    // are applied on this thread once all decoding tasks complete.
+    std::vector<const ONNX_NAMESPACE::TensorProto*> initializer_protos;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
+            initializer_protos.push_back(&initializer_tensor);
+        }
+    }
+    struct DecodedInitializer {
+        std::shared_ptr<default_opset::Constant> constant;
+        std::exception_ptr error;
+    };
+    std::vector<std::future<DecodedInitializer>> decoding_futures;
+    decoding_futures.reserve(initializer_protos.size());
+    const auto executor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        {"ONNXFrontendInitializerDecoder", InferenceEngine::getNumberOfCPUCores(), 1});
+    for (const auto* initializer_proto : initializer_protos) {
+        auto decode = std::make_shared<std::packaged_task<DecodedInitializer()>>([initializer_proto] {
+            DecodedInitializer decoded;
             try {
-                ng_constant = tensor.get_ng_constant();
+                decoded.constant = Tensor{*initializer_proto}.get_ng_constant();
+            } catch (...) {
+                decoded.error = std::current_exception();
+            }
+            return decoded;
+        });
+        decoding_futures.push_back(decode->get_future());
+        executor->run([decode] {
+            (*decode)();
+        });
+    }
+    // join every task before touching the results, so that an exception thrown below
+    // cannot unwind past decoding tasks which still read the model proto
+    for (auto& decoding_future : decoding_futures) {
+        decoding_future.wait();
+    }
+    for (std::size_t i = 0; i < initializer_protos.size(); ++i) {
+        const auto& initializer_tensor = *initializer_protos[i];
+        Tensor tensor = Tensor{initializer_tensor};
+        auto decoded = decoding_futures[i].get();
+        auto ng_constant = std::move(decoded.constant);
+        if (decoded.error) {
+            try {
+                std::rethrow_exception(decoded.error);
             } catch (const error::invalid_external_data&) {
                 // invalid external data makes initializers creation impossible
                 throw;
@@ -83,11 +123,11 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
                             << exc.what();
                 ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
             }
-
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
         }
+
+        initializers.emplace(initializer_tensor.name(), tensor);
+        ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -424,6 +424,16 @@ public:
         return m_tensor_proto->data_type();
     }
     std::shared_ptr<ngraph::op::Constant> get_ng_constant() const {
+        if (detail::has_tensor_external_data(*m_tensor_proto)) {
+            try {
+                // external data is stored raw in the element type layout, so the constant
+                // can be built directly over the mapped file region instead of a copy
+                return make_ng_constant_over_external_data();
+            } catch (...) {
+                // mapping can be unavailable (e.g. exotic filesystems) - fall back to
+                // reading the data into memory below
+            }
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -457,6 +467,20 @@ public:
     }
 
 private:
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_over_external_data() const {
+        const auto& type = get_ng_type();
+        const auto external_data = detail::TensorExternalData{*m_tensor_proto};
+        auto buffer = external_data.load_external_mmap_data();
+        if (buffer->size() < ngraph::shape_size(m_shape) * type.size()) {
+            throw error::invalid_external_data{external_data};
+        }
+        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 
+#include <openvino/cc/selective_build.h>
+
 #include "core/attribute.hpp"
 #include "ngraph/log.hpp"
 #include "op/abs.hpp"
@@ -163,6 +165,8 @@
 #include "op/where.hpp"
 #include "op/xor.hpp"
 
+OV_CC_DOMAINS(onnx_op);
+
 namespace ngraph {
 namespace onnx_import {
 namespace {
@@ -274,11 +278,17 @@ bool OperatorsBridge::_is_operator_registered(const std::string& name,
 
 static const char* const MICROSOFT_DOMAIN = "com.microsoft";
 
-#define REGISTER_OPERATOR(name_, ver_, fn_) \
-    m_map[""][name_].emplace(ver_, std::bind(op::set_##ver_::fn_, std::placeholders::_1))
+// Translator registration is wrapped into conditional compilation scopes, so a selective build
+// keeps only the translators exercised by the profiled models and the linker drops the rest.
+#define REGISTER_OPERATOR(name_, ver_, fn_)                                                         \
+    OV_SCOPE(onnx_op, OV_PP_CAT4(op_, fn_, _, ver_)) {                                              \
+        m_map[""][name_].emplace(ver_, std::bind(op::set_##ver_::fn_, std::placeholders::_1));      \
+    }
 
-#define REGISTER_OPERATOR_WITH_DOMAIN(domain_, name_, ver_, fn_) \
-    m_map[domain_][name_].emplace(ver_, std::bind(op::set_##ver_::fn_, std::placeholders::_1))
+#define REGISTER_OPERATOR_WITH_DOMAIN(domain_, name_, ver_, fn_)                                    \
+    OV_SCOPE(onnx_op, OV_PP_CAT4(domain_op_, fn_, _, ver_)) {                                       \
+        m_map[domain_][name_].emplace(ver_, std::bind(op::set_##ver_::fn_, std::placeholders::_1)); \
+    }
 
 OperatorsBridge::OperatorsBridge() {
     _load_initial_state();
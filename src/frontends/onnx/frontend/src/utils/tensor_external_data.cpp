@@ -5,6 +5,8 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -20,11 +22,11 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoll(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoll(entry.value());
         if (entry.key() == "checksum")
-            m_sha1_digest = std::stoi(entry.value());
+            m_sha1_digest = std::stoll(entry.value());
     }
 }
 
@@ -67,6 +69,41 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+std::shared_ptr<MappedExternalData> TensorExternalData::load_external_mmap_data() const {
+    // initializers of one model usually share a single external file - map it once
+    static std::mutex mappings_mutex;
+    static std::map<std::string, std::weak_ptr<ov::util::MappedMemory>> mappings;
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    {
+        std::lock_guard<std::mutex> lock{mappings_mutex};
+        auto& cached_mapping = mappings[m_data_location];
+        mapped_memory = cached_mapping.lock();
+        if (!mapped_memory) {
+            NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
+#else
+            mapped_memory = ov::util::load_mmap_object(m_data_location);
+#endif
+            NGRAPH_SUPPRESS_DEPRECATED_END
+            cached_mapping = mapped_memory;
+        }
+    }
+
+    const auto offset = static_cast<size_t>(m_offset);
+    if (m_offset < 0 || offset > mapped_memory->size())
+        throw error::invalid_external_data{*this};
+    const auto data_length = m_data_length == 0 ? mapped_memory->size() - offset : static_cast<size_t>(m_data_length);
+    if (m_data_length < 0 || data_length > mapped_memory->size() - offset)
+        throw error::invalid_external_data{*this};
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<MappedExternalData>(mapped_memory->data() + offset, data_length, mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
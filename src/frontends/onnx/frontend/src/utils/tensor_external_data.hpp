@@ -6,9 +6,18 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <memory>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Buffer aliasing a region of a memory-mapped external data file. The mapping is
+///         kept alive by the buffer, so constants built on top of it stay valid after import.
+using MappedExternalData = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +32,16 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map the external data file and return a buffer aliasing the initializer
+    ///             region, without copying it. Mappings are shared between the initializers
+    ///             stored in one file.
+    ///
+    /// \note       If the offset/length do not fit the mapped file,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \return     A buffer over the mapped region, keeping the mapping alive
+    std::shared_ptr<MappedExternalData> load_external_mmap_data() const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -30,9 +49,10 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
-    int m_sha1_digest = 0;
+    // 64-bit on purpose: checkpoints larger than 2 GB are the main external-data use case
+    int64_t m_offset = 0;
+    int64_t m_data_length = 0;
+    int64_t m_sha1_digest = 0;
 };
 }  // namespace detail
 }  // namespace onnx_import
@@ -4,6 +4,9 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include <future>
+
+#include "ie_system_conf.h"
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/extension/conversion.hpp"
@@ -13,6 +16,7 @@
 #include "pass/transpose_sinking.hpp"
 #include "so_extension.hpp"
 #include "tf_framework_node.hpp"
+#include "threading/ie_executor_manager.hpp"
 #include "utils.hpp"
 
 using namespace ov::frontend::tensorflow;
@@ -96,8 +100,45 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         ng_op_map[input_name] = {param};
     }
 
+    // translate the input-free operations (mostly Const) ahead of time: such a translation
+    // creates a node with no edges to the rest of the graph, so it can run on all cores;
+    // operations with inputs are translated in the topological order below, as connecting
+    // an input registers an edge on the producer output which is not synchronized
+    std::vector<std::future<ov::OutputVector>> pre_translated(operation_places.size());
+    const auto executor =
+        InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor({"TFFrontendOpTranslator",
+                                                                                    InferenceEngine::getNumberOfCPUCores(),
+                                                                                    1});
+    for (size_t op_idx = 0; op_idx < operation_places.size(); ++op_idx) {
+        const auto& operation_place = operation_places[op_idx];
+        auto operation_decoder = operation_place->get_decoder();
+        if (operation_decoder->get_input_size() != 0 || ng_op_map.count(operation_place->get_names()[0]) ||
+            !translate_map.count(operation_decoder->get_op_type())) {
+            continue;
+        }
+        const auto op_fun = translate_map.find(operation_decoder->get_op_type());
+        auto translate = std::make_shared<std::packaged_task<ov::OutputVector()>>([operation_decoder, op_fun] {
+            const ov::OutputVector no_inputs;
+            NodeContext node_context(*operation_decoder, no_inputs);
+            return op_fun->second(node_context);
+        });
+        pre_translated[op_idx] = translate->get_future();
+        executor->run([translate] {
+            (*translate)();
+        });
+    }
+
+    // join every task before stitching: an exception thrown below must not unwind past
+    // translation tasks which still use the local translator map
+    for (auto& pre_translated_future : pre_translated) {
+        if (pre_translated_future.valid()) {
+            pre_translated_future.wait();
+        }
+    }
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t op_idx = 0; op_idx < operation_places.size(); ++op_idx) {
+        const auto& operation_place = operation_places[op_idx];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
@@ -151,14 +192,20 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         // generate OV node output vector for the current operation node
         ov::OutputVector ng_outputs;
         try {
-            FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
-                                          "No translator found for " + operation_decoder->get_op_type() + " node.");
-            auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
-            // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
-            // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
-            NodeContext node_context(*operation_decoder, ng_inputs);
-            // generate OV node output vector using translator for given operation type
-            ng_outputs = (*op_fun)(node_context);
+            if (pre_translated[op_idx].valid()) {
+                // the future rethrows the translation exception, if any, so the failure
+                // handling below stays the same as for the in-order translation
+                ng_outputs = pre_translated[op_idx].get();
+            } else {
+                FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
+                                              "No translator found for " + operation_decoder->get_op_type() + " node.");
+                auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
+                // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
+                // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
+                NodeContext node_context(*operation_decoder, ng_inputs);
+                // generate OV node output vector using translator for given operation type
+                ng_outputs = (*op_fun)(node_context);
+            }
         } catch (...) {
             if (fail_fast) {
                 // re-throw any exception
@@ -9,18 +9,6 @@
 
 #pragma once
 
-#include "ie_api.h"
-#include "ie_blob.h"
-
-namespace InferenceEngine {
-
-/**
- * @brief      Copies data with taking into account layout and precision params
- * @ingroup    ie_dev_api_memory
- *
- * @param[in]  src   The source Blob::Ptr
- * @param[in]  dst   The destination Blob::Ptr
- */
-INFERENCE_ENGINE_API_CPP(void) blob_copy(Blob::Ptr src, Blob::Ptr dst);
-
-}  // namespace InferenceEngine
+// The declaration moved to the public API so that applications can use the
+// converter directly; this header is kept for plugin code compatibility.
+#include "ie_blob_transform.hpp"
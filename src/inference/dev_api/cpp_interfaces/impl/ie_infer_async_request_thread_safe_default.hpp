@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <exception>
 #include <future>
 #include <map>
@@ -97,6 +98,7 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
             case InferState::Stop:
                 break;
             }
+            _cancelRequested.store(false, std::memory_order_relaxed);
             _state = InferState::Busy;
         }
         if (state != InferState::Stop) {
@@ -285,10 +287,21 @@ public:
         }
     }
 
+    /**
+     * @brief Lock-free check whether cancellation of the running inference was requested.
+     *        Cheap enough for cooperative checkpoints on the execution hot path (e.g. between
+     *        node executions), where taking the state mutex per check would be too expensive
+     * @return true when Cancel() was called for the inference being executed
+     */
+    bool IsCancelRequested() const noexcept {
+        return _cancelRequested.load(std::memory_order_relaxed);
+    }
+
     void Cancel() override {
         std::lock_guard<std::mutex> lock{_mutex};
         if (_state == InferState::Busy) {
             _state = InferState::Canceled;
+            _cancelRequested.store(true, std::memory_order_relaxed);
         }
     }
 
@@ -456,5 +469,7 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    // mirrors the Busy -> Canceled transition for lock-free polling from the execution hot path
+    std::atomic_bool _cancelRequested{false};
 };
 }  // namespace InferenceEngine
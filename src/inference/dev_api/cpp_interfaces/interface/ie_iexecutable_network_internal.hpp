@@ -109,6 +109,14 @@ public:
      */
     virtual void Export(std::ostream& networkModel);
 
+    /**
+     * @brief Replaces constant tensors of the compiled network with new values of the same shape and precision
+     * @param weights Map of a constant (friendly) name to a blob with the new value
+     * @note The topology is kept intact, only weight-dependent buffers are refreshed; plugins which
+     *       do not support in-place weight updates keep the default NotImplemented behavior
+     */
+    virtual void UpdateWeights(const std::map<std::string, Blob::Ptr>& weights);
+
     /**
      * @brief Get executable graph information from a device
      * @return A network object to store executable graph information
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpp/ie_infer_request.hpp"
 #include "ie_common.h"
@@ -196,6 +197,21 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Alias for a per-output completion callback type
+     */
+    using OutputCompletionCallback = std::function<void(const std::string&)>;
+
+    /**
+     * @brief Set callback function which will be called as soon as the output blob with the given name
+     *        is fully written, which may happen before the request itself completes. Each output blob
+     *        is written exactly once per request, in the order outputs become ready.
+     * @param outputName - a name of the output the callback is attached to
+     * @param callback - function to be called with the output name; an empty function removes
+     *        a previously set callback
+     */
+    virtual void SetOutputCompletionCallback(const std::string& outputName, OutputCompletionCallback callback);
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -322,6 +338,35 @@ protected:
      */
     virtual void checkBlobsForBatch(const std::string& name, const std::vector<Blob::Ptr>& blobs);
 
+    /**
+     * @brief A blob binding which already passed the full SetBlob validation.
+     * Applications which rotate among a few pre-allocated buffers re-bind the same
+     * (pointer, descriptor) pairs on every request; such bindings are recognized and
+     * re-applied without repeating validation.
+     */
+    struct KnownBlobBinding {
+        const Blob* blob = nullptr;  //!< Identity of the user blob object
+        void* buffer = nullptr;      //!< Host data pointer of the blob at validation time
+        TensorDesc desc;             //!< Descriptor of the blob at validation time
+        bool isInput = false;        //!< Whether the binding targets a network input
+    };
+
+    /**
+     * @brief Looks up a previously validated binding of the given blob to the given port
+     * @param name A name of input or output blob
+     * @param blob The user blob being set
+     * @return A pointer to the matching record or nullptr when the binding was not seen before
+     */
+    const KnownBlobBinding* findKnownBlobBinding(const std::string& name, const Blob::Ptr& blob) const;
+
+    /**
+     * @brief Remembers a successfully validated blob binding for the SetBlob fast re-bind path
+     * @param name A name of input or output blob
+     * @param blob The user blob which passed validation
+     * @param isInput Whether the blob was bound to a network input
+     */
+    void rememberBlobBinding(const std::string& name, const Blob::Ptr& blob, bool isInput);
+
     InferenceEngine::InputsDataMap _networkInputs;    //!< Holds information about network inputs info
     InferenceEngine::OutputsDataMap _networkOutputs;  //!< Holds information about network outputs data
     InferenceEngine::BlobMap _inputs;                 //!< A map of user passed blobs for network inputs
@@ -331,6 +376,7 @@ protected:
     std::vector<std::shared_ptr<const ov::Node>> _results;     //!< A vector of function outputs
     std::map<std::string, PreProcessDataPtr> _preProcData;     //!< A map of pre-process data per input
     std::map<std::string, BatchedBlob::Ptr> _batched_inputs;   //!< A map of user passed blobs for network inputs
+    std::map<std::string, std::vector<KnownBlobBinding>> _knownBlobBindings;  //!< Previously validated blob bindings per port
     int m_curBatch = -1;                                       //!< Current batch value used in dynamic batching
 
     /**
@@ -339,6 +385,7 @@ protected:
      */
     std::shared_ptr<IExecutableNetworkInternal> _exeNetwork;
     Callback _callback;  //!< A callback
+    std::map<std::string, OutputCompletionCallback> _outputCompletionCallbacks;  //!< A map of per-output completion callbacks
 
 private:
     void* _userData = nullptr;
@@ -59,6 +59,231 @@ DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
  */
 DECLARE_CONFIG_KEY(FORCE_DISABLE_CACHE);
 
+/**
+ * @brief Defines a mode when read-only weight tensors are replicated into the weight cache of each NUMA node
+ *        (set value to YES) so every stream works with a socket-local copy instead of reading weights across
+ *        the interconnect. Effective on multi-socket systems; increases memory consumption accordingly.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_WEIGHT_REPLICATION);
+
+/**
+ * @brief Routes the constant data of the compiled graphs through the process-wide content-keyed
+ *        weight store regardless of the stream count (set value to YES). Compiling the same model
+ *        several times - e.g. reshaped to a few static input resolutions - then keeps one copy of
+ *        the byte-identical weights, and each variant only owns its activation planning. Combine
+ *        with KEY_CPU_RELEASE_SOURCE_MODEL to drop the per-variant source copies as well. Off by
+ *        default, since the store clones constants which a single compiled model would reference
+ *        in place.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CROSS_MODEL_WEIGHT_SHARING);
+
+/**
+ * @brief Defines a mode when oneDNN primitives of non-constant nodes are prepared lazily (set value to YES):
+ *        network loading finishes as soon as the memory is allocated, while the primitives are finalized by a
+ *        background thread and, for the nodes the background thread has not reached yet, by the first inference
+ *        request. Trades a slower first request for a much shorter time-to-ready.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAZY_PRIMITIVE_INIT);
+
+/**
+ * @brief Defines the maximum number of executable nodes for which the CPU plugin inference switches to a flat
+ *        single-thread interpreter loop without per-node profiling scopes and cancellation checks. For
+ *        sub-millisecond topologies this service code is a measurable share of the total latency. Zero
+ *        (the default) disables the fast path.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INFER_FAST_PATH_NODE_LIMIT);
+
+/**
+ * @brief Defines a mode when input preprocessing of an asynchronous inference request runs as a dedicated
+ *        pipeline stage on a separate executor (set value to YES), so preprocessing of the next request
+ *        overlaps with graph execution of the previous one instead of running serially on the stream thread.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PIPELINED_PREPROCESSING);
+
+/**
+ * @brief Defines a mode when output precision conversion of an asynchronous inference request runs as a
+ *        dedicated pipeline stage on a separate executor (set value to YES), so the stream thread is
+ *        released right after graph execution and the conversion overlaps with the next scheduled request.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PIPELINED_POSTPROCESSING);
+
+/**
+ * @brief Defines a mode when constant FullyConnected weights are stored as int8 with per-output-channel
+ *        scales and activations are quantized on the fly with a per-row scale (set value to YES). Halves
+ *        the weight bandwidth of memory-bound layers without an offline calibration pass at the cost of
+ *        int8 rounding error, so the mode is opt-in.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_QUANTIZATION);
+
+/**
+ * @brief Defines a mode when constant FullyConnected weights are packed as int4 with group-wise scales
+ *        and decompressed on the fly during execution (set value to YES). Shrinks the executable weight
+ *        copy roughly 8x versus f32, trading some accuracy and compute for memory capacity, so the mode
+ *        is opt-in and meant for co-hosting many models.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INT4_WEIGHT_COMPRESSION);
+
+/**
+ * @brief Forces the core type used by executor streams on hybrid (P/E-core) processors, overriding the
+ *        automatic selection done for the HYBRID_AWARE binding: BIG pins streams to the performance
+ *        cores, LITTLE to the efficiency cores, ROUND_ROBIN distributes streams over both starting
+ *        with the performance cores, and ANY leaves the placement to the OS scheduler.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PREFERRED_CORE_TYPE);
+DECLARE_CONFIG_VALUE(ANY);
+DECLARE_CONFIG_VALUE(BIG);
+DECLARE_CONFIG_VALUE(LITTLE);
+DECLARE_CONFIG_VALUE(ROUND_ROBIN);
+
+/**
+ * @brief Enables runtime scaling of the active stream set (set value to YES): the streams executor grows
+ *        and shrinks the number of streams that execute tasks concurrently based on the observed request
+ *        queue depth, with hysteresis, so a compiled model adapts to the load without recompilation.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ADAPTIVE_STREAMS);
+
+/**
+ * @brief Lower scheduler utilization clamp in percent [0, 100] applied to every stream thread, a soft
+ *        alternative to core pinning for deployments co-located with other services: threads stay
+ *        migratable, but the OS steers frequency and placement as if they occupied at least this
+ *        share of a CPU. Linux 5.3+ only, ignored elsewhere.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAM_UTIL_CLAMP_MIN);
+
+/**
+ * @brief Upper scheduler utilization clamp in percent [0, 100] applied to every stream thread, limiting
+ *        the CPU share inference may claim from co-located services. Linux 5.3+ only, ignored elsewhere.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAM_UTIL_CLAMP_MAX);
+
+/**
+ * @brief A list of likely input shape combinations to pre-build the shape-specialized
+ *        primitives for right after a dynamic model is compiled, e.g.
+ *        "ids[1,128]|mask[1,128];ids[1,256]|mask[1,256]". Combinations are separated by ';',
+ *        the entries of one combination by '|'. Warm-up runs in the background on the stream
+ *        threads, so the first live request with a registered shape finds its primitives ready.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WARMUP_SHAPES);
+
+/**
+ * @brief Enables the in-process cache of models transformed up to the plugin-specific opset.
+ *        Recompiling the same source model with a different runtime configuration (e.g. another
+ *        stream count) then reuses the transformed snapshot instead of re-running the common
+ *        transformation pipeline. The cache is keyed by the source model identity, the
+ *        transformation-affecting options and the input/output information.
+ *        The option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TRANSFORMED_MODEL_CACHE);
+
+/**
+ * @brief Backs the large buffers the CPU plugin allocates while compiling a model (cloned
+ *        constant data and the reused intermediate-tensor arena) with 2 MB huge pages to cut
+ *        dTLB misses on big models. Explicitly reserved huge pages are used when available,
+ *        otherwise the allocation falls back to transparent huge pages and finally to regular
+ *        pages, so the option is safe to set unconditionally.
+ *        The option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief Allows the CPU memory planner to re-execute cheap producers instead of keeping their
+ *        outputs alive. Long-lived tensors (e.g. skip connections passing through an
+ *        activation) are duplicated right before their late consumer when re-solving the
+ *        memory reuse problem shows that the recomputation shrinks the peak arena size, which
+ *        trades a little compute for footprint on memory-constrained devices.
+ *        The option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ACTIVATION_RECOMPUTE);
+
+/**
+ * @brief The name of the executor domain a compiled model attaches to. All models compiled with the same
+ *        domain share one streams executor (and so one bounded set of stream threads) instead of creating
+ *        their own, which avoids thread oversubscription when many models are loaded side by side. The
+ *        stream configuration of the first model compiled into a domain defines the domain executor.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXECUTOR_DOMAIN);
+
+/**
+ * @brief Directory the CPU plugin exports its lightweight per-node performance counters to.
+ *        Every stream graph maps one flat binary file there (one fixed-size record per
+ *        executable node: execution count and accumulated TSC cycles) which the owning stream
+ *        thread updates in place without locks, so an external monitoring agent can scrape
+ *        execution statistics from a production process at negligible overhead. An empty value
+ *        (default) disables the export.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_EXPORT_DIR);
+
+/**
+ * @brief Path prefix for the CPU plugin Chrome trace export. Every stream graph records its node
+ *        execution spans (name, stream id, start, duration) into a preallocated in-memory ring -
+ *        the oldest spans are overwritten, keeping the most recent history - and serializes it to
+ *        `<prefix>_<pid>_<graphId>.json` in the Chrome trace event format when the compiled model
+ *        is released, so a production timeline can be opened in chrome://tracing or perfetto
+ *        without VTune. An empty value (default) disables the tracing.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CHROME_TRACE);
+
+/**
+ * @brief Attributes hardware PMU readings (LLC misses and references, opened per stream thread
+ *        through perf_event_open) to the CPU plugin nodes around their execution, and prints a
+ *        per-node-type summary (miss ratio, estimated DRAM traffic and bandwidth) when the
+ *        compiled model is released. This tells whether a slow node is bandwidth- or
+ *        compute-bound. Requires Linux and perf_event access (kernel.perf_event_paranoid); the
+ *        attribution is silently skipped when the counters cannot be opened.
+ *        The option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PMU_COUNTERS);
+
+/**
+ * @brief Splits the batch of an inference request into micro-batches of at most this size which run
+ *        through the CPU graph one after another, so every layer works on an activation slice small
+ *        enough to stay cache-resident instead of streaming the whole batch through memory. Requires
+ *        dynamic batch (KEY_DYN_BATCH_LIMIT covering the full batch) since the split reuses its
+ *        machinery; zero (the default) disables the split.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MICRO_BATCH_SIZE);
+
+/**
+ * @brief Deadline in milliseconds the asynchronous requests of the compiled model are expected to
+ *        meet. At enqueue the CPU plugin multiplies its smoothed per-request service time by the
+ *        number of requests already admitted and rejects the submission with the InferCancelled
+ *        exception when the product exceeds the deadline, so an overloaded server fails fast
+ *        instead of spending CPU on requests that would complete late anyway. Zero (the default)
+ *        disables the admission control.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_REQUEST_DEADLINE);
+
+/**
+ * @brief Drops the source model right after the per-stream graphs are compiled (set value to YES),
+ *        so hosts keeping many models resident reclaim the memory pinned by the original graph.
+ *        The runtime model is still reconstructed from the compiled graph on demand by
+ *        GetExecGraphInfo(), but Export() becomes unavailable for such a network.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RELEASE_SOURCE_MODEL);
+
 /**
  * @brief The name for setting work mode internal in MULTI device plugin option.
  */
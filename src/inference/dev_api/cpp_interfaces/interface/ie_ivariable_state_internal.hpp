@@ -50,6 +50,20 @@ public:
      */
     virtual Blob::CPtr GetState() const;
 
+    /**
+     * @brief Sets the number of valid elements along the sequence axis for a state
+     * pre-allocated at its maximal length. Passing 0 discards the accumulated prefix
+     * without touching the storage.
+     * @param length A new valid prefix length, in elements of the sequence axis
+     */
+    virtual void SetStateLength(size_t length);
+
+    /**
+     * @brief Gets the number of valid elements along the sequence axis
+     * @return The valid prefix length tracked for the state
+     */
+    virtual size_t GetStateLength() const;
+
 protected:
     /**
      * @brief A default dtor
@@ -58,6 +72,7 @@ protected:
 
     std::string name;
     Blob::Ptr state;
+    size_t stateLength = 0;
 };
 
 /**
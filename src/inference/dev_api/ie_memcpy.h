@@ -29,3 +29,23 @@
  */
 
 INFERENCE_ENGINE_API_CPP(int) ie_memcpy(void* dest, size_t destsz, void const* src, size_t count);
+
+/**
+ * @brief      Copies bytes between buffers with security enhancements, splitting
+ *             large copies across the available threads.
+ *             Performs the same checks as ie_memcpy. Copies below one megabyte fall
+ *             back to a plain single-threaded copy, so the function can be used
+ *             unconditionally at API boundaries where blob sizes vary; very large
+ *             copies additionally bypass the CPU caches with streaming stores.
+ * @ingroup    ie_dev_api_memory
+ *
+ * @param dest A Pointer to the object to copy to
+ * @param destsz A max number of bytes to modify in the destination (typically the size
+ *               of the destination object)
+ * @param src A pointer to the object to copy from
+ * @param count A number of bytes to copy
+ *
+ * @return zero on success and non-zero value on error.
+ */
+
+INFERENCE_ENGINE_API_CPP(int) ie_memcpy_parallel(void* dest, size_t destsz, void const* src, size_t count);
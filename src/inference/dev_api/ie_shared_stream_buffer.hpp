@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the SharedStreamBuffer class
+ * @file ie_shared_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <streambuf>
+
+namespace InferenceEngine {
+
+/**
+ * @brief A read-only streambuf over an externally owned memory region.
+ *
+ * Allows to expose an already loaded (e.g. memory-mapped) buffer through the
+ * std::istream based interfaces without copying it. Consumers which understand
+ * this type may also access the underlying region directly to avoid extra
+ * copies, keeping the owner alive for as long as the data is referenced.
+ */
+class SharedStreamBuffer : public std::streambuf {
+public:
+    /**
+     * @brief Constructor
+     * @param data Pointer to the beginning of the region
+     * @param size Size of the region in bytes
+     * @param owner Optional object which keeps the region alive
+     */
+    SharedStreamBuffer(char* data, size_t size, std::shared_ptr<void> owner = {})
+        : _data(data),
+          _size(size),
+          _owner(std::move(owner)),
+          _offset(0) {}
+
+    /**
+     * @brief Returns a pointer to the beginning of the underlying region
+     */
+    char* getData() const noexcept {
+        return _data;
+    }
+
+    /**
+     * @brief Returns the size of the underlying region in bytes
+     */
+    size_t getSize() const noexcept {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the object which keeps the underlying region alive
+     */
+    const std::shared_ptr<void>& getOwner() const noexcept {
+        return _owner;
+    }
+
+protected:
+    std::streamsize showmanyc() override {
+        return _size - _offset;
+    }
+
+    std::streamsize xsgetn(char* s, std::streamsize count) override {
+        auto real_count = std::min<std::streamsize>(showmanyc(), count);
+        std::memcpy(s, _data + _offset, real_count);
+        _offset += real_count;
+        return real_count;
+    }
+
+    int_type underflow() override {
+        return (showmanyc() == 0) ? traits_type::eof() : traits_type::to_int_type(*(_data + _offset));
+    }
+
+    int_type uflow() override {
+        return (showmanyc() == 0) ? traits_type::eof() : traits_type::to_int_type(*(_data + _offset++));
+    }
+
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        if (dir != std::ios_base::beg && dir != std::ios_base::cur && dir != std::ios_base::end) {
+            return pos_type(off_type(-1));
+        }
+        const auto base = (dir == std::ios_base::beg) ? 0 : (dir == std::ios_base::cur) ? _offset : _size;
+        const auto new_offset = static_cast<off_type>(base) + off;
+        if (new_offset < 0 || new_offset > static_cast<off_type>(_size)) {
+            return pos_type(off_type(-1));
+        }
+        _offset = static_cast<size_t>(new_offset);
+        return pos_type(_offset);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    char* _data;
+    size_t _size;
+    std::shared_ptr<void> _owner;
+    size_t _offset;
+};
+
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 
@@ -132,6 +133,48 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Converts a bfloat16 array to a single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of bfloat16 values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const short* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a single-precision floating point array to a bfloat16 array
+ *             with rounding to nearest even and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of bfloat16 values
+ * @param[in]  src    A source array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(short* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a single-precision floating point array to an unsigned 8-bit integer
+ *             array with rounding and saturation and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of unsigned 8-bit integer values
+ * @param[in]  src    A source array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tou8Arrays(uint8_t* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 #if defined(_MSC_VER)
 #    pragma warning(push)
 #    pragma warning(disable : 4018)
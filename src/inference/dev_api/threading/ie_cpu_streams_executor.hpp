@@ -42,6 +42,8 @@ public:
 
     void run(Task task) override;
 
+    void runWithPriority(Task task, int priority) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
@@ -29,6 +29,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,6 +42,7 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    std::unordered_map<std::string, IStreamsExecutor::Ptr> sharedStreamsExecutors;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +86,17 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the streams executor of the executor domain named by `config._name`, creating it from
+     * `config` on the first call. Unlike getIdleCPUStreamsExecutor, the executor is handed out to all
+     * callers of the domain no matter how many of them hold it, so compiled models attached to one domain
+     * share a single bounded set of stream threads instead of creating their own.
+     * @param config A stream executor config whose `_name` identifies the executor domain; only the first
+     * caller's config takes effect
+     * @return A shared pointer to the domain streams executor
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config);
+
     /**
      * @cond
      */
@@ -103,6 +103,16 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _enforcePreferredCoreType = false;  //!< The preferred core type was set explicitly via configuration,
+                                                 //!< so @ref MakeDefaultMultiThreaded must not override it
+        bool _adaptiveStreams = false;  //!< Scale the number of concurrently executing streams at runtime
+                                        //!< based on the observed task queue depth
+        int _streamUtilClampMin = -1;  //!< Lower scheduler utilization clamp for stream threads in percent,
+                                       //!< negative means no clamp (Linux only)
+        int _streamUtilClampMax = -1;  //!< Upper scheduler utilization clamp for stream threads in percent,
+                                       //!< negative means no clamp (Linux only)
+        std::string _executorDomain;  //!< The name of the executor domain shared between compiled models,
+                                      //!< empty means a dedicated executor per model
 
         /**
          * @brief      A constructor with arguments
@@ -156,6 +166,15 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief Dispatches the task with the given scheduling priority
+     * @param task A task to start
+     * @param priority Relative priority of the task: tasks with a greater value are claimed by the
+     *        stream threads first, tasks of equal priority keep the submission order. The default
+     *        implementation ignores the priority and behaves as run()
+     */
+    virtual void runWithPriority(Task task, int priority);
 };
 
 }  // namespace InferenceEngine
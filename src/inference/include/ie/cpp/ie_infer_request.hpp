@@ -215,6 +215,20 @@ public:
         SetCallback<F>{*this}(std::move(callbackToSet));
     }
 
+    /**
+     * @brief Sets a callback function that will be called as soon as a particular output blob is
+     * fully written, which may happen before the whole inference request completes
+     *
+     * Each output blob is written exactly once per request, in the order outputs become ready,
+     * which allows streaming early results of a multi-output network while the remaining
+     * outputs are still being produced.
+     *
+     * @param name Name of the output blob the callback is attached to
+     * @param callbackToSet callback object which will be called with the output name; an empty
+     * function removes a previously set callback
+     */
+    void SetOutputCompletionCallback(const std::string& name, std::function<void(const std::string&)> callbackToSet);
+
     /**
      * @brief Gets state control interface for given infer request.
      *
@@ -155,6 +155,34 @@ DECLARE_GPU_CONFIG_KEY(MAX_NUM_THREADS);
  * Thus, this key should be turned off if graph loading time is considered to be most important target to optimize.*/
 DECLARE_GPU_CONFIG_KEY(ENABLE_LOOP_UNROLLING);
 
+/**
+ * @brief Turning on this key makes the plugin execute an FP32 network in FP16 where it is numerically safe.
+ * Eligible operations are converted to FP16 at compile time, while operations whose accuracy degrades in half
+ * precision (softmax accumulation, normalization and other wide reductions) keep FP32 computation with
+ * conversions inserted around them. The per-operation runtime precision can be inspected through the
+ * executable graph info. The key is turned off by default and has no effect on quantized networks.
+ */
+DECLARE_GPU_CONFIG_KEY(ENABLE_AUTO_FP16);
+
+/**
+ * @brief Turning on this key lets an infer request accept input blobs whose shapes differ from the compiled ones.
+ * The plugin keeps the source model and compiles a graph variant per distinct set of input shapes on first use,
+ * caching the variants inside the executable network, so variable-length workloads run without padding to the
+ * worst-case shape and without a full network reload per shape. Building a variant still costs one compilation,
+ * so the benefit comes when a bounded set of shapes repeats. The key is turned off by default and is not
+ * compatible with multiple throughput streams or dynamic batch.
+ */
+DECLARE_GPU_CONFIG_KEY(ENABLE_PER_SHAPE_GRAPH_CACHE);
+
+/**
+ * @brief This key limits the estimated host memory consumed by concurrent OpenCL kernel compilations
+ * on model loading. The value is an unsigned integer number of megabytes. When the in-flight compilations
+ * would exceed the budget, the remaining ones wait, so large models load within a bounded memory footprint
+ * at the cost of a longer compilation. Kernels needed first by the network are scheduled first.
+ * The default value is 0, which disables the limit and compiles with full task executor parallelism.
+ */
+DECLARE_GPU_CONFIG_KEY(COMPILATION_MEMORY_BUDGET);
+
 /**
  * @brief These keys instruct the GPU plugin to use surface/buffer memory type.
  */
@@ -34,5 +34,47 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling the automatic cost-based graph partitioning.
+ * When set to CONFIG_VALUE(YES) and the network carries no manual per-layer affinities,
+ * layers are assigned to the fallback devices by minimizing the sum of per-layer execution
+ * cost and the cost of transferring tensors over the resulting device boundaries, rather
+ * than by taking the first device that supports a layer.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_BASED_PARTITIONING);
+
+/**
+ * @brief The key for a file with measured per-layer execution times used by the cost-based
+ * partitioning. Each line holds three tab-separated fields: device name, layer friendly name
+ * and the execution time in microseconds, as reported by the performance counters of a
+ * profiling run on that device. Layers without a measured entry fall back to an estimate
+ * derived from their tensor sizes.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_COSTS_FILE);
+
+/**
+ * @brief The key for a file to exchange the chosen partition with.
+ * If the file exists, the per-layer affinities are reloaded from it and the automatic
+ * partitioning is skipped; otherwise the partition chosen by this load is dumped there.
+ * Each line holds two tab-separated fields: layer friendly name and device name.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_FILE);
+
+/**
+ * @brief The key for enabling the pipelined execution of the subgraphs.
+ * When set to CONFIG_VALUE(YES), the devices executing the subgraphs accept requests
+ * concurrently, so with several infer requests in flight a subgraph of one request overlaps
+ * the neighboring subgraphs of the other requests (e.g. the GPU stage of one request runs
+ * while the CPU finishes the preceding stage of the next one). Every infer request owns a
+ * private set of the boundary tensors, so the in-flight requests never share intermediate
+ * data. Combined with HETERO_CONFIG_KEY(COST_BASED_PARTITIONING), the automatic split
+ * balances the per-stage costs across the devices instead of minimizing their sum, since
+ * the throughput of a pipeline is set by its slowest stage.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or
+ * CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINED_EXECUTION);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the function copying Blob data between layouts
+ *
+ * @file ie_blob_transform.hpp
+ */
+#pragma once
+
+#include "ie_api.h"
+#include "ie_blob.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Copies data from one blob to another with taking into account layout and precision parameters
+ *
+ * Source and destination must have the same precision and dimensions, while the layouts may differ
+ * (for example NHWC to NCHW). The conversion is vectorized and parallelized internally, so applications
+ * do not need to implement their own layout converters.
+ *
+ * @param[in]  src   The source Blob::Ptr
+ * @param[in]  dst   The destination Blob::Ptr
+ */
+INFERENCE_ENGINE_API_CPP(void) blob_copy(Blob::Ptr src, Blob::Ptr dst);
+
+}  // namespace InferenceEngine
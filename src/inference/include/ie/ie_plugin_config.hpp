@@ -219,6 +219,15 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get per-category device memory consumption of an executable network, in bytes.
+ *
+ * The map keys are plugin-defined categories, e.g. "weights" for constant data, "activation_arena"
+ * for the reused intermediate-tensor storage and "scratch" for temporary primitive workspace.
+ * String value is "MEMORY_STATISTICS".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
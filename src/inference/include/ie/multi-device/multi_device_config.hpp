@@ -42,5 +42,14 @@ DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
  * is not 0, the network will be dispatched to the strongest device.
  */
 DECLARE_CONFIG_KEY(AUTO_NETWORK_PRIORITY);
+
+/**
+ * @brief Warm start config option for the Auto plugin.
+ * When set to YES and a compiled blob cache is configured for the selected accelerator,
+ * the CPU fall-back network is not loaded at all and inference starts directly on the
+ * accelerator from the cached blob. Note that a first (not yet cached) compilation then
+ * also runs without the CPU fall-back, trading time-to-first-inference for memory.
+ */
+DECLARE_CONFIG_KEY(AUTO_WARM_START_FROM_CACHE);
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
@@ -160,6 +160,18 @@ public:
      */
     void export_model(std::ostream& model_stream);
 
+    /**
+     * @brief Replaces constants of the compiled model with new values without recompilation
+     *
+     * Each tensor must match the shape and element type of the constant it replaces; only the
+     * weight-dependent buffers (reorders, prepacked copies) are refreshed, the topology and the
+     * selected primitives stay as compiled. Throws if the device does not support in-place weight
+     * updates for the current configuration or if a named constant is not found.
+     *
+     * @param weights Map of a constant (friendly) name to a tensor with the new value
+     */
+    void update_weights(const std::map<std::string, Tensor>& weights);
+
     /**
      * @brief Sets properties for current compiled model
      *
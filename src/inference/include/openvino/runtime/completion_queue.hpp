@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides CompletionQueue.
+ *
+ * @file openvino/runtime/completion_queue.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief This is a class that collects completions of asynchronous inference requests, so an application
+ * thread harvests finished requests in batches with a single wait instead of reacting to one callback
+ * dispatch per request.
+ *
+ * A request is attached to the queue with subscribe(), which replaces its completion callback; every time
+ * the request finishes, its tag together with the exception raised during inference (if any) is pushed to
+ * the queue. The queue does not own the subscribed requests and may outlive or be outlived by them.
+ */
+class OPENVINO_RUNTIME_API CompletionQueue {
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+
+public:
+    /**
+     * @brief A single harvested completion
+     */
+    struct Completion {
+        /// @brief The tag the finished request was subscribed with
+        int64_t tag;
+        /// @brief The exception raised during inference, or null when the request finished successfully
+        std::exception_ptr exception;
+    };
+
+    /**
+     * @brief Constructs an empty queue
+     */
+    CompletionQueue();
+
+    /**
+     * @brief Subscribes an inference request to this queue
+     * The request completion callback is replaced, so every subsequent completion of the request is
+     * delivered through the queue instead of a user callback.
+     * @param request The request whose completions are pushed to this queue
+     * @param tag A value identifying the request in harvested completions
+     */
+    void subscribe(InferRequest& request, int64_t tag);
+
+    /**
+     * @brief Harvests available completions without blocking
+     * @param completions The vector harvested completions are appended to
+     * @param max_count The maximum number of completions to harvest
+     * @return The number of harvested completions, zero when the queue is empty
+     */
+    size_t try_pop(std::vector<Completion>& completions,
+                   size_t max_count = std::numeric_limits<size_t>::max());
+
+    /**
+     * @brief Blocks until at least one completion is available and harvests a batch
+     * @param completions The vector harvested completions are appended to
+     * @param max_count The maximum number of completions to harvest
+     * @return The number of harvested completions, zero only after shutdown()
+     */
+    size_t wait(std::vector<Completion>& completions,
+                size_t max_count = std::numeric_limits<size_t>::max());
+
+    /**
+     * @brief Blocks until at least one completion is available or the timeout elapses and harvests a batch
+     * @param completions The vector harvested completions are appended to
+     * @param max_count The maximum number of completions to harvest
+     * @param timeout The maximum duration to block for
+     * @return The number of harvested completions, zero when the timeout elapsed
+     */
+    size_t wait_for(std::vector<Completion>& completions,
+                    size_t max_count,
+                    const std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Unblocks all waiting harvesters
+     * After shutdown every wait returns immediately with whatever completions are still queued,
+     * so a harvesting thread blocked in wait() can be released when the application stops.
+     * Completions of requests finishing later are still pushed and can be harvested with try_pop().
+     */
+    void shutdown();
+};
+
+}  // namespace ov
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -23,6 +24,7 @@
 #include "openvino/op/op.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/load_time_profile.hpp"
 #include "openvino/runtime/remote_context.hpp"
 #include "openvino/runtime/tensor.hpp"
 
@@ -254,6 +256,55 @@ public:
         return compile_model(model_path, device_name, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Asynchronously creates a compiled model from a source model object.
+     *
+     * The compilation is scheduled on a shared CPU streams executor and the method returns
+     * immediately, so an application can overlap compilation of several models with its own
+     * work (e.g. I/O) during warm-up. Exceptions thrown during compilation are rethrown from
+     * std::future::get.
+     *
+     * @param model Model object acquired from Core::read_model
+     * @param device_name Name of device to load a model to
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation
+     * @return A future which provides a compiled model once compilation has finished
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Asynchronously reads a model and creates a compiled model from IR / ONNX / PDPD file
+     *
+     * Both reading and compilation are scheduled on a shared CPU streams executor, so file I/O of
+     * one model overlaps with compilation of others. Exceptions thrown during reading or
+     * compilation are rethrown from std::future::get.
+     *
+     * @param model_path Path to a model
+     * @param device_name Name of device to load a model to
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation
+     * @return A future which provides a compiled model once compilation has finished
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Returns the load-time phase breakdown recorded for the most recent load of a model.
+     *
+     * Core measures every Core::compile_model call and keeps the phase timings (model reading,
+     * cache import, plugin compilation, cache export) per model, so an application can report
+     * its "time to ready" metrics broken down by phase. For models compiled from a
+     * Core::read_model result, the read phase measured during read_model is attributed to the
+     * same profile.
+     *
+     * @param model_name The model path for path-based loads, the model friendly name otherwise
+     * @return The phase breakdown of the most recent load of the model
+     */
+    LoadTimeProfile get_load_time_profile(const std::string& model_name) const;
+
     /**
      * @brief Creates a compiled model from a source model within a specified remote context.
      * @param model Model object acquired from Core::read_model
@@ -422,6 +473,25 @@ public:
         return import_model(model_stream, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Exports every compiled model currently alive in this Core into one snapshot stream
+     *
+     * Each model is written as its device export blob together with the device name and the
+     * compilation properties it was loaded with, so a new process can restore the whole set with
+     * Core::import_snapshot and skip model compilation entirely. Models compiled for devices
+     * without import/export support are left out of the snapshot.
+     *
+     * @param snapshot Output stream for the snapshot
+     */
+    void export_snapshot(std::ostream& snapshot);
+
+    /**
+     * @brief Restores all compiled models from a snapshot created by Core::export_snapshot
+     * @param snapshot Input stream with the snapshot
+     * @return Compiled models in the order they were exported
+     */
+    std::vector<CompiledModel> import_snapshot(std::istream& snapshot);
+
     /**
      * @brief Query device if it supports specified model with specified properties
      *
@@ -525,6 +595,32 @@ public:
         return to.template as<T>();
     }
 
+    /**
+     * @brief Returns a snapshot of every property the device can answer in one call.
+     *
+     * The snapshot covers the metrics and config keys the device advertises; entries which
+     * need additional options (e.g. a model for the optimal batch size) are left out. Core
+     * caches the immutable device metrics after the first query, so repeated capability
+     * polling is served from memory instead of going to the device each time.
+     *
+     * @param device_name A name of a device to snapshot the properties of.
+     * @return A map of property name to property value.
+     */
+    AnyMap get_all_properties(const std::string& device_name) const;
+
+    /**
+     * @brief Drops the cached immutable device metrics, so the next query goes to the device.
+     *
+     * Core assumes metrics like the device name or its optimization capabilities never change
+     * while a device is running and answers repeated queries from a cache. The cache is dropped
+     * automatically when a plugin is unloaded or its config changes; this method is for the
+     * remaining cases the application knows better (e.g. a driver update).
+     *
+     * @param device_name A name of a device ("GPU" also covers "GPU.0", "GPU.1", ...);
+     *        an empty name drops the cache of every device.
+     */
+    void invalidate_property_cache(const std::string& device_name = {});
+
     /**
      * @brief Returns devices available for inference
      * Core objects goes over all registered plugins and asks about available devices.
@@ -536,6 +632,20 @@ public:
      */
     std::vector<std::string> get_available_devices() const;
 
+    /**
+     * @brief Loads every registered plugin library and runs its one-time initialization.
+     *
+     * Plugins are normally loaded lazily on first use of their device, which defers costly
+     * initialization (ISA detection, device enumeration) but pays it on the first request.
+     * This explicit warmup lets a process front-load that cost - for example a pre-fork server
+     * can preload plugins in the parent so the workers inherit the already initialized
+     * libraries instead of each paying the device enumeration again.
+     *
+     * Plugins which fail to load (e.g. due to missing drivers) are skipped, same as during
+     * device enumeration.
+     */
+    void preload_plugins();
+
     /**
      * @brief Register a new device and plugin which enable this device inside OpenVINO Runtime.
      *
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides InferAwaitable, a C++20 coroutine adapter for InferRequest.
+ * The runtime itself builds with an older language standard, so the adapter is header-only and
+ * compiled entirely in the application: it is defined only when the including translation unit
+ * supports coroutines and expands to nothing otherwise.
+ *
+ * @file openvino/runtime/infer_awaitable.hpp
+ */
+#pragma once
+
+#if defined(__cpp_impl_coroutine) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+
+#    include <coroutine>
+#    include <exception>
+
+#    include "openvino/runtime/infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief An awaitable wrapping one asynchronous inference of an InferRequest, so coroutine-based
+ * services integrate inference with `co_await infer_async(request)` instead of callback shims.
+ *
+ * Awaiting starts the inference and suspends the coroutine; the completion callback resumes it
+ * directly on the completing thread and `co_await` rethrows the inference exception, if any. The
+ * awaiter lives in the coroutine frame and the completion callback captures just two pointers
+ * (which fit the small-object storage of the callback type), so one await costs no heap
+ * allocation and no synchronization beyond what the async pipeline already does.
+ *
+ * The awaitable replaces the request completion callback and must not be combined with
+ * set_callback() or with concurrent awaits of the same request.
+ */
+class InferAwaitable {
+    InferRequest& _request;
+    std::exception_ptr _exception;
+
+public:
+    /**
+     * @brief Constructs an awaitable for one inference of the given request
+     * @param request The request to run; must stay alive until the await completes
+     */
+    explicit InferAwaitable(InferRequest& request) : _request{request} {}
+
+    /// @brief The inference has not run yet, so the coroutine always suspends
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    /**
+     * @brief Starts the inference; the completion callback resumes the coroutine on the
+     * completing thread
+     * @param handle The coroutine to resume on completion
+     */
+    void await_suspend(std::coroutine_handle<> handle) {
+        _request.set_callback([this, handle](std::exception_ptr exception) {
+            _exception = std::move(exception);
+            handle.resume();
+        });
+        _request.start_async();
+    }
+
+    /// @brief Rethrows the exception raised during inference, if any
+    void await_resume() const {
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+    }
+};
+
+/**
+ * @brief Makes an awaitable running one asynchronous inference of the given request
+ * @param request The request to run; must stay alive until the await completes
+ * @return An awaitable for use in a `co_await` expression
+ */
+inline InferAwaitable infer_async(InferRequest& request) {
+    return InferAwaitable{request};
+}
+
+}  // namespace ov
+
+#endif  // defined(__cpp_impl_coroutine) || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
@@ -260,6 +260,20 @@ public:
      */
     void infer();
 
+    /**
+     * @brief Runs synchronous inference for a batch of samples through one call, amortizing
+     * the per-call overhead of the single-sample flow: the request and the sample layout are
+     * validated once, the model ports are resolved once and the samples are executed in one
+     * guarded loop.
+     * @param inputs One entry per sample, each holding one tensor per model input in the
+     *        order of the model inputs
+     * @param outputs Optional per-sample output tensors, in the order of the model outputs.
+     *        When empty, consecutive samples reuse the request output tensors and only the
+     *        results of the last sample remain accessible after the call
+     */
+    void infer_batch(const std::vector<std::vector<Tensor>>& inputs,
+                     const std::vector<std::vector<Tensor>>& outputs = {});
+
     /**
      * @brief Cancels inference request
      */
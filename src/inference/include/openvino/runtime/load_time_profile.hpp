@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for the LoadTimeProfile structure that describes
+ *        the phase breakdown of a single model load
+ *
+ * @file openvino/runtime/load_time_profile.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace ov {
+
+/**
+ * @struct LoadTimeProfile
+ * @brief Represents the "time to ready" breakdown of one model load performed by Core.
+ *
+ * The phases mirror the stages of Core::compile_model: reading the model from disk,
+ * looking up and importing a cached blob, compiling the model with the plugin (which
+ * includes the plugin transformation pipeline) and exporting the compiled blob to the
+ * cache. Phases that did not run for a particular load are reported as zero; for
+ * example, a load served from the cache has no read and compile phases.
+ */
+struct LoadTimeProfile {
+    /**
+     * @brief The key the profile is stored under: the model path for path-based loads,
+     * the model friendly name otherwise
+     */
+    std::string model_name;
+
+    /**
+     * @brief A name of the device the model was loaded to
+     */
+    std::string device_name;
+
+    /**
+     * @brief Indicates whether the load was served by a cached blob import instead of compilation
+     */
+    bool loaded_from_cache = false;
+
+    /**
+     * @brief Time spent reading the model from disk or memory
+     */
+    std::chrono::microseconds read_model{0};
+
+    /**
+     * @brief Time spent on the cache lookup and, when a valid blob was found, its import
+     */
+    std::chrono::microseconds cache_import{0};
+
+    /**
+     * @brief Time spent in the plugin compilation, including the transformation pipeline
+     */
+    std::chrono::microseconds compile{0};
+
+    /**
+     * @brief Time spent exporting the freshly compiled blob to the cache
+     */
+    std::chrono::microseconds cache_export{0};
+
+    /**
+     * @brief Total wall time of the load operation
+     */
+    std::chrono::microseconds total{0};
+};
+
+}  // namespace ov
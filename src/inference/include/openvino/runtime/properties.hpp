@@ -277,6 +277,24 @@ static constexpr Property<PerformanceMode> performance_mode{"PERFORMANCE_HINT"};
  * usually this value comes from the actual use-case (e.g. number of video-cameras, or other sources of inputs)
  */
 static constexpr Property<uint32_t> num_requests{"PERFORMANCE_HINT_NUM_REQUESTS"};
+
+/**
+ * @brief (Optional) Upper bound, in bytes, on the device memory a compiled model should occupy.
+ * The hint makes a device prefer smaller-footprint choices during compilation (e.g. skip
+ * memory-hungry caches or per-socket weight replication) when the model would otherwise
+ * exceed the budget. It is best effort, not a hard limit. The value 0 (default) means no budget.
+ */
+static constexpr Property<uint64_t> memory_budget{"MEMORY_BUDGET_HINT"};
+
+/**
+ * @brief (Optional) Enables empirical algorithm selection during model compilation.
+ * When enabled, a device benchmarks the candidate implementations of performance-critical
+ * operations (e.g. direct vs. Winograd convolution) on the model's actual shapes and picks
+ * the fastest, within a bounded compile-time budget, instead of relying purely on heuristics.
+ * Compilation takes longer; with model caching enabled the cost is paid only on the first
+ * compilation. Disabled by default.
+ */
+static constexpr Property<bool> empirical_algorithm_selection{"EMPIRICAL_ALGORITHM_SELECTION_HINT"};
 }  // namespace hint
 
 /**
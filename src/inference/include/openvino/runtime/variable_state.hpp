@@ -76,6 +76,20 @@ public:
      * @param state The current state to set
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Returns the number of valid elements along the sequence axis for a state
+     * pre-allocated at its maximal length (e.g. a streaming cache appended in place).
+     * @return The valid prefix length of the state
+     */
+    size_t get_state_length() const;
+
+    /**
+     * @brief Sets the valid prefix length of the state without copying the data.
+     * Passing 0 discards the accumulated prefix while keeping the allocation.
+     * @param length The new valid prefix length
+     */
+    void set_state_length(size_t length);
 };
 
 namespace runtime {
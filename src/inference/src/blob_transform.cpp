@@ -4,6 +4,7 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #    include "cpu_x86_sse42/blob_transform_sse42.hpp"
@@ -50,33 +51,39 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     dst_ptr += dst_blk_desc.getOffsetPadding();
 
 #ifdef HAVE_SSE
+    // The vectored kernels process independent (n, h) rows, so split the row space
+    // between threads and let each call handle a single row.
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    H_src_stride,
-                                    N_dst_stride,
-                                    H_dst_stride,
-                                    C_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride + h * H_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride + h * H_dst_stride,
+                                        N_src_stride,
+                                        H_src_stride,
+                                        N_dst_stride,
+                                        H_dst_stride,
+                                        C_dst_stride,
+                                        1,
+                                        1,
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     H_src_stride,
-                                     N_dst_stride,
-                                     H_dst_stride,
-                                     C_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride + h * H_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride + h * H_dst_stride,
+                                         N_src_stride,
+                                         H_src_stride,
+                                         N_dst_stride,
+                                         H_dst_stride,
+                                         C_dst_stride,
+                                         1,
+                                         1,
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
@@ -84,30 +91,34 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    H_src_stride,
-                                    C_src_stride,
-                                    N_dst_stride,
-                                    H_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride + h * H_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride + h * H_dst_stride,
+                                        N_src_stride,
+                                        H_src_stride,
+                                        C_src_stride,
+                                        N_dst_stride,
+                                        H_dst_stride,
+                                        1,
+                                        1,
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     H_src_stride,
-                                     C_src_stride,
-                                     N_dst_stride,
-                                     H_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for2d(N, H, [&](size_t n, size_t h) {
+                blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride + h * H_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride + h * H_dst_stride,
+                                         N_src_stride,
+                                         H_src_stride,
+                                         C_src_stride,
+                                         N_dst_stride,
+                                         H_dst_stride,
+                                         1,
+                                         1,
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
@@ -116,35 +127,31 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
 #endif  // HAVE_SSE
 
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
         for (size_t i = 0; i < N * C * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
@@ -211,39 +218,45 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
 
 #ifdef HAVE_SSE
+    // The vectored kernels process independent (n, d) slices, so split the slice
+    // space between threads and let each call handle a single slice.
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
         C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    D_src_stride,
-                                    H_src_stride,
-                                    N_dst_stride,
-                                    D_dst_stride,
-                                    H_dst_stride,
-                                    C_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(D),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for2d(N, D, [&](size_t n, size_t d) {
+                blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride + d * D_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride + d * D_dst_stride,
+                                        N_src_stride,
+                                        D_src_stride,
+                                        H_src_stride,
+                                        N_dst_stride,
+                                        D_dst_stride,
+                                        H_dst_stride,
+                                        C_dst_stride,
+                                        1,
+                                        1,
+                                        static_cast<int>(H),
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     D_src_stride,
-                                     H_src_stride,
-                                     N_dst_stride,
-                                     D_dst_stride,
-                                     H_dst_stride,
-                                     C_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(D),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for2d(N, D, [&](size_t n, size_t d) {
+                blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride + d * D_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride + d * D_dst_stride,
+                                         N_src_stride,
+                                         D_src_stride,
+                                         H_src_stride,
+                                         N_dst_stride,
+                                         D_dst_stride,
+                                         H_dst_stride,
+                                         C_dst_stride,
+                                         1,
+                                         1,
+                                         static_cast<int>(H),
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
@@ -251,36 +264,40 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
         C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
         if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr),
-                                    reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride,
-                                    D_src_stride,
-                                    H_src_stride,
-                                    C_src_stride,
-                                    N_dst_stride,
-                                    D_dst_stride,
-                                    H_dst_stride,
-                                    static_cast<int>(N),
-                                    static_cast<int>(D),
-                                    static_cast<int>(H),
-                                    static_cast<int>(W));
+            parallel_for2d(N, D, [&](size_t n, size_t d) {
+                blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr) + n * N_src_stride + d * D_src_stride,
+                                        reinterpret_cast<uint8_t*>(dst_ptr) + n * N_dst_stride + d * D_dst_stride,
+                                        N_src_stride,
+                                        D_src_stride,
+                                        H_src_stride,
+                                        C_src_stride,
+                                        N_dst_stride,
+                                        D_dst_stride,
+                                        H_dst_stride,
+                                        1,
+                                        1,
+                                        static_cast<int>(H),
+                                        static_cast<int>(W));
+            });
             return;
         }
 
         if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr),
-                                     reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride,
-                                     D_src_stride,
-                                     H_src_stride,
-                                     C_src_stride,
-                                     N_dst_stride,
-                                     D_dst_stride,
-                                     H_dst_stride,
-                                     static_cast<int>(N),
-                                     static_cast<int>(D),
-                                     static_cast<int>(H),
-                                     static_cast<int>(W));
+            parallel_for2d(N, D, [&](size_t n, size_t d) {
+                blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr) + n * N_src_stride + d * D_src_stride,
+                                         reinterpret_cast<float*>(dst_ptr) + n * N_dst_stride + d * D_dst_stride,
+                                         N_src_stride,
+                                         D_src_stride,
+                                         H_src_stride,
+                                         C_src_stride,
+                                         N_dst_stride,
+                                         D_dst_stride,
+                                         H_dst_stride,
+                                         1,
+                                         1,
+                                         static_cast<int>(H),
+                                         static_cast<int>(W));
+            });
             return;
         }
     }
@@ -288,39 +305,31 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     (void)H_dst_stride;
 #endif  // HAVE_SSE
     if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
+        parallel_for3d(N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    src_ptr_l_l += W_src_stride;
+                    dst_ptr_l++;
                 }
             }
-        }
+        });
     } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
+        parallel_for3d(N, C, D, [&](size_t n, size_t c, size_t d) {
+            data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
+            data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
+            for (size_t h = 0; h < H; h++) {
+                data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
+                for (size_t w = 0; w < W; w++) {
+                    *dst_ptr_l = *src_ptr_l_l;
+                    dst_ptr_l += W_dst_stride;
+                    src_ptr_l_l++;
                 }
             }
-        }
+        });
     } else {
         for (size_t i = 0; i < N * C * D * H * W; i++) {
             dst_ptr[i] = src_ptr[i];
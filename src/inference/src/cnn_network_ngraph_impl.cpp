@@ -430,7 +430,10 @@ void CNNNetworkNGraphImpl::reshape(const std::map<std::string, ngraph::PartialSh
 
     {
         shared_ptr<Function> specialized_ngraph_function = nullptr;
-        if (outputs_are_static) {
+        if (outputs_are_static || _new_api) {
+            // Data keeps the partial shape as is, so the 2.0 API does not need the
+            // legacy static-ization below; skipping it saves a full graph clone plus
+            // a pass pipeline on every wrapper construction for a dynamic model
             specialized_ngraph_function = _ngraph_function;
         } else {
             specialized_ngraph_function = ngraph::clone_function(*_ngraph_function);
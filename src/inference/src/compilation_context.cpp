@@ -12,6 +12,9 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <mutex>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
@@ -41,6 +44,107 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+/**
+ * Memoizes the model-dependent part of the cache hash per ngraph::Function instance.
+ *
+ * Running the Hash pass serializes the whole model, which takes hundreds of
+ * milliseconds for large topologies; warming up the same model object on several
+ * devices or with different compile options used to pay that cost on every call.
+ * Entries are keyed by the function address and validated through a weak_ptr, so
+ * a function recreated at a reused address cannot alias a stale hash. The same
+ * instance can legitimately be mutated in place between compilations
+ * (read_model -> reshape -> compile_model), so every lookup is additionally
+ * validated against a cheap structural fingerprint: it covers everything a user
+ * can change without replacing the instance - topology, names, ports, shapes,
+ * types and runtime info - and only skips the constant data whose serialization
+ * makes the full Hash pass expensive.
+ */
+class ModelHashCache {
+public:
+    static uint64_t modelFingerprint(const std::shared_ptr<ngraph::Function>& function) {
+        uint64_t seed = 0;
+        std::unordered_map<const ngraph::Node*, size_t> ids;
+        for (const auto& op : function->get_ordered_ops()) {
+            ids[op.get()] = ids.size();
+            seed = hash_combine(seed, std::string(op->get_type_info().name));
+            seed = hash_combine(seed, static_cast<uint64_t>(op->get_type_info().version));
+            seed = hash_combine(seed, op->get_friendly_name());
+            for (const auto& input : op->input_values()) {
+                seed = hash_combine(seed, ids[input.get_node()]);
+                seed = hash_combine(seed, input.get_index());
+            }
+            for (const auto& output : op->outputs()) {
+                seed = hash_combine(seed, output.get_element_type().get_type_name());
+                std::stringstream shapeStrm;
+                shapeStrm << output.get_partial_shape();
+                seed = hash_combine(seed, shapeStrm.str());
+            }
+            for (const auto& rtMapData : op->get_rt_info()) {
+                seed = hash_combine(seed, rtMapData.first);
+                std::stringstream strm;
+                rtMapData.second.print(strm);
+                seed = hash_combine(seed, strm.str());
+            }
+        }
+        return seed;
+    }
+
+    uint64_t modelHash(const std::shared_ptr<ngraph::Function>& function) {
+        const uint64_t fingerprint = modelFingerprint(function);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_hashes.find(function.get());
+            if (it != m_hashes.end() && it->second.function.lock() == function &&
+                it->second.fingerprint == fingerprint) {
+                return it->second.hash;
+            }
+        }
+
+        uint64_t seed = 0;
+        ov::pass::Manager m;
+        m.register_pass<ngraph::pass::FixRtInfo>();
+        m.register_pass<ov::pass::Hash>(seed);
+        m.run_passes(function);
+
+        // Runtime information is not covered by serialization-based hashing
+        for (const auto& op : function->get_ordered_ops()) {
+            const auto& rt = op->get_rt_info();
+            for (const auto& rtMapData : rt) {
+                seed = hash_combine(seed, rtMapData.first);
+                std::stringstream strm;
+                rtMapData.second.print(strm);
+                seed = hash_combine(seed, strm.str());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_hashes.begin(); it != m_hashes.end();) {
+            it = it->second.function.expired() ? m_hashes.erase(it) : std::next(it);
+        }
+        m_hashes[function.get()] = {function, fingerprint, seed};
+        return seed;
+    }
+
+    static ModelHashCache& instance() {
+        static ModelHashCache cache;
+        return cache;
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<ngraph::Function> function;
+        uint64_t fingerprint;
+        uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const ngraph::Function*, Entry> m_hashes;
+};
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -69,31 +173,17 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     IE_ASSERT(network.getFunction());
 
-    uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function and its runtime information; this part only
+    // depends on the model itself, so it is memoized per function instance
     CNNNetwork net(network);
-    ov::pass::Manager m;
-    m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
-    m.run_passes(net.getFunction());
+    uint64_t seed = ModelHashCache::instance().modelHash(net.getFunction());
 
-    // 2. Compute hash on serialized data and options
+    // 2. Compute hash on compile options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : network.getFunction()->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
-        }
-    }
-
-    // 4. Add inputs info
+    // 3. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -114,7 +204,7 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
         }
     }
 
-    // 5. Add outputs info
+    // 4. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
         seed = hash_combine(seed, as_int32_t(info->getPrecision()));
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/completion_queue.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace ov {
+
+struct CompletionQueue::Impl {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    std::deque<Completion> completions;
+    bool shutDown = false;
+
+    void push(int64_t tag, std::exception_ptr exception) {
+        bool wasEmpty = false;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            wasEmpty = completions.empty();
+            completions.push_back({tag, std::move(exception)});
+        }
+        // harvesters only sleep on an empty queue, so notification is needed just for
+        // the empty -> non-empty transition; that way a burst of completions wakes the
+        // harvesting thread once instead of once per request
+        if (wasEmpty) {
+            conditionVariable.notify_one();
+        }
+    }
+
+    size_t pop(std::unique_lock<std::mutex>& lock, std::vector<Completion>& out, size_t maxCount) {
+        size_t count = 0;
+        while (count < maxCount && !completions.empty()) {
+            out.emplace_back(std::move(completions.front()));
+            completions.pop_front();
+            ++count;
+        }
+        const bool leftover = !completions.empty();
+        lock.unlock();
+        // completions left behind by a bounded harvest would otherwise be noticed only on
+        // the next push, so hand them over to another waiter right away
+        if (leftover) {
+            conditionVariable.notify_one();
+        }
+        return count;
+    }
+};
+
+CompletionQueue::CompletionQueue() : _impl{std::make_shared<Impl>()} {}
+
+void CompletionQueue::subscribe(InferRequest& request, int64_t tag) {
+    auto impl = _impl;
+    request.set_callback([impl, tag](std::exception_ptr exception) {
+        impl->push(tag, std::move(exception));
+    });
+}
+
+size_t CompletionQueue::try_pop(std::vector<Completion>& completions, size_t max_count) {
+    std::unique_lock<std::mutex> lock{_impl->mutex};
+    return _impl->pop(lock, completions, max_count);
+}
+
+size_t CompletionQueue::wait(std::vector<Completion>& completions, size_t max_count) {
+    std::unique_lock<std::mutex> lock{_impl->mutex};
+    _impl->conditionVariable.wait(lock, [&] {
+        return _impl->shutDown || !_impl->completions.empty();
+    });
+    return _impl->pop(lock, completions, max_count);
+}
+
+size_t CompletionQueue::wait_for(std::vector<Completion>& completions,
+                                 size_t max_count,
+                                 const std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock{_impl->mutex};
+    if (!_impl->conditionVariable.wait_for(lock, timeout, [&] {
+            return _impl->shutDown || !_impl->completions.empty();
+        })) {
+        return 0;
+    }
+    return _impl->pop(lock, completions, max_count);
+}
+
+void CompletionQueue::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock{_impl->mutex};
+        _impl->shutDown = true;
+    }
+    _impl->conditionVariable.notify_all();
+}
+
+}  // namespace ov
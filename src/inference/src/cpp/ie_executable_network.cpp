@@ -208,6 +208,16 @@ void CompiledModel::export_model(std::ostream& networkModel) {
     OV_EXEC_NET_CALL_STATEMENT(_impl->Export(networkModel));
 }
 
+void CompiledModel::update_weights(const std::map<std::string, Tensor>& weights) {
+    OV_EXEC_NET_CALL_STATEMENT({
+        std::map<std::string, ie::Blob::Ptr> blobs;
+        for (const auto& weight : weights) {
+            blobs.emplace(weight.first, weight.second._impl);
+        }
+        _impl->UpdateWeights(blobs);
+    });
+}
+
 void CompiledModel::set_property(const AnyMap& config) {
     OV_EXEC_NET_CALL_STATEMENT(_impl->SetConfig(config));
 }
@@ -133,6 +133,11 @@ void InferRequest::SetCompletionCallbackImpl(std::function<void()> callbackToSet
     });)
 }
 
+void InferRequest::SetOutputCompletionCallback(const std::string& name,
+                                               std::function<void(const std::string&)> callbackToSet) {
+    INFER_REQ_CALL_STATEMENT(_impl->SetOutputCompletionCallback(name, std::move(callbackToSet));)
+}
+
 #define CATCH_IE_EXCEPTION_RETURN(StatusCode, ExceptionType) \
     catch (const ExceptionType&) {                           \
         return StatusCode;                                   \
@@ -414,6 +419,57 @@ void InferRequest::infer() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Infer();)
 }
 
+void InferRequest::infer_batch(const std::vector<std::vector<Tensor>>& inputs,
+                               const std::vector<std::vector<Tensor>>& outputs) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        OPENVINO_ASSERT(!inputs.empty(), "infer_batch was called with an empty batch.");
+        OPENVINO_ASSERT(outputs.empty() || outputs.size() == inputs.size(),
+                        "infer_batch error. Got ",
+                        outputs.size(),
+                        " output sample(s) for ",
+                        inputs.size(),
+                        " input sample(s).");
+        // resolve the port names and validate the sample layout once for the whole batch
+        std::vector<std::string> inputNames;
+        for (const auto& input : _impl->GetInputs()) {
+            inputNames.push_back(get_legacy_name_from_port(input->output(0)));
+        }
+        std::vector<std::string> outputNames;
+        if (!outputs.empty()) {
+            for (const auto& output : _impl->GetOutputs()) {
+                outputNames.push_back(get_legacy_name_from_port(output->output(0)));
+            }
+        }
+        for (auto&& sample : inputs) {
+            OPENVINO_ASSERT(sample.size() == inputNames.size(),
+                            "infer_batch error. A sample holds ",
+                            sample.size(),
+                            " input tensor(s) while the model has ",
+                            inputNames.size(),
+                            " input(s).");
+        }
+        for (auto&& sample : outputs) {
+            OPENVINO_ASSERT(sample.size() == outputNames.size(),
+                            "infer_batch error. A sample holds ",
+                            sample.size(),
+                            " output tensor(s) while the model has ",
+                            outputNames.size(),
+                            " output(s).");
+        }
+        for (std::size_t sample = 0; sample < inputs.size(); ++sample) {
+            for (std::size_t port = 0; port < inputNames.size(); ++port) {
+                _impl->SetBlob(inputNames[port], inputs[sample][port]._impl);
+            }
+            if (!outputs.empty()) {
+                for (std::size_t port = 0; port < outputNames.size(); ++port) {
+                    _impl->SetBlob(outputNames[port], outputs[sample][port]._impl);
+                }
+            }
+            _impl->Infer();
+        }
+    });
+}
+
 void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
@@ -421,17 +477,21 @@ void InferRequest::cancel() {
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT({
         auto ieInfos = _impl->GetPerformanceCounts();
+        // one sort of iterators instead of a min_element/erase selection per entry
+        std::vector<decltype(ieInfos)::const_iterator> order;
+        order.reserve(ieInfos.size());
+        for (auto it = ieInfos.cbegin(); it != ieInfos.cend(); ++it) {
+            order.push_back(it);
+        }
+        std::sort(order.begin(),
+                  order.end(),
+                  [](const decltype(ieInfos)::const_iterator& lhs, const decltype(ieInfos)::const_iterator& rhs) {
+                      return lhs->second.execution_index < rhs->second.execution_index;
+                  });
         std::vector<ProfilingInfo> infos;
         infos.reserve(ieInfos.size());
-        while (!ieInfos.empty()) {
-            auto itIeInfo = std::min_element(
-                std::begin(ieInfos),
-                std::end(ieInfos),
-                [](const decltype(ieInfos)::value_type& lhs, const decltype(ieInfos)::value_type& rhs) {
-                    return lhs.second.execution_index < rhs.second.execution_index;
-                });
-            IE_ASSERT(itIeInfo != ieInfos.end());
-            auto& ieInfo = itIeInfo->second;
+        for (const auto& itIeInfo : order) {
+            const auto& ieInfo = itIeInfo->second;
             infos.push_back(ProfilingInfo{});
             auto& info = infos.back();
             switch (ieInfo.status) {
@@ -450,7 +510,6 @@ std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
             info.node_name = itIeInfo->first;
             info.exec_type = std::string{ieInfo.exec_type};
             info.node_type = std::string{ieInfo.layer_type};
-            ieInfos.erase(itIeInfo);
         }
         return infos;
     })
@@ -79,6 +79,14 @@ std::string VariableState::get_name() const {
     OV_VARIABLE_CALL_STATEMENT(return _impl->GetName());
 }
 
+size_t VariableState::get_state_length() const {
+    OV_VARIABLE_CALL_STATEMENT(return _impl->GetStateLength());
+}
+
+void VariableState::set_state_length(size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->SetStateLength(length));
+}
+
 Tensor VariableState::get_state() const {
     OV_VARIABLE_CALL_STATEMENT(return {std::const_pointer_cast<ie::Blob>(_impl->GetState()), _so});
 }
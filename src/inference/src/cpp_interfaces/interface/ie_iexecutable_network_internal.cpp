@@ -83,6 +83,10 @@ void IExecutableNetworkInternal::Export(std::ostream& networkModel) {
     IE_THROW(NotImplemented);
 }
 
+void IExecutableNetworkInternal::UpdateWeights(const std::map<std::string, Blob::Ptr>&) {
+    IE_THROW(NotImplemented);
+}
+
 std::shared_ptr<ngraph::Function> IExecutableNetworkInternal::GetExecGraphInfo() {
     IE_THROW(NotImplemented);
 }
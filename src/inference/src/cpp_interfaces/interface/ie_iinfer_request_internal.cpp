@@ -108,6 +108,18 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
     }
     if (!userBlob)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+    // Applications rotating among a few pre-allocated buffers re-bind the same blobs on every
+    // request; re-apply a binding which already passed the checks below without repeating them
+    if (const auto* knownBinding = findKnownBlobBinding(name, userBlob)) {
+        if (knownBinding->isInput) {
+            _inputs[name] = userBlob;
+            _deviceInputs[name] = userBlob;
+            _batched_inputs.erase(name);
+        } else {
+            _outputs[name] = userBlob;
+        }
+        return;
+    }
     InputInfo::Ptr foundInput;
     DataPtr foundOutput;
     const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
@@ -152,6 +164,7 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
             }
             _inputs[name] = userBlob;
             devBlob = userBlob;
+            rememberBlobBinding(name, userBlob, true);
         }
         _batched_inputs.erase(name);
     } else {
@@ -175,9 +188,41 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
         //     IE_THROW(ParameterMismatch) << "Failed to set Blob with layout not corresponding to user output layout";
         // }
         _outputs[name] = userBlob;
+        rememberBlobBinding(name, userBlob, false);
     }
 }
 
+const IInferRequestInternal::KnownBlobBinding* IInferRequestInternal::findKnownBlobBinding(const std::string& name,
+                                                                                           const Blob::Ptr& blob) const {
+    const auto it = _knownBlobBindings.find(name);
+    if (it == _knownBlobBindings.end())
+        return nullptr;
+    if (blob->is<CompoundBlob>() || blob->is<RemoteBlob>())
+        return nullptr;
+    void* buffer = blob->buffer().as<void*>();
+    for (const auto& binding : it->second) {
+        if (binding.blob == blob.get() && binding.buffer == buffer && binding.desc == blob->getTensorDesc())
+            return &binding;
+    }
+    return nullptr;
+}
+
+void IInferRequestInternal::rememberBlobBinding(const std::string& name, const Blob::Ptr& blob, bool isInput) {
+    if (blob->is<CompoundBlob>() || blob->is<RemoteBlob>())
+        return;
+    auto& bindings = _knownBlobBindings[name];
+    // a handful of rotated buffers is the practical case; do not let the cache grow unbounded
+    constexpr size_t maxBindingsPerPort = 8;
+    if (bindings.size() >= maxBindingsPerPort)
+        bindings.erase(bindings.begin());
+    KnownBlobBinding binding;
+    binding.blob = blob.get();
+    binding.buffer = blob->buffer().as<void*>();
+    binding.desc = blob->getTensorDesc();
+    binding.isInput = isInput;
+    bindings.push_back(std::move(binding));
+}
+
 void IInferRequestInternal::SetBlobs(const std::string& name, const std::vector<Blob::Ptr>& blobs) {
     if (blobs.size() == 1) {
         SetBlob(name, blobs[0]);
@@ -404,6 +449,8 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& da
     DataPtr foundOutput;
     if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
         foundInput->getPreProcess() = copyPreProcess(info);
+        // the new pre-processing info may change the outcome of blob validation
+        _knownBlobBindings.erase(name);
     } else {
         IE_THROW() << "Pre-process can't be set to output blob";
     }
@@ -446,6 +493,17 @@ void IInferRequestInternal::SetCallback(Callback callback) {
     _callback = std::move(callback);
 }
 
+void IInferRequestInternal::SetOutputCompletionCallback(const std::string& outputName, OutputCompletionCallback callback) {
+    if (_networkOutputs.find(outputName) == _networkOutputs.end()) {
+        IE_THROW(NotFound) << "Failed to set completion callback. Output with name " << outputName << " wasn't found";
+    }
+    if (callback) {
+        _outputCompletionCallbacks[outputName] = std::move(callback);
+    } else {
+        _outputCompletionCallbacks.erase(outputName);
+    }
+}
+
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
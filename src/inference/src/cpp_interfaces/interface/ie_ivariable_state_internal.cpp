@@ -23,4 +23,12 @@ Blob::CPtr IVariableStateInternal::GetState() const {
     return state;
 }
 
+void IVariableStateInternal::SetStateLength(size_t length) {
+    stateLength = length;
+}
+
+size_t IVariableStateInternal::GetStateLength() const {
+    return stateLength;
+}
+
 }  // namespace InferenceEngine
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_f16c.hpp"
+
+#include <immintrin.h>  // F16C / AVX2
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+
+void f16tof32Arrays_f16c(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256 f = _mm256_cvtph_ps(h);
+        f = _mm256_fmadd_ps(f, vscale, vbias);
+        _mm256_storeu_ps(dst + i, f);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_f16c(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+    // Clamp to the maximal finite f16 magnitude to keep the scalar path's
+    // saturation semantics: overflow produces +/-max16 rather than INF. The
+    // constant-first operand order makes MINPS/MAXPS pass NaN inputs through.
+    const __m256 vmax = _mm256_set1_ps(65504.0f);
+    const __m256 vmin = _mm256_set1_ps(-65504.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        f = _mm256_fmadd_ps(f, vscale, vbias);
+        f = _mm256_max_ps(vmin, _mm256_min_ps(vmax, f));
+        __m128i h = _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,23 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// FP16 <-> FP32 array conversion primitives vectored for F16C/AVX2
+// (w/o threads, the caller splits the work)
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_f16c(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_f16c(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace InferenceEngine
@@ -8,46 +8,101 @@
 
 namespace InferenceEngine {
 
+void SharedMutex::lock() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pendingWriters++;
+    m_cv.wait(lock, [&] {
+        return m_readers == 0 && !m_writer;
+    });
+    m_pendingWriters--;
+    m_writer = true;
+}
+
+void SharedMutex::unlock() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_writer = false;
+    }
+    m_cv.notify_all();
+}
+
+void SharedMutex::lock_shared() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [&] {
+        return !m_writer && m_pendingWriters == 0;
+    });
+    m_readers++;
+}
+
+void SharedMutex::unlock_shared() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (--m_readers == 0) {
+        lock.unlock();
+        m_cv.notify_all();
+    }
+}
+
+//////////////////////////////////////////////////////
+
 CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
                                  const std::string& hash,
-                                 std::shared_ptr<std::mutex> m,
-                                 std::atomic_int& refCount)
+                                 std::shared_ptr<SharedMutex> m,
+                                 std::atomic_int& refCount,
+                                 bool exclusive)
     : m_cacheGuard(cacheGuard),
       m_hash(hash),
       m_mutex(m),
-      m_refCount(refCount) {
+      m_refCount(refCount),
+      m_exclusive(exclusive) {
     // Don't lock mutex right here for exception-safe considerations
     m_refCount++;
 }
 
 CacheGuardEntry::~CacheGuardEntry() {
     m_refCount--;
-    m_mutex->unlock();
+    if (m_exclusive) {
+        m_mutex->unlock();
+    } else {
+        m_mutex->unlock_shared();
+    }
     m_cacheGuard.checkForRemove(m_hash);
 }
 
 void CacheGuardEntry::performLock() {
-    m_mutex->lock();
+    if (m_exclusive) {
+        m_mutex->lock();
+    } else {
+        m_mutex->lock_shared();
+    }
 }
 
 //////////////////////////////////////////////////////
 
+constexpr std::size_t CacheGuard::c_numStripes;
+
 CacheGuard::~CacheGuard() {
-    IE_ASSERT(m_table.size() == 0);
+    for (auto& stripe : m_stripes) {
+        IE_ASSERT(stripe.m_table.size() == 0);
+    }
 }
 
-std::unique_ptr<CacheGuardEntry> CacheGuard::getHashLock(const std::string& hash) {
-    std::unique_lock<std::mutex> lock(m_tableMutex);
-    auto& data = m_table[hash];
+CacheGuard::Stripe& CacheGuard::getStripe(const std::string& hash) {
+    return m_stripes[std::hash<std::string>{}(hash) % c_numStripes];
+}
+
+std::unique_ptr<CacheGuardEntry> CacheGuard::getLockImpl(const std::string& hash, bool exclusive) {
+    auto& stripe = getStripe(hash);
+    std::unique_lock<std::mutex> lock(stripe.m_tableMutex);
+    auto& data = stripe.m_table[hash];
     std::unique_ptr<CacheGuardEntry> res;
     try {
         // TODO: use std::make_unique when migrated to C++14
-        res =
-            std::unique_ptr<CacheGuardEntry>(new CacheGuardEntry(*this, hash, data.m_mutexPtr, data.m_itemRefCounter));
+        res = std::unique_ptr<CacheGuardEntry>(
+            new CacheGuardEntry(*this, hash, data.m_mutexPtr, data.m_itemRefCounter, exclusive));
     } catch (...) {
         // In case of exception, we shall remove hash entry if it is not used
         if (data.m_itemRefCounter == 0) {
-            m_table.erase(hash);
+            stripe.m_table.erase(hash);
         }
         throw;
     }
@@ -56,13 +111,22 @@ std::unique_ptr<CacheGuardEntry> CacheGuard::getHashLock(const std::string& hash
     return res;
 }
 
+std::unique_ptr<CacheGuardEntry> CacheGuard::getHashLock(const std::string& hash) {
+    return getLockImpl(hash, true);
+}
+
+std::unique_ptr<CacheGuardEntry> CacheGuard::getReadHashLock(const std::string& hash) {
+    return getLockImpl(hash, false);
+}
+
 void CacheGuard::checkForRemove(const std::string& hash) {
-    std::lock_guard<std::mutex> lock(m_tableMutex);
-    if (m_table.count(hash)) {
-        auto& data = m_table[hash];
+    auto& stripe = getStripe(hash);
+    std::lock_guard<std::mutex> lock(stripe.m_tableMutex);
+    if (stripe.m_table.count(hash)) {
+        auto& data = stripe.m_table[hash];
         if (data.m_itemRefCounter == 0) {
             // Nobody is using this and nobody is waiting for it - can be removed
-            m_table.erase(hash);
+            stripe.m_table.erase(hash);
         }
     }
 }
@@ -10,7 +10,9 @@
  * @file ie_cache_guard.hpp
  */
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -19,10 +21,47 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Reader/writer mutex: a resource is held either by any number of readers or by a
+ * single writer. A pending writer blocks new readers, so a steady stream of cache hits
+ * cannot starve a thread which needs to fill the cache.
+ * It is a minimal C++11 stand-in for std::shared_mutex
+ */
+class SharedMutex {
+public:
+    /**
+     * @brief Acquires exclusive (writer) ownership, waits for all readers and writers to leave
+     */
+    void lock();
+
+    /**
+     * @brief Releases exclusive ownership
+     */
+    void unlock();
+
+    /**
+     * @brief Acquires shared (reader) ownership, waits while a writer holds or awaits the mutex
+     */
+    void lock_shared();
+
+    /**
+     * @brief Releases shared ownership
+     */
+    void unlock_shared();
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    unsigned int m_readers = 0;
+    unsigned int m_pendingWriters = 0;
+    bool m_writer = false;
+};
+
 class CacheGuard;
 /**
  * @brief This class represents RAII guard class to protect multiple threads to modify the same cached network
- * Use CacheGuard::getHashLock(hash) to acquire lock for specific cache entry identified by its 'hash'
+ * Use CacheGuard::getHashLock(hash) to acquire exclusive lock for specific cache entry identified by its 'hash',
+ * or CacheGuard::getReadHashLock(hash) to share the entry with other readers
  * On destruction, lock will be released
  * @see CacheGuard
  */
@@ -35,11 +74,13 @@ public:
      * @param hash String representing hash of network
      * @param m Shared pointer to mutex for internal locking
      * @param refCount Reference counter. Will be decremented on CacheGuardEntry destruction
+     * @param exclusive True for exclusive (writer) ownership, false for shared (reader) one
      */
     CacheGuardEntry(CacheGuard& cacheGuard,
                     const std::string& hash,
-                    std::shared_ptr<std::mutex> m,
-                    std::atomic_int& refCount);
+                    std::shared_ptr<SharedMutex> m,
+                    std::atomic_int& refCount,
+                    bool exclusive);
     CacheGuardEntry(const CacheGuardEntry&) = delete;
     CacheGuardEntry& operator=(const CacheGuardEntry&) = delete;
 
@@ -63,14 +104,17 @@ public:
 private:
     CacheGuard& m_cacheGuard;
     std::string m_hash;
-    std::shared_ptr<std::mutex> m_mutex;
+    std::shared_ptr<SharedMutex> m_mutex;
     std::atomic_int& m_refCount;
+    bool m_exclusive;
 };
 
 /**
  * @brief This class holds a table of currently locked hashes
  * Inference engine core will need to obtain a lock for a specific cache to get exclusive access to it
  * It is needed to avoid race situations when multiple threads try to to write to the same cache simultaneously
+ * Read (import) paths take a shared lock instead, so concurrent loads of an already cached network do not serialize
+ * The table itself is striped by the hash value to keep its own lock out of the way on many-core startup stampedes
  *
  * Usage example:
  *     auto hash = <calculate hash for network>;
@@ -95,20 +139,31 @@ public:
      */
     std::unique_ptr<CacheGuardEntry> getHashLock(const std::string& hash);
 
+    /**
+     * @brief Gets a shared lock for a specific cache entry identified by it's hash value
+     * Once returned, client can read the cache entry concurrently with other shared holders
+     * If any thread holds an exclusive lock to same hash - this function will not return until it is unlocked
+     *
+     * @param hash String representing hash of network
+     *
+     * @return RAII pointer to CacheGuardEntry
+     */
+    std::unique_ptr<CacheGuardEntry> getReadHashLock(const std::string& hash);
+
     /**
      * @brief Checks whether there is any clients holding the lock after CacheGuardEntry deletion
      * It will be called on destruction of CacheGuardEntry and shall not be used directly by client's code
      * If there is no more clients holding the lock, associated entry will be removed from table unlocked
      *
      * @param hash String representing hash of network
-     *
-     * @return RAII pointer to CacheGuardEntry
      */
     void checkForRemove(const std::string& hash);
 
 private:
+    std::unique_ptr<CacheGuardEntry> getLockImpl(const std::string& hash, bool exclusive);
+
     struct Item {
-        std::shared_ptr<std::mutex> m_mutexPtr{std::make_shared<std::mutex>()};
+        std::shared_ptr<SharedMutex> m_mutexPtr{std::make_shared<SharedMutex>()};
         // Reference counter for item usage
         std::atomic_int m_itemRefCounter{0};
 
@@ -118,8 +173,15 @@ private:
         Item(Item&& other) : m_mutexPtr(std::move(other.m_mutexPtr)), m_itemRefCounter(other.m_itemRefCounter.load()) {}
         Item& operator=(Item&& other) = delete;
     };
-    std::mutex m_tableMutex;
-    std::unordered_map<std::string, Item> m_table;
+    struct Stripe {
+        std::mutex m_tableMutex;
+        std::unordered_map<std::string, Item> m_table;
+    };
+    static constexpr std::size_t c_numStripes = 16;
+
+    Stripe& getStripe(const std::string& hash);
+
+    std::array<Stripe, c_numStripes> m_stripes;
 };
 
 }  // namespace InferenceEngine
@@ -16,6 +16,10 @@
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "ie_shared_stream_buffer.hpp"
+#include "openvino/util/env_util.hpp"
+#include "openvino/util/file_lock.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace InferenceEngine {
 
@@ -85,6 +89,14 @@ class FileStorageCacheManager final : public ICacheManager {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    // Advisory lock on a sidecar file next to the blob: it orders concurrent processes
+    // on one host (readers share, a writer excludes), while the in-process ordering is
+    // done by the CacheGuard. The sidecar is never removed, so the lock is not taken
+    // on a file which another process is about to delete.
+    std::shared_ptr<ov::util::FileLock> lockBlobFile(const std::string& blobHash, bool exclusive) const {
+        return ov::util::lock_file(getBlobFile(blobHash) + ".lock", exclusive);
+    }
+
 public:
     /**
      * @brief Constructor
@@ -100,20 +112,36 @@ public:
 
 private:
     void writeCacheEntry(const std::string& id, StreamWriter writer) override {
+        auto lock = lockBlobFile(id, true);
         std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
         writer(stream);
     }
 
     void readCacheEntry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
+        // shared lock: concurrent processes import the same blob simultaneously, a writer
+        // which is still producing it is waited out instead of reading a partial file
+        auto lock = lockBlobFile(id, false);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (ov::util::getenv_bool("OV_CACHE_MMAP", true)) {
+                // Map the blob instead of reading it: plugins which understand
+                // SharedStreamBuffer import the topology immediately while constant
+                // data is paged in lazily on first use, others still get a normal
+                // seekable stream over the mapping.
+                auto mapped = ov::util::load_mmap_object(blobFileName);
+                SharedStreamBuffer buffer{mapped->data(), mapped->size(), mapped};
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
+        auto lock = lockBlobFile(id, true);
         if (FileUtils::fileExist(blobFileName))
             std::remove(blobFileName.c_str());
     }
@@ -6,9 +6,12 @@
 
 #include <sys/stat.h>
 
+#include <array>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -28,6 +31,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_system_conf.h"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -40,6 +44,7 @@
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_extension.hpp"
+#include "threading/ie_executor_manager.hpp"
 #include "xml_parse_utils.h"
 
 #ifdef OPENVINO_STATIC_LIBRARY
@@ -176,6 +181,63 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     ie::CacheGuard cacheGuard;
 
+    // Load-time phase breakdown of the most recent load of each model, keyed by the model
+    // path or friendly name (see ov::Core::get_load_time_profile). ReadNetwork and the query
+    // are const, so the storage is mutable, like the plugins map above.
+    mutable std::mutex loadProfilesMutex;
+    mutable std::map<std::string, ov::LoadTimeProfile> loadTimeProfiles;
+
+    // Immutable device metrics are answered from this cache once queried: orchestration code
+    // tends to poll device capabilities, and e.g. a GPU metric query costs an OpenCL device
+    // round trip each time. Keyed by the device name as passed by the caller, so "GPU" and
+    // "GPU.1" are distinct entries. The GetMetric query is const, so the storage is mutable,
+    // like the load profiles above.
+    mutable std::mutex metricsCacheMutex;
+    mutable std::map<std::string, ov::AnyMap> metricsCache;
+
+    // metric names whose value cannot change for a running device; everything else
+    // (e.g. memory statistics or AVAILABLE_DEVICES, which follows device hot-plug)
+    // is queried from the plugin every time
+    static bool IsImmutableMetric(const std::string& name) {
+        static const std::unordered_set<std::string> immutable = {METRIC_KEY(SUPPORTED_METRICS),
+                                                                  METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+                                                                  METRIC_KEY(FULL_DEVICE_NAME),
+                                                                  METRIC_KEY(OPTIMIZATION_CAPABILITIES),
+                                                                  METRIC_KEY(DEVICE_ARCHITECTURE),
+                                                                  METRIC_KEY(DEVICE_GOPS),
+                                                                  METRIC_KEY(DEVICE_TYPE),
+                                                                  METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
+                                                                  METRIC_KEY(RANGE_FOR_STREAMS),
+                                                                  METRIC_KEY(IMPORT_EXPORT_SUPPORT)};
+        return immutable.count(name) != 0;
+    }
+
+    // Registry of the executable networks loaded through this Core, used by the process
+    // snapshot (see ov::Core::export_snapshot). Weak references only: the registry must not
+    // extend the lifetime of a network the application has already released.
+    struct LoadedNetworkRecord {
+        std::string deviceName;
+        std::map<std::string, std::string> config;
+        std::weak_ptr<ie::IExecutableNetworkInternal> exec;
+        std::weak_ptr<void> so;
+    };
+    std::mutex loadedNetworksMutex;
+    std::vector<LoadedNetworkRecord> loadedNetworks;
+
+    void RegisterLoadedNetwork(const std::string& deviceName,
+                               const std::map<std::string, std::string>& config,
+                               const ov::SoPtr<ie::IExecutableNetworkInternal>& exec) {
+        std::lock_guard<std::mutex> lock(loadedNetworksMutex);
+        // released networks leave expired entries behind; prune them on the way
+        loadedNetworks.erase(std::remove_if(loadedNetworks.begin(),
+                                            loadedNetworks.end(),
+                                            [](const LoadedNetworkRecord& record) {
+                                                return record.exec.expired();
+                                            }),
+                             loadedNetworks.end());
+        loadedNetworks.push_back({deviceName, config, exec._ptr, exec._so});
+    }
+
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
         std::map<std::string, std::string> defaultConfig;
@@ -246,28 +308,59 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return supported;
     }
 
+    static std::chrono::microseconds DurationSince(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+    void RecordReadTime(const std::string& modelName, const std::chrono::microseconds& duration) const {
+        std::lock_guard<std::mutex> lock(loadProfilesMutex);
+        auto& profile = loadTimeProfiles[modelName];
+        profile.model_name = modelName;
+        profile.read_model = duration;
+    }
+
+    void RecordLoadTimeProfile(ov::LoadTimeProfile profile) const {
+        std::lock_guard<std::mutex> lock(loadProfilesMutex);
+        auto& stored = loadTimeProfiles[profile.model_name];
+        if (profile.read_model.count() == 0 && stored.read_model.count() != 0) {
+            // the model was read by a separate read_model call; its time is part of "time to ready"
+            profile.read_model = stored.read_model;
+            profile.total += stored.read_model;
+        }
+        stored = std::move(profile);
+    }
+
     ov::SoPtr<ie::IExecutableNetworkInternal> compile_model_impl(const InferenceEngine::CNNNetwork& network,
                                                                  ov::InferencePlugin& plugin,
                                                                  const std::map<std::string, std::string>& parsedConfig,
                                                                  const ie::RemoteContext::Ptr& context,
                                                                  const std::string& blobID,
                                                                  const std::string& modelPath = std::string(),
-                                                                 bool forceDisableCache = false) {
+                                                                 bool forceDisableCache = false,
+                                                                 ov::LoadTimeProfile* profile = nullptr) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
+        const auto compileStart = std::chrono::steady_clock::now();
         execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
                               : plugin.compile_model(network, parsedConfig);
+        if (profile) {
+            profile->compile = DurationSince(compileStart);
+        }
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
             try {
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
+                const auto exportStart = std::chrono::steady_clock::now();
                 cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
                     networkStream << ie::CompiledBlobHeader(
                         ie::GetInferenceEngineVersion()->buildNumber,
                         ie::NetworkCompilationContext::calculateFileInfo(modelPath));
                     execNetwork->Export(networkStream);
                 });
+                if (profile) {
+                    profile->cache_export = DurationSince(exportStart);
+                }
             } catch (...) {
                 cacheManager->removeCacheEntry(blobID);
                 throw;
@@ -485,12 +578,27 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        const auto readStart = std::chrono::steady_clock::now();
+        auto network = InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        RecordReadTime(network.getName(), DurationSince(readStart));
+        return network;
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model, const ie::Blob::CPtr& weights) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from memory");
-        return InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI);
+        const auto readStart = std::chrono::steady_clock::now();
+        auto network = InferenceEngine::details::ReadNetwork(model, weights, extensions, ov_extensions, newAPI);
+        RecordReadTime(network.getName(), DurationSince(readStart));
+        return network;
+    }
+
+    ov::LoadTimeProfile GetLoadTimeProfile(const std::string& modelName) const {
+        std::lock_guard<std::mutex> lock(loadProfilesMutex);
+        auto it = loadTimeProfiles.find(modelName);
+        if (it == loadTimeProfiles.end()) {
+            IE_THROW() << "No load time profile has been recorded for model: " << modelName;
+        }
+        return it->second;
     }
 
     bool isNewAPI() const override {
@@ -514,21 +622,38 @@ public:
 
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
+        ov::LoadTimeProfile profile;
+        profile.model_name = network.getName();
+        profile.device_name = context->getDeviceName();
+        const auto loadStart = std::chrono::steady_clock::now();
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (cacheManager && DeviceSupportsImportExport(plugin)) {
             auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
-            auto lock = cacheGuard.getHashLock(hash);
+            // a cache hit only reads the entry, so it is probed under a shared lock first;
+            // on a miss the lock is upgraded and the cache is probed again, as another
+            // thread may have filled it in between
+            auto lock = cacheGuard.getReadHashLock(hash);
+            const auto importStart = std::chrono::steady_clock::now();
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, context, loadedFromCache);
             if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, context, hash);
+                lock.reset();
+                lock = cacheGuard.getHashLock(hash);
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, context, loadedFromCache);
+            }
+            profile.cache_import = DurationSince(importStart);
+            profile.loaded_from_cache = loadedFromCache;
+            if (!loadedFromCache) {
+                res = compile_model_impl(network, plugin, parsed._config, context, hash, {}, false, &profile);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
         } else {
-            res = compile_model_impl(network, plugin, parsed._config, context, {});
+            res = compile_model_impl(network, plugin, parsed._config, context, {}, {}, false, &profile);
         }
+        profile.total = DurationSince(loadStart);
+        RecordLoadTimeProfile(std::move(profile));
         return res;
     }
 
@@ -622,21 +747,37 @@ public:
         }
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
+        ov::LoadTimeProfile profile;
+        profile.model_name = network.getName();
+        profile.device_name = deviceNameOrig;
+        const auto loadStart = std::chrono::steady_clock::now();
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
             auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
             bool loadedFromCache = false;
-            auto lock = cacheGuard.getHashLock(hash);
+            // same shared-then-exclusive pattern as in the remote-context overload above
+            auto lock = cacheGuard.getReadHashLock(hash);
+            const auto importStart = std::chrono::steady_clock::now();
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
             if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
+                lock.reset();
+                lock = cacheGuard.getHashLock(hash);
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+            }
+            profile.cache_import = DurationSince(importStart);
+            profile.loaded_from_cache = loadedFromCache;
+            if (!loadedFromCache) {
+                res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache, &profile);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
         } else {
-            res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache);
+            res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache, &profile);
         }
+        profile.total = DurationSince(loadStart);
+        RecordLoadTimeProfile(std::move(profile));
+        RegisterLoadedNetwork(deviceName, config_with_batch, res);
         return {res._ptr, res._so};
     }
 
@@ -647,22 +788,46 @@ public:
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
         ov::SoPtr<ie::IExecutableNetworkInternal> res;
+        ov::LoadTimeProfile profile;
+        profile.model_name = modelPath;
+        profile.device_name = deviceName;
+        const auto loadStart = std::chrono::steady_clock::now();
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
         if (cacheManager && DeviceSupportsImportExport(plugin)) {
             bool loadedFromCache = false;
             auto hash = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
-            auto lock = cacheGuard.getHashLock(hash);
+            // same shared-then-exclusive pattern as in the CNNNetwork overloads above
+            auto lock = cacheGuard.getReadHashLock(hash);
+            const auto importStart = std::chrono::steady_clock::now();
             res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
             if (!loadedFromCache) {
+                lock.reset();
+                lock = cacheGuard.getHashLock(hash);
+                res =
+                    LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
+            }
+            profile.cache_import = DurationSince(importStart);
+            profile.loaded_from_cache = loadedFromCache;
+            if (!loadedFromCache) {
+                const auto readStart = std::chrono::steady_clock::now();
                 auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                profile.read_model = DurationSince(readStart);
+                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath, false, &profile);
             }
         } else if (cacheManager) {
+            // the plugin handles its own caching internally; its whole load counts as compilation
+            const auto compileStart = std::chrono::steady_clock::now();
             res = plugin.compile_model(modelPath, parsed._config);
+            profile.compile = DurationSince(compileStart);
         } else {
+            const auto readStart = std::chrono::steady_clock::now();
             auto cnnNetwork = ReadNetwork(modelPath, std::string());
-            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, {}, modelPath);
+            profile.read_model = DurationSince(readStart);
+            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, {}, modelPath, false, &profile);
         }
+        profile.total = DurationSince(loadStart);
+        RecordLoadTimeProfile(std::move(profile));
+        RegisterLoadedNetwork(deviceName, config, res);
         return {res._ptr, res._so};
     }
 
@@ -719,9 +884,124 @@ public:
             //    not from ngraph. Plugins should use SetExeNetworkInfo
         }
 
+        RegisterLoadedNetwork(deviceName, config, exec);
         return {exec._ptr, exec._so};
     }
 
+    // The snapshot is a sequence of per-network plugin export blobs, each preceded by the
+    // device name and the compilation config the network was loaded with, so a new process
+    // restores every network through the plugin import path and skips compilation entirely.
+    // Networks on devices without import/export support are left out.
+
+    using SnapshotMagic = std::array<char, 4>;
+
+    static SnapshotMagic SnapshotHeaderMagic() {
+        return {{'O', 'V', 'S', 'N'}};
+    }
+
+    static uint32_t SnapshotHeaderVersion() {
+        return 1;
+    }
+
+    void ExportSnapshot(std::ostream& snapshot) {
+        struct AliveNetwork {
+            std::string deviceName;
+            std::map<std::string, std::string> config;
+            std::shared_ptr<ie::IExecutableNetworkInternal> exec;
+            std::shared_ptr<void> so;  // keeps the plugin library loaded while the network is exported
+        };
+        std::vector<AliveNetwork> aliveNetworks;
+        {
+            std::lock_guard<std::mutex> lock(loadedNetworksMutex);
+            for (const auto& record : loadedNetworks) {
+                auto exec = record.exec.lock();
+                if (exec != nullptr) {
+                    aliveNetworks.push_back({record.deviceName, record.config, exec, record.so.lock()});
+                }
+            }
+        }
+
+        auto writeString = [&snapshot](const std::string& value) {
+            const uint64_t size = value.size();
+            snapshot.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            snapshot.write(value.data(), value.size());
+        };
+
+        std::vector<AliveNetwork> exportableNetworks;
+        for (auto&& network : aliveNetworks) {
+            bool supported = false;
+            try {
+                supported = DeviceSupportsImportExport(network.deviceName);
+            } catch (const ie::Exception&) {
+                // e.g. a meta device which does not answer SUPPORTED_METRICS
+            }
+            if (supported) {
+                exportableNetworks.emplace_back(std::move(network));
+            }
+        }
+
+        const auto magic = SnapshotHeaderMagic();
+        snapshot.write(magic.data(), magic.size());
+        const uint32_t version = SnapshotHeaderVersion();
+        snapshot.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        const uint64_t count = exportableNetworks.size();
+        snapshot.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+        for (const auto& network : exportableNetworks) {
+            writeString(network.deviceName);
+            const uint64_t configSize = network.config.size();
+            snapshot.write(reinterpret_cast<const char*>(&configSize), sizeof(configSize));
+            for (const auto& entry : network.config) {
+                writeString(entry.first);
+                writeString(entry.second);
+            }
+            std::stringstream blob;
+            network.exec->Export(blob);
+            writeString(blob.str());
+        }
+    }
+
+    std::vector<ie::SoExecutableNetworkInternal> ImportSnapshot(std::istream& snapshot) {
+        auto readString = [&snapshot]() {
+            uint64_t size = 0;
+            snapshot.read(reinterpret_cast<char*>(&size), sizeof(size));
+            std::string value(size, '\0');
+            snapshot.read(&value[0], value.size());
+            if (!snapshot) {
+                IE_THROW() << "The process snapshot stream is truncated";
+            }
+            return value;
+        };
+
+        SnapshotMagic magic = {};
+        snapshot.read(magic.data(), magic.size());
+        if (!snapshot || magic != SnapshotHeaderMagic()) {
+            IE_THROW() << "The stream is not a process snapshot";
+        }
+        uint32_t version = 0;
+        snapshot.read(reinterpret_cast<char*>(&version), sizeof(version));
+        if (version != SnapshotHeaderVersion()) {
+            IE_THROW() << "Unsupported process snapshot version: " << version;
+        }
+
+        uint64_t count = 0;
+        snapshot.read(reinterpret_cast<char*>(&count), sizeof(count));
+        std::vector<ie::SoExecutableNetworkInternal> networks;
+        for (uint64_t i = 0; i < count; i++) {
+            const auto deviceName = readString();
+            uint64_t configSize = 0;
+            snapshot.read(reinterpret_cast<char*>(&configSize), sizeof(configSize));
+            std::map<std::string, std::string> config;
+            for (uint64_t c = 0; c < configSize; c++) {
+                const auto key = readString();
+                config[key] = readString();
+            }
+            std::istringstream blob(readString());
+            networks.emplace_back(ImportNetwork(blob, deviceName, config));
+        }
+        return networks;
+    }
+
     ie::QueryNetworkResult QueryNetwork(const ie::CNNNetwork& network,
                                         const std::string& deviceName,
                                         const std::map<std::string, std::string>& config) const override {
@@ -798,7 +1078,46 @@ public:
             parsed._config.insert(o);
         }
 
-        return GetCPPPluginByName(parsed._deviceName).get_metric(name, parsed._config);
+        // options may change the answer (e.g. a model for OPTIMAL_BATCH_SIZE),
+        // so only option-free queries of immutable metrics are cached
+        const bool cacheable = options.empty() && IsImmutableMetric(name);
+        if (cacheable) {
+            std::lock_guard<std::mutex> lock(metricsCacheMutex);
+            auto device = metricsCache.find(deviceName);
+            if (device != metricsCache.end()) {
+                auto hit = device->second.find(name);
+                if (hit != device->second.end()) {
+                    return hit->second;
+                }
+            }
+        }
+
+        auto value = GetCPPPluginByName(parsed._deviceName).get_metric(name, parsed._config);
+        if (cacheable) {
+            std::lock_guard<std::mutex> lock(metricsCacheMutex);
+            metricsCache[deviceName].emplace(name, value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Drops the cached immutable metrics of a device
+     * @param deviceName A device name ("GPU" also drops "GPU.0", "GPU.1", ...);
+     *        an empty name drops the cache of every device
+     */
+    void InvalidateMetricsCache(const std::string& deviceName) {
+        std::lock_guard<std::mutex> lock(metricsCacheMutex);
+        if (deviceName.empty()) {
+            metricsCache.clear();
+            return;
+        }
+        for (auto it = metricsCache.begin(); it != metricsCache.end();) {
+            if (it->first == deviceName || it->first.compare(0, deviceName.size() + 1, deviceName + ".") == 0) {
+                it = metricsCache.erase(it);
+            } else {
+                ++it;
+            }
+        }
     }
 
     Any GetConfig(const std::string& deviceName, const std::string& name) const override {
@@ -847,6 +1166,28 @@ public:
         return devices;
     }
 
+    /**
+     * @brief Loads every registered plugin library and runs its one-time initialization
+     *
+     * Device use stays lazy by default; this explicit warmup is for processes which want to pay
+     * the plugin load cost once up front, e.g. a pre-fork server loading plugins in the parent
+     * so the workers inherit the already initialized libraries. Plugins failing to load are
+     * skipped, same as during device enumeration.
+     */
+    void PreloadPlugins() {
+        for (auto&& deviceName : GetListOfDevicesInRegistry()) {
+            try {
+                GetCPPPluginByName(deviceName);
+            } catch (const ie::Exception&) {
+                // plugin is not created by e.g. invalid env
+            } catch (const ov::Exception&) {
+                // plugin is not created by e.g. invalid env
+            } catch (const std::runtime_error&) {
+                // plugin is not created by e.g. invalid env
+            }
+        }
+    }
+
     /**
      * @brief Create a new shared context object on specified accelerator device
      * using specified plugin-specific low level device API parameters (device handle, pointer, etc.)
@@ -989,6 +1330,8 @@ public:
         }
 
         plugins.erase(deviceName);
+        // a reloaded plugin may answer differently (e.g. a newer library)
+        InvalidateMetricsCache(deviceName);
     }
 
     /**
@@ -1104,6 +1447,10 @@ public:
                 });
             }
         }
+
+        // a conservative measure: the cached metrics are immutable by contract, but a plugin
+        // config change is the natural point a deployment expects a fresh answer after
+        InvalidateMetricsCache(deviceName);
     }
 
     /**
@@ -1680,6 +2027,48 @@ CompiledModel Core::compile_model(const std::string& modelPath, const std::strin
     });
 }
 
+namespace {
+
+std::future<CompiledModel> schedule_compilation(std::function<CompiledModel()> compile) {
+    // A dedicated shared executor: compilation tasks are heavyweight and internally
+    // parallel, so one worker per stream is enough to overlap several of them.
+    static const ie::IStreamsExecutor::Config compileExecutorConfig{"CoreCompileModelAsyncExecutor",
+                                                                    ie::getNumberOfCPUCores(),
+                                                                    1};
+    auto task = std::make_shared<std::packaged_task<CompiledModel()>>(std::move(compile));
+    auto future = task->get_future();
+    ie::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(compileExecutorConfig)->run([task] {
+        (*task)();
+    });
+    return future;
+}
+
+}  // namespace
+
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        return schedule_compilation([core = *this, model, device_name, config]() mutable {
+            return core.compile_model(model, device_name, config);
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& model_path,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        return schedule_compilation([core = *this, model_path, device_name, config]() mutable {
+            return core.compile_model(model_path, device_name, config);
+        });
+    });
+}
+
+LoadTimeProfile Core::get_load_time_profile(const std::string& model_name) const {
+    OV_CORE_CALL_STATEMENT(return _impl->GetLoadTimeProfile(model_name););
+}
+
 CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
                                   const RemoteContext& context,
                                   const AnyMap& config) {
@@ -1744,6 +2133,22 @@ CompiledModel Core::import_model(std::istream& modelStream, const RemoteContext&
     });
 }
 
+void Core::export_snapshot(std::ostream& snapshot) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::export_snapshot");
+    OV_CORE_CALL_STATEMENT(_impl->ExportSnapshot(snapshot););
+}
+
+std::vector<CompiledModel> Core::import_snapshot(std::istream& snapshot) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::import_snapshot");
+    OV_CORE_CALL_STATEMENT({
+        std::vector<CompiledModel> models;
+        for (auto&& exec : _impl->ImportSnapshot(snapshot)) {
+            models.emplace_back(CompiledModel{exec._ptr, exec._so});
+        }
+        return models;
+    });
+}
+
 SupportedOpsMap Core::query_model(const std::shared_ptr<const ov::Model>& model,
                                   const std::string& deviceName,
                                   const AnyMap& config) const {
@@ -1790,17 +2195,15 @@ Any Core::get_property(const std::string& deviceName, const std::string& name) c
                     "get_config is also possible for the individual devices before creating the AUTO on top.");
 
     OV_CORE_CALL_STATEMENT({
-        auto parsed = parseDeviceNameIntoConfig(deviceName);
+        // served through CoreImpl::GetMetric, so immutable metrics come from the core-level cache
         if (ov::supported_properties == name) {
             try {
-                return _impl->GetCPPPluginByName(parsed._deviceName).get_metric(name, parsed._config);
+                return _impl->GetMetric(deviceName, name);
             } catch (ie::Exception&) {
-                auto ro_properties = _impl->GetCPPPluginByName(parsed._deviceName)
-                                         .get_metric(METRIC_KEY(SUPPORTED_METRICS), parsed._config)
-                                         .as<std::vector<std::string>>();
-                auto rw_properties = _impl->GetCPPPluginByName(parsed._deviceName)
-                                         .get_metric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), parsed._config)
-                                         .as<std::vector<std::string>>();
+                auto ro_properties =
+                    _impl->GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+                auto rw_properties =
+                    _impl->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
                 std::vector<ov::PropertyName> supported_properties;
                 for (auto&& ro_property : ro_properties) {
                     supported_properties.emplace_back(ro_property, PropertyMutability::RO);
@@ -1813,13 +2216,56 @@ Any Core::get_property(const std::string& deviceName, const std::string& name) c
             }
         }
         try {
-            return _impl->GetCPPPluginByName(parsed._deviceName).get_metric(name, parsed._config);
+            return _impl->GetMetric(deviceName, name);
         } catch (ie::Exception&) {
-            return _impl->GetCPPPluginByName(parsed._deviceName).get_config(name, parsed._config);
+            return _impl->GetConfig(deviceName, name);
         }
     });
 }
 
+AnyMap Core::get_all_properties(const std::string& deviceName) const {
+    OPENVINO_ASSERT(deviceName.find("HETERO:") != 0,
+                    "You can only get_all_properties of the HETERO itself (without devices). "
+                    "get_all_properties is also possible for the individual devices before creating the HETERO on "
+                    "top.");
+    OPENVINO_ASSERT(deviceName.find("MULTI:") != 0,
+                    "You can only get_all_properties of the MULTI itself (without devices). "
+                    "get_all_properties is also possible for the individual devices before creating the MULTI on "
+                    "top.");
+    OPENVINO_ASSERT(deviceName.find("AUTO:") != 0,
+                    "You can only get_all_properties of the AUTO itself (without devices). "
+                    "get_all_properties is also possible for the individual devices before creating the AUTO on "
+                    "top.");
+
+    OV_CORE_CALL_STATEMENT({
+        AnyMap properties;
+        const auto metrics =
+            _impl->GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+        for (auto&& metric : metrics) {
+            try {
+                properties[metric] = _impl->GetMetric(deviceName, metric);
+            } catch (...) {
+                // metrics which need options (e.g. OPTIMAL_BATCH_SIZE needs a model) are
+                // not part of the snapshot
+            }
+        }
+        const auto configKeys =
+            _impl->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS)).as<std::vector<std::string>>();
+        for (auto&& key : configKeys) {
+            try {
+                properties[key] = _impl->GetConfig(deviceName, key);
+            } catch (...) {
+                // a key the plugin advertises but cannot answer yet keeps the snapshot usable
+            }
+        }
+        return properties;
+    });
+}
+
+void Core::invalidate_property_cache(const std::string& deviceName) {
+    OV_CORE_CALL_STATEMENT(_impl->InvalidateMetricsCache(deviceName););
+}
+
 void Core::get_property(const std::string& deviceName, const std::string& name, ov::Any& to) const {
     any_lexical_cast(get_property(deviceName, name), to);
 }
@@ -1828,6 +2274,10 @@ std::vector<std::string> Core::get_available_devices() const {
     OV_CORE_CALL_STATEMENT(return _impl->GetAvailableDevices(););
 }
 
+void Core::preload_plugins() {
+    OV_CORE_CALL_STATEMENT(_impl->PreloadPlugins(););
+}
+
 void Core::register_plugin(const std::string& pluginName, const std::string& deviceName) {
     OV_CORE_CALL_STATEMENT(_impl->RegisterPluginByName(pluginName, deviceName););
 }
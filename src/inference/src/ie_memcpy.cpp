@@ -7,6 +7,15 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define IE_MEMCPY_HAVE_SSE2
+#    include <emmintrin.h>
+#endif
+
 int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
     size_t i;
     if (!src || count > destsz ||
@@ -20,3 +29,68 @@ int ie_memcpy(void* dest, size_t destsz, void const* src, size_t count) {
         (reinterpret_cast<uint8_t*>(dest))[i] = (reinterpret_cast<const uint8_t*>(src))[i];
     return 0;
 }
+
+namespace {
+
+// Below this size a single core saturates the copy and splitting only adds scheduling overhead
+constexpr size_t parallelCopyMinBytes = 1024 * 1024;
+// Above this size the data cannot stay cache resident anyway, so streaming stores are used
+// to avoid evicting the working set of the computation that follows the copy
+constexpr size_t streamingCopyMinBytes = 16 * 1024 * 1024;
+
+void copy_chunk(uint8_t* dst, const uint8_t* src, size_t size, bool streaming) {
+#ifdef IE_MEMCPY_HAVE_SSE2
+    if (streaming) {
+        // peel the unaligned head so the streaming stores hit 16-byte boundaries
+        size_t head = (16 - reinterpret_cast<uintptr_t>(dst) % 16) % 16;
+        head = std::min(head, size);
+        memcpy(dst, src, head);
+        dst += head;
+        src += head;
+        size -= head;
+
+        const size_t vecSize = size / 16 * 16;
+        for (size_t i = 0; i < vecSize; i += 16) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i),
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        }
+        dst += vecSize;
+        src += vecSize;
+        size -= vecSize;
+    }
+#endif
+    memcpy(dst, src, size);
+}
+
+}  // namespace
+
+int ie_memcpy_parallel(void* dest, size_t destsz, void const* src, size_t count) {
+    if (!src || count > destsz ||
+        count > (dest > src ? ((uintptr_t)dest - (uintptr_t)src) : ((uintptr_t)src - (uintptr_t)dest))) {
+        // zero out dest if error detected
+        memset(dest, 0, destsz);
+        return -1;
+    }
+
+    if (count < parallelCopyMinBytes) {
+        memcpy(dest, src, count);
+        return 0;
+    }
+
+    const bool streaming = count >= streamingCopyMinBytes;
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(count, static_cast<size_t>(nthr), static_cast<size_t>(ithr), start, end);
+        if (start >= end)
+            return;
+        copy_chunk(reinterpret_cast<uint8_t*>(dest) + start,
+                   reinterpret_cast<const uint8_t*>(src) + start,
+                   end - start,
+                   streaming);
+    });
+#ifdef IE_MEMCPY_HAVE_SSE2
+    if (streaming)
+        _mm_sfence();
+#endif
+    return 0;
+}
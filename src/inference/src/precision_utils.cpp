@@ -6,22 +6,16 @@
 
 #include <stdint.h>
 
-namespace InferenceEngine {
-namespace PrecisionUtils {
+#include <algorithm>
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_AVX2
+#    include "cpu_x86_avx2/precision_utils_f16c.hpp"
+#endif
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
-}
-
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
-}
+namespace InferenceEngine {
+namespace PrecisionUtils {
 
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
@@ -41,6 +35,103 @@ inline float asfloat(uint32_t v) {
     return f;
 }
 
+namespace {
+
+// Below this many elements per block a conversion runs on the calling thread:
+// scheduling tasks costs more than the conversion itself. Larger arrays are
+// split into blocks of this size converted in parallel.
+constexpr size_t blockElems = 64 * 1024;
+
+template <typename Kernel>
+void forEachBlock(size_t nelem, const Kernel& kernel) {
+    if (nelem <= blockElems) {
+        kernel(size_t(0), nelem);
+        return;
+    }
+
+    const size_t blocks = (nelem + blockElems - 1) / blockElems;
+    parallel_for(blocks, [&](size_t b) {
+        const size_t begin = b * blockElems;
+        kernel(begin, std::min(blockElems, nelem - begin));
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+
+    forEachBlock(nelem, [&](size_t begin, size_t len) {
+#ifdef HAVE_AVX2
+        // every AVX2 capable CPU also supports F16C
+        if (with_cpu_x86_avx2()) {
+            f16tof32Arrays_f16c(dst + begin, _src + begin, len, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = begin; i < begin + len; i++) {
+            dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        }
+    });
+}
+
+void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    forEachBlock(nelem, [&](size_t begin, size_t len) {
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            f32tof16Arrays_f16c(dst + begin, src + begin, len, scale, bias);
+            return;
+        }
+#endif
+        for (size_t i = begin; i < begin + len; i++) {
+            dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+        }
+    });
+}
+
+void bf16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const uint16_t* _src = reinterpret_cast<const uint16_t*>(src);
+
+    forEachBlock(nelem, [&](size_t begin, size_t len) {
+        // bfloat16 is the upper half of the f32 representation, so the loop is a
+        // plain shift the compiler vectorizes under the baseline flags
+        for (size_t i = begin; i < begin + len; i++) {
+            dst[i] = asfloat(static_cast<uint32_t>(_src[i]) << 16) * scale + bias;
+        }
+    });
+}
+
+void f32tobf16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    uint16_t* _dst = reinterpret_cast<uint16_t*>(dst);
+
+    forEachBlock(nelem, [&](size_t begin, size_t len) {
+        for (size_t i = begin; i < begin + len; i++) {
+            union {
+                float f;
+                uint32_t u;
+            } v;
+            v.f = src[i] * scale + bias;
+            if ((v.u & EXP_MASK_F32) == EXP_MASK_F32) {
+                // NaN or INF: truncate so a NaN payload is not rounded away
+                _dst[i] = static_cast<uint16_t>(v.u >> 16);
+            } else {
+                // round to nearest even
+                const uint32_t rounding = 0x7FFFU + ((v.u >> 16) & 1);
+                _dst[i] = static_cast<uint16_t>((v.u + rounding) >> 16);
+            }
+        }
+    });
+}
+
+void f32tou8Arrays(uint8_t* dst, const float* src, size_t nelem, float scale, float bias) {
+    forEachBlock(nelem, [&](size_t begin, size_t len) {
+        // saturating round-to-nearest, simple enough for the compiler to vectorize
+        for (size_t i = begin; i < begin + len; i++) {
+            dst[i] = static_cast<uint8_t>(std::min(std::max(src[i] * scale + bias + 0.5f, 0.f), 255.f));
+        }
+    });
+}
+
 // Function to convert F16 into F32
 float f16tof32(ie_fp16 x) {
     // this is storage for output result
@@ -4,10 +4,13 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -215,35 +218,108 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        // All stream threads pull from the single shared _taskQueue, so scheduling is
+        // work-conserving by construction: a stream that finishes early immediately claims the
+        // next queued task instead of idling behind a fixed per-stream assignment. Affinity is
+        // not lost by this - the task runs on the claiming stream's core set, and plugins bind
+        // per-stream state (graphs, scratch memory) to the executing stream id.
+        _activeStreamsLimit = _config._streams;
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                if (0 <= _config._streamUtilClampMin || 0 <= _config._streamUtilClampMax) {
+                    // soft affinity: hint the scheduler about the CPU share of this stream thread
+                    // instead of (or in addition to) pinning it to cores
+                    SetCurrentThreadUtilClamp(std::max(_config._streamUtilClampMin, 0),
+                                              0 <= _config._streamUtilClampMax ? _config._streamUtilClampMax : 100);
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        ++_numWaiting;
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return (0 != _numQueuedTasks && _numRunning < _activeStreamsLimit) ||
+                                   (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        --_numWaiting;
+                        if (0 != _numQueuedTasks && _numRunning < _activeStreamsLimit) {
+                            // claim from the highest-priority queue with work pending, so tasks
+                            // submitted with a greater priority overtake an already queued backlog
+                            auto highest = _taskQueues.begin();
+                            task = std::move(highest->second.front());
+                            highest->second.pop();
+                            if (highest->second.empty()) {
+                                _taskQueues.erase(highest);
+                            }
+                            --_numQueuedTasks;
+                            ++_numRunning;
                         }
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
+                        bool streamRunnable = false;
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            --_numRunning;
+                            streamRunnable = 0 != _numQueuedTasks && 0 != _numWaiting && _numRunning < _activeStreamsLimit;
+                        }
+                        if (streamRunnable) {
+                            _queueCondVar.notify_one();
+                        }
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    // Called under _mutex on every submission when adaptive streams are enabled. Tracks a smoothed
+    // queue depth and scales the number of concurrently executing streams: a backlog (on average a
+    // submitted task finds another one already queued) grows the set immediately, while shrinking
+    // requires the depth to stay below the low watermark for a full dwell period, so the hysteresis
+    // keeps short load dips from bouncing the stream set back and forth.
+    void UpdateActiveStreamsLimit() {
+        constexpr double depthDecay = 0.9;
+        constexpr double growWatermark = 1.0;
+        constexpr double shrinkWatermark = 0.25;
+        constexpr int shrinkDwell = 64;
+        _queueDepthAvg = depthDecay * _queueDepthAvg + (1.0 - depthDecay) * static_cast<double>(_numQueuedTasks);
+        if (_queueDepthAvg > growWatermark) {
+            if (_activeStreamsLimit < _config._streams) {
+                ++_activeStreamsLimit;
+            }
+            _calmEnqueues = 0;
+        } else if (_queueDepthAvg < shrinkWatermark) {
+            if (++_calmEnqueues >= shrinkDwell) {
+                if (_activeStreamsLimit > 1) {
+                    --_activeStreamsLimit;
+                }
+                _calmEnqueues = 0;
+            }
+        } else {
+            _calmEnqueues = 0;
+        }
+    }
+
+    void Enqueue(Task task, int priority) {
+        bool streamWaiting = false;
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[priority].emplace(std::move(task));
+            ++_numQueuedTasks;
+            if (_config._adaptiveStreams) {
+                UpdateActiveStreamsLimit();
+            }
+            streamWaiting = 0 != _numWaiting && _numRunning < _activeStreamsLimit;
+        }
+        // Waking a stream costs a syscall on every submission, while under saturation all streams
+        // are busy and will pick the task up on their next loop iteration anyway - only notify
+        // when some stream is actually blocked on the queue. The waiter count is only changed
+        // under _mutex, so a stream either observes the new task in its wait predicate or is
+        // counted here and gets the wakeup.
+        if (streamWaiting) {
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -282,7 +358,18 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // per-priority FIFO queues, ordered so that begin() is the highest priority with work
+    // pending; _numQueuedTasks keeps the total across them as the wait predicates and the
+    // adaptive streams logic only need the sum
+    std::map<int, std::queue<Task>, std::greater<int>> _taskQueues;
+    std::size_t _numQueuedTasks = 0;
+    int _numWaiting = 0;
+    // how many streams may execute tasks concurrently; stays at _config._streams unless
+    // adaptive streams are enabled (all fields below are guarded by _mutex)
+    int _activeStreamsLimit = 0;
+    int _numRunning = 0;
+    double _queueDepthAvg = 0.0;
+    int _calmEnqueues = 0;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -329,7 +416,15 @@ void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), 0);
+    }
+}
+
+void CPUStreamsExecutor::runWithPriority(Task task, int priority) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
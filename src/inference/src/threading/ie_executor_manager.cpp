@@ -45,6 +45,17 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    auto foundEntry = sharedStreamsExecutors.find(config._name);
+    if (foundEntry == sharedStreamsExecutors.end()) {
+        auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+        sharedStreamsExecutors[config._name] = newExec;
+        return newExec;
+    }
+    return foundEntry->second;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -61,8 +72,10 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedStreamsExecutors.clear();
     } else {
         executors.erase(id);
+        sharedStreamsExecutors.erase(id);
         cpuStreamsExecutors.erase(
             std::remove_if(cpuStreamsExecutors.begin(),
                            cpuStreamsExecutors.end(),
@@ -134,4 +147,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
+    return _impl.getSharedCPUStreamsExecutor(config);
+}
+
 }  // namespace InferenceEngine
@@ -19,12 +19,21 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::runWithPriority(Task task, int) {
+    run(std::move(task));
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_PREFERRED_CORE_TYPE),
+        CONFIG_KEY_INTERNAL(CPU_ADAPTIVE_STREAMS),
+        CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MIN),
+        CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MAX),
+        CONFIG_KEY_INTERNAL(CPU_EXECUTOR_DOMAIN),
     };
 }
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
@@ -106,6 +115,48 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_PREFERRED_CORE_TYPE)) {
+        if (value == CONFIG_VALUE_INTERNAL(ANY)) {
+            _threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::ANY;
+        } else if (value == CONFIG_VALUE_INTERNAL(BIG)) {
+            _threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::BIG;
+        } else if (value == CONFIG_VALUE_INTERNAL(LITTLE)) {
+            _threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::LITTLE;
+        } else if (value == CONFIG_VALUE_INTERNAL(ROUND_ROBIN)) {
+            _threadPreferredCoreType = IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_PREFERRED_CORE_TYPE)
+                       << ". Expected only ANY / BIG (P-cores) / LITTLE (E-cores) / ROUND_ROBIN";
+        }
+        _enforcePreferredCoreType = true;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_ADAPTIVE_STREAMS)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _adaptiveStreams = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _adaptiveStreams = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_ADAPTIVE_STREAMS)
+                       << ". Expected only YES/NO";
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MIN) ||
+               key == CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MAX)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << key << ". Expected only integer percent [0, 100]";
+        }
+        if (val_i > 100) {
+            IE_THROW() << "Wrong value for property key " << key << ". Expected only integer percent [0, 100]";
+        }
+        // any negative value will be treated as an unset clamp
+        if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MIN)) {
+            _streamUtilClampMin = std::max(val_i, -1);
+        } else {
+            _streamUtilClampMax = std::max(val_i, -1);
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_EXECUTOR_DOMAIN)) {
+        _executorDomain = value;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -133,6 +184,25 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_PREFERRED_CORE_TYPE)) {
+        switch (_threadPreferredCoreType) {
+        case IStreamsExecutor::Config::PreferredCoreType::ANY:
+            return {CONFIG_VALUE_INTERNAL(ANY)};
+        case IStreamsExecutor::Config::PreferredCoreType::BIG:
+            return {CONFIG_VALUE_INTERNAL(BIG)};
+        case IStreamsExecutor::Config::PreferredCoreType::LITTLE:
+            return {CONFIG_VALUE_INTERNAL(LITTLE)};
+        case IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN:
+            return {CONFIG_VALUE_INTERNAL(ROUND_ROBIN)};
+        }
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_ADAPTIVE_STREAMS)) {
+        return {_adaptiveStreams ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MIN)) {
+        return {std::to_string(_streamUtilClampMin)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAM_UTIL_CLAMP_MAX)) {
+        return {std::to_string(_streamUtilClampMax)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_EXECUTOR_DOMAIN)) {
+        return {_executorDomain};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -161,18 +231,28 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
         // by default the latency case uses (faster) Big cores only, depending on the compute ratio
         const bool bLatencyCaseBigOnly =
             num_big_cores_phys > (num_little_cores / (fp_intesive ? fp32_threshold : int8_threshold));
-        // selecting the preferred core type
-        streamExecutorConfig._threadPreferredCoreType =
-            bLatencyCase ? (bLatencyCaseBigOnly ? IStreamsExecutor::Config::PreferredCoreType::BIG
-                                                : IStreamsExecutor::Config::PreferredCoreType::ANY)
-                         : IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+        // selecting the preferred core type (honoring an explicitly configured one)
+        if (!streamExecutorConfig._enforcePreferredCoreType) {
+            streamExecutorConfig._threadPreferredCoreType =
+                bLatencyCase ? (bLatencyCaseBigOnly ? IStreamsExecutor::Config::PreferredCoreType::BIG
+                                                    : IStreamsExecutor::Config::PreferredCoreType::ANY)
+                             : IStreamsExecutor::Config::PreferredCoreType::ROUND_ROBIN;
+        }
         // additionally selecting the #cores to use in the "Big-only" case
-        if (bLatencyCaseBigOnly) {
+        const bool bBigOnly = streamExecutorConfig._enforcePreferredCoreType
+                                  ? IStreamsExecutor::Config::PreferredCoreType::BIG ==
+                                        streamExecutorConfig._threadPreferredCoreType
+                                  : bLatencyCaseBigOnly;
+        if (bBigOnly) {
             const int hyper_threading_threshold =
                 2;  // min #cores, for which the hyper-threading becomes useful for the latency case
             const auto num_big_cores =
                 custom::info::default_concurrency(custom::task_arena::constraints{}.set_core_type(core_types.back()));
             num_cores_default = (num_big_cores_phys <= hyper_threading_threshold) ? num_big_cores : num_big_cores_phys;
+        } else if (streamExecutorConfig._enforcePreferredCoreType &&
+                   IStreamsExecutor::Config::PreferredCoreType::LITTLE ==
+                       streamExecutorConfig._threadPreferredCoreType) {
+            num_cores_default = num_little_cores;
         }
     }
 #endif
@@ -14,6 +14,11 @@
 #if !(defined(__APPLE__) || defined(_WIN32))
 #    include <sched.h>
 #    include <unistd.h>
+#    if defined(__linux__)
+#        include <sys/syscall.h>
+
+#        include <cstdint>
+#    endif
 #endif
 
 namespace InferenceEngine {
@@ -98,6 +103,42 @@ bool PinCurrentThreadToSocket(int socket) {
     }
     return res;
 }
+#    if defined(__linux__) && defined(__NR_sched_setattr)
+// glibc provides no wrapper for sched_setattr, so the attribute layout is declared locally
+// (the kernel checks the size field, so older kernels simply reject the extended structure)
+struct ThreadSchedAttr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+    uint32_t sched_util_min;
+    uint32_t sched_util_max;
+};
+#    endif
+
+bool SetCurrentThreadUtilClamp(int utilMin, int utilMax) {
+#    if defined(__linux__) && defined(__NR_sched_setattr)
+    constexpr uint64_t flagKeepPolicy = 0x08;
+    constexpr uint64_t flagKeepParams = 0x10;
+    constexpr uint64_t flagUtilClampMin = 0x20;
+    constexpr uint64_t flagUtilClampMax = 0x40;
+    constexpr uint32_t capacityScale = 1024;
+    if (utilMin < 0 || utilMax > 100 || utilMin > utilMax)
+        return false;
+    ThreadSchedAttr attr = {};
+    attr.size = sizeof(attr);
+    attr.sched_flags = flagKeepPolicy | flagKeepParams | flagUtilClampMin | flagUtilClampMax;
+    attr.sched_util_min = static_cast<uint32_t>(utilMin) * capacityScale / 100;
+    attr.sched_util_max = static_cast<uint32_t>(utilMax) * capacityScale / 100;
+    return 0 == syscall(__NR_sched_setattr, 0, &attr, 0);
+#    else
+    return false;
+#    endif
+}
 #else   // no threads pinning/binding on Win/MacOS
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
@@ -113,5 +154,8 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& procMask) {
 bool PinCurrentThreadToSocket(int socket) {
     return false;
 }
+bool SetCurrentThreadUtilClamp(int utilMin, int utilMax) {
+    return false;
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 }  //  namespace InferenceEngine
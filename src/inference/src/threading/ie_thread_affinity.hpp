@@ -85,4 +85,17 @@ bool PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
  * @return     `True` in case of success, `false` otherwise
  */
 bool PinCurrentThreadToSocket(int socket);
+
+/**
+ * @brief      Sets scheduler utilization clamps for the current thread (a soft alternative to core
+ *             pinning): the thread stays migratable, but the scheduler treats its utilization as at
+ *             least utilMin and at most utilMax of a CPU, which steers frequency and task placement
+ *             without starving co-located workloads. Supported on Linux 5.3+ only.
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  utilMin  The lower utilization clamp in percent [0, 100]
+ * @param[in]  utilMax  The upper utilization clamp in percent [0, 100]
+ * @return     `True` in case of success, `false` otherwise
+ */
+bool SetCurrentThreadUtilClamp(int utilMin, int utilMax);
 }  //  namespace InferenceEngine
@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -53,6 +55,7 @@ std::string GetNetworkPrecision(const InferenceEngine::CNNNetwork &network) {
 thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::_thisWorkerInferRequest = nullptr;
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName = "";
+constexpr size_t MultiDeviceExecutableNetwork::_probeInterval;
 
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
@@ -88,6 +91,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
+        _deviceStats[device];
         GenerateWorkers(device, network);
     }
 }
@@ -114,6 +118,7 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
                               itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
     auto& workerRequests = _workerRequests[device];
     auto& idleWorkerRequests = _idleWorkerRequests[device];
+    auto& deviceStats = _deviceStats[device];
     workerRequests.resize(numRequests);
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
@@ -125,9 +130,17 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
         workerRequestPtr->_index = num++;
         IE_ASSERT(idleWorkerRequests.try_push(std::make_pair(workerRequestPtr->_index, workerRequestPtr)) == true);
         workerRequest._inferRequest->SetCallback(
-            [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this, device, idleWorkerRequestsPtr, &deviceStats] (std::exception_ptr exceptionPtr) mutable {
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                // feed the scheduler with the observed latency; a lost update just drops a sample
+                const auto elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
+                const auto prevUs = deviceStats.avgLatencyUs.load(std::memory_order_relaxed);
+                deviceStats.avgLatencyUs.store(prevUs == 0 ? elapsedUs : (prevUs * 7 + elapsedUs) / 8,
+                                               std::memory_order_relaxed);
+                if (deviceStats.inflight > 0)
+                    deviceStats.inflight--;
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -191,12 +204,20 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                 [=](const DeviceInformation& d)->bool{return d.deviceName.find("CPU") != std::string::npos;});
         // if have CPU Device,  enable _loadContext[CPU]
         if (CPUIter != metaDevices.end()) {
-            _loadContext[CPU].isEnabled = true;
-            _loadContext[CPU].deviceInfo = *CPUIter;
-            _loadContext[CPU].deviceInfo.config[CONFIG_KEY(PERFORMANCE_HINT)] =
-                InferenceEngine::PluginConfigParams::LATENCY;
-            _loadContext[CPU].workName = "CPU_HELP";
-            LOG_INFO("[AUTOPLUGIN]:will load CPU for accelerator");
+            if (_context.warmStartFromCache && IsBlobCacheAvailable(_loadContext[ACTUALDEVICE].deviceInfo.deviceName)) {
+                // loading from the cached blob is fast enough that the CPU fall-back
+                // only costs memory, so the user opted to skip it entirely
+                _loadContext[CPU].isEnabled = false;
+                LOG_INFO("[AUTOPLUGIN]:blob cache is available for %s, will not load CPU for accelerator",
+                        _loadContext[ACTUALDEVICE].deviceInfo.deviceName.c_str());
+            } else {
+                _loadContext[CPU].isEnabled = true;
+                _loadContext[CPU].deviceInfo = *CPUIter;
+                _loadContext[CPU].deviceInfo.config[CONFIG_KEY(PERFORMANCE_HINT)] =
+                    InferenceEngine::PluginConfigParams::LATENCY;
+                _loadContext[CPU].workName = "CPU_HELP";
+                LOG_INFO("[AUTOPLUGIN]:will load CPU for accelerator");
+            }
         } else {
             _loadContext[CPU].isEnabled = false;
         }
@@ -261,10 +282,12 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
             // initialize containers before run async task
             _idleWorkerRequests[device.deviceName];
             _workerRequests[device.deviceName];
+            _deviceStats[device.deviceName];
             _inferPipelineTasksDeviceSpecific[device.deviceName] = nullptr;
         }
         _idleWorkerRequests["CPU_HELP"];
         _workerRequests["CPU_HELP"];
+        _deviceStats["CPU_HELP"];
         _inferPipelineTasksDeviceSpecific["CPU_HELP"] = nullptr;
         _executor->run(_loadContext[CPU].task);
         _executor->run(_loadContext[ACTUALDEVICE].task);
@@ -285,10 +308,23 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const std::string&
                 while (_idleWorkerRequests["CPU_HELP"].try_pop(worker))
                     destroynum++;
                 if (destroynum == _workerRequests["CPU_HELP"].size()) {
-                    std::lock_guard<std::mutex> lock(_confMutex);
-                    _workerRequests["CPU_HELP"].clear();
-                    _loadContext[CPU].executableNetwork._ptr.reset();
-                    _loadContext[CPU].executableNetwork._so.reset();
+                    {
+                        std::lock_guard<std::mutex> lock(_confMutex);
+                        _workerRequests["CPU_HELP"].clear();
+                        _loadContext[CPU].executableNetwork._ptr.reset();
+                        _loadContext[CPU].executableNetwork._so.reset();
+                        // the network was only kept for the metric queries served before the
+                        // actual device got ready; dropping it releases the original weights
+                        _network = {};
+                    }
+                    // migrate the tasks that were still queued for the helper device, so
+                    // they are re-scheduled (in their original order) to the actual device
+                    auto& helperTasks = _inferPipelineTasksDeviceSpecific["CPU_HELP"];
+                    if (helperTasks) {
+                        Task task;
+                        while (helperTasks->try_pop(task))
+                            ScheduleToWorkerInferRequest(std::move(task));
+                    }
                     break;
                 }
             }
@@ -381,6 +417,20 @@ void MultiDeviceExecutableNetwork::TryToLoadNetWork(AutoLoadContext& context,
     TryToLoadNetWork(context, modelPath, network);
 }
 
+bool MultiDeviceExecutableNetwork::IsBlobCacheAvailable(const DeviceName& device) const {
+    // a cached compiled blob can only exist when the device caches into a configured
+    // directory and is able to import the blob back
+    try {
+        if (_core->GetConfig(device, CONFIG_KEY(CACHE_DIR)).as<std::string>().empty()) {
+            return false;
+        }
+        return _core->GetMetric(device, METRIC_KEY(IMPORT_EXPORT_SUPPORT)).as<bool>();
+    } catch (...) {
+        // the device does not report its caching capabilities
+        return false;
+    }
+}
+
 void MultiDeviceExecutableNetwork::WaitFirstNetworkReady() {
     if (_firstLoadFuture.valid()) {
         // wait for the first loading finished
@@ -426,6 +476,18 @@ void MultiDeviceExecutableNetwork::WaitActualNetworkReady() const {
                });
 }
 
+uint64_t MultiDeviceExecutableNetwork::PredictCompletionUs(const DeviceName& device) const {
+    const auto statsIter = _deviceStats.find(device);
+    if (statsIter == _deviceStats.end()) {
+        return 0;
+    }
+    const auto& stats = statsIter->second;
+    const auto inflight = (std::max)(stats.inflight.load(std::memory_order_relaxed), 0);
+    // predicted completion time is the moving latency scaled by the requests already queued
+    // on the device; a device without samples yet predicts 0 and gets probed first
+    return stats.avgLatencyUs.load(std::memory_order_relaxed) * (inflight + 1);
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
     std::vector<DeviceInformation> devices;
     // AUTO work mode
@@ -455,11 +517,31 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             std::lock_guard<std::mutex> lock(_mutex);
             return _devicePriorities;
         }();
+        if (preferred_device.empty() && devices.size() > 1) {
+            const auto schedule = _scheduleCounter++;
+            if (schedule % _probeInterval == 0) {
+                // probe dispatch: rotate the starting device instead of predicting, so every
+                // device keeps producing samples even when it is never the fastest candidate
+                std::rotate(devices.begin(),
+                            devices.begin() + (schedule / _probeInterval) % devices.size(),
+                            devices.end());
+            } else {
+                // pick the device expected to finish this request first; the stable sort keeps
+                // the configured priority as the tie-breaker
+                std::stable_sort(devices.begin(), devices.end(),
+                                 [this](const DeviceInformation& a, const DeviceInformation& b) {
+                                     return PredictCompletionUs(a.deviceName) < PredictCompletionUs(b.deviceName);
+                                 });
+            }
+        }
     }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
         if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+            auto statsIter = _deviceStats.find(device.deviceName);
+            if (statsIter != _deviceStats.end())
+                statsIter->second.inflight++;
             return;
         }
     }
@@ -479,6 +561,7 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
   if (idleWorkerRequests.try_pop(worker)) {
       workerRequestPtr = worker.second;
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+      workerRequestPtr->_startTime = std::chrono::steady_clock::now();
       _thisWorkerInferRequest = workerRequestPtr;
       {
           auto capturedTask = std::move(inferPipelineTask);
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <unordered_map>
 #include <map>
@@ -45,6 +46,7 @@ struct DeviceInformation {
 struct AutoContext {
     bool           needPerfCounters = {false};
     unsigned int   modelPriority = 0;
+    bool           warmStartFromCache = {false};
 };
 
 struct AutoLoadContext {
@@ -84,6 +86,13 @@ public:
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
         int                                       _index = 0;
+        std::chrono::steady_clock::time_point     _startTime;
+    };
+    // moving latency estimate and in-flight depth of a device, fed by the worker request
+    // callbacks and consumed by the MULTI-mode scheduling
+    struct DeviceLatencyStats {
+        std::atomic<uint64_t> avgLatencyUs = {0};
+        std::atomic<int>      inflight = {0};
     };
     using NotBusyWorkerRequests = InferenceEngine::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
 
@@ -127,9 +136,15 @@ public:
     DeviceMap<std::unique_ptr<InferenceEngine::ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    // entries are created before any worker may run, lookups afterwards are lock-free
+    DeviceMap<DeviceLatencyStats>                               _deviceStats;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic_size_t                                          _scheduleCounter = {0};
+    // every _probeInterval-th dispatch bypasses the latency prediction, so the estimates of
+    // currently unloaded devices (e.g. ones recovered from thermal throttling) stay fresh
+    static constexpr size_t                                     _probeInterval = 16;
 
 private:
     void GenerateWorkers(const std::string& device, const InferenceEngine::SoExecutableNetworkInternal& executableNetwork);
@@ -141,6 +156,8 @@ private:
     void TryToLoadNetWork(AutoLoadContext& context,
                           const std::string& modelPath,
                           const InferenceEngine::CNNNetwork& network);
+    bool IsBlobCacheAvailable(const DeviceName& device) const;
+    uint64_t PredictCompletionUs(const DeviceName& device) const;
 
 private:
     std::shared_ptr<InferenceEngine::ICore>                             _core;
@@ -155,7 +172,9 @@ private:
     mutable AutoLoadContext                                             _loadContext[CONTEXTNUM];
     mutable std::mutex                                                  _confMutex;
     bool                                                                _exitFlag = {false};
-    const InferenceEngine::CNNNetwork                                   _network;
+    // released after the cut-over to the actual device (see the recycle task),
+    // as keeping it would pin the original weights for the network lifetime
+    InferenceEngine::CNNNetwork                                         _network;
 };
 
 }  // namespace MultiDevicePlugin
\ No newline at end of file
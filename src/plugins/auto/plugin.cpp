@@ -4,6 +4,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include <string>
+#include <sstream>
 #include <vector>
 #include <memory>
 #include <map>
@@ -61,6 +62,7 @@ namespace {
                     res.push_back(PluginConfigParams::KEY_PERF_COUNT);
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
                     res.push_back(MultiDeviceConfigParams::KEY_AUTO_NETWORK_PRIORITY);
+                    res.push_back(MultiDeviceConfigParams::KEY_AUTO_WARM_START_FROM_CACHE);
                     return res;
                 }();
 }  // namespace
@@ -295,7 +297,34 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     std::mutex load_mutex;
     std::vector<Task> loads;
     std::once_flag readNetworkFlag;
+
+    // Identical devices (same architecture and same load config) get the network compiled only
+    // once: the first device of each group compiles, the others import the exported blob. That
+    // broadcasts the compiled kernels and weights to every device while paying the compilation
+    // cost a single time, which matters for data-parallel setups like MULTI:GPU.0,GPU.1,...
+    std::map<std::string, std::string> cloneSourcePerDevice;  // device -> device it imports from
+    {
+        std::map<std::string, std::string> groupLeaders;  // architecture + config -> first device
+        for (auto& p : metaDevices) {
+            try {
+                if (!GetCore()->DeviceSupportsImportExport(p.deviceName))
+                    continue;
+                auto groupKey = GetCore()->GetMetric(p.deviceName,
+                                                     METRIC_KEY(DEVICE_ARCHITECTURE)).as<std::string>();
+                for (auto& kvp : p.config)
+                    groupKey += "|" + kvp.first + "=" + kvp.second;
+                auto res = groupLeaders.insert({groupKey, p.deviceName});
+                if (!res.second)
+                    cloneSourcePerDevice[p.deviceName] = res.first->second;
+            } catch (const InferenceEngine::Exception&) {
+                // device doesn't report an architecture - compile for it directly
+            }
+        }
+    }
+
     for (auto& p : metaDevices) {
+        if (cloneSourcePerDevice.count(p.deviceName))
+            continue;
         loads.push_back([&]() {
             const auto &deviceName = p.deviceName;
             const auto &deviceConfig = p.config;
@@ -321,6 +350,45 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
                                      1 /*single thread per stream*/,
                                      IStreamsExecutor::ThreadBindingType::NONE});
     executor->runAndWait(loads);
+
+    if (!cloneSourcePerDevice.empty()) {
+        // Leaders are loaded - export each compiled blob once and import it on the remaining
+        // identical devices in parallel. Every device still gets its own executable network and
+        // thus its own memory pool; only the compilation result is shared.
+        std::map<std::string, std::string> exportedBlobPerDevice;  // leader -> blob
+        std::vector<Task> imports;
+        for (auto& p : metaDevices) {
+            auto clone = cloneSourcePerDevice.find(p.deviceName);
+            if (clone == cloneSourcePerDevice.end())
+                continue;
+            auto source = executableNetworkPerDevice.find(clone->second);
+            if (source == executableNetworkPerDevice.end())
+                continue;  // the compiling device failed to load, don't propagate the failure
+            if (exportedBlobPerDevice.find(clone->second) == exportedBlobPerDevice.end()) {
+                std::stringstream blob;
+                source->second->Export(blob);
+                exportedBlobPerDevice[clone->second] = blob.str();
+            }
+            imports.push_back([&]() {
+                SoExecutableNetworkInternal exec_net;
+                try {
+                    std::stringstream blob{exportedBlobPerDevice.at(cloneSourcePerDevice.at(p.deviceName))};
+                    exec_net = GetCore()->ImportNetwork(blob, p.deviceName, p.config);
+                } catch (const InferenceEngine::Exception&) {
+                    // the device rejected the blob - fall back to a regular compilation
+                    if (modelPath.empty())
+                        exec_net = GetCore()->LoadNetwork(network, p.deviceName, p.config);
+                    else
+                        exec_net = GetCore()->LoadNetwork(modelPath, p.deviceName, p.config);
+                }
+                std::unique_lock<std::mutex> lock{load_mutex};
+                executableNetworkPerDevice.insert({p.deviceName, exec_net});
+                multiNetworkConfig.insert(p.config.begin(), p.config.end());
+            });
+        }
+        executor->runAndWait(imports);
+    }
+
     if (executableNetworkPerDevice.empty())
         IE_THROW(NotFound) << "Failed to load network to any device "
                            <<  "that the " << GetName() << " device is initialized to work with";
@@ -586,6 +654,15 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == MultiDeviceConfigParams::KEY_AUTO_WARM_START_FROM_CACHE) {
+            if (kvp.second == PluginConfigParams::YES) {
+                context.warmStartFromCache = true;
+            } else if (kvp.second == PluginConfigParams::NO) {
+                context.warmStartFromCache = false;
+            } else {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (std::find(perf_hints_configs.begin(), perf_hints_configs.end(), kvp.first) != perf_hints_configs.end()) {
             PerfHintsConfig::CheckConfigAndValue(kvp);
         } else if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), kvp.first)) {
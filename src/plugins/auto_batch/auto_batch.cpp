@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -254,6 +256,17 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            // track the arrival rate, so the collection thread can flush a partial batch
+            // as soon as the queue stalls instead of waiting out the full timeout
+            const auto nowMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+            const auto prevMs = workerInferRequest._lastArrivalMs.exchange(nowMs, std::memory_order_relaxed);
+            if (prevMs && nowMs > prevMs) {
+                const auto gapMs = nowMs - prevMs;
+                const auto avgMs = workerInferRequest._avgArrivalGapMs.load(std::memory_order_relaxed);
+                workerInferRequest._avgArrivalGapMs.store(avgMs == 0 ? gapMs : (avgMs * 7 + gapMs) / 8,
+                                                          std::memory_order_relaxed);
+            }
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
@@ -376,11 +389,24 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // how long the currently collected (partial) batch has been waiting already
+            uint64_t collectedMs = 0;
             while (1) {
                 std::cv_status status;
+                // when requests are trickling in, waiting out the full timeout only adds
+                // latency, so the wait is sliced by the observed arrival gap and the partial
+                // batch is flushed once the queue stalls (Nagle-style); with no arrival
+                // statistics yet this degenerates to the plain full-timeout wait
+                const uint64_t timeOutMs = static_cast<uint64_t>(_timeOut);
+                const auto avgGapMs = workerRequestPtr->_avgArrivalGapMs.load(std::memory_order_relaxed);
+                const uint64_t stallGapMs = avgGapMs ? (std::max)(uint64_t{1}, 2 * avgGapMs) : timeOutMs;
+                uint64_t waitMs = (std::max)(uint64_t{1}, timeOutMs > collectedMs ? timeOutMs - collectedMs : 1);
+                if (workerRequestPtr->_tasks.size())
+                    waitMs = (std::min)(waitMs, stallGapMs);
+                const auto waitStart = std::chrono::steady_clock::now();
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(waitMs));
                 }
                 if (_terminate) {
                     break;
@@ -389,6 +415,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = workerRequestPtr->_tasks.size();
                     if (sz == workerRequestPtr->_batchSize) {
+                        collectedMs = 0;
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
@@ -397,6 +424,17 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         }
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
+                        collectedMs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - waitStart).count());
+                        const auto nowMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch()).count());
+                        const auto lastMs = workerRequestPtr->_lastArrivalMs.load(std::memory_order_relaxed);
+                        const bool stalled = nowMs >= lastMs + stallGapMs;
+                        // flush early only when the queue stalled for the adaptive gap;
+                        // otherwise keep collecting until the timeout budget is spent
+                        if (!stalled && collectedMs < timeOutMs)
+                            continue;
+                        collectedMs = 0;
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
@@ -418,6 +456,8 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         }
                         all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
+                    } else if (!sz) {
+                        collectedMs = 0;
                     }
                 }
             }
@@ -38,6 +38,11 @@ public:
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
         InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
+        // arrival bookkeeping for the adaptive (Nagle-style) flush: timestamp of the last
+        // submitted task and a moving average of the inter-arrival gap, both in milliseconds
+        // of the steady clock; relaxed updates, a lost sample only delays the adaptation
+        std::atomic<uint64_t> _lastArrivalMs = {0};
+        std::atomic<uint64_t> _avgArrivalGapMs = {0};
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
@@ -57,6 +57,239 @@ using namespace InferenceEngine::HeteroConfigParams;
 template <typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+// Assumed boundary bandwidth (bytes per microsecond, roughly a PCIe-class link) used to
+// price a tensor crossing a device boundary. The absolute value matters less than staying
+// comparable with the measured per-layer times from the costs file.
+constexpr double transferBytesPerUs = 1000.0;
+
+// device name -> layer friendly name -> measured execution time, us
+using LayerCostMap = std::unordered_map<std::string, std::unordered_map<std::string, double>>;
+
+LayerCostMap LoadLayerCosts(const std::string& fileName) {
+    LayerCostMap costs;
+    std::ifstream file(fileName);
+    if (!file.is_open()) {
+        IE_THROW() << "Failed to open the layer costs file: " << fileName;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        auto deviceEnd = line.find('\t');
+        auto layerEnd = line.rfind('\t');
+        if (deviceEnd == std::string::npos || layerEnd == deviceEnd) {
+            IE_THROW() << "Malformed line in the layer costs file " << fileName << ": " << line;
+        }
+        costs[line.substr(0, deviceEnd)][line.substr(deviceEnd + 1, layerEnd - deviceEnd - 1)] =
+            std::stod(line.substr(layerEnd + 1));
+    }
+    return costs;
+}
+
+double TensorBytes(const ngraph::Output<ngraph::Node>& output) {
+    const auto& shape = output.get_partial_shape();
+    if (shape.is_dynamic() || output.get_element_type().is_dynamic()) {
+        return 0.0;
+    }
+    return static_cast<double>(ngraph::shape_size(shape.to_shape())) * output.get_element_type().size();
+}
+
+bool LoadAffinities(const std::string& fileName, std::map<std::string, std::string>& layersMap) {
+    std::ifstream file(fileName);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        auto layerEnd = line.rfind('\t');
+        if (layerEnd == std::string::npos) {
+            IE_THROW() << "Malformed line in the partitioning file " << fileName << ": " << line;
+        }
+        layersMap[line.substr(0, layerEnd)] = line.substr(layerEnd + 1);
+    }
+    return !layersMap.empty();
+}
+
+void DumpAffinities(const std::string& fileName, const std::map<std::string, std::string>& layersMap) {
+    std::ofstream file(fileName);
+    if (!file.is_open()) {
+        IE_THROW() << "Failed to open the partitioning file for writing: " << fileName;
+    }
+    for (auto&& layer : layersMap) {
+        file << layer.first << '\t' << layer.second << '\n';
+    }
+}
+
+// Assigns every layer (parameters, constants and results are co-located with their
+// neighbors later) to the device minimizing the sum of the per-layer execution cost and
+// the cost of moving tensors over the introduced device boundaries. A forward greedy pass
+// over the topological order is followed by a backward refinement pass that also sees the
+// consumer-side assignments; the exact minimum over a general DAG is not tractable, but
+// on the typical mostly-sequential topologies two passes land close to it.
+std::map<std::string, std::string> CostBasedPartitioning(
+    const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+    const std::vector<std::string>& fallbackDevices,
+    const std::map<std::string, InferenceEngine::QueryNetworkResult>& queryResults,
+    const LayerCostMap& layerCosts) {
+    NodeMap<std::size_t> chosenDevice;
+    auto Supports = [&](std::size_t deviceIndex, const std::shared_ptr<ngraph::Node>& node) {
+        return contains(queryResults.at(fallbackDevices[deviceIndex]).supportedLayersMap, node->get_friendly_name());
+    };
+    auto ComputeCost = [&](std::size_t deviceIndex, const std::shared_ptr<ngraph::Node>& node) {
+        auto itDevice = layerCosts.find(fallbackDevices[deviceIndex]);
+        if (itDevice != layerCosts.end()) {
+            auto itLayer = itDevice->second.find(node->get_friendly_name());
+            if (itLayer != itDevice->second.end()) {
+                return itLayer->second;
+            }
+        }
+        // No measurement - estimate from the touched bytes, biased towards the devices
+        // listed first in the fallback priorities (same units as the transfer cost, so
+        // the estimates stay comparable with the measured times)
+        double bytes = 0.0;
+        for (auto&& input : node->inputs()) {
+            bytes += TensorBytes(input.get_source_output());
+        }
+        for (auto&& output : node->outputs()) {
+            bytes += TensorBytes(output);
+        }
+        return bytes / transferBytesPerUs * (1 + deviceIndex);
+    };
+    auto BoundaryCost = [&](std::size_t deviceIndex, const std::shared_ptr<ngraph::Node>& node, bool withConsumers) {
+        double cost = 0.0;
+        for (auto&& input : node->inputs()) {
+            auto itProducer = chosenDevice.find(input.get_source_output().get_node());
+            if (itProducer != chosenDevice.end() && itProducer->second != deviceIndex) {
+                cost += TensorBytes(input.get_source_output()) / transferBytesPerUs;
+            }
+        }
+        if (withConsumers) {
+            for (auto&& output : node->outputs()) {
+                for (auto&& targetInput : output.get_target_inputs()) {
+                    auto itConsumer = chosenDevice.find(targetInput.get_node());
+                    if (itConsumer != chosenDevice.end() && itConsumer->second != deviceIndex) {
+                        cost += TensorBytes(output) / transferBytesPerUs;
+                    }
+                }
+            }
+        }
+        return cost;
+    };
+    auto Assign = [&](const std::shared_ptr<ngraph::Node>& node, bool withConsumers) {
+        bool assigned = false;
+        std::size_t bestDevice = 0;
+        double bestCost = 0.0;
+        for (std::size_t deviceIndex = 0; deviceIndex < fallbackDevices.size(); ++deviceIndex) {
+            if (!Supports(deviceIndex, node)) {
+                continue;
+            }
+            auto cost = ComputeCost(deviceIndex, node) + BoundaryCost(deviceIndex, node, withConsumers);
+            if (!assigned || cost < bestCost) {
+                assigned = true;
+                bestDevice = deviceIndex;
+                bestCost = cost;
+            }
+        }
+        if (assigned) {
+            chosenDevice[node.get()] = bestDevice;
+        }
+    };
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_constant(node) || ngraph::op::is_output(node) || ngraph::op::is_parameter(node)) {
+            continue;
+        }
+        Assign(node, false);
+    }
+    for (auto itNode = orderedOps.rbegin(); itNode != orderedOps.rend(); ++itNode) {
+        if (chosenDevice.find(itNode->get()) != chosenDevice.end()) {
+            Assign(*itNode, true);
+        }
+    }
+    std::map<std::string, std::string> layersMap;
+    for (auto&& node : chosenDevice) {
+        layersMap.emplace(node.first->get_friendly_name(), fallbackDevices[node.second]);
+    }
+    return layersMap;
+}
+
+// Splits the topological order into one contiguous stage per fallback device, keeping
+// the per-stage cost sums close to equal. Unlike CostBasedPartitioning, which minimizes
+// the total cost and therefore gravitates towards the single cheapest device, a pipeline
+// needs every device to carry a comparable share of the model: with several requests in
+// flight the stages execute concurrently and the throughput is set by the slowest one.
+std::map<std::string, std::string> PipelinePartitioning(
+    const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+    const std::vector<std::string>& fallbackDevices,
+    const std::map<std::string, InferenceEngine::QueryNetworkResult>& queryResults,
+    const LayerCostMap& layerCosts) {
+    auto Supports = [&](std::size_t deviceIndex, const std::shared_ptr<ngraph::Node>& node) {
+        return contains(queryResults.at(fallbackDevices[deviceIndex]).supportedLayersMap, node->get_friendly_name());
+    };
+    auto ComputeCost = [&](std::size_t deviceIndex, const std::shared_ptr<ngraph::Node>& node) {
+        auto itDevice = layerCosts.find(fallbackDevices[deviceIndex]);
+        if (itDevice != layerCosts.end()) {
+            auto itLayer = itDevice->second.find(node->get_friendly_name());
+            if (itLayer != itDevice->second.end()) {
+                return itLayer->second;
+            }
+        }
+        double bytes = 0.0;
+        for (auto&& input : node->inputs()) {
+            bytes += TensorBytes(input.get_source_output());
+        }
+        for (auto&& output : node->outputs()) {
+            bytes += TensorBytes(output);
+        }
+        return bytes / transferBytesPerUs;
+    };
+    std::vector<std::shared_ptr<ngraph::Node>> computeOps;
+    for (auto&& node : orderedOps) {
+        if (!ngraph::op::is_constant(node) && !ngraph::op::is_output(node) && !ngraph::op::is_parameter(node)) {
+            computeOps.push_back(node);
+        }
+    }
+    std::map<std::string, std::string> layersMap;
+    std::size_t opIndex = 0;
+    for (std::size_t deviceIndex = 0; deviceIndex < fallbackDevices.size() && opIndex < computeOps.size();
+         ++deviceIndex) {
+        // the share of a stage is recomputed from what is still unassigned, so estimation
+        // noise accumulated in the earlier stages does not starve the later ones
+        double remaining = 0.0;
+        for (auto i = opIndex; i < computeOps.size(); ++i) {
+            remaining += ComputeCost(deviceIndex, computeOps[i]);
+        }
+        const double target = remaining / (fallbackDevices.size() - deviceIndex);
+        const bool lastDevice = (deviceIndex + 1 == fallbackDevices.size());
+        double accumulated = 0.0;
+        while (opIndex < computeOps.size() && (lastDevice || accumulated < target)) {
+            auto&& node = computeOps[opIndex];
+            if (Supports(deviceIndex, node)) {
+                layersMap.emplace(node->get_friendly_name(), fallbackDevices[deviceIndex]);
+                accumulated += ComputeCost(deviceIndex, node);
+            } else {
+                // co-locating with the stage is impossible - fall back to the usual device
+                // priorities for this layer and accept the extra boundary
+                for (std::size_t fallbackIndex = 0; fallbackIndex < fallbackDevices.size(); ++fallbackIndex) {
+                    if (Supports(fallbackIndex, node)) {
+                        layersMap.emplace(node->get_friendly_name(), fallbackDevices[fallbackIndex]);
+                        break;
+                    }
+                }
+            }
+            ++opIndex;
+        }
+    }
+    return layersMap;
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork& network,
                                                  const Engine::Configs& config,
                                                  Engine* plugin)
@@ -90,11 +323,40 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
-        } else {
+        if (it == _config.end()) {
             IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous device";
         }
+        auto itPartitioningFile = _config.find(HETERO_CONFIG_KEY(PARTITIONING_FILE));
+        const std::string partitioningFile =
+            itPartitioningFile != _config.end() ? itPartitioningFile->second : std::string{};
+        auto itCostBased = _config.find(HETERO_CONFIG_KEY(COST_BASED_PARTITIONING));
+        if (!partitioningFile.empty() && LoadAffinities(partitioningFile, queryNetworkResult.supportedLayersMap)) {
+            // a previously dumped partition fully defines the assignment
+        } else if (itCostBased != _config.end() && itCostBased->second == YES) {
+            std::map<std::string, QueryNetworkResult> queryResults;
+            for (auto&& metaDevice : _heteroPlugin->GetDevicePlugins(it->second, _config)) {
+                queryResults[metaDevice.first] =
+                    _heteroPlugin->GetCore()->QueryNetwork(network, metaDevice.first, metaDevice.second);
+            }
+            LayerCostMap layerCosts;
+            auto itCostsFile = _config.find(HETERO_CONFIG_KEY(PARTITIONING_COSTS_FILE));
+            if (itCostsFile != _config.end() && !itCostsFile->second.empty()) {
+                layerCosts = LoadLayerCosts(itCostsFile->second);
+            }
+            auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+            const bool pipelinedExecution = itPipelined != _config.end() && itPipelined->second == YES;
+            auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(it->second);
+            // in the pipelined mode the devices form the stages of a pipeline, so the split
+            // balances the stage costs instead of minimizing their sum
+            queryNetworkResult.supportedLayersMap =
+                pipelinedExecution ? PipelinePartitioning(orderedOps, fallbackDevices, queryResults, layerCosts)
+                                   : CostBasedPartitioning(orderedOps, fallbackDevices, queryResults, layerCosts);
+            if (!partitioningFile.empty()) {
+                DumpAffinities(partitioningFile, queryNetworkResult.supportedLayersMap);
+            }
+        } else {
+            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+        }
     }
 
     using Input = ngraph::Input<ngraph::Node>;
@@ -490,9 +752,16 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
             }}
             .run_on_model(ngraph::clone_function(*function));
     }
+    auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+    const bool pipelinedExecution = itPipelined != _config.end() && itPipelined->second == YES;
     for (auto&& network : _networks) {
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
         metaDevices[network._device].emplace(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE), "");
+        if (pipelinedExecution) {
+            // the default exclusive executor serializes the stages of all requests globally,
+            // which would defeat the cross-request overlap the pipelined mode provides
+            metaDevices[network._device][CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = NO;
+        }
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
                                                                  network._device,
                                                                  metaDevices[network._device]);
@@ -549,6 +818,11 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, importedConfigs);
         assert(metaDevices.size() == 1);
         auto& loadConfig = metaDevices[deviceName];
+        auto itPipelined = importedConfigs.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+        if (itPipelined != importedConfigs.end() && itPipelined->second == YES) {
+            // same as in the compile path: exclusive requests would serialize the pipeline
+            loadConfig[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = NO;
+        }
 
         InferenceEngine::SoExecutableNetworkInternal executableNetwork;
         CNNNetwork cnnnetwork;
@@ -824,7 +1098,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
-    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
+    } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION) ||
+               name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
@@ -907,6 +1182,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -933,6 +1209,12 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
             value = std::max(value,
                              desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
+        auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+        if (itPipelined != _config.end() && itPipelined->second == YES && _networks.size() > 1) {
+            // keeping every pipeline stage busy takes one extra in-flight request per
+            // additional subgraph on top of the per-device demand
+            value += static_cast<unsigned int>(_networks.size()) - 1u;
+        }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
         // find metric key among plugin metrics
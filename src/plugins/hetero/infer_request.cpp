@@ -7,11 +7,14 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <algorithm>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
+#include <ie_remote_context.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "itt.hpp"
 
@@ -83,6 +86,76 @@ void HeteroInferRequest::CreateInferRequest(
             requestBlob(inputInfo.first, desc._request, false);
         }
     }
+
+    // Upgrade the intermediate blobs to remote ones where the producer and all consumers
+    // run on the same device context, so the handoff over such a boundary becomes a pointer
+    // exchange instead of a copy through a temporary host blob
+    auto tryGetContext = [](const InferenceEngine::SoExecutableNetworkInternal& network)
+        -> std::shared_ptr<InferenceEngine::RemoteContext> {
+        try {
+            return network->GetContext();
+        } catch (...) {
+            // the device does not expose a remote context (e.g. CPU), keep the host blob
+            return nullptr;
+        }
+    };
+    struct BoundaryEnd {
+        InferenceEngine::SoIInferRequestInternal* _request = nullptr;
+        std::shared_ptr<InferenceEngine::RemoteContext> _context;
+        std::string _blobName;
+    };
+    std::map<std::string, BoundaryEnd> producers;
+    std::map<std::string, std::vector<BoundaryEnd>> consumers;
+    for (auto&& desc : _inferRequests) {
+        for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
+            if (!InferenceEngine::details::contains(_networkOutputs, outputInfo.first)) {
+                producers[outputInfo.first] = {&desc._request, tryGetContext(desc._network), outputInfo.first};
+            }
+        }
+        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
+            if (!InferenceEngine::details::contains(_networkInputs, inputInfo.first)) {
+                auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+                if (itName != subgraphInputToOutputBlobNames.end()) {
+                    consumers[itName->second].push_back(
+                        {&desc._request, tryGetContext(desc._network), inputInfo.first});
+                }
+            }
+        }
+    }
+    for (auto&& producer : producers) {
+        if (nullptr == producer.second._context) {
+            continue;
+        }
+        auto itConsumers = consumers.find(producer.first);
+        if (itConsumers == consumers.end()) {
+            continue;
+        }
+        auto sharedContext =
+            std::all_of(itConsumers->second.begin(),
+                        itConsumers->second.end(),
+                        [&](const BoundaryEnd& consumer) {
+                            return nullptr != consumer._context &&
+                                   consumer._context->getDeviceName() == producer.second._context->getDeviceName();
+                        });
+        if (!sharedContext) {
+            continue;
+        }
+        InferenceEngine::RemoteBlob::Ptr remoteBlob;
+        try {
+            remoteBlob = producer.second._context->CreateBlob(_blobs.at(producer.first)->getTensorDesc());
+        } catch (...) {
+            // allocation from the context may be unsupported for this layout - keep the host blob
+            continue;
+        }
+        if (nullptr == remoteBlob) {
+            continue;
+        }
+        (*producer.second._request)->SetBlob(producer.second._blobName, remoteBlob);
+        for (auto&& consumer : itConsumers->second) {
+            (*consumer._request)->SetBlob(consumer._blobName, remoteBlob);
+        }
+        _blobs[producer.first] = remoteBlob;
+    }
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
@@ -26,6 +26,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = NO;
 }
 
 namespace {
@@ -39,6 +41,10 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(COST_BASED_PARTITIONING),
+                                                                  HETERO_CONFIG_KEY(PARTITIONING_COSTS_FILE),
+                                                                  HETERO_CONFIG_KEY(PARTITIONING_FILE),
+                                                                  HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
                                                                   "TARGET_FALLBACK",
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
@@ -203,6 +209,19 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(COST_BASED_PARTITIONING)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(COST_BASED_PARTITIONING));
+        IE_ASSERT(it != _config.end());
+        bool costBased = it->second == YES;
+        return {costBased};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+        IE_ASSERT(it != _config.end());
+        bool pipelined = it->second == YES;
+        return {pipelined};
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_COSTS_FILE) || name == HETERO_CONFIG_KEY(PARTITIONING_FILE)) {
+        auto it = _config.find(name);
+        return {it != _config.end() ? it->second : std::string{}};
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
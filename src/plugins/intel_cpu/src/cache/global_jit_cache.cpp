@@ -0,0 +1,14 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "global_jit_cache.h"
+
+using namespace MKLDNNPlugin;
+
+constexpr size_t GlobalJitCache::capacity;
+
+GlobalJitCache& GlobalJitCache::getInstance() {
+    static GlobalJitCache instance;
+    return instance;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include "multi_cache.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Process-wide cache for JIT compiled executors.
+ *
+ * Unlike the per-stream runtime parameters cache, this cache is shared between all streams, graphs and
+ * networks loaded into the process, so identically parametrized kernels are generated only once no matter
+ * how many models or streams use them. Entries are intended for immutable, engine-independent objects
+ * (e.g. xbyak-generated kernels wrapped into stateless executors); oneDNN primitives are tied to an engine
+ * and must stay in the per-stream cache.
+ *
+ * The keys must be address-free (no raw pointers to node-local data), otherwise sharing across networks
+ * would never hit.
+ */
+class GlobalJitCache {
+public:
+    static GlobalJitCache& getInstance();
+
+    GlobalJitCache(const GlobalJitCache&) = delete;
+    GlobalJitCache& operator=(const GlobalJitCache&) = delete;
+
+    /**
+    * @brief Thread safe version of the MultiCache::getOrCreate interface.
+    * @note The builder is invoked under the cache lock, which serializes code generation but guarantees
+    *       that concurrent streams never compile the same kernel twice.
+    */
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _cache.getOrCreate(key, std::move(builder));
+    }
+
+private:
+    GlobalJitCache() : _cache(capacity) {}
+
+    // maximum records limit per key/value type pair, see MultiCache
+    static constexpr size_t capacity = 5000;
+
+    std::mutex _mutex;
+    MultiCache _cache;
+};
+
+} // namespace MKLDNNPlugin
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <map>
+#include <sstream>
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
@@ -14,6 +15,7 @@
 #include "ie_system_conf.h"
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <openvino/runtime/properties.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -129,6 +131,214 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WARMUP_SHAPES == key) {
+            warmupShapes.clear();
+            std::istringstream sets(val);
+            std::string set;
+            while (std::getline(sets, set, ';')) {
+                if (set.empty())
+                    continue;
+                std::map<std::string, SizeVector> shapeSet;
+                std::istringstream entries(set);
+                std::string entry;
+                while (std::getline(entries, entry, '|')) {
+                    const auto dimsBegin = entry.find('[');
+                    if (dimsBegin == std::string::npos || dimsBegin == 0 || entry.back() != ']')
+                        IE_THROW() << "Wrong value for property key "
+                                   << PluginConfigInternalParams::KEY_CPU_WARMUP_SHAPES
+                                   << ". Expected a list of input[dim,...] entries, got " << entry;
+                    SizeVector dims;
+                    std::istringstream dimsStream(entry.substr(dimsBegin + 1, entry.size() - dimsBegin - 2));
+                    std::string dim;
+                    while (std::getline(dimsStream, dim, ',')) {
+                        try {
+                            dims.push_back(std::stoul(dim));
+                        } catch (const std::exception&) {
+                            IE_THROW() << "Wrong value for property key "
+                                       << PluginConfigInternalParams::KEY_CPU_WARMUP_SHAPES
+                                       << ". Expected only unsigned numbers as dimensions, got " << dim;
+                        }
+                    }
+                    shapeSet[entry.substr(0, dimsBegin)] = std::move(dims);
+                }
+                if (!shapeSet.empty())
+                    warmupShapes.push_back(std::move(shapeSet));
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHT_REPLICATION == key) {
+            if (val == PluginConfigParams::YES)
+                numaWeightReplication = true;
+            else if (val == PluginConfigParams::NO)
+                numaWeightReplication = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHT_REPLICATION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_CROSS_MODEL_WEIGHT_SHARING == key) {
+            if (val == PluginConfigParams::YES)
+                crossModelWeightSharing = true;
+            else if (val == PluginConfigParams::NO)
+                crossModelWeightSharing = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_CROSS_MODEL_WEIGHT_SHARING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODEL_CACHE == key) {
+            if (val == PluginConfigParams::YES)
+                transformedModelCache = true;
+            else if (val == PluginConfigParams::NO)
+                transformedModelCache = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODEL_CACHE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_ACTIVATION_RECOMPUTE == key) {
+            if (val == PluginConfigParams::YES)
+                activationRecompute = true;
+            else if (val == PluginConfigParams::NO)
+                activationRecompute = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_ACTIVATION_RECOMPUTE
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_HUGE_PAGES == key) {
+            if (val == PluginConfigParams::YES)
+                useHugePages = true;
+            else if (val == PluginConfigParams::NO)
+                useHugePages = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PERF_EXPORT_DIR == key) {
+            // empty string means that the export is switched off
+            perfExportDirectory = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_CHROME_TRACE == key) {
+            // empty string means that the tracing is switched off
+            chromeTracePath = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_PMU_COUNTERS == key) {
+            if (val == PluginConfigParams::YES)
+                pmuCounters = true;
+            else if (val == PluginConfigParams::NO)
+                pmuCounters = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PMU_COUNTERS
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_INFER_FAST_PATH_NODE_LIMIT == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_INFER_FAST_PATH_NODE_LIMIT
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the fast path
+            inferFastPathNodeLimit = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_MICRO_BATCH_SIZE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_MICRO_BATCH_SIZE
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the micro-batch split
+            microBatchSize = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_REQUEST_DEADLINE == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_REQUEST_DEADLINE
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the admission control
+            requestDeadlineMs = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RELEASE_SOURCE_MODEL == key) {
+            if (val == PluginConfigParams::YES)
+                releaseSourceModel = true;
+            else if (val == PluginConfigParams::NO)
+                releaseSourceModel = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_RELEASE_SOURCE_MODEL
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_LAZY_PRIMITIVE_INIT == key) {
+            if (val == PluginConfigParams::YES)
+                lazyPrimitiveInit = true;
+            else if (val == PluginConfigParams::NO)
+                lazyPrimitiveInit = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_LAZY_PRIMITIVE_INIT
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PIPELINED_PREPROCESSING == key) {
+            if (val == PluginConfigParams::YES)
+                pipelinedPreprocessing = true;
+            else if (val == PluginConfigParams::NO)
+                pipelinedPreprocessing = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PIPELINED_PREPROCESSING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PIPELINED_POSTPROCESSING == key) {
+            if (val == PluginConfigParams::YES)
+                pipelinedPostprocessing = true;
+            else if (val == PluginConfigParams::NO)
+                pipelinedPostprocessing = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PIPELINED_POSTPROCESSING
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_QUANTIZATION == key) {
+            if (val == PluginConfigParams::YES)
+                dynamicQuantization = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicQuantization = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_DYNAMIC_QUANTIZATION
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_INT4_WEIGHT_COMPRESSION == key) {
+            if (val == PluginConfigParams::YES)
+                int4WeightCompression = true;
+            else if (val == PluginConfigParams::NO)
+                int4WeightCompression = false;
+            else
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_INT4_WEIGHT_COMPRESSION
+                           << ". Expected only YES/NO";
+        } else if (ov::hint::memory_budget.name() == key) {
+            try {
+                memoryBudget = std::stoull(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::hint::memory_budget.name()
+                           << ". Expected only unsigned numbers, got " << val;
+            }
+        } else if (ov::hint::model_priority.name() == key) {
+            if (val == "LOW")
+                modelPriority = ov::hint::ModelPriority::LOW;
+            else if (val == "MEDIUM")
+                modelPriority = ov::hint::ModelPriority::MEDIUM;
+            else if (val == "HIGH")
+                modelPriority = ov::hint::ModelPriority::HIGH;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::hint::model_priority.name()
+                           << ". Expected only LOW/MEDIUM/HIGH";
+        } else if (ov::hint::empirical_algorithm_selection.name() == key) {
+            if (val == PluginConfigParams::YES || val == "TRUE")
+                empiricalAlgorithmSelection = true;
+            else if (val == PluginConfigParams::NO || val == "FALSE")
+                empiricalAlgorithmSelection = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::hint::empirical_algorithm_selection.name()
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -183,6 +393,14 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
                          std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
         _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+        _config.insert({ov::hint::memory_budget.name(), std::to_string(memoryBudget)});
+        {
+            std::ostringstream modelPriorityStr;
+            modelPriorityStr << modelPriority;
+            _config.insert({ov::hint::model_priority.name(), modelPriorityStr.str()});
+        }
+        _config.insert({ov::hint::empirical_algorithm_selection.name(),
+                        empiricalAlgorithmSelection ? PluginConfigParams::YES : PluginConfigParams::NO});
     }
 }
 
@@ -209,6 +427,9 @@ void Config::readDebugCapsProperties() {
     if (envVarValue = readEnv("OV_CPU_VERBOSE"))
         verbose = envVarValue;
 
+    if (envVarValue = readEnv("OV_CPU_KERNEL_BENCH"))
+        kernelBenchmark = envVarValue;
+
     if (envVarValue = readEnv("OV_CPU_BLOB_DUMP_DIR"))
         blobDumpDir = envVarValue;
 
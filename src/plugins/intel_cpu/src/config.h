@@ -6,13 +6,18 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
+#include <openvino/runtime/properties.hpp>
 #include "utils/debug_capabilities.h"
 
 #include <string>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
+class PrepackedWeights;
+
 struct Config {
     Config();
 
@@ -24,9 +29,50 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool numaWeightReplication = false;
+    // force the content-keyed weight store for any stream count, so separately compiled
+    // models (e.g. static-shape variants of one model) share byte-identical constants
+    // (see KEY_CPU_CROSS_MODEL_WEIGHT_SHARING)
+    bool crossModelWeightSharing = false;
+    bool transformedModelCache = false;
+    bool useHugePages = false;
+    bool activationRecompute = false;
+    // best-effort footprint bound in bytes (see ov::hint::memory_budget), 0 - unlimited
+    uint64_t memoryBudget = 0;
+    // benchmark candidate conv algorithms on the real shapes at compile time
+    // (see ov::hint::empirical_algorithm_selection)
+    bool empiricalAlgorithmSelection = false;
+    bool lazyPrimitiveInit = false;
+    bool pipelinedPreprocessing = false;
+    bool pipelinedPostprocessing = false;
+    // lossy, so strictly opt-in (see KEY_CPU_DYNAMIC_QUANTIZATION)
+    bool dynamicQuantization = false;
+    // lossy, so strictly opt-in (see KEY_CPU_INT4_WEIGHT_COMPRESSION)
+    bool int4WeightCompression = false;
+    // zero disables the flat single-loop inference fast path
+    int inferFastPathNodeLimit = 0;
+    // per-node hardware PMU attribution (see KEY_CPU_PMU_COUNTERS)
+    bool pmuCounters = false;
+    // path prefix for the Chrome trace export of node execution spans (see KEY_CPU_CHROME_TRACE), "" - off
+    std::string chromeTracePath;
+    // directory for the always-on per-node counter export (see KEY_CPU_PERF_EXPORT_DIR), "" - off
+    std::string perfExportDirectory;
     std::string dumpToDot = "";
+    // input shape combinations to pre-build primitives for (see KEY_CPU_WARMUP_SHAPES)
+    std::vector<std::map<std::string, InferenceEngine::SizeVector>> warmupShapes;
     int batchLimit = 0;
+    // zero disables the micro-batch split of large-batch requests (see KEY_CPU_MICRO_BATCH_SIZE)
+    int microBatchSize = 0;
+    // async requests which cannot complete within this deadline in milliseconds are rejected
+    // at enqueue (see KEY_CPU_REQUEST_DEADLINE), 0 - no admission control
+    int requestDeadlineMs = 0;
+    // drop the source model once the per-stream graphs are built; disables Export()
+    // (see KEY_CPU_RELEASE_SOURCE_MODEL)
+    bool releaseSourceModel = false;
     size_t rtCacheCapacity = 100ul;
+    // scheduling weight of this model's requests on the stream threads; only effective
+    // when several models feed one executor (see streamExecutorConfig._executorDomain)
+    ov::hint::ModelPriority modelPriority = ov::hint::ModelPriority::MEDIUM;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -40,6 +86,9 @@ struct Config {
 #endif
 
     std::string cache_dir{};
+    // packed weight bytes restored from an imported blob; lets graph compilation
+    // skip weight reorders on a cache hit (not a user-visible property)
+    std::shared_ptr<PrepackedWeights> prepackedWeights;
 
     void readProperties(const std::map<std::string, std::string> &config);
     void updateProperties();
@@ -60,6 +109,8 @@ struct Config {
 
     std::string execGraphPath;
     std::string verbose;
+    // per-kernel microbenchmark after graph compilation; the value is the iteration count
+    std::string kernelBenchmark;
     std::string blobDumpDir = "mkldnn_dump";
     FORMAT blobDumpFormat = FORMAT::TEXT;
     // std::hash<int> is necessary for Ubuntu-16.04 (gcc-5.4 and defect in C++11 standart)
@@ -18,6 +18,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "Convolution", Convolution },
         { "GroupConvolution", Convolution },
         { "MatMul", MatMul },
+        { "ScaledDotProductAttention", Attention },
         { "FullyConnected", FullyConnected },
         { "MaxPool", Pooling },
         { "AvgPool", Pooling },
@@ -223,6 +224,8 @@ std::string NameFromType(const Type type) {
             return "FullyConnected";
         case MatMul:
             return "MatMul";
+        case Attention:
+            return "Attention";
         case Softmax:
             return "Softmax";
         case Split:
@@ -32,6 +32,7 @@ enum Type {
     Concatenation,
     Eltwise,
     MatMul,
+    Attention,
     Reshape,
     ShapeOf,
     NonZero,
@@ -108,6 +108,9 @@ MKLDNNPlugin::CPUTargetMachine::CPUTargetMachine(dnnl::impl::cpu::x64::cpu_isa_t
     jitters[ngraph::opset1::Tanh::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_tanh_emitter);
 
     jitters[ngraph::op::v4::HSwish::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_hswish_emitter);
+    jitters[ngraph::op::v4::Mish::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_mish_emitter);
+    jitters[ngraph::op::v4::SoftPlus::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_softplus_emitter);
+    jitters[ngraph::op::v5::Round::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_round_half_to_even_emitter);
     // jitters[ngraph::opset1::HardSigmoid::get_type_info_static()] = CREATE_EMITTER(); // not supported
     // jitters[ngraph::opset1::Selu::get_type_info_static()] = CREATE_EMITTER(); // not supported
     jitters[ngraph::op::v0::Gelu::get_type_info_static()] = CREATE_EMITTER(MKLDNNPlugin::jit_gelu_v0_emitter);
@@ -0,0 +1,209 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_amx_emitters.hpp"
+#include "utils/general_utils.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl;
+using namespace InferenceEngine;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+amx_tile_config_t amx_tile_config_t::full_tiles() {
+    amx_tile_config_t config;
+    std::memset(&config, 0, sizeof(config));
+    config.palette_id = 1;
+    for (int tile = 0; tile < 8; tile++) {
+        config.rows[tile] = 16;
+        config.cols_b[tile] = 64;
+    }
+    return config;
+}
+
+jit_amx_tile_config_emitter::jit_amx_tile_config_emitter(x64::jit_generator* host, x64::cpu_isa_t host_isa,
+                                                         const amx_tile_config_t& config)
+    : jit_emitter(host, host_isa, Precision::FP32, emitter_in_out_map::gpr_to_gpr), config_(config) {
+    if (!x64::mayiuse(x64::amx_tile))
+        IE_THROW() << "jit_amx_tile_config_emitter requires AMX tile support";
+    prepare_table();
+}
+
+void jit_amx_tile_config_emitter::register_table_entries() {
+    // the 64-byte configuration is embedded into the emitter data section
+    // and loaded with a single ldtilecfg
+    table_entry_val_t dwords[16];
+    std::memcpy(dwords, &config_, sizeof(config_));
+    for (size_t i = 0; i < 16; i++)
+        push_arg_entry_of("config", dwords[i], false);
+}
+
+void jit_amx_tile_config_emitter::emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                                            const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                                            const emitter_context* emit_context) const {
+    h->ldtilecfg(table_val("config"));
+}
+
+jit_amx_tile_release_emitter::jit_amx_tile_release_emitter(x64::jit_generator* host, x64::cpu_isa_t host_isa)
+    : jit_emitter(host, host_isa, Precision::FP32, emitter_in_out_map::gpr_to_gpr) {
+    if (!x64::mayiuse(x64::amx_tile))
+        IE_THROW() << "jit_amx_tile_release_emitter requires AMX tile support";
+}
+
+void jit_amx_tile_release_emitter::emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                                             const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                                             const emitter_context* emit_context) const {
+    h->tilerelease();
+}
+
+jit_amx_tile_gemm_emitter::jit_amx_tile_gemm_emitter(x64::jit_generator* host, x64::cpu_isa_t host_isa,
+                                                     Precision a_prc, Precision b_prc,
+                                                     int M, int N, int K,
+                                                     size_t lda, size_t ldb, size_t ldc,
+                                                     bool accumulate)
+    : jit_emitter(host, host_isa, a_prc, emitter_in_out_map::gpr_to_gpr),
+      a_prc_(a_prc), b_prc_(b_prc), M_(M), N_(N), K_(K), lda_(lda), ldb_(ldb), ldc_(ldc), accumulate_(accumulate) {
+    const bool is_bf16 = a_prc_ == Precision::BF16 && b_prc_ == Precision::BF16;
+    const bool is_int8 = one_of(a_prc_, Precision::U8, Precision::I8) && one_of(b_prc_, Precision::U8, Precision::I8);
+    if (!is_bf16 && !is_int8)
+        IE_THROW() << "jit_amx_tile_gemm_emitter supports bf16 x bf16 and int8 x int8 inputs, got "
+                   << a_prc_.name() << " x " << b_prc_.name();
+    if (is_bf16 && !x64::mayiuse(x64::amx_bf16))
+        IE_THROW() << "jit_amx_tile_gemm_emitter requires AMX bf16 support";
+    if (is_int8 && !x64::mayiuse(x64::amx_int8))
+        IE_THROW() << "jit_amx_tile_gemm_emitter requires AMX int8 support";
+
+    k_step_ = 64 / a_prc_.size();
+    if (M_ <= 0 || N_ <= 0 || K_ <= 0 || M_ % 16 != 0 || N_ % 16 != 0 || K_ % k_step_ != 0)
+        IE_THROW() << "jit_amx_tile_gemm_emitter does not handle tails: M, N have to be multiples of 16 "
+                   << "and K a multiple of " << k_step_;
+
+    m_tiles_ = M_ % 32 == 0 ? 2 : 1;
+    n_tiles_ = N_ % 32 == 0 ? 2 : 1;
+}
+
+size_t jit_amx_tile_gemm_emitter::aux_gprs_count() const {
+    // A, B (reused for C) block pointers, K counter and the three strides
+    // which tile loads/stores take in registers
+    return 6;
+}
+
+void jit_amx_tile_gemm_emitter::validate_arguments(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                                                   const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs) const {
+    if (in_idxs.size() != 3)
+        IE_THROW() << "jit_amx_tile_gemm_emitter expects three input gprs: A, B and C pointers";
+}
+
+void jit_amx_tile_gemm_emitter::emit_tile_product(const Tmm& acc, const Tmm& a, const Tmm& b) const {
+    if (a_prc_ == Precision::BF16) {
+        h->tdpbf16ps(acc, a, b);
+    } else if (a_prc_ == Precision::U8 && b_prc_ == Precision::I8) {
+        h->tdpbusd(acc, a, b);
+    } else if (a_prc_ == Precision::I8 && b_prc_ == Precision::I8) {
+        h->tdpbssd(acc, a, b);
+    } else if (a_prc_ == Precision::I8 && b_prc_ == Precision::U8) {
+        h->tdpbsud(acc, a, b);
+    } else {
+        h->tdpbuud(acc, a, b);
+    }
+}
+
+void jit_amx_tile_gemm_emitter::emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                                          const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                                          const emitter_context* emit_context) const {
+    Reg64 reg_a(in_idxs[0]);
+    Reg64 reg_b(in_idxs[1]);
+    Reg64 reg_c(in_idxs[2]);
+
+    Reg64 reg_a_ptr(aux_gpr_idxs[0]);
+    Reg64 reg_bc_ptr(aux_gpr_idxs[1]);
+    Reg64 reg_k(aux_gpr_idxs[2]);
+    Reg64 reg_lda(aux_gpr_idxs[3]);
+    Reg64 reg_ldb(aux_gpr_idxs[4]);
+    Reg64 reg_ldc(aux_gpr_idxs[5]);
+
+    h->mov(reg_lda, lda_);
+    h->mov(reg_ldb, ldb_);
+    h->mov(reg_ldc, ldc_);
+
+    const Tmm tmm_c00(0), tmm_c01(1), tmm_c10(2), tmm_c11(3);
+    const Tmm tmm_a0(4), tmm_a1(5);
+    const Tmm tmm_b0(6), tmm_b1(7);
+
+    // bytes of A consumed per K iteration; B advances by the matching number
+    // of VNNI-packed rows
+    const size_t a_k_advance = 64lu;
+    const size_t b_k_advance = 16lu * ldb_;
+
+    for (int mb = 0; mb < M_; mb += 16 * m_tiles_) {
+        for (int nb = 0; nb < N_; nb += 16 * n_tiles_) {
+            const size_t c_off = static_cast<size_t>(mb) * ldc_ + static_cast<size_t>(nb) * sizeof(float);
+            if (accumulate_) {
+                h->lea(reg_bc_ptr, h->ptr[reg_c + c_off]);
+                h->tileloadd(tmm_c00, h->ptr[reg_bc_ptr + reg_ldc]);
+                if (n_tiles_ == 2)
+                    h->tileloadd(tmm_c01, h->ptr[reg_bc_ptr + reg_ldc + 64]);
+                if (m_tiles_ == 2) {
+                    h->tileloadd(tmm_c10, h->ptr[reg_bc_ptr + reg_ldc + 16 * ldc_]);
+                    if (n_tiles_ == 2)
+                        h->tileloadd(tmm_c11, h->ptr[reg_bc_ptr + reg_ldc + 16 * ldc_ + 64]);
+                }
+            } else {
+                h->tilezero(tmm_c00);
+                if (n_tiles_ == 2)
+                    h->tilezero(tmm_c01);
+                if (m_tiles_ == 2) {
+                    h->tilezero(tmm_c10);
+                    if (n_tiles_ == 2)
+                        h->tilezero(tmm_c11);
+                }
+            }
+
+            h->lea(reg_a_ptr, h->ptr[reg_a + static_cast<size_t>(mb) * lda_]);
+            h->lea(reg_bc_ptr, h->ptr[reg_b + static_cast<size_t>(nb) * 4]);
+            h->mov(reg_k, K_ / k_step_);
+
+            Label l_k_loop;
+            h->L(l_k_loop);
+            {
+                h->tileloadd(tmm_a0, h->ptr[reg_a_ptr + reg_lda]);
+                if (m_tiles_ == 2)
+                    h->tileloadd(tmm_a1, h->ptr[reg_a_ptr + reg_lda + 16 * lda_]);
+                h->tileloadd(tmm_b0, h->ptr[reg_bc_ptr + reg_ldb]);
+                if (n_tiles_ == 2)
+                    h->tileloadd(tmm_b1, h->ptr[reg_bc_ptr + reg_ldb + 64]);
+
+                emit_tile_product(tmm_c00, tmm_a0, tmm_b0);
+                if (n_tiles_ == 2)
+                    emit_tile_product(tmm_c01, tmm_a0, tmm_b1);
+                if (m_tiles_ == 2) {
+                    emit_tile_product(tmm_c10, tmm_a1, tmm_b0);
+                    if (n_tiles_ == 2)
+                        emit_tile_product(tmm_c11, tmm_a1, tmm_b1);
+                }
+
+                h->add(reg_a_ptr, a_k_advance);
+                h->add(reg_bc_ptr, b_k_advance);
+                h->dec(reg_k);
+                h->jnz(l_k_loop, Xbyak::CodeGenerator::T_NEAR);
+            }
+
+            h->lea(reg_bc_ptr, h->ptr[reg_c + c_off]);
+            h->tilestored(h->ptr[reg_bc_ptr + reg_ldc], tmm_c00);
+            if (n_tiles_ == 2)
+                h->tilestored(h->ptr[reg_bc_ptr + reg_ldc + 64], tmm_c01);
+            if (m_tiles_ == 2) {
+                h->tilestored(h->ptr[reg_bc_ptr + reg_ldc + 16 * ldc_], tmm_c10);
+                if (n_tiles_ == 2)
+                    h->tilestored(h->ptr[reg_bc_ptr + reg_ldc + 16 * ldc_ + 64], tmm_c11);
+            }
+        }
+    }
+}
+
+} // namespace MKLDNNPlugin
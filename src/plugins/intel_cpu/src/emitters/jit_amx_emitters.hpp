@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_emitter.hpp"
+#include <cpu/x64/jit_generator.hpp>
+
+namespace MKLDNNPlugin {
+
+// In-memory image of the AMX tile configuration consumed by ldtilecfg
+// (palette 1): per-tile row counts and row widths in bytes.
+struct amx_tile_config_t {
+    uint8_t palette_id;
+    uint8_t start_row;
+    uint8_t reserved[14];
+    uint16_t cols_b[16];
+    uint8_t rows[16];
+
+    // Configuration shared by all tile-GEMM emitters of this file: eight full
+    // 16 x 64-byte tiles. tmm0-tmm3 are the 2x2 block of accumulators,
+    // tmm4-tmm5 hold two row blocks of A, tmm6-tmm7 two column blocks of B.
+    static amx_tile_config_t full_tiles();
+};
+static_assert(sizeof(amx_tile_config_t) == 64, "AMX tile config must be exactly 64 bytes");
+
+/**
+ * Programs the AMX tile file with the configuration passed at construction.
+ * Has to be emitted before any of the tile-GEMM emitters below; the kernel must
+ * emit jit_amx_tile_release_emitter (or call tilerelease itself) before returning,
+ * otherwise the dirty tile state is carried into the surrounding oneDNN kernels.
+ */
+class jit_amx_tile_config_emitter : public jit_emitter {
+public:
+    jit_amx_tile_config_emitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                                const amx_tile_config_t& config);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                   const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                   const emitter_context* emit_context) const override;
+
+    void register_table_entries() override;
+
+    amx_tile_config_t config_;
+};
+
+/**
+ * Resets the tile file to the init state. Emit once on every exit path of a kernel
+ * that configured tiles.
+ */
+class jit_amx_tile_release_emitter : public jit_emitter {
+public:
+    jit_amx_tile_release_emitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                   const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                   const emitter_context* emit_context) const override;
+};
+
+/**
+ * Tile-GEMM building block: C[M x N] (+)= A[M x K] * B[K x N] on the AMX tile file,
+ * usable from snippets and fused-node kernels. The shapes are fixed at construction
+ * (one emitter instance per blocking, the way oneDNN specializes brgemm kernels);
+ * in_idxs are three gprs with the A, B and C base pointers.
+ *
+ * Expected layouts (strides are byte strides, fixed at construction):
+ *  - A: plain row major, lda between rows, bf16 or int8;
+ *  - B: VNNI repacked, i.e. element (k, n) lives at (k / g) * ldb + n * 4 + (k % g) * type_size,
+ *    where g = 4 / type_size (2 for bf16, 4 for int8) - the layout oneDNN uses for
+ *    amx weights, so repacked weights can be shared with library primitives;
+ *  - C: plain row major, ldc between rows, f32 for bf16 inputs and i32 for int8 ones.
+ *
+ * M, N have to be multiples of 16 and K a multiple of 64 / type_size: tails keep
+ * their own emitter instance (and, when shorter than a full tile, their own tile
+ * configuration), again mirroring how the library blocks tail processing.
+ */
+class jit_amx_tile_gemm_emitter : public jit_emitter {
+public:
+    jit_amx_tile_gemm_emitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                              InferenceEngine::Precision a_prc, InferenceEngine::Precision b_prc,
+                              int M, int N, int K,
+                              size_t lda, size_t ldb, size_t ldc,
+                              bool accumulate);
+
+    size_t get_inputs_num() const override { return 3; }
+
+protected:
+    size_t aux_gprs_count() const override;
+
+private:
+    void emit_impl(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                   const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs,
+                   const emitter_context* emit_context) const override;
+
+    void validate_arguments(const std::vector<size_t>& in_idxs, const std::vector<size_t>& out_idxs,
+                            const std::vector<size_t>& pool_vec_idxs, const std::vector<size_t>& pool_gpr_idxs) const override;
+
+    void emit_tile_product(const Xbyak::Tmm& acc, const Xbyak::Tmm& a, const Xbyak::Tmm& b) const;
+
+    InferenceEngine::Precision a_prc_;
+    InferenceEngine::Precision b_prc_;
+    int M_, N_, K_;
+    size_t lda_, ldb_, ldc_;
+    bool accumulate_;
+
+    int k_step_;   // elements of K consumed per tile load (64 / type_size)
+    int m_tiles_;  // 1 or 2 row blocks of 16 processed at once
+    int n_tiles_;  // 1 or 2 column blocks of 16 processed at once
+};
+
+} // namespace MKLDNNPlugin
@@ -112,6 +112,47 @@ public:
         set_injector();
     }
 };
+class jit_mish_emitter : public jit_mkldnn_emitter {
+public:
+    jit_mish_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+        kind = dnnl_eltwise_mish;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
+class jit_softplus_emitter : public jit_mkldnn_emitter {
+public:
+    jit_softplus_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+        kind = dnnl_eltwise_soft_relu;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
+class jit_round_half_to_even_emitter : public jit_mkldnn_emitter {
+public:
+    jit_round_half_to_even_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                        const std::shared_ptr<ngraph::Node>& n,
+                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32)
+            : jit_mkldnn_emitter(host, host_isa, n, exec_prc) {
+        // the half-away-from-zero mode is filtered out by the snippets tokenizer
+        kind = dnnl_eltwise_round_half_to_even;
+        alpha = 0.f;
+        beta = 0.f;
+
+        set_injector();
+    }
+};
+
 class jit_gelu_v0_emitter : public jit_mkldnn_emitter {
 public:
     jit_gelu_v0_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
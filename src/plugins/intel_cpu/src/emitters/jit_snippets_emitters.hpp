@@ -419,7 +419,7 @@ private:
 class MemoryEmitter : public jit_emitter  {
 public:
     MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
-    : jit_emitter(h, isa, n), ea(getEA(n)) {
+    : jit_emitter(h, isa, n), ea(getEA(n)), prc(n->get_output_element_type(0)) {
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -438,12 +438,17 @@ protected:
     }
 
     size_t ea;
+    // In-memory element type of the tensor behind ea. Everything except bf16 is processed as f32,
+    // bf16 is converted on load/store while the computation still runs on f32 vectors.
+    ov::element::Type prc;
 };
 
 class StoreEmitter : public MemoryEmitter  {
 public:
     StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n) {
+        if (prc == ov::element::bf16 && !mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core_bf16))
+            IE_THROW() << "Store emitter supports bf16 only on avx512_core_bf16 platforms";
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -472,8 +477,16 @@ private:
                                     Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Vmm vmm_src0 = Vmm(in[0]);
-        h->uni_vmovups(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+        if (prc == ov::element::bf16) {
+            // ymm31 is a safe scratch: the snippets register allocator only hands out vmm0-vmm15
+            Ymm ymm_cvt = Ymm(31);
+            h->vcvtneps2bf16(ymm_cvt, Zmm(in[0]));
+            h->vmovdqu16(h->ptr[out_reg], ymm_cvt);
+            h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen / 2);
+        } else {
+            h->uni_vmovups(h->ptr[out_reg], vmm_src0);
+            h->add(out_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+        }
     }
 };
 
@@ -481,6 +494,8 @@ class ScalarStoreEmitter : public MemoryEmitter {
 public:
     ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n)
     : MemoryEmitter(h, isa, n) {
+        if (prc == ov::element::bf16 && !mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core_bf16))
+            IE_THROW() << "ScalarStore emitter supports bf16 only on avx512_core_bf16 platforms";
     }
 
     size_t get_inputs_num() const override {return 1;}
@@ -509,8 +524,15 @@ private:
                                         Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 out_reg(ea);
         Xmm vmm_src0 = Xmm(in[0]);
-        h->uni_vmovss(h->ptr[out_reg], vmm_src0);
-        h->add(out_reg, sizeof(float));
+        if (prc == ov::element::bf16) {
+            Xmm xmm_cvt = Xmm(31);
+            h->vcvtneps2bf16(xmm_cvt, vmm_src0);
+            h->uni_vpextrw(h->ptr[out_reg], xmm_cvt, 0);
+            h->add(out_reg, sizeof(uint16_t));
+        } else {
+            h->uni_vmovss(h->ptr[out_reg], vmm_src0);
+            h->add(out_reg, sizeof(float));
+        }
     }
 };
 
@@ -546,10 +568,16 @@ private:
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Vmm vmm_src0 = Vmm(out[0]);
-        h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        if (prc == ov::element::bf16) {
+            // bf16 to f32 is a plain shift into the upper half of each dword
+            h->uni_vpmovzxwd(vmm_src0, h->ptr[in_reg]);
+            h->uni_vpslld(vmm_src0, vmm_src0, 16);
+        } else {
+            h->uni_vmovups(vmm_src0, h->ptr[in_reg]);
+        }
 
         if (shouldPostIncrement) {
-            h->add(in_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen);
+            h->add(in_reg, mkldnn::impl::cpu::x64::cpu_isa_traits<isa>::vlen / (prc == ov::element::bf16 ? 2 : 1));
         }
     }
 
@@ -591,7 +619,13 @@ private:
 
         // In doesn't really matter if we broadcast or `movss` for vector tails so keep only one version for `BroadcastLoad`,
         // key point here is not to add post-increment, it might be fixed by some other approach in future
-        h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        if (prc == ov::element::bf16) {
+            // broadcasting the word into every 16-bit lane and shifting left leaves the f32 value in every dword
+            h->vpbroadcastw(vmm_src0, h->ptr[in_reg]);
+            h->uni_vpslld(vmm_src0, vmm_src0, 16);
+        } else {
+            h->uni_vbroadcastss(vmm_src0, h->ptr[in_reg]);
+        }
     }
 };
 
@@ -626,11 +660,16 @@ private:
                                             Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
         Reg64 in_reg(ea);
         Xmm vmm_src0 = Xmm(out[0]);
-        h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        if (prc == ov::element::bf16) {
+            h->vpbroadcastw(vmm_src0, h->ptr[in_reg]);
+            h->uni_vpslld(vmm_src0, vmm_src0, 16);
+        } else {
+            h->uni_vmovss(vmm_src0, h->ptr[in_reg]);
+        }
 
         // Doesn't work if the same pointer comes with multiple load operations
         if (shouldPostIncrement) {
-            h->add(in_reg, sizeof(float));
+            h->add(in_reg, prc == ov::element::bf16 ? sizeof(uint16_t) : sizeof(float));
         }
     }
 
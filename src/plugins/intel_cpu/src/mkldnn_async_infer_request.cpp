@@ -3,13 +3,83 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include <chrono>
 #include <memory>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    auto request = static_cast<MKLDNNInferRequestBase*>(inferRequest.get());
+    request->SetAsyncRequest(this);
+
+    // with dedicated preprocessing/postprocessing executors the asynchronous pipeline gets separate
+    // stages around graph execution, so per-request preprocessing and output conversion of this request
+    // overlap with graph execution of the neighbouring scheduled ones instead of occupying the stream thread
+    auto preprocExecutor = request->getPreprocExecutor();
+    auto postprocExecutor = request->getPostprocExecutor();
+    // graph execution of models with a non-default priority is submitted through the wrapper,
+    // so their requests overtake (or give way to) the other models sharing the stream threads
+    auto priorityExecutor = request->getPriorityTaskExecutor();
+    const bool admission = request->hasDeadlineAdmission();
+    if (preprocExecutor || postprocExecutor || priorityExecutor || admission) {
+        _pipeline.clear();
+        if (preprocExecutor) {
+            _pipeline.emplace_back(preprocExecutor,
+                                   [request, admission] {
+                                       try {
+                                           request->RunPreprocessingStage();
+                                       } catch (...) {
+                                           // an aborted pipeline skips the remaining stages,
+                                           // so the admission slot has to be released here
+                                           if (admission)
+                                               request->LeaveAdmissionQueue();
+                                           throw;
+                                       }
+                                   });
+        }
+        _pipeline.emplace_back(priorityExecutor ? priorityExecutor : taskExecutor,
+                               [request, postprocExecutor, admission] {
+                                   if (postprocExecutor)
+                                       request->DeferPostprocessing();
+                                   if (admission) {
+                                       const auto start = std::chrono::steady_clock::now();
+                                       try {
+                                           request->InferImpl();
+                                       } catch (...) {
+                                           request->LeaveAdmissionQueue();
+                                           throw;
+                                       }
+                                       request->RecordAdmittedCompletion(static_cast<uint64_t>(
+                                           std::chrono::duration_cast<std::chrono::microseconds>(
+                                               std::chrono::steady_clock::now() - start).count()));
+                                   } else {
+                                       request->InferImpl();
+                                   }
+                               });
+        if (postprocExecutor) {
+            _pipeline.emplace_back(postprocExecutor,
+                                   [request] {
+                                       request->RunPostprocessingStage();
+                                   });
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    auto request = static_cast<MKLDNNInferRequestBase*>(_syncRequest.get());
+    if (request->hasDeadlineAdmission()) {
+        request->ThrowIfDeadlineUnattainable();
+        request->EnterAdmissionQueue();
+        try {
+            InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+        } catch (...) {
+            request->LeaveAdmissionQueue();
+            throw;
+        }
+    } else {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
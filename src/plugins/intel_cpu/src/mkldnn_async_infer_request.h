@@ -17,6 +17,10 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+protected:
+    // adds the deadline admission checkpoint in front of the regular submission
+    void StartAsync_ThreadUnsafe() override;
 };
 
 }  // namespace MKLDNNPlugin
@@ -118,6 +118,18 @@ MKLDNNDescriptor::operator std::shared_ptr<mkldnn::softmax_forward::desc>() {
     return typeDesc->getPtr();
 }
 
+MKLDNNDescriptor::MKLDNNDescriptor(std::shared_ptr<mkldnn::logsoftmax_forward::desc> desc) {
+    this->desc.reset(new DescFwdImpl<mkldnn::logsoftmax_forward::desc>(desc));
+}
+
+MKLDNNDescriptor::operator std::shared_ptr<mkldnn::logsoftmax_forward::desc>() {
+    auto typeDesc = std::dynamic_pointer_cast<DescFwdImpl<mkldnn::logsoftmax_forward::desc>>(desc);
+    if (typeDesc == nullptr) {
+        IE_THROW() << "Cannot cast descriptor!";
+    }
+    return typeDesc->getPtr();
+}
+
 MKLDNNDescriptor::MKLDNNDescriptor(std::shared_ptr<mkldnn::vanilla_rnn_forward::desc> desc) {
     this->desc.reset(new DescFwdImpl<mkldnn::vanilla_rnn_forward::desc>(desc));
 }
@@ -34,6 +34,9 @@ public:
     explicit MKLDNNDescriptor(std::shared_ptr<mkldnn::softmax_forward::desc> desc);
     operator std::shared_ptr<mkldnn::softmax_forward::desc>();
 
+    explicit MKLDNNDescriptor(std::shared_ptr<mkldnn::logsoftmax_forward::desc> desc);
+    operator std::shared_ptr<mkldnn::logsoftmax_forward::desc>();
+
     explicit MKLDNNDescriptor(std::shared_ptr<mkldnn::vanilla_rnn_forward::desc> desc);
     operator std::shared_ptr<mkldnn::vanilla_rnn_forward::desc>();
 
@@ -12,6 +12,7 @@
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include <blob_factory.hpp>
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -26,6 +27,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "ie_icore.hpp"
 
 using namespace MKLDNNPlugin;
@@ -54,6 +56,19 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
     std::mutex _mutex;
 };
 
+// forwards the tasks of one compiled model to the streams executor with a fixed priority,
+// so its requests overtake (or give way to) the requests of the other models feeding the
+// same executor
+struct PriorityTaskExecutor : public ITaskExecutor {
+    PriorityTaskExecutor(IStreamsExecutor::Ptr executor, int priority)
+        : _executor{std::move(executor)}, _priority{priority} {}
+    void run(InferenceEngine::Task task) override {
+        _executor->runWithPriority(std::move(task), _priority);
+    }
+    IStreamsExecutor::Ptr _executor;
+    int _priority = 0;
+};
+
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
@@ -86,9 +101,27 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (!streamsExecutorConfig._executorDomain.empty()) {
+            // models compiled into the same executor domain run on one shared set of stream threads,
+            // so loading many models side by side does not oversubscribe the machine
+            streamsExecutorConfig._name += "/" + streamsExecutorConfig._executorDomain;
+            _taskExecutor = ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig);
+        } else {
+            _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
+    _requestDeadlineUs = 1000ull * static_cast<uint64_t>(std::max(_cfg.requestDeadlineMs, 0));
+    if (ov::hint::ModelPriority::MEDIUM != _cfg.modelPriority) {
+        // graph execution tasks of this model are submitted through the priority wrapper, while
+        // _taskExecutor itself stays the streams executor (GetGraph() relies on that to resolve
+        // the stream id); mostly useful with an executor domain, where interactive and batch
+        // models feed one shared task queue
+        if (auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor)) {
+            const int priority = ov::hint::ModelPriority::HIGH == _cfg.modelPriority ? 1 : -1;
+            _priorityTaskExecutor = std::make_shared<PriorityTaskExecutor>(streamsExecutor, priority);
+        }
+    }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         // There is no additional threads but we still need serialize callback execution to preserve legacy behaviour
@@ -101,6 +134,20 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.pipelinedPreprocessing && 0 != cfg.streamExecutorConfig._streams) {
+        // input preprocessing of asynchronous requests runs as a dedicated pipeline stage on this executor,
+        // so it overlaps with graph execution of the previously scheduled request on the stream threads
+        _preprocExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                               IStreamsExecutor::Config{"CPUPreprocExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
+    if (_cfg.pipelinedPostprocessing && 0 != cfg.streamExecutorConfig._streams) {
+        // output precision conversion of asynchronous requests runs as a dedicated pipeline stage on this
+        // executor, so the stream thread is released right after graph execution
+        _postprocExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+                                IStreamsExecutor::Config{"CPUPostprocExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -119,23 +166,44 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
     if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                if (!memoryNode) {
-                    IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-                }
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
+        for (auto &node : GetGraph()._graph.GetMemoryStateNodes()) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            if (!memoryNode) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+            }
+            auto state_store = memoryNode->getStore();
+            auto state_name = memoryNode->getId();
+
+            // Remove suffix with pair ID. Internal information.
+            auto suffix_idx = state_name.find("/id=");
+            if (suffix_idx != std::string::npos)
+                state_name = state_name.substr(0, suffix_idx);
+
+            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+        }
+    }
 
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+    // keep own copies of the I/O info: warm-up and request creation then do not depend on the
+    // source model, and the maps are valid before the plugin wrapper fills them in after load
+    setNetworkInputs(_network.getInputsInfo());
+    setNetworkOutputs(_network.getOutputsInfo());
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+    if (_cfg.releaseSourceModel) {
+        // the lazy path in GetGraph() reads the source model, so a stream whose build task was
+        // picked up by a faster sibling during the parallel build above is finalized here
+        for (auto& g : _graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (!graphLock._graph.IsReady()) {
+                {
+                    std::lock_guard<std::mutex> lock{_cfgMutex};
+                    graphLock._graph.setConfig(_cfg);
+                }
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[0]);
             }
         }
+        // every graph holds its own replica, so the original graph only serves introspection
+        // from here on; GetExecGraphInfo() reconstructs the runtime model on demand instead
+        _network = InferenceEngine::CNNNetwork{};
     }
 }
 
@@ -190,6 +258,49 @@ InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferReques
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
 
+void MKLDNNExecNetwork::ScheduleWarmup() {
+    if (_cfg.warmupShapes.empty())
+        return;
+    // the task keeps the network alive until the dry runs are done
+    auto self = std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this());
+    auto warmup = [self] {
+        try {
+            auto request = self->CreateInferRequestImpl(self->_networkInputs, self->_networkOutputs);
+            for (auto&& shapeSet : self->_cfg.warmupShapes) {
+                try {
+                    for (auto&& input : shapeSet) {
+                        const auto& inputsInfo = self->_networkInputs;
+                        auto itInfo = inputsInfo.find(input.first);
+                        if (itInfo == inputsInfo.end())
+                            continue;
+                        auto blob = make_blob_with_precision(TensorDesc{itInfo->second->getPrecision(),
+                                                                        input.second,
+                                                                        TensorDesc::getLayoutByDims(input.second)});
+                        blob->allocate();
+                        // zeroed data keeps index-consuming ops within bounds during the dry run
+                        std::memset(blob->buffer(), 0, blob->byteSize());
+                        request->SetBlob(input.first, blob);
+                    }
+                    request->Infer();
+                } catch (...) {
+                    // pre-building a registered shape is best effort: on failure the shape is
+                    // simply prepared on its first live encounter, as without warm-up
+                }
+            }
+        } catch (...) {
+            // could not create the warm-up request, nothing to pre-build with
+        }
+    };
+    if (_cfg.streamExecutorConfig._streams != 0) {
+        // one dry run per stream, since every stream keeps its own graph and primitive caches
+        for (size_t i = 0; i < _graphs.size(); i++) {
+            _taskExecutor->run(warmup);
+        }
+    } else {
+        warmup();
+    }
+}
+
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
     if (_graphs.size() == 0)
         IE_THROW() << "No graph was found";
@@ -199,9 +310,12 @@ std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
 
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0) IE_THROW() << "No graph was found";
-    Config engConfig = GetGraph()._graph.getProperty();
-    auto option = engConfig._config.find(name);
-    if (option != engConfig._config.end()) {
+    // middleware tends to query the config per request, so answer from the network-level
+    // config directly: the per-stream graph copies are kept in sync by setProperty, and going
+    // through GetGraph() here would take the graph lock and copy the whole Config for one key
+    std::lock_guard<std::mutex> lock{_cfgMutex};
+    auto option = _cfg._config.find(name);
+    if (option != _cfg._config.end()) {
         return option->second;
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork config key: " << name;
@@ -220,20 +334,39 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(MEMORY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
-        for (auto && key : GetGraph()._graph.getProperty()._config) {
-            configKeys.push_back(key.first);
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            for (auto && key : _cfg._config) {
+                configKeys.push_back(key.first);
+            }
         }
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        Config engConfig = GetGraph()._graph.getProperty();
-        auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
-        IE_ASSERT(option != engConfig._config.end());
-        auto streams = std::stoi(option->second);
+        // queried per request by the AUTO/MULTI middleware - read the typed field instead of
+        // copying the Config and re-parsing the streams number from its string map
+        int streams = 0;
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            streams = _cfg.streamExecutorConfig._streams;
+        }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(MEMORY_STATISTICS)) {
+        std::map<std::string, uint64_t> stats;
+        // one counted-buffers set over all per-stream graphs, so shared constants are not
+        // accumulated once per stream
+        std::unordered_set<const void*> countedBuffers;
+        for (auto& g : _graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (graphLock._graph.IsReady()) {
+                graphLock._graph.CollectMemoryStatistics(stats, countedBuffers);
+            }
+        }
+        IE_SET_METRIC_RETURN(MEMORY_STATISTICS, stats);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -286,7 +419,43 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &ne
     return true;
 }
 
+void MKLDNNExecNetwork::UpdateWeights(const std::map<std::string, InferenceEngine::Blob::Ptr>& weights) {
+    // the per-stream graph lock also serializes the update against inference: a request which is
+    // already running on the graph finishes with the old values, the next one sees the new ones
+    for (auto& g : _graphs) {
+        auto graphLock = Graph::Lock(g);
+        if (graphLock._graph.IsReady()) {
+            graphLock._graph.UpdateWeights(weights);
+        }
+    }
+}
+
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    if (_cfg.releaseSourceModel) {
+        IE_THROW(NotImplemented) << "Cannot export the network: the source model was released after compilation ("
+                                 << PluginConfigInternalParams::KEY_CPU_RELEASE_SOURCE_MODEL << ")";
+    }
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // Append the packed weights of the compiled graph: importing the blob on a
+    // machine which selects the same layouts then skips the weight reorders.
+    std::vector<std::pair<std::string, MKLDNNMemoryPtr>> packed;
+    std::unordered_set<std::string> seen;
+    auto graphLock = GetGraph();
+    for (const auto& node : graphLock._graph.GetNodes()) {
+        const auto& blobs = node->getInternalBlobs();
+        const auto& mems = node->getInternalBlobMemory();
+        if (blobs.size() != mems.size())
+            continue;
+        for (size_t i = 0; i < blobs.size(); i++) {
+            auto key = MKLDNNWeightsSharing::MakeKey(mems[i]->getDesc(),
+                                                     blobs[i]->buffer(),
+                                                     blobs[i]->byteSize());
+            // content-based keys, so byte-identical weights are written once
+            if (seen.insert(key).second)
+                packed.emplace_back(std::move(key), mems[i]);
+        }
+    }
+    serializePrepackedWeights(modelStream, packed);
 }
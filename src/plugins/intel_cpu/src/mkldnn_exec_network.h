@@ -11,6 +11,7 @@
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <map>
@@ -33,6 +34,10 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
+    // Pre-builds the shape-specialized primitives for the shape combinations registered
+    // via KEY_CPU_WARMUP_SHAPES; must be called on an owned instance (after make_shared)
+    void ScheduleWarmup();
+
     MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                       const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
 
@@ -46,11 +51,13 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    void UpdateWeights(const std::map<std::string, InferenceEngine::Blob::Ptr>& weights) override;
+
 protected:
     friend class MKLDNNInferRequestBase;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
-    const InferenceEngine::CNNNetwork           _network;
+    InferenceEngine::CNNNetwork                 _network;  // empty after the source model is released
     mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
@@ -67,6 +74,22 @@ protected:
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
 
+    // executor of the dedicated preprocessing pipeline stage; null unless pipelined preprocessing is enabled
+    InferenceEngine::ITaskExecutor::Ptr         _preprocExecutor;
+
+    // executor of the dedicated postprocessing pipeline stage; null unless pipelined postprocessing is enabled
+    InferenceEngine::ITaskExecutor::Ptr         _postprocExecutor;
+
+    // wraps _taskExecutor to submit graph execution with the configured model priority;
+    // null when the priority is MEDIUM (the default submission path is used)
+    InferenceEngine::ITaskExecutor::Ptr         _priorityTaskExecutor;
+
+    // deadline-aware admission control (see KEY_CPU_REQUEST_DEADLINE): the smoothed service time
+    // and the count of admitted but not yet completed requests drive the rejection at enqueue
+    uint64_t                                    _requestDeadlineUs = 0;
+    std::atomic<uint64_t>                       _serviceTimeEstimateUs{0};
+    std::atomic<int>                            _admittedRequests{0};
+
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <map>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <iostream>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -25,8 +27,12 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_fake_quantize_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_memcpy.h>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -36,7 +42,9 @@
 
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
+#include "utils/kernel_bench.h"
 #include "utils/node_dumper.h"
+#include "utils/pmu_counters.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/verbose.h"
@@ -60,17 +68,75 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 mkldnn::engine MKLDNNGraph::eng(mkldnn::engine::kind::cpu, 0);
 
+MKLDNNGraph::~MKLDNNGraph() {
+    if (primitivePreparer.joinable())
+        primitivePreparer.join();
+    // the spans reference graph nodes, so the trace is serialized while they are still alive
+    if (traceSink)
+        traceSink->dump();
+    if (config.pmuCounters)
+        DumpPmuCounters();
+}
+
+void MKLDNNGraph::DumpPmuCounters() const {
+    struct TypeStats {
+        uint64_t llcMisses = 0;
+        uint64_t llcRefs = 0;
+        double timeUs = 0.0;
+    };
+    std::map<std::string, TypeStats> statsByType;
+    for (const auto& node : graphNodes) {
+        if (!node->pmuLlcMisses && !node->pmuLlcRefs)
+            continue;
+        auto& stats = statsByType[node->getTypeStr()];
+        stats.llcMisses += node->pmuLlcMisses;
+        stats.llcRefs += node->pmuLlcRefs;
+        stats.timeUs += node->pmuTimeUs;
+    }
+    if (statsByType.empty())
+        return;
+
+    // a cache line travels from DRAM for every LLC miss, so misses * 64 estimates the traffic
+    constexpr double cacheLineBytes = 64.0;
+    std::cout << "ov_cpu_pmu," << _name << ",type,time_ms,llc_miss,llc_ref,miss_ratio,dram_mb,dram_gb_per_s"
+              << std::endl;
+    for (const auto& entry : statsByType) {
+        const auto& stats = entry.second;
+        const double dramBytes = stats.llcMisses * cacheLineBytes;
+        std::cout << "ov_cpu_pmu," << _name << "," << entry.first << "," << stats.timeUs / 1e3 << ","
+                  << stats.llcMisses << "," << stats.llcRefs << ","
+                  << (stats.llcRefs ? static_cast<double>(stats.llcMisses) / stats.llcRefs : 0.0) << ","
+                  << dramBytes / 1e6 << "," << (stats.timeUs > 0 ? dramBytes / stats.timeUs / 1e3 : 0.0)
+                  << std::endl;
+    }
+}
+
 template<typename NET>
 void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
         MKLDNNWeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
 
+    if (primitivePreparer.joinable())
+        primitivePreparer.join();
+    deferredPrimitiveNodes.clear();
+    deferredPreparationDone = false;
+
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once; NUMA weight replication
+    // keeps the cache active so each socket-local graph clones constants into its
+    // own node's store instead of referencing memory resident on another socket, and
+    // cross-model sharing keeps it active so separately compiled models (e.g. several
+    // static-shape variants of one model) deduplicate byte-identical constants
+    weightsCache = (config.streamExecutorConfig._streams != 1 || config.numaWeightReplication ||
+                    config.crossModelWeightSharing) ? w_cache : nullptr;
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    scratchPad = std::make_shared<MKLDNNScratchPad>(getEngine());
+
+    // covers the constants cloned during replication and the intermediate-tensor
+    // arena of AllocateWithReuse
+    HugePagePolicyScope hugePagesScope(config.useHugePages);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -88,6 +154,7 @@ template void MKLDNNGraph::CreateGraph(const CNNNetwork&,
 void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
     this->reuse_io_tensors = false;
+    this->extensionMgr = extMgr;
 
     isQuantizedFlag = (config.lpTransformsMode == Config::On) &&
                       ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(subgraph);
@@ -116,6 +183,12 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, co
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setScratchPad(scratchPad);
+        node->setPrepackedWeights(config.prepackedWeights);
+        node->setDynamicQuantizationFlag(config.dynamicQuantization);
+        node->setInt4WeightCompressionFlag(config.int4WeightCompression);
+        if (config.activationRecompute && node->getType() == Eltwise && op->get_input_size() == 1)
+            recomputableOps[node.get()] = op;
 
         graphNodes.push_back(node);
 
@@ -168,6 +241,70 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, co
     }
 }
 
+// The per-frame normalization x -> (x - mean) / stdScale can be absorbed by a FakeQuantize
+// which directly consumes the input: expressing its input range and scales in the raw data
+// domain gives the same result without ever touching the frame itself. For u8 inputs this
+// keeps the whole input path in u8 - the normalization happens inside the FakeQuantize
+// kernel at register level, so the full-frame u8->fp32 and fp32->u8 passes disappear.
+static bool foldMeanScaleIntoFakeQuantize(const MKLDNNNodePtr& inputNode, const InputInfo::Ptr& inputInfo) {
+    const PreProcessInfo& pp = inputInfo->getPreProcess();
+    if (pp.getMeanVariant() != MEAN_VALUE)
+        return false;
+
+    const auto childEdges = inputNode->getChildEdgesAtPort(0);
+    if (childEdges.size() != 1 || childEdges[0]->getOutputNum() != 0)
+        return false;
+
+    auto* fq = dynamic_cast<MKLDNNFakeQuantizeNode*>(childEdges[0]->getChild().get());
+    if (fq == nullptr || fq->isBinarization() || fq->getAxis() != 1)
+        return false;
+
+    const size_t channels = pp.getNumberOfChannels();
+    const auto& dims = fq->getInputShapeAtPort(0).getDims();
+    if (dims.size() < 2 || !dimsEqualStrong(channels, dims[1]))
+        return false;
+
+    std::vector<float> meanValues(channels);
+    std::vector<float> stdScales(channels);
+    for (size_t c = 0; c < channels; c++) {
+        // a non-positive stdScale would flip the range and cannot be expressed by a crop
+        if (pp[c]->stdScale <= 0.0f)
+            return false;
+        meanValues[c] = pp[c]->meanValue;
+        stdScales[c] = pp[c]->stdScale;
+    }
+
+    const auto at = [](const std::vector<float>& v, size_t c) {
+        return v[v.size() == 1 ? 0 : c];
+    };
+
+    const auto& cropLow = fq->getCropLow();
+    const auto& cropHigh = fq->getCropHigh();
+    const auto& inputScale = fq->getInputScale();
+    const auto& inputShift = fq->getInputShift();
+    if (cropLow.empty() || cropHigh.empty() || inputScale.empty() || inputShift.empty())
+        return false;
+
+    std::vector<float> newCropLow(channels);
+    std::vector<float> newCropHigh(channels);
+    std::vector<float> newInputScale(channels);
+    std::vector<float> newInputShift(channels);
+
+    for (size_t c = 0; c < channels; c++) {
+        newCropLow[c] = at(cropLow, c) * stdScales[c] + meanValues[c];
+        newCropHigh[c] = at(cropHigh, c) * stdScales[c] + meanValues[c];
+        newInputScale[c] = at(inputScale, c) / stdScales[c];
+        newInputShift[c] = at(inputShift, c) - at(inputScale, c) * meanValues[c] / stdScales[c];
+    }
+
+    fq->setCropLow(std::move(newCropLow));
+    fq->setCropHigh(std::move(newCropHigh));
+    fq->setInputScale(std::move(newInputScale));
+    fq->setInputShift(std::move(newInputShift));
+
+    return true;
+}
+
 void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "MKLDNNGraph::Replicate", "CNNNetwork");
 
@@ -175,6 +312,7 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     OutputsDataMap outputsInfo = network.getOutputsInfo();
 
     this->_name = network.getName();
+    this->extensionMgr = extMgr;
 
     std::shared_ptr<const ngraph::Function> func = network.getFunction();
     if (!func) {
@@ -210,6 +348,12 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
             node->setQuantizedGraphFlag(true);
         }
         node->setRuntimeCache(rtParamsCache);
+        node->setScratchPad(scratchPad);
+        node->setPrepackedWeights(config.prepackedWeights);
+        node->setDynamicQuantizationFlag(config.dynamicQuantization);
+        node->setInt4WeightCompressionFlag(config.int4WeightCompression);
+        if (config.activationRecompute && node->getType() == Eltwise && op->get_input_size() == 1)
+            recomputableOps[node.get()] = op;
         graphNodes.push_back(node);
 
         if (op->get_type_info() == ngraph::op::v0::Parameter::get_type_info_static()) {
@@ -294,6 +438,26 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         }
     }
 
+    // let input/output nodes follow the layout the user declared for the blobs, so that
+    // channels-last blobs are consumed/produced in place and a layout change, if the graph
+    // still needs one, is performed by an internal reorder rather than an extra copy
+    // on the infer request boundary
+    for (auto &input : inputNodesMap) {
+        const auto layout = inputsInfo.at(input.first)->getTensorDesc().getLayout();
+        if (layout == Layout::NHWC || layout == Layout::NDHWC) {
+            if (auto inputNode = std::dynamic_pointer_cast<MKLDNNInputNode>(input.second))
+                inputNode->withExternalChannelsLast();
+        }
+    }
+
+    for (auto &output : outputNodesMap) {
+        const auto layout = outputsInfo.at(output.first)->getTensorDesc().getLayout();
+        if (layout == Layout::NHWC || layout == Layout::NDHWC) {
+            if (auto outputNode = std::dynamic_pointer_cast<MKLDNNInputNode>(output.second))
+                outputNode->withExternalChannelsLast();
+        }
+    }
+
     // Loading mean images
     for (const auto& input : inputsInfo) {
         Shape outShape;
@@ -304,7 +468,8 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         }
         InputInfo::Ptr ii = inputsInfo[input.first];
         if (ii && ii->getPreProcess().getNumberOfChannels()) {
-            _normalizePreprocMap[input.first].Load(outShape, ii);
+            if (!foldMeanScaleIntoFakeQuantize(inputNodesMap[input.first], ii))
+                _normalizePreprocMap[input.first].Load(outShape, ii);
         }
     }
 }
@@ -327,18 +492,70 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    if (config.activationRecompute)
+        ApplyActivationRecompute();
+
     Allocate();
 
     CreatePrimitives();
 
 #ifndef CPU_DEBUG_CAPS
-    for (auto &graphNode : graphNodes) {
-        graphNode->cleanup();
+    // In the lazy mode the internal blobs of the deferred nodes are still needed for primitive
+    // creation, so each node is cleaned up right after its primitive is prepared instead.
+    if (!config.lazyPrimitiveInit) {
+        for (auto &graphNode : graphNodes) {
+            graphNode->cleanup();
+        }
     }
 #endif
     ExtractConstantAndExecutableNodes();
 
+    // A tiny topology spends a measurable share of its sub-millisecond inference time in the
+    // per-node service code (profiling scopes, perf counter plumbing, cancellation checks), so
+    // below the configured limit Infer falls through to a flat interpreter loop instead.
+    useInferFastPath = config.inferFastPathNodeLimit > 0 &&
+                       executableGraphNodes.size() <= static_cast<size_t>(config.inferFastPathNodeLimit) &&
+                       !config.collectPerfCounters && !config.pmuCounters;
+#ifdef CPU_DEBUG_CAPS
+    // the fast path skips the node dumping and verbose hooks
+    useInferFastPath = false;
+#endif
+
     ExecuteConstantNodesOnly();
+
+    if (!config.perfExportDirectory.empty())
+        InitPerfCountersExport();
+
+    if (!config.chromeTracePath.empty()) {
+        static std::atomic<uint32_t> traceGraphCounter {0};
+        traceSink = std::make_shared<ChromeTraceSink>(config.chromeTracePath, traceGraphCounter++);
+    }
+
+#ifdef CPU_DEBUG_CAPS
+    if (!config.kernelBenchmark.empty())
+        benchmarkGraphKernels(*this, config.kernelBenchmark);
+#endif
+
+    StartDeferredPrimitivePreparation();
+}
+
+void MKLDNNGraph::InitPerfCountersExport() {
+    // the id only has to be unique within the process, it also disambiguates the file names
+    // of the per-stream graphs of one compiled model
+    static std::atomic<uint32_t> graphCounter {0};
+    const uint32_t graphId = graphCounter++;
+
+    perfExport = std::make_shared<PerfCountersExport>(config.perfExportDirectory, graphId,
+                                                      executableGraphNodes.size());
+    if (!perfExport->isValid()) {
+        // a missing directory or an unsupported platform must not fail the compilation
+        perfExport.reset();
+        return;
+    }
+
+    for (auto& node : executableGraphNodes)
+        node->setPerfExportRecord(
+            perfExport->registerNode(node->getExecIndex(), node->getTypeStr(), node->getName()));
 }
 
 void MKLDNNGraph::InitNodes() {
@@ -357,14 +574,44 @@ void MKLDNNGraph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
+    if (config.empiricalAlgorithmSelection) {
+        // measured algorithm choice has to stay sequential: probing convolutions concurrently
+        // would distort the timings. The budget bounds the compile-time cost for deep models.
+        auto timeBudget = std::chrono::microseconds(std::chrono::milliseconds(500));
+        for (auto& node : graphNodes) {
+            if (auto* conv = dynamic_cast<MKLDNNConvolutionNode*>(node.get()))
+                conv->selectAlgorithmEmpirically(timeBudget);
+        }
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
+    // Descriptor preparation only reads neighbour shapes and precisions which are fixed
+    // after init(), so nodes are processed in parallel on the plugin's threading runtime.
+    // Cross-node decisions (selectOptimalPrimitiveDescriptor) stay sequential below.
+    std::vector<std::exception_ptr> errors(graphNodes.size());
+    parallel_for(graphNodes.size(), [&](size_t i) {
+        const auto& node = graphNodes[i];
+        try {
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+                node->getSupportedDescriptors();
+            }
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+                node->initSupportedPrimitiveDescriptors();
+            }
+            {
+                OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+                node->filterSupportedPrimitiveDescriptors();
+            }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
     }
 
     for (auto &node : graphNodes) {
@@ -384,6 +631,9 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
     for (const auto& graphNode : graphNodes) {
+        if (graphNode->getType() == MemoryInput) {
+            memoryStateNodes.emplace_back(graphNode);
+        }
         if (graphNode->isConstant()) {
             constantGraphNodes.emplace_back(graphNode);
         } else if (CPU_DEBUG_CAPS_ALWAYS_TRUE(graphNode->isExecutable())) {
@@ -441,6 +691,53 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     }
 }
 
+void MKLDNNGraph::UpdateWeights(const std::map<std::string, InferenceEngine::Blob::Ptr>& weights) {
+    if (weightsCache)
+        IE_THROW(NotImplemented) << "Cannot update weights of graph " << _name
+                                 << ": constant memory is shared through the weights store by content-based keys,"
+                                 << " so it cannot be overwritten in place";
+
+    for (const auto& weight : weights) {
+        MKLDNNInputNode* constNode = nullptr;
+        for (const auto& node : graphNodes) {
+            if (node->getType() == Input && node->isConstant() && node->getName() == weight.first) {
+                constNode = dynamic_cast<MKLDNNInputNode*>(node.get());
+                break;
+            }
+        }
+        if (!constNode)
+            IE_THROW(NotFound) << "Cannot update weights: constant with name " << weight.first
+                               << " was not found in graph " << _name;
+
+        // nodes that prepacked the constant into their internal memory at compile time (RNN,
+        // INT8 deconvolution) do not re-read the source buffer, so an in-place update would
+        // silently be ignored by them
+        for (size_t i = 0; i < constNode->getChildEdges().size(); i++) {
+            const auto child = constNode->getChildEdgeAt(i)->getChild();
+            if (!child->internalBlobs.empty())
+                IE_THROW(NotImplemented) << "Cannot update weights: constant " << weight.first
+                                         << " was prepacked into internal memory of node " << child->getName();
+        }
+
+        const auto& blob = weight.second;
+        const auto memory = std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr());
+        if (blob->getTensorDesc().getPrecision() != memory->getDesc().getPrecision())
+            IE_THROW(ParameterMismatch) << "Failed to update constant " << weight.first << " with precision: "
+                                        << blob->getTensorDesc().getPrecision() << ", if the constant precision is: "
+                                        << memory->getDesc().getPrecision();
+        if (blob->byteSize() != memory->GetSize())
+            IE_THROW(ParameterMismatch) << "Failed to update constant " << weight.first << " with size: "
+                                        << blob->byteSize() << " bytes, if the constant size is: "
+                                        << memory->GetSize() << " bytes";
+
+        cpu_memcpy(memory->GetData(), blob->cbuffer().as<const uint8_t*>(), blob->byteSize());
+    }
+
+    // constant reorders re-read the updated source buffers and refresh their outputs in place,
+    // so the weight copies the executable primitives actually consume are rebuilt as well
+    ExecuteConstantNodesOnly();
+}
+
 static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
     memory::desc dstMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(childDesc.clone())->getDnnlDesc();
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(parentDesc.clone())->getDnnlDesc();
@@ -684,6 +981,182 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::CollectMemoryStatistics(std::map<std::string, uint64_t>& stats,
+                                          std::unordered_set<const void*>& countedBuffers) const {
+    auto addMemory = [&](const char* category, const MKLDNNMemory& memory) {
+        const void* data = memory.GetPrimitive().get_data_handle();
+        const auto size = memory.getDesc().getMaxMemSize();
+        if (data == nullptr || size == MemoryDesc::UNDEFINED_SIZE)
+            return;
+        if (countedBuffers.insert(data).second)
+            stats[category] += size;
+    };
+
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Input && node->isConstant()) {
+            auto constNode = std::static_pointer_cast<MKLDNNInputNode>(node);
+            if (auto memory = constNode->getMemoryPtr())
+                addMemory("weights", *memory);
+        }
+        // weights reordered into the primitive-preferred layout
+        for (const auto& blobMemory : node->getInternalBlobMemory()) {
+            if (blobMemory)
+                addMemory("weights", *blobMemory);
+        }
+    }
+
+    if (memWorkspace)
+        addMemory("activation_arena", *memWorkspace);
+    if (scratchPad)
+        stats["scratch"] += scratchPad->getCapacity();
+}
+
+void MKLDNNGraph::ApplyActivationRecompute() {
+    // the source ops were retained during replication; release them whatever the outcome
+    auto candidates = std::move(recomputableOps);
+    recomputableOps.clear();
+    if (candidates.empty())
+        return;
+
+    const int64_t alignment = 32;  // bytes, as in AllocateWithReuse
+
+    // tensor lifetime model mirroring the boxes AllocateWithReuse will build: one box per
+    // produced tensor, spanning from the producer execution step to the last consumer
+    std::map<std::pair<MKLDNNNode*, int>, size_t> tensorToBox;
+    std::vector<MemorySolver::Box> boxes;
+    for (auto& edge : graphEdges) {
+        if (!edge->hasDefinedMaxSize())
+            return;  // planning-time recompute only supports statically sized models
+        auto parent = edge->getParent();
+        auto child = edge->getChild();
+        const auto key = std::make_pair(parent.get(), edge->getInputNum());
+        auto it = tensorToBox.find(key);
+        if (it == tensorToBox.end()) {
+            it = tensorToBox.emplace(key, boxes.size()).first;
+            boxes.push_back({parent->execIndex, child->execIndex,
+                             div_up(static_cast<int64_t>(edge->getDesc().getMaxMemSize()), alignment),
+                             static_cast<int64_t>(boxes.size())});
+        }
+        MemorySolver::Box& box = boxes[it->second];
+        if (isConstOutput(edge) || parent->getType() == Input || child->getType() == Output) {
+            box.start = 0;
+            box.finish = -1;
+        } else if (box.finish != -1) {
+            box.finish = std::max(box.finish, child->execIndex);
+        }
+    }
+
+    int64_t bestPeak = MemorySolver(boxes).solve();
+
+    struct Recompute {
+        MKLDNNNodePtr producer;
+        MKLDNNEdgePtr lateEdge;
+    };
+    std::vector<Recompute> accepted;
+
+    // below this distance between the last two consumers the tensor is not long-lived
+    // enough for the re-execution to be worth considering
+    constexpr int minRecomputeDistance = 16;
+
+    for (auto& node : graphNodes) {
+        if (candidates.find(node.get()) == candidates.end())
+            continue;
+        if (node->getParentEdges().size() != 1 || node->getChildEdges().size() < 2 ||
+            node->outputShapes.size() != 1 || node->isDynamicNode() || node->isConstant())
+            continue;
+
+        // find the latest consumer; the span from the previous one is the potential saving
+        MKLDNNEdgePtr lateEdge;
+        int late = -1;
+        int secondLate = -1;
+        bool suitable = true;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto childEdge = node->getChildEdgeAt(i);
+            auto consumer = childEdge->getChild();
+            if (consumer->getType() == Output) {
+                suitable = false;  // network outputs must come from the original execution
+                break;
+            }
+            if (consumer->execIndex > late) {
+                secondLate = late;
+                late = consumer->execIndex;
+                lateEdge = childEdge;
+            } else {
+                secondLate = std::max(secondLate, consumer->execIndex);
+            }
+        }
+        if (!suitable || secondLate < 0 || late - secondLate < minRecomputeDistance)
+            continue;
+
+        const auto xIt = tensorToBox.find(std::make_pair(node.get(), 0));
+        auto parentEdge = node->getParentEdgeAt(0);
+        const auto yIt = tensorToBox.find(std::make_pair(parentEdge->getParent().get(), parentEdge->getInputNum()));
+        if (xIt == tensorToBox.end() || yIt == tensorToBox.end() || boxes[xIt->second].finish == -1)
+            continue;
+
+        // tentatively shorten the tensor to its second-latest consumer, keep the producer
+        // input alive up to the recompute point and add the short-lived recomputed copy;
+        // accept only when the solver confirms a smaller peak
+        auto trial = boxes;
+        trial[xIt->second].finish = secondLate;
+        if (trial[yIt->second].finish != -1)
+            trial[yIt->second].finish = std::max(trial[yIt->second].finish, late);
+        trial.push_back({late - 1, late, trial[xIt->second].size, static_cast<int64_t>(trial.size())});
+        const int64_t peak = MemorySolver(trial).solve();
+        if (peak < bestPeak) {
+            bestPeak = peak;
+            boxes = std::move(trial);
+            accepted.push_back({node, lateEdge});
+        }
+    }
+
+    if (accepted.empty())
+        return;
+
+    // restores the invariant that the first N parent edge indexes match the port numbers,
+    // which the edge drop and re-insertion below break (normally SortTopologically does it,
+    // but re-sorting here would destroy the deliberate placement of the duplicates)
+    auto normalizePortOrder = [](const MKLDNNNodePtr& node) {
+        int port_num = node->inputShapes.size();
+        std::vector<MKLDNNEdgePtr> res(port_num);
+        for (size_t i = 0; i < node->parentEdges.size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            int port = edge->getOutputNum();
+            if (port < port_num && !res[port])
+                res[port] = edge;
+            else
+                res.push_back(edge);
+        }
+        node->parentEdges = {res.begin(), res.end()};
+    };
+
+    for (auto& recompute : accepted) {
+        const auto& op = candidates.at(recompute.producer.get());
+        auto consumer = recompute.lateEdge->getChild();
+        const int consumerPort = recompute.lateEdge->getOutputNum();
+        auto parentEdge = recompute.producer->getParentEdgeAt(0);
+        auto parent = parentEdge->getParent();
+        const int parentPort = parentEdge->getInputNum();
+
+        auto dupOp = op->clone_with_new_inputs(op->input_values());
+        dupOp->set_friendly_name(op->get_friendly_name() + "_recompute");
+        MKLDNNNodePtr duplicate {MKLDNNNode::factory().create(dupOp, getEngine(), extensionMgr, weightsCache)};
+
+        recompute.lateEdge->drop();
+        RemoveEdge(recompute.lateEdge);
+        InsertNode(parent, consumer, duplicate, parentPort, consumerPort, true);
+        normalizePortOrder(consumer);
+
+        // schedule the duplicate right before its consumer, so the recomputed tensor stays
+        // short-lived (InsertNode appends the node at the end of the list)
+        graphNodes.pop_back();
+        graphNodes.insert(std::find(graphNodes.begin(), graphNodes.end(), consumer), duplicate);
+    }
+
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        graphNodes[i]->execIndex = static_cast<int>(i);
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -708,11 +1181,41 @@ void MKLDNNGraph::Allocate() {
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
+        if (config.lazyPrimitiveInit && !node->isConstant()) {
+            // constant nodes cannot be deferred since they are executed at load time
+            deferredPrimitiveNodes.push_back(node);
+            continue;
+        }
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
-        node->createPrimitive();
+        if (config.lazyPrimitiveInit) {
+            node->ensurePrimitiveCreated();
+        } else {
+            node->createPrimitive();
+        }
     }
 }
 
+void MKLDNNGraph::StartDeferredPrimitivePreparation() {
+    if (deferredPrimitiveNodes.empty())
+        return;
+
+    primitivePreparer = std::thread([this]() {
+        for (const auto& node : deferredPrimitiveNodes) {
+            PrepareNodePrimitive(node);
+        }
+        // from now on inference requests can skip the preparation checks entirely
+        deferredPreparationDone = true;
+    });
+}
+
+void MKLDNNGraph::PrepareNodePrimitive(const MKLDNNNodePtr& node) {
+    // preparation is serialized since primitive creation may touch graph-wide state which is not
+    // thread safe (runtime parameters cache, scratchpad arena); the per-node call_once guard inside
+    // ensurePrimitiveCreated makes a visit from the second contender a no-op
+    std::lock_guard<std::mutex> lock(preparationMutex);
+    node->ensurePrimitiveCreated();
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
@@ -749,7 +1252,8 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
-void MKLDNNGraph::PullOutputData(BlobMap &out) {
+void MKLDNNGraph::PullOutputData(BlobMap &out, std::vector<DeferredOutputConversion>* deferredConversions,
+                                 const std::function<void(const std::string&)>& onOutputReady) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
@@ -793,6 +1297,8 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
 
         // check for empty output blob
         if (std::any_of(outDims.begin(), outDims.end(), [](const Dim dim) {return dim == 0;})) {
+            if (onOutputReady)
+                onOutputReady(name);
             continue;
         }
 
@@ -807,7 +1313,11 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            if (onOutputReady)
+                onOutputReady(name);
+            continue;
+        }
 
         if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
             // User can initialize output via SetOutput API using tensorDesc with ANY layout.
@@ -819,6 +1329,9 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             outBloMem.Create(outBlobDesc, ext_blob_ptr, false);
 
             outBloMem.SetData(intr_blob, 0, false);
+
+            if (onOutputReady)
+                onOutputReady(name);
         } else {
             size_t size_to_copy = intr_blob.GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
             // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
@@ -831,7 +1344,27 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
                 size_to_copy = std::accumulate(outDims.begin() + 1, outDims.end(), (size_t)1, std::multiplies<size_t>()) * MB_to_process;
             }
 
-            cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+            if (deferredConversions && srcPrec != dstPrec) {
+                // only snapshot the raw graph memory here; the conversion does not touch graph memory
+                // anymore and runs on the postprocessing pipeline stage
+                deferredConversions->emplace_back();
+                auto& conversion = deferredConversions->back();
+                conversion.name = name;
+                conversion.stagingData.resize(size_to_copy * srcPrec.size());
+                ie_memcpy_parallel(conversion.stagingData.data(), conversion.stagingData.size(),
+                                   intr_blob_ptr, conversion.stagingData.size());
+                conversion.dstBlob = ext_blob;
+                conversion.srcPrec = srcPrec;
+                conversion.dstPrec = dstPrec;
+                conversion.elementCount = size_to_copy;
+                // the user blob is not written yet: the caller reports this output once
+                // the deferred conversion has been executed
+            } else {
+                cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+
+                if (onOutputReady)
+                    onOutputReady(name);
+            }
         }
     }
 }
@@ -840,11 +1373,30 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
 
+    PerfExportRecord* record = node->getPerfExportRecord();
+    const uint64_t start = record ? perfReadCycles() : 0;
+    const bool pmu = config.pmuCounters && PmuCounters::get().isValid();
+    const double traceStart = (traceSink || pmu) ? ChromeTraceSink::nowUs() : 0.0;
+    const PmuCounters::Sample pmuStart = pmu ? PmuCounters::get().read() : PmuCounters::Sample();
+
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
     } else {
         node->execute(stream);
     }
+
+    if (pmu) {
+        const auto pmuEnd = PmuCounters::get().read();
+        node->pmuLlcMisses += pmuEnd.llcMisses - pmuStart.llcMisses;
+        node->pmuLlcRefs += pmuEnd.llcRefs - pmuStart.llcRefs;
+        node->pmuTimeUs += ChromeTraceSink::nowUs() - traceStart;
+    }
+    if (traceSink)
+        traceSink->recordSpan(node.get(), infer_count, traceStart, ChromeTraceSink::nowUs());
+    if (record) {
+        record->totalCycles += perfReadCycles() - start;
+        record->executeCount++;
+    }
 }
 
 void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, int batch) {
@@ -854,12 +1406,39 @@ void MKLDNNGraph::Infer(MKLDNNInferRequestBase* request, int batch) {
 
     mkldnn::stream stream(eng);
 
+    if (useInferFastPath && (deferredPrimitiveNodes.empty() || deferredPreparationDone)) {
+        // flat loop over the sorted nodes without the per-node ITT scopes; the cancellation
+        // checkpoint boils down to one relaxed atomic load per node, so a Cancel() frees the
+        // stream within one node execution even on this path
+        for (const auto& node : executableGraphNodes) {
+            if (request)
+                request->ThrowIfCanceled();
+            PerfExportRecord* record = node->getPerfExportRecord();
+            const uint64_t start = record ? perfReadCycles() : 0;
+            const double traceStart = traceSink ? ChromeTraceSink::nowUs() : 0.0;
+            if (node->isDynamicNode()) {
+                node->executeDynamic(stream);
+            } else {
+                node->execute(stream);
+            }
+            if (traceSink)
+                traceSink->recordSpan(node.get(), infer_count, traceStart, ChromeTraceSink::nowUs());
+            if (record) {
+                record->totalCycles += perfReadCycles() - start;
+                record->executeCount++;
+            }
+        }
+        return;
+    }
+
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
         PERF(node, config.collectPerfCounters);
 
         if (request)
             request->ThrowIfCanceled();
+        if (!deferredPrimitiveNodes.empty() && !deferredPreparationDone)
+            PrepareNodePrimitive(node);
         ExecuteNode(node, stream);
     }
 
@@ -952,33 +1531,49 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
-void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
+void MKLDNNGraph::BuildPerfRegistry() const {
     unsigned i = 0;
-    std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
-            getPerfMapFor = [&](std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap, const MKLDNNNodePtr& node) {
-        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[node->getName()];
+    std::function<void(const MKLDNNNodePtr&)> appendEntriesFor = [&](const MKLDNNNodePtr& node) {
+        PerfRegistryEntry entry;
+        entry.node = node.get();
+        entry.name = node->getName();
+        InferenceEngine::InferenceEngineProfileInfo &pc = entry.info;
         pc.execution_index = i++;
-        // TODO: Why time counter is signed?
-        pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
-                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
         size_t layerTypeLen = sizeof(pc.layer_type) / sizeof(pc.layer_type[0]);
         node->typeStr.copy(pc.layer_type, layerTypeLen, 0);
+        perfRegistry.push_back(std::move(entry));
 
         for (auto& fusedNode : node->fusedWith) {
-            getPerfMapFor(perfMap, fusedNode);
+            appendEntriesFor(fusedNode);
         }
 
         for (auto& mergedWith : node->mergedWith) {
-            getPerfMapFor(perfMap, mergedWith);
+            appendEntriesFor(mergedWith);
         }
     };
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        getPerfMapFor(perfMap, graphNodes[i]);
+    for (size_t n = 0; n < graphNodes.size(); n++) {
+        appendEntriesFor(graphNodes[n]);
+    }
+}
+
+void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
+    // the static part (names, execution order, primitive types) comes from the registry,
+    // so a query only reads the per-node time counters in place
+    std::lock_guard<std::mutex> lock{perfRegistryMutex};
+    if (perfRegistry.empty()) {
+        BuildPerfRegistry();
+    }
+    for (const auto& entry : perfRegistry) {
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[entry.name];
+        pc = entry.info;
+        // TODO: Why time counter is signed?
+        pc.cpu_uSec = pc.realTime_uSec = (long long) entry.node->PerfCounter().avg();
+        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
     }
 }
 
@@ -1192,6 +1787,10 @@ bool MKLDNNGraph::InsertNode(MKLDNNNodePtr parent, MKLDNNNodePtr child, MKLDNNNo
         node->setQuantizedGraphFlag(true);
     }
     node->setRuntimeCache(rtParamsCache);
+    node->setScratchPad(scratchPad);
+    node->setPrepackedWeights(config.prepackedWeights);
+    node->setDynamicQuantizationFlag(config.dynamicQuantization);
+    node->setInt4WeightCompressionFlag(config.int4WeightCompression);
 
     if (initNode) {
         node->getSupportedDescriptors();
@@ -1249,7 +1848,14 @@ void MKLDNNGraph::EnforceBF16() {
     }
 
     for (const auto& node : graphNodes) {
-        if (nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail)
+        // a calibration plan carried in the runtime attributes overrides the heuristic:
+        // nodes it pins to FP32 are left untouched, nodes it marks BF16 are enforced
+        // even on the graph tail that is skipped by default
+        if (node->enforcedPrecision == Precision::FP32)
+            continue;
+
+        if (nodesToSkip.count(node) && !node->enforceBF16evenForGraphTail &&
+            node->enforcedPrecision != Precision::BF16)
             continue;
 
         if (node->getType() != Input && node->getType() != Output) {
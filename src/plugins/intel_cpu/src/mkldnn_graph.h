@@ -11,11 +11,19 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "cache/multi_cache.h"
+#include "mkldnn_scratch_pad.h"
+#include "utils/chrome_trace.h"
+#include "utils/perf_export.h"
+#include <functional>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequestBase;
@@ -30,6 +38,7 @@ public:
     };
 
     MKLDNNGraph() = default;
+    ~MKLDNNGraph();
 
     Status GetStatus() {
         return status;
@@ -55,10 +64,31 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
+
+    // An output precision conversion postponed to the postprocessing pipeline stage: the raw graph
+    // output memory is snapshotted while the stream graph is still locked, so the conversion itself
+    // can run after the graph has been handed over to the next request
+    struct DeferredOutputConversion {
+        std::string name;
+        std::vector<uint8_t> stagingData;
+        InferenceEngine::Blob::Ptr dstBlob;
+        InferenceEngine::Precision srcPrec;
+        InferenceEngine::Precision dstPrec;
+        size_t elementCount;
+    };
+
+    // onOutputReady (if set) is called once per output right after the corresponding user blob is
+    // fully written; outputs whose conversion is deferred are reported by the caller instead, after
+    // the conversion has been executed
+    void PullOutputData(InferenceEngine::BlobMap &out, std::vector<DeferredOutputConversion>* deferredConversions = nullptr,
+                        const std::function<void(const std::string&)>& onOutputReady = {});
 
     void Infer(MKLDNNInferRequestBase* request = nullptr, int batch = -1);
 
+    // In-place replacement of constant values: the topology and the selected primitives are kept,
+    // only the constant buffers and everything derived from them (constant reorders) are refreshed
+    void UpdateWeights(const std::map<std::string, InferenceEngine::Blob::Ptr>& weights);
+
     const std::vector<MKLDNNNodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -83,6 +113,12 @@ public:
         return outputNodesMap;
     }
 
+    // Collected once after graph compilation, so every infer request doesn't rescan all nodes
+    // to register its memory states
+    const std::vector<MKLDNNNodePtr>& GetMemoryStateNodes() const {
+        return memoryStateNodes;
+    }
+
     MKLDNNNodePtr getInputNodeByName(const std::string &name) {
         auto input = inputNodesMap.find(name);
         if (input == inputNodesMap.end())
@@ -107,6 +143,14 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Accumulates the per-category memory consumption of this graph (in bytes) into stats.
+     * Each physical buffer is counted once: constants may be shared between the per-stream graphs
+     * through the weights cache, so the caller passes one countedBuffers set over all graphs.
+     */
+    void CollectMemoryStatistics(std::map<std::string, uint64_t>& stats,
+                                 std::unordered_set<const void*>& countedBuffers) const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(MKLDNNEdgePtr& edge);
@@ -189,6 +233,11 @@ protected:
 
     void ForgetGraphData() {
         status = NotReady;
+        if (traceSink) {
+            // serialize before the recorded nodes are released
+            traceSink->dump();
+            traceSink.reset();
+        }
         eng = mkldnn::engine(mkldnn::engine::kind::cpu, 0);
 
         inputNodesMap.clear();
@@ -196,6 +245,13 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        recomputableOps.clear();
+        perfExport.reset();
+        {
+            // the registry points into the released nodes, so it is rebuilt on the next query
+            std::lock_guard<std::mutex> lock{perfRegistryMutex};
+            perfRegistry.clear();
+        }
     }
     Status status { NotReady };
     Config config;
@@ -216,6 +272,7 @@ protected:
 
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
+    bool useInferFastPath = false;
 
     static mkldnn::engine eng;
 
@@ -228,8 +285,13 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void ApplyActivationRecompute();
     void CreatePrimitives();
+    void StartDeferredPrimitivePreparation();
+    void PrepareNodePrimitive(const MKLDNNNodePtr& node);
     void ExtractConstantAndExecutableNodes();
+    void InitPerfCountersExport();
+    void DumpPmuCounters() const;
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
 
@@ -248,8 +310,42 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
+    std::vector<MKLDNNNodePtr> memoryStateNodes;
 
     MultiCachePtr rtParamsCache;
+    MKLDNNScratchPadPtr scratchPad;
+
+    // always-on lightweight counter export of this stream graph (see KEY_CPU_PERF_EXPORT_DIR);
+    // owns the mapped region the nodes' records point into, so it has to outlive the nodes' use
+    PerfCountersExport::Ptr perfExport;
+
+    // ring of node execution spans dumped as Chrome trace JSON on release (see KEY_CPU_CHROME_TRACE)
+    ChromeTraceSink::Ptr traceSink;
+
+    // retained during replication for the activation recompute pass: the source ops of the
+    // cheap unary nodes it may duplicate, and the extension manager to create the duplicates
+    std::unordered_map<MKLDNNNode*, std::shared_ptr<ngraph::Node>> recomputableOps;
+    MKLDNNExtensionManager::Ptr extensionMgr;
+
+    // nodes whose primitive creation was deferred by the lazy preparation mode; they are finalized
+    // by the background preparation thread or by the first inference request, whichever comes first
+    std::vector<MKLDNNNodePtr> deferredPrimitiveNodes;
+    std::thread primitivePreparer;
+    std::mutex preparationMutex;
+    std::atomic<bool> deferredPreparationDone {false};
+
+    // static part of the profiling counters, resolved once on the first GetPerfData call:
+    // the node set, execution order, names and primitive types are fixed after compilation,
+    // so a profiling query only refreshes the time counters of these entries
+    struct PerfRegistryEntry {
+        const MKLDNNNode* node = nullptr;
+        std::string name;
+        InferenceEngine::InferenceEngineProfileInfo info = {};
+    };
+    mutable std::mutex perfRegistryMutex;
+    mutable std::vector<PerfRegistryEntry> perfRegistry;  // empty until the first query
+
+    void BuildPerfRegistry() const;
 
     void EnforceBF16();
 };
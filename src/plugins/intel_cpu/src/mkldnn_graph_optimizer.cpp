@@ -20,6 +20,8 @@
 #include "nodes/mkldnn_reduce_node.h"
 #include "nodes/mkldnn_input_node.h"
 #include "nodes/mkldnn_rnn.h"
+#include "nodes/mkldnn_softmax_node.h"
+#include "nodes/mkldnn_log_softmax_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -82,6 +84,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FusePerformedAsScaleShiftAndFakeQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndLog");
+    FuseSoftmaxAndLog(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseScaleShiftAndLogSoftmax");
+    FuseScaleShiftAndLogSoftmax(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndZeroPoints");
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
@@ -830,7 +840,9 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
         auto outDims = childNode->outputShapes[0].getStaticDims();
         int elemSize = childNode->getOriginalOutputPrecisionAtPort(0).size();
 
-        int L3_cache_size = utils::get_cache_size(3, false);
+        // under throughput mode the streams share the L3, so each graph can only count on its fraction
+        int streams = std::max(1, graph.getConfig().streamExecutorConfig._streams);
+        int L3_cache_size = utils::get_cache_size(3, false) / streams;
         int dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
         int dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
 
@@ -1474,7 +1486,10 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
             }
         }
 
-        if (!childNode->getFusedWith().empty())
+        // An Eltwise child may already carry its own fused chain collapsed by the preceding sweeps of this
+        // pass. Such chain is migrated into the parent together with the child (see below), so it does not
+        // terminate the fusion; any other child with a non-empty fused list is left as is.
+        if (!childNode->getFusedWith().empty() && childNode->getType() != Eltwise)
             return false;
 
         return parentNode->canFuse(childNode);
@@ -1502,6 +1517,13 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
 
         childNode->fuseInto(parentNode);
 
+        // Migrate the chain the child has absorbed on its own, so the whole elementwise segment ends up
+        // as post ops of a single JIT kernel and none of the intermediate tensors is spilled to memory.
+        for (auto &fusedNode : childNode->getFusedWith()) {
+            parentNode->addFusedNode(fusedNode);
+        }
+        childNode->clearFusedWith();
+
         if (childNode->getType() == FakeQuantize) {
             auto parentEdges = childNode->parentEdges;
             for (auto &parentEdge : parentEdges) {
@@ -1864,6 +1886,96 @@ void MKLDNNGraphOptimizer::FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph
     }
 }
 
+void MKLDNNGraphOptimizer::FuseSoftmaxAndLog(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableSoftmaxNode = [](MKLDNNNodePtr node) {
+        return node->getType() == Softmax && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableLogNode = [](MKLDNNNodePtr node) {
+        return node->getType() == Math && node->getAlgorithm() == MathLog;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (!isSuitableSoftmaxNode(parent)) continue;
+
+        auto child = parent->getChildEdgeAt(0)->getChild();
+        if (!isSuitableLogNode(child)) continue;
+
+        auto* softmaxNode = dynamic_cast<MKLDNNSoftMaxNode *>(parent.get());
+        if (softmaxNode == nullptr)
+            IE_THROW() << "Cannot cast " << parent->getName() << " to SoftMax node";
+
+        softmaxNode->fuseLog();
+        graph.DropNode(child);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseScaleShiftAndLogSoftmax(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto getConstPort = [](const MKLDNNNodePtr node) -> int {
+        if (node->getParentEdgesAtPort(0)[0]->getParent()->getType() == Input && node->getParentEdgesAtPort(0)[0]->getParent()->isConstant()) {
+            return 0;
+        } else if (node->getParentEdgesAtPort(1)[0]->getParent()->getType() == Input && node->getParentEdgesAtPort(1)[0]->getParent()->isConstant()) {
+           return 1;
+        } else {
+            return -1;
+        }
+    };
+
+    auto isSuitableScaleNode = [getConstPort](MKLDNNNodePtr node) {
+        if (node->getType() != Eltwise || node->getChildEdges().size() != 1 ||
+            !one_of(node->getAlgorithm(), EltwiseMultiply, EltwiseDivide))
+            return false;
+        const auto constPort = getConstPort(node);
+        // the divisor (a temperature) has to be the constant operand
+        if (constPort == -1 || (node->getAlgorithm() == EltwiseDivide && constPort != 1))
+            return false;
+        return true;
+    };
+
+    auto isSuitableLogSoftmaxNode = [](MKLDNNNodePtr node) {
+        return node->getType() == LogSoftmax && node->getParentEdges().size() == 1;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (!isSuitableScaleNode(parent)) continue;
+
+        auto child = parent->getChildEdgeAt(0)->getChild();
+        if (!isSuitableLogSoftmaxNode(child)) continue;
+
+        auto* logSoftmaxNode = dynamic_cast<MKLDNNLogSoftmaxNode *>(child.get());
+        if (logSoftmaxNode == nullptr)
+            IE_THROW() << "Cannot cast " << child->getName() << " to LogSoftmax node";
+
+        std::vector<float> scalesBuffer;
+        std::vector<float> shiftsBuffer;
+        std::tie(scalesBuffer, shiftsBuffer) =
+            parent->getScalesAndShifts(parent->getParentEdgesAtPort(1 - getConstPort(parent))[0]->getParent().get());
+
+        // only a per-tensor scale can be folded into the log-softmax pass
+        if (scalesBuffer.size() != 1 || !std::isfinite(scalesBuffer[0]))
+            continue;
+
+        logSoftmaxNode->fuseInputScale(scalesBuffer[0]);
+
+        auto parentEdges = parent->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (!p_edge->getParent()->isConstant())
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        graph.DropNode(parent);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergeTransposeAndReorder(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
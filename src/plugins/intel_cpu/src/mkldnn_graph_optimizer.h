@@ -40,6 +40,8 @@ private:
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph);
     void FuseClampAndFakeQuantize(MKLDNNGraph &graph);
+    void FuseSoftmaxAndLog(MKLDNNGraph &graph);
+    void FuseScaleShiftAndLogSoftmax(MKLDNNGraph &graph);
     void MergeTransposeAndReorder(MKLDNNGraph &graph);
     void reshapeRnnSeq(MKLDNNGraph &graph);
 };
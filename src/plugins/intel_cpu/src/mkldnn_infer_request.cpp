@@ -4,6 +4,7 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -18,6 +19,7 @@
 #include "mkldnn_memory_state.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include "nodes/common/cpu_memcpy.h"
+#include <ie_memcpy.h>
 #include "mkldnn_async_infer_request.h"
 #include <debug.h>
 #include "utils/general_utils.h"
@@ -39,22 +41,20 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::CreateInferRequest() {
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
-    for (auto& node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!memoryNode) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
+    for (auto& node : graph->GetMemoryStateNodes()) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+        if (!memoryNode) {
+            IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+        }
+        auto state_store = memoryNode->getStore();
+        auto state_name = memoryNode->getId();
 
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
+        // Remove suffix with pair ID. Internal information.
+        auto suffix_idx = state_name.find("/id=");
+        if (suffix_idx != std::string::npos)
+            state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-        }
+        memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
     }
 }
 
@@ -73,8 +73,27 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::pushInput(const std::string& inputNam
 
     InferenceEngine::Blob::Ptr iconv;
     if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout()));
-        iconv->allocate();
+        const InferenceEngine::TensorDesc convertedDesc(inPrec, tensorDesc.getDims(), tensorDesc.getLayout());
+
+        // If the graph input memory expects exactly the converted layout, convert straight into it instead of
+        // materializing an intermediate blob: PushInputData then sees the data already in place and skips the copy.
+        void* graphData = nullptr;
+        const auto& inputNodesMap = graph->GetInputNodesMap();
+        auto inputNode = inputNodesMap.find(inputName);
+        if (inputNode != inputNodesMap.end()) {
+            const auto& interMem = inputNode->second->getChildEdgesAtPort(0)[0]->getMemory();
+            if (interMem.getDesc().isDefined() && convertedDesc == MemoryDescUtils::convertToTensorDesc(interMem.getDesc()) &&
+                    interMem.GetData() != srcData) {
+                graphData = interMem.GetData();
+            }
+        }
+
+        if (graphData != nullptr) {
+            iconv = make_blob_with_precision(convertedDesc, graphData);
+        } else {
+            iconv = make_blob_with_precision(inPrec, convertedDesc);
+            iconv->allocate();
+        }
         if (inputBlob->size() != iconv->size())
             IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
                                << iconv->size();
@@ -104,7 +123,9 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::PushStates() {
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    // states created by this plugin wrap the store itself and need no push
+                    if (data_ptr != cur_state_mem_buf)
+                        cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
                 }
             }
         }
@@ -126,7 +147,9 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::PullStates() {
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    // nothing to pull when the state wraps the store itself
+                    if (data_ptr != cur_state_mem_buf)
+                        cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
                 }
             }
         }
@@ -157,12 +180,21 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
     if (graph->hasDynamicInput())
         redefineMemoryForInputNodes();
 
-    execDataPreprocessing(_inputs);
+    // preprocessing may have already run as a dedicated pipeline stage
+    // overlapped with graph execution of the previous request
+    if (preprocessedOnPipeline)
+        preprocessedOnPipeline = false;
+    else
+        execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
 
     ThrowIfCanceled();
 
+    // large offline batches can optionally run as a sequence of cache-sized micro-batches
+    if (graph->getProperty().microBatchSize > 0 && TryInferMicroBatched())
+        return;
+
     PushInputData();
 
     if (memoryStates.size() != 0) {
@@ -177,7 +209,107 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
-    graph->PullOutputData(_outputs);
+    // when a postprocessing pipeline stage follows, only raw copies of the converted outputs are taken
+    // here, so the stream graph becomes available for the next request right after this call returns
+    const bool postprocessOnPipeline = deferPostprocessing;
+    deferPostprocessing = false;
+    if (postprocessOnPipeline)
+        deferredOutputConversions.clear();
+
+    std::function<void(const std::string&)> onOutputReady;
+    if (!_outputCompletionCallbacks.empty()) {
+        onOutputReady = [this](const std::string& name) {
+            NotifyOutputCompleted(name);
+        };
+    }
+
+    graph->PullOutputData(_outputs, postprocessOnPipeline ? &deferredOutputConversions : nullptr, onOutputReady);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::TryInferMicroBatched() {
+    // Executes the request batch as a sequence of micro-batches reusing the dynamic batch
+    // machinery: every slice is copied to the head of the graph input memory, the graph runs
+    // with the batch limited to the slice size, and the head of the output memory is copied
+    // back to the slice position. Each layer then works on an activation slice small enough
+    // to stay cache-resident instead of streaming the whole batch through memory.
+    const auto& cfg = graph->getProperty();
+    const size_t microBatch = static_cast<size_t>(cfg.microBatchSize);
+    if (cfg.batchLimit <= 0 || graph->hasDynamicInput())
+        return false;
+    // the split bypasses the regular push/pull paths, so nothing else may redirect
+    // or post-process the request data
+    if (m_curBatch > 0 || !memoryStates.empty() || !_preProcData.empty() || !graph->_normalizePreprocMap.empty())
+        return false;
+    if (deferPostprocessing || !_outputCompletionCallbacks.empty())
+        return false;
+
+    struct BatchSlice {
+        uint8_t* user;
+        uint8_t* internal;
+        size_t bytesPerElement;
+    };
+    std::vector<BatchSlice> inputSlices;
+    std::vector<BatchSlice> outputSlices;
+    size_t totalBatch = 0;
+
+    auto collectSlices = [&](const std::map<std::string, MKLDNNNodePtr>& nodesMap, InferenceEngine::BlobMap& blobs,
+                             bool isInput, std::vector<BatchSlice>& slices) {
+        for (const auto& entry : nodesMap) {
+            const auto blobIt = blobs.find(entry.first);
+            if (blobIt == blobs.end())
+                return false;
+            const auto& blob = blobIt->second;
+            const auto& memory = isInput ? entry.second->getChildEdgeAt(0)->getMemory()
+                                         : entry.second->getParentEdgeAt(0)->getMemory();
+            // a plain per-slice copy is only exact when the request blob matches the graph
+            // memory layout and the batch is the outermost dimension
+            if (MemoryDescUtils::convertToTensorDesc(memory.getDesc()) != blob->getTensorDesc())
+                return false;
+            const auto& dims = blob->getTensorDesc().getDims();
+            const auto& order = blob->getTensorDesc().getBlockingDesc().getOrder();
+            if (dims.empty() || dims[0] == 0 || order.empty() || order[0] != 0)
+                return false;
+            if (totalBatch == 0)
+                totalBatch = dims[0];
+            else if (totalBatch != dims[0])
+                return false;
+            uint8_t* userPtr = blob->buffer().as<uint8_t*>();
+            if (userPtr == nullptr)
+                return false;
+            slices.push_back({userPtr, static_cast<uint8_t*>(memory.GetData()), blob->byteSize() / dims[0]});
+        }
+        return true;
+    };
+
+    if (!collectSlices(graph->GetInputNodesMap(), _inputs, true, inputSlices) ||
+        !collectSlices(graph->GetOutputNodesMap(), _outputs, false, outputSlices))
+        return false;
+    if (totalBatch <= microBatch)
+        return false;
+
+    const auto& nodes = graph->GetNodes();
+    for (size_t start = 0; start < totalBatch; start += microBatch) {
+        const int sliceBatch = static_cast<int>(std::min(microBatch, totalBatch - start));
+        for (const auto& node : nodes)
+            node->setDynamicBatchLim(sliceBatch);
+        for (const auto& slice : inputSlices)
+            ie_memcpy_parallel(slice.internal, sliceBatch * slice.bytesPerElement,
+                               slice.user + start * slice.bytesPerElement, sliceBatch * slice.bytesPerElement);
+        graph->Infer(this, sliceBatch);
+        for (const auto& slice : outputSlices)
+            ie_memcpy_parallel(slice.user + start * slice.bytesPerElement, sliceBatch * slice.bytesPerElement,
+                               slice.internal, sliceBatch * slice.bytesPerElement);
+        ThrowIfCanceled();
+    }
+    for (const auto& node : nodes)
+        node->setDynamicBatchLim(0);
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::NotifyOutputCompleted(const std::string& name) {
+    const auto callback = _outputCompletionCallbacks.find(name);
+    if (callback != _outputCompletionCallbacks.end())
+        callback->second(name);
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequestBase::GetPerformanceCounts() const {
@@ -327,11 +459,79 @@ void MKLDNNPlugin::MKLDNNInferRequestBase::SetAsyncRequest(MKLDNNAsyncInferReque
 }
 
 void MKLDNNPlugin::MKLDNNInferRequestBase::ThrowIfCanceled() const {
-    if (_asyncRequest != nullptr) {
+    // the lock-free flag keeps the per-node checkpoints of graph execution cheap;
+    // the locking call confirms the state and raises the InferCancelled exception
+    if (_asyncRequest != nullptr && _asyncRequest->IsCancelRequested()) {
         _asyncRequest->ThrowIfCanceled();
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequestBase::RunPreprocessingStage() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "PipelinedPreproc");
+    execDataPreprocessing(_inputs);
+    preprocessedOnPipeline = true;
+}
+
+InferenceEngine::ITaskExecutor::Ptr MKLDNNPlugin::MKLDNNInferRequestBase::getPreprocExecutor() const {
+    return execNetwork->_preprocExecutor;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::RunPostprocessingStage() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "PipelinedPostproc");
+    for (auto& conversion : deferredOutputConversions) {
+        cpu_convert(conversion.stagingData.data(), conversion.dstBlob->buffer(),
+                    conversion.srcPrec, conversion.dstPrec, conversion.elementCount);
+        NotifyOutputCompleted(conversion.name);
+    }
+    deferredOutputConversions.clear();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::DeferPostprocessing() {
+    deferPostprocessing = true;
+}
+
+InferenceEngine::ITaskExecutor::Ptr MKLDNNPlugin::MKLDNNInferRequestBase::getPostprocExecutor() const {
+    return execNetwork->_postprocExecutor;
+}
+
+InferenceEngine::ITaskExecutor::Ptr MKLDNNPlugin::MKLDNNInferRequestBase::getPriorityTaskExecutor() const {
+    return execNetwork->_priorityTaskExecutor;
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequestBase::hasDeadlineAdmission() const {
+    return 0 != execNetwork->_requestDeadlineUs;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::ThrowIfDeadlineUnattainable() const {
+    const auto serviceUs = execNetwork->_serviceTimeEstimateUs.load(std::memory_order_relaxed);
+    // until the first request completes there is no estimate and everything is admitted
+    if (0 == serviceUs)
+        return;
+    const auto backlog =
+        static_cast<uint64_t>(std::max(execNetwork->_admittedRequests.load(std::memory_order_relaxed), 0)) + 1;
+    if (backlog * serviceUs > execNetwork->_requestDeadlineUs) {
+        IE_THROW(InferCancelled) << "Request rejected by admission control: " << backlog << " requests of ~"
+                                 << serviceUs << " us each do not fit the deadline of "
+                                 << execNetwork->_requestDeadlineUs << " us";
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::EnterAdmissionQueue() {
+    ++execNetwork->_admittedRequests;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::LeaveAdmissionQueue() {
+    --execNetwork->_admittedRequests;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::RecordAdmittedCompletion(uint64_t serviceTimeUs) {
+    --execNetwork->_admittedRequests;
+    // EWMA with 1/8 weight; racing streams may drop an observation, which the estimate tolerates
+    auto& estimate = execNetwork->_serviceTimeEstimateUs;
+    const auto previous = estimate.load(std::memory_order_relaxed);
+    estimate.store(0 == previous ? serviceTimeUs : (previous * 7 + serviceTimeUs) / 8, std::memory_order_relaxed);
+}
+
 InferenceEngine::Precision
 MKLDNNPlugin::MKLDNNInferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
@@ -367,6 +567,46 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::initBlobs() {
 }
 
 // TODO [DS] : restore API 1.0 version, after dynamism supporting will be removed from API 1.0
+bool MKLDNNPlugin::MKLDNNInferRequestBase::tryRebindKnownBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data) {
+    const auto it = knownBlobBindings.find(name);
+    if (it == knownBlobBindings.end())
+        return false;
+    if (data->is<InferenceEngine::CompoundBlob>())
+        return false;
+    void* buffer = data->buffer().as<void*>();
+    for (const auto& binding : it->second) {
+        if (binding.blob != data.get() || binding.buffer != buffer || !(binding.desc == data->getTensorDesc()))
+            continue;
+        if (binding.usesExternalPtr)
+            externalPtr[name] = buffer;
+        else
+            externalPtr.erase(name);
+        if (binding.isInput)
+            _inputs[name] = data;
+        else
+            _outputs[name] = data;
+        return true;
+    }
+    return false;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequestBase::rememberKnownBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isInput) {
+    if (data->is<InferenceEngine::CompoundBlob>())
+        return;
+    auto& bindings = knownBlobBindings[name];
+    // a handful of rotated buffers is the practical case; do not let the cache grow unbounded
+    constexpr size_t maxBindingsPerPort = 8;
+    if (bindings.size() >= maxBindingsPerPort)
+        bindings.erase(bindings.begin());
+    KnownBlobBinding binding;
+    binding.blob = data.get();
+    binding.buffer = data->buffer().as<void*>();
+    binding.desc = data->getTensorDesc();
+    binding.isInput = isInput;
+    binding.usesExternalPtr = externalPtr.find(name) != externalPtr.end();
+    bindings.push_back(std::move(binding));
+}
+
 void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "SetBlobOldApi");
     if (name.empty()) {
@@ -375,6 +615,12 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
 
     if (!data)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
+
+    // Applications rotating among a few pre-allocated buffers re-bind the same blobs on every
+    // request; re-apply a binding which already passed the checks below without repeating them
+    if (tryRebindKnownBlob(name, data))
+        return;
+
     InferenceEngine::InputInfo::Ptr foundInput;
     InferenceEngine::DataPtr foundOutput;
     const bool isInput = findInputAndOutputBlobByName(name, foundInput, foundOutput);
@@ -460,6 +706,7 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
                 externalPtr.erase(name);
             }
             _inputs[name] = data;
+            rememberKnownBlob(name, data, true);
         }
     }
     if (foundOutput) {
@@ -502,6 +749,7 @@ void MKLDNNPlugin::MKLDNNLegacyInferRequest::SetBlob(const std::string& name, co
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        rememberKnownBlob(name, data, false);
     }
 }
 
@@ -683,6 +931,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     if (!data)
         IE_THROW(NotAllocated) << "Failed to set empty blob with name: \'" << name << "\'";
 
+    // Applications rotating among a few pre-allocated buffers re-bind the same blobs on every
+    // request; re-apply a binding which already passed the checks below without repeating them
+    if (tryRebindKnownBlob(name, data))
+        return;
+
     bool isInput = false;
     const auto inputNodeItr = modelInputsMap.find(name);
     const auto outputNodeItr = modelOutputsMap.find(name);
@@ -739,6 +992,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             externalPtr.erase(name);
         }
         _inputs[name] = data;
+        if (!compoundBlobPassed)
+            rememberKnownBlob(name, data, true);
     } else {
         if (compoundBlobPassed) {
             IE_THROW(NotImplemented) << "cannot set compound blob: supported only for input pre-processing";
@@ -767,6 +1022,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             externalPtr.erase(name);
         }
         _outputs[name] = data;
+        rememberKnownBlob(name, data, false);
     }
 }
 
@@ -9,6 +9,7 @@
 #include <string>
 #include <map>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -38,6 +39,68 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief      Runs input preprocessing as a dedicated pipeline stage, so the subsequent InferImpl() call skips it
+     */
+    void RunPreprocessingStage();
+
+    /**
+     * @brief      Returns the executor of the dedicated preprocessing pipeline stage or null when pipelined
+     *             preprocessing is not enabled
+     */
+    InferenceEngine::ITaskExecutor::Ptr getPreprocExecutor() const;
+
+    /**
+     * @brief      Runs the output precision conversions postponed by the preceding InferImpl() call as a
+     *             dedicated pipeline stage
+     */
+    void RunPostprocessingStage();
+
+    /**
+     * @brief      Makes the subsequent InferImpl() call postpone output precision conversions to the
+     *             postprocessing pipeline stage
+     */
+    void DeferPostprocessing();
+
+    /**
+     * @brief      Returns the executor of the dedicated postprocessing pipeline stage or null when pipelined
+     *             postprocessing is not enabled
+     */
+    InferenceEngine::ITaskExecutor::Ptr getPostprocExecutor() const;
+
+    /**
+     * @brief      Returns the executor submitting graph execution with the configured model priority or
+     *             null when the model priority is the default one
+     */
+    InferenceEngine::ITaskExecutor::Ptr getPriorityTaskExecutor() const;
+
+    /**
+     * @brief      Tells whether deadline-aware admission control is enabled for the compiled model
+     */
+    bool hasDeadlineAdmission() const;
+
+    /**
+     * @brief      Admission checkpoint at enqueue: throws InferCancelled when the backlog times the
+     *             smoothed service time already exceeds the configured deadline
+     */
+    void ThrowIfDeadlineUnattainable() const;
+
+    /**
+     * @brief      Counts this request into the admission backlog
+     */
+    void EnterAdmissionQueue();
+
+    /**
+     * @brief      Releases the admission backlog slot of a request whose pipeline was aborted
+     */
+    void LeaveAdmissionQueue();
+
+    /**
+     * @brief      Releases the admission backlog slot and folds the observed graph execution time
+     *             into the smoothed service time estimate
+     */
+    void RecordAdmittedCompletion(uint64_t serviceTimeUs);
+
 protected:
     MKLDNNInferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                            InferenceEngine::OutputsDataMap networkOutputs,
@@ -56,19 +119,51 @@ protected:
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    /**
+     * @brief      A blob binding which already passed the full SetBlob validation. Applications which
+     *             rotate among a few pre-allocated buffers re-bind the same (pointer, descriptor)
+     *             pairs on every request; such bindings are re-applied without re-running validation
+     */
+    struct KnownBlobBinding {
+        const InferenceEngine::Blob* blob = nullptr;
+        void* buffer = nullptr;
+        InferenceEngine::TensorDesc desc;
+        bool isInput = false;
+        bool usesExternalPtr = false;
+    };
+
+    /**
+     * @brief      Re-applies a previously validated binding of the given blob, including its zero-copy
+     *             (externalPtr) decision
+     * @return     true when the binding was recognized and applied, false when full validation is needed
+     */
+    bool tryRebindKnownBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data);
+
+    /**
+     * @brief      Remembers a successfully validated blob binding, together with its zero-copy
+     *             (externalPtr) decision, for the SetBlob fast re-bind path
+     */
+    void rememberKnownBlob(const std::string& name, const InferenceEngine::Blob::Ptr& data, bool isInput);
+
     MKLDNNGraph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
+    std::unordered_map<std::string, std::vector<KnownBlobBinding>> knownBlobBindings;
 
 private:
     void PushStates();
     void PullStates();
+    bool TryInferMicroBatched();
     void redefineMemoryForInputNodes();
+    void NotifyOutputCompleted(const std::string& name);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
+    bool                                preprocessedOnPipeline = false;
+    bool                                deferPostprocessing = false;
+    std::vector<MKLDNNGraph::DeferredOutputConversion> deferredOutputConversions;
 };
 
 class MKLDNNLegacyInferRequest : public MKLDNNInferRequestBase {
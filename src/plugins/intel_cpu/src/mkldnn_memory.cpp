@@ -23,6 +23,10 @@
 #include "nodes/mkldnn_reorder_node.h"
 #include "memory_desc/cpu_memory_desc.h"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 using namespace InferenceEngine;
 using namespace mkldnn;
 
@@ -36,8 +40,48 @@ namespace {
             }
         }
     }
+
+    thread_local bool useHugePagesOnThisThread = false;
+
+#ifdef __linux__
+    constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    std::shared_ptr<void> allocateHugePages(size_t bytes) {
+        if (!useHugePagesOnThisThread || bytes < hugePageSize)
+            return nullptr;
+        const size_t length = (bytes + hugePageSize - 1) & ~(hugePageSize - 1);
+        void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+        if (ptr == MAP_FAILED) {
+            // no explicitly reserved huge pages - take regular pages and ask the kernel for transparent ones
+            ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (ptr == MAP_FAILED)
+                return nullptr;
+#ifdef MADV_HUGEPAGE
+            madvise(ptr, length, MADV_HUGEPAGE);
+#endif
+        }
+        return std::shared_ptr<void>(ptr, [length] (void* handle) {
+            munmap(handle, length);
+        });
+    }
+#else
+    std::shared_ptr<void> allocateHugePages(size_t) {
+        return nullptr;
+    }
+#endif
 }   // namespace
 
+HugePagePolicyScope::HugePagePolicyScope(bool enabled) : prevEnabled(useHugePagesOnThisThread) {
+    useHugePagesOnThisThread = enabled;
+}
+
+HugePagePolicyScope::~HugePagePolicyScope() {
+    useHugePagesOnThisThread = prevEnabled;
+}
+
 MKLDNNMemory::MKLDNNMemory(const mkldnn::engine& eng) : eng(eng) {}
 
 size_t MKLDNNMemory::GetSize() const {
@@ -60,6 +104,16 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
     if (data == nullptr) {
+        hugePageHolder.reset();
+        if (desc.data.format_kind != dnnl_format_kind_wino) {
+            if (auto hugePages = allocateHugePages(desc.get_size())) {
+                prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE));
+                // a fresh anonymous mapping is zeroed by the kernel, padding needs no extra processing
+                prim->set_data_handle_no_pads_proc(hugePages.get());
+                hugePageHolder = std::move(hugePages);
+                return;
+            }
+        }
         prim.reset(new memory(desc, eng));
 
         size_t real_size = 0;
@@ -73,6 +127,10 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
             }
         }
     } else {
+        // A huge-page buffer stays owned only while the provided handle still points into it
+        // (the grow-only reuse of redefineDesc passes the previously set handle back)
+        if (hugePageHolder && hugePageHolder.get() != data)
+            hugePageHolder.reset();
         // MKLDNN accepts not a const data, probably need to remove some level of consteness in a call stack
 
         // ========================
@@ -98,6 +156,8 @@ void MKLDNNMemory::Create(MemoryDescPtr desc, const void* data, bool pads_zeroin
         useExternalStorage = true;
     } else {
         useExternalStorage = false;
+        // Fresh allocation: previously retained storage is not referenced anymore
+        primStorageHolder.reset();
     }
 
     if (pMemDesc->isDefined()) {
@@ -164,7 +224,23 @@ void MKLDNNMemory::redefineDesc(MemoryDescPtr desc, void *data) {
             this->Create(std::move(desc), nullptr, false);
         }
     } else {
-        this->Create(std::move(desc), nullptr, false);
+        // Grow-only reuse for internally owned storage: memories created against a
+        // bounded dynamic shape are already sized to the shape upper bound at graph
+        // allocation, so a new descriptor which fits into the existing capacity keeps
+        // the buffer instead of reallocating. That makes steady-state inference with
+        // recurring or bounded shapes allocation free and avoids the latency spikes
+        // of growing tensors in long-running services.
+        const size_t newSize = desc->isDefined()
+                                   ? desc->getCurrentMemSize()
+                                   : (desc->hasDefinedMaxSize() ? desc->getMaxMemSize() : MemoryDesc::UNDEFINED_SIZE);
+        if (newSize != MemoryDesc::UNDEFINED_SIZE && newSize <= memUpperBound && prim && prim->get_data_handle()) {
+            auto storage = prim;
+            this->Create(std::move(desc), storage->get_data_handle(), false);
+            primStorageHolder = std::move(storage);
+        } else {
+            primStorageHolder.reset();
+            this->Create(std::move(desc), nullptr, false);
+        }
     }
 }
 
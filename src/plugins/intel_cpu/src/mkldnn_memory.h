@@ -31,6 +31,26 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Scoped request to back large internally allocated MKLDNNMemory buffers with 2 MB huge
+ * pages. The preference is thread local, so concurrent LoadNetwork calls with different
+ * settings do not interfere; it covers everything the current thread allocates while the
+ * scope is alive (constant data cloned during graph replication and the intermediate-tensor
+ * arena). When the system has no huge pages reserved the allocation transparently falls
+ * back, first to madvised regular pages and then to the default allocation path.
+ */
+class HugePagePolicyScope {
+public:
+    explicit HugePagePolicyScope(bool enabled);
+    ~HugePagePolicyScope();
+
+    HugePagePolicyScope(const HugePagePolicyScope&) = delete;
+    HugePagePolicyScope& operator= (const HugePagePolicyScope&) = delete;
+
+private:
+    bool prevEnabled;
+};
+
 class MKLDNNMemory {
 public:
     explicit MKLDNNMemory(const mkldnn::engine& eng);
@@ -123,6 +143,12 @@ private:
 private:
     MemoryDescPtr pMemDesc;
     std::shared_ptr<mkldnn::memory> prim;
+    // Keeps the previously allocated dnnl memory (and so its buffer) alive when the
+    // current prim aliases it after a grow-only descriptor redefinition.
+    std::shared_ptr<mkldnn::memory> primStorageHolder;
+    // Owns the huge-page mapping when the buffer was taken from huge pages instead of
+    // letting dnnl allocate it (see HugePagePolicyScope).
+    std::shared_ptr<void> hugePageHolder;
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
@@ -12,6 +12,16 @@ namespace MKLDNNPlugin {
 
 void  MKLDNNVariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
+    stateLength = 0;
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != state->byteSize()) {
+        IE_THROW() << "Failed to set the state with name " << name << ": byte size " << newState->byteSize()
+                   << " does not match the allocated state storage of " << state->byteSize() << " bytes";
+    }
+    // copy into the wrapped storage, so the graph picks the value up without a push
+    cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), newState->byteSize());
 }
 
 }  // namespace MKLDNNPlugin
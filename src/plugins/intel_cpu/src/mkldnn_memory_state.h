@@ -18,12 +18,15 @@ class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        // wrap the graph-side storage instead of copying it out: the blob observed through
+        // this object is the live tensor the MemoryInput node reads and writes, so neither
+        // querying nor keeping the state between inferences costs a memcpy
+        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()),
+                                         storage->GetData());
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
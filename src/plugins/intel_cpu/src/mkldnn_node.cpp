@@ -55,6 +55,7 @@
 #include <ngraph/opsets/opset1.hpp>
 
 #include <dnnl_types.h>
+#include <common/primitive_hashing_utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
@@ -166,6 +167,19 @@ MKLDNNNode::MKLDNNNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::en
     if (it != rtInfo.end()) {
         enforceBF16evenForGraphTail = it->second.as<bool>();
     }
+
+    const auto itPrecision = rtInfo.find("enforcedPrecision");
+    if (itPrecision != rtInfo.end()) {
+        const auto& precision = itPrecision->second.as<std::string>();
+        if (precision == "bf16") {
+            enforcedPrecision = Precision::BF16;
+        } else if (precision == "f32") {
+            enforcedPrecision = Precision::FP32;
+        } else {
+            IE_THROW() << "Unsupported enforcedPrecision value " << precision << " for node with name '"
+                       << getName() << "'";
+        }
+    }
 }
 
 MKLDNNNode::MKLDNNNode(const std::string& type, const std::string& name, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache)
@@ -240,6 +254,16 @@ void MKLDNNNode::createPrimitive() {
     }
 }
 
+void MKLDNNNode::ensurePrimitiveCreated() {
+    std::call_once(primitiveCreatedFlag, [&]() {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, profiling.createPrimitive);
+        createPrimitive();
+#ifndef CPU_DEBUG_CAPS
+        cleanup();
+#endif
+    });
+}
+
 void MKLDNNNode::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), false);
 }
@@ -516,6 +540,21 @@ void MKLDNNNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNNode::prepareScratchPadMem(const mkldnn::primitive& prim) {
+    if (!scratchPad)
+        return;
+
+    const auto* scratchpadMd = dnnl_primitive_desc_query_md(prim.get_primitive_desc(), dnnl_query_scratchpad_md, 0);
+    if (scratchpadMd == nullptr)
+        return;
+
+    mkldnn::memory::desc md(*scratchpadMd);
+    if (md.get_size() == 0)
+        return;
+
+    primArgs[DNNL_ARG_SCRATCHPAD] = scratchPad->createScratchPadMem(md);
+}
+
 void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
     if (needShapeInfer()) {
         redefineOutputMemory(shapeInfer());
@@ -750,15 +789,31 @@ void MKLDNNNode::prepareMemory(mkldnn::primitive_desc_iterator& itpd) {
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
+        // The key is content-based (precision, shape, target format, size and data
+        // hash) rather than node-name based, so identical weights of different nodes
+        // and models are stored once. Hashing the data is not free, so skip it when
+        // no store needs the key.
+        std::string string_hash;
+        if (weightCache != nullptr || prepackedWeights != nullptr) {
+            string_hash = MKLDNNWeightsSharing::MakeKey(*intDescs[i],
+                                                        internalBlob->buffer(),
+                                                        internalBlob->byteSize());
+        }
+
         auto create = [&] () {
+            MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
+            _ptr->Create(*intDescs[i]);
+
+            // A hit means a blob exported on a machine which selected the same target
+            // format, so the packed bytes can be copied in place of the reorder.
+            if (prepackedWeights != nullptr && prepackedWeights->copyTo(string_hash, _ptr->GetData(), _ptr->GetSize()))
+                return _ptr;
+
             // TODO [DS]: internal blobs should be removed or rewritten using Memory object
             auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
             MKLDNNMemory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
-
-            MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(*intDescs[i]);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -766,13 +821,6 @@ void MKLDNNNode::prepareMemory(mkldnn::primitive_desc_iterator& itpd) {
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
             ptr = create();
@@ -1470,6 +1518,31 @@ std::vector<VectorDims> MKLDNNNode::shapeInferGeneric(const std::vector<Shape>&
     return shapeInferGeneric(input_shapes, input_value_port_mask);
 }
 
+namespace {
+
+struct ShapeInferKey {
+    const MKLDNNNode* node;
+    std::vector<ov::StaticShape> inShapes;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        size_t seed = hash_combine(0, node);
+        for (auto&& shape : inShapes) {
+            seed = hash_combine(seed, shape.size());
+            for (auto&& dim : shape) {
+                seed = hash_combine(seed, dim.get_length());
+            }
+        }
+        return seed;
+    }
+
+    bool operator==(const ShapeInferKey& rhs) const {
+        return node == rhs.node && inShapes == rhs.inShapes;
+    }
+};
+
+}  // namespace
+
 std::vector<VectorDims> MKLDNNNode::shapeInferGeneric(uint32_t input_value_port_mask) const {
     std::vector<ov::StaticShape> input_shapes;
     const auto & iranks = shapeInference->get_input_ranks();
@@ -1484,6 +1557,18 @@ std::vector<VectorDims> MKLDNNNode::shapeInferGeneric(uint32_t input_value_port_
         }
     }
 
+    // Serving traffic commonly cycles through a limited set of shapes (e.g. sequence
+    // lengths), so memoize shape inference results per node in the runtime LRU cache.
+    // Value-dependent inference (non-zero port mask) is excluded since the result
+    // would depend on tensor contents, not only on dims.
+    if (input_value_port_mask == 0 && rtParamsCache) {
+        auto builder = [&](const ShapeInferKey& key) {
+            return shapeInferGeneric(key.inShapes, 0);
+        };
+        auto result = rtParamsCache->getOrCreate(ShapeInferKey{this, std::move(input_shapes)}, builder);
+        return result.first;
+    }
+
     return shapeInferGeneric(input_shapes, input_value_port_mask);
 }
 
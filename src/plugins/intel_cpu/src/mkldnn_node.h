@@ -6,6 +6,7 @@
 
 #include <ie_api.h>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <cassert>
@@ -30,12 +31,15 @@
 #include "cpu_shape.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "cache/multi_cache.h"
+#include "mkldnn_scratch_pad.h"
 
 #include <utils/shape_inference/static_shape.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
 
 namespace MKLDNNPlugin {
 
+struct PerfExportRecord;
+
 using MKLDNNNodePtr = std::shared_ptr<MKLDNNNode>;
 using MKLDNNNodeConstPtr = std::shared_ptr<const MKLDNNNode>;
 using MKLDNNNodeWeakPtr = std::weak_ptr<MKLDNNNode>;
@@ -379,6 +383,13 @@ public:
 
     virtual void createPrimitive();
 
+    /**
+     * @brief Lazy counterpart of createPrimitive() used by the deferred preparation mode.
+     * The first call creates the primitive and releases the internal blobs, the subsequent ones are no-op,
+     * so the background preparation thread and the first inference request may both visit the same node.
+     */
+    void ensurePrimitiveCreated();
+
     virtual void selectOptimalPrimitiveDescriptor();
     virtual void initOptimalPrimitiveDescriptor();
 
@@ -474,6 +485,16 @@ public:
         return profiling;
     }
 
+    // the always-on lightweight counter record of this node in the shared-memory export
+    // (see KEY_CPU_PERF_EXPORT_DIR), nullptr when the export is off
+    PerfExportRecord* getPerfExportRecord() const {
+        return perfExportRecord;
+    }
+
+    void setPerfExportRecord(PerfExportRecord* record) {
+        perfExportRecord = record;
+    }
+
     /**
      * @brief Returns runtime node precision based on input/output data types or data type used for computations
      * @return Runtime node precision
@@ -559,6 +580,14 @@ public:
         isInQuantizedGraph = flag;
     }
 
+    void setDynamicQuantizationFlag(bool flag) {
+        dynamicQuantizationEnabled = flag;
+    }
+
+    void setInt4WeightCompressionFlag(bool flag) {
+        int4WeightCompressionEnabled = flag;
+    }
+
     bool canBePerformedAsScaleShift(const MKLDNNNode *parentNode = nullptr) const;
 
     bool isDynamicNode() const {
@@ -583,6 +612,10 @@ public:
         return internalBlobs;
     }
 
+    const std::vector<MKLDNNMemoryPtr>& getInternalBlobMemory() const {
+        return internalBlobMemory;
+    }
+
     /**
     * @brief Return scales and shift if nodes can be executed as ScaleShift, else raise exception
     * If node has only scale or shift value, fill missing value with default values
@@ -606,6 +639,14 @@ public:
         rtParamsCache = cache;
     }
 
+    void setScratchPad(MKLDNNScratchPadPtr pad) {
+        scratchPad = pad;
+    }
+
+    void setPrepackedWeights(std::shared_ptr<PrepackedWeights> store) {
+        prepackedWeights = store;
+    }
+
 protected:
     bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const;
 
@@ -636,6 +677,10 @@ protected:
     std::vector <mkldnn::memory::format_tag> inputMemoryFormatsFilter;
     std::vector <mkldnn::memory::format_tag> outputMemoryFormatsFilter;
     bool enforceBF16evenForGraphTail = false;
+    // per-node precision decision of a calibration run, carried in the "enforcedPrecision"
+    // runtime attribute: BF16 forces the node to BF16 even on the skipped graph tail,
+    // FP32 pins it to FP32, UNSPECIFIED leaves the node to the global heuristic
+    InferenceEngine::Precision enforcedPrecision = InferenceEngine::Precision::UNSPECIFIED;
 
     std::string originalLayers;  // contains names of the original layers separated by comma
 
@@ -667,11 +712,19 @@ protected:
     std::vector<MKLDNNDescriptor> descs;
 
     MKLDNNWeightsSharing::Ptr weightCache;
+    // packed weight bytes restored from an imported blob, see prepareMemory()
+    std::shared_ptr<PrepackedWeights> prepackedWeights;
 
     Algorithm algorithm = Algorithm::Default;
 
     bool isInQuantizedGraph = false;
 
+    // opt-in runtime dynamic quantization (see KEY_CPU_DYNAMIC_QUANTIZATION)
+    bool dynamicQuantizationEnabled = false;
+
+    // opt-in int4 weight storage (see KEY_CPU_INT4_WEIGHT_COMPRESSION)
+    bool int4WeightCompressionEnabled = false;
+
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
@@ -775,6 +828,14 @@ protected:
         return rtParamsCache;
     }
 
+    MKLDNNScratchPadPtr getScratchPad() const {
+        return scratchPad;
+    }
+
+    // Requests a scratchpad memory for the given primitive from the graph-wide arena and registers it
+    // in primArgs. Used by the nodes which create their primitives with scratchpad_mode::user.
+    void prepareScratchPadMem(const mkldnn::primitive& prim);
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
@@ -799,8 +860,16 @@ private:
 
     PerfCount perfCounter;
     PerfCounters profiling;
+    PerfExportRecord* perfExportRecord = nullptr;
+
+    // accumulated hardware PMU attribution of this node (see KEY_CPU_PMU_COUNTERS)
+    uint64_t pmuLlcMisses = 0;
+    uint64_t pmuLlcRefs = 0;
+    double pmuTimeUs = 0.0;
 
     MultiCachePtr rtParamsCache;
+    MKLDNNScratchPadPtr scratchPad;
+    std::once_flag primitiveCreatedFlag;
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
 
@@ -24,6 +24,7 @@
 #include "nodes/mkldnn_embedding_segments_sum_node.h"
 #include "nodes/mkldnn_region_yolo_node.h"
 #include "nodes/mkldnn_matmul_node.h"
+#include "nodes/mkldnn_attention_node.h"
 #include "nodes/mkldnn_detection_output_node.h"
 #include "nodes/mkldnn_reverse_sequence_node.h"
 #include "nodes/mkldnn_pad_node.h"
@@ -153,6 +154,7 @@ MKLDNNPlugin::MKLDNNNode::NodesFactory::NodesFactory()
     MKLDNN_NODE(MKLDNNReshapeNode, Reshape);
     MKLDNN_NODE(MKLDNNMVNNode, MVN);
     MKLDNN_NODE(MKLDNNMatMulNode, MatMul);
+    MKLDNN_NODE(MKLDNNAttentionNode, Attention);
     MKLDNN_NODE(MKLDNNScatterUpdateNode, ScatterUpdate);
     MKLDNN_NODE(MKLDNNScatterUpdateNode, ScatterElementsUpdate);
     MKLDNN_NODE(MKLDNNScatterUpdateNode, ScatterNDUpdate);
@@ -11,7 +11,10 @@
 #include "mkldnn_serialize.h"
 
 #include <threading/ie_executor_manager.hpp>
+#include <algorithm>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <ie_plugin_config.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
@@ -78,7 +81,6 @@
 #include <transformations/op_conversions/convert_reduce_to_pooling.hpp>
 #include <transformations/convert_precision.hpp>
 #include <transformations/init_node_info.hpp>
-#include <transformations/disable_decompression_convert_constant_folding.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
@@ -359,8 +361,10 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
     // List of enabled/disabled transformations
 
-    // Allow FP16 Converts to be folded and FP16 constants to be upgraded to FP32 data type
-    pass_config->disable<ov::pass::DisableDecompressionConvertConstantFolding>();
+    // Decompression Converts of compressed fp16 IRs are kept up to the CPU specific opset, so the
+    // common pipeline does not expand every weight to an FP32 constant; FullyConnected consumes
+    // such weights in fp16 directly and the remaining Converts are folded back in
+    // ConvertToCPUSpecificOpset. The legacy compressed fp16 format is not used by this plugin.
     pass_config->disable<ov::pass::ConvertCompressedOnlyToLegacy>();
 
     pass_config->disable<ngraph::pass::ConvertGELU>();
@@ -534,6 +538,95 @@ static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, con
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+namespace {
+
+// Snapshot of a model transformed up to the CPU-specific opset. Recompiling the same source
+// model with another runtime configuration (e.g. a different stream count) reuses the snapshot
+// and skips the common transformation pipeline; every load still mutates a private clone, the
+// cached network itself stays pristine.
+struct TransformedModelSnapshot {
+    std::weak_ptr<const ngraph::Function> source;
+    bool enableLPT;
+    bool enableSnippets;
+    std::string ioFingerprint;
+    CNNNetwork transformed;
+};
+
+std::string NetworkIoFingerprint(const CNNNetwork& network) {
+    std::string fingerprint;
+    for (const auto& input : network.getInputsInfo()) {
+        fingerprint += "in:" + input.first + ":" + input.second->getPrecision().name() + ":" +
+                       std::to_string(static_cast<int>(input.second->getLayout())) + ";";
+    }
+    for (const auto& output : network.getOutputsInfo()) {
+        fingerprint += "out:" + output.first + ":" + output.second->getPrecision().name() + ":" +
+                       std::to_string(static_cast<int>(output.second->getLayout())) + ";";
+    }
+    return fingerprint;
+}
+
+std::mutex transformedModelCacheMutex;
+std::deque<TransformedModelSnapshot> transformedModelCache;
+constexpr size_t transformedModelCacheLimit = 8;
+
+CNNNetwork CloneAndTransformCached(const CNNNetwork& network, const bool enableLPT, const bool enableSnippets) {
+    const auto source = network.getFunction();
+    const auto ioFingerprint = NetworkIoFingerprint(network);
+    std::lock_guard<std::mutex> lock(transformedModelCacheMutex);
+    auto cacheIt = std::find_if(transformedModelCache.begin(),
+                                transformedModelCache.end(),
+                                [&](const TransformedModelSnapshot& snapshot) {
+                                    return snapshot.source.lock() == source && snapshot.enableLPT == enableLPT &&
+                                           snapshot.enableSnippets == enableSnippets &&
+                                           snapshot.ioFingerprint == ioFingerprint;
+                                });
+    if (cacheIt == transformedModelCache.end()) {
+        CNNNetwork transformed = InferenceEngine::details::cloneNetwork(network);
+        auto nGraphFunc = transformed.getFunction();
+        TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets);
+        // drop the entries whose source model is gone, then the oldest ones
+        transformedModelCache.erase(std::remove_if(transformedModelCache.begin(),
+                                                   transformedModelCache.end(),
+                                                   [](const TransformedModelSnapshot& snapshot) {
+                                                       return snapshot.source.expired();
+                                                   }),
+                                    transformedModelCache.end());
+        while (transformedModelCache.size() >= transformedModelCacheLimit)
+            transformedModelCache.pop_back();
+        transformedModelCache.push_front({source, enableLPT, enableSnippets, ioFingerprint, transformed});
+        cacheIt = transformedModelCache.begin();
+    }
+    return InferenceEngine::details::cloneNetwork(cacheIt->transformed);
+}
+
+void ApplyMemoryBudget(Config& conf, const std::shared_ptr<const ngraph::Function>& function) {
+    if (conf.memoryBudget == 0 || !function)
+        return;
+
+    uint64_t constantBytes = 0;
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = ov::as_type_ptr<ngraph::op::Constant>(op))
+            constantBytes += constant->get_byte_size();
+    }
+
+    // weight replication multiplies the constant data per NUMA node, so it is the first
+    // feature to give up when the copies would not fit the budget
+    const uint64_t numaNodes = InferenceEngine::getAvailableNUMANodes().size();
+    if (conf.numaWeightReplication && numaNodes > 1 && constantBytes * numaNodes > conf.memoryBudget)
+        conf.numaWeightReplication = false;
+
+    // when the weights alone reach the budget, fall back to the smallest-footprint execution:
+    // a single stream avoids per-stream duplication of the intermediate-tensor arena, and a
+    // shrunk runtime cache bounds the shape-specialized primitives kept for dynamic models
+    if (constantBytes >= conf.memoryBudget) {
+        if (conf.streamExecutorConfig._streams > 1)
+            conf.streamExecutorConfig._streams = 1;
+        conf.rtCacheCapacity = std::min(conf.rtCacheCapacity, static_cast<size_t>(10));
+    }
+}
+
+}  // namespace
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -561,7 +654,6 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     }
 
     auto config = orig_config;
-    CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
     const auto& lptProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE);
     const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
             || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled for the plugin */;
@@ -575,8 +667,18 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& snapshotProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODEL_CACHE);
+    const bool enableTransformedModelCache = ((snapshotProp != config.end() && snapshotProp->second == PluginConfigParams::YES)
+            || engConfig.transformedModelCache) && network.getFunction() != nullptr;
+    CNNNetwork clonedNetwork;
+    if (enableTransformedModelCache) {
+        clonedNetwork = CloneAndTransformCached(network, enableLPT, enableSnippets);
+    } else {
+        clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+        auto func = clonedNetwork.getFunction();
+        TransformationUpToCPUSpecificOpSet(func, enableLPT, enableSnippets);
+    }
     auto nGraphFunc = clonedNetwork.getFunction();
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableSnippets);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
@@ -658,8 +760,11 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
+    ApplyMemoryBudget(conf, nGraphFunc);
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    execNetwork->ScheduleWarmup();
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -869,7 +974,17 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
+    // Packed weights appended by Export(), if any, let graph compilation skip
+    // the weight reorders whenever this machine selects the same layouts.
+    conf.prepackedWeights = deserializePrepackedWeights(networkModel);
+
     auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    execNetwork->ScheduleWarmup();
+
+    // All graphs are compiled by now, drop the raw packed bytes.
+    if (conf.prepackedWeights) {
+        conf.prepackedWeights->clear();
+    }
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -42,7 +42,7 @@ public:
 
 private:
     Config engConfig;
-    NumaNodesWeights weightsSharing;
+    NumaNodesWeights& weightsSharing = NumaNodesWeights::getInstance();
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
     bool streamsSet = false;
 };
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "mkldnn_memory.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Grow-only scratch memory arena shared by all nodes of a graph.
+ *
+ * Each stream executes its own copy of the graph strictly sequentially, so one arena per graph is
+ * enough: at any moment at most one primitive works with the scratch memory. Nodes request a dnnl
+ * memory object over the arena right before the execution, and the arena keeps only the maximum
+ * capacity ever requested instead of every node holding a scratch buffer of its own for the whole
+ * network lifetime.
+ */
+class MKLDNNScratchPad {
+public:
+    explicit MKLDNNScratchPad(mkldnn::engine eng) : eng(std::move(eng)) {}
+
+    /**
+     * @brief Creates a dnnl memory object with the requested descriptor backed by the arena storage,
+     *        growing the storage if the request exceeds the current capacity.
+     */
+    mkldnn::memory createScratchPadMem(const mkldnn::memory::desc& md) {
+        const size_t size = md.get_size();
+        if (size == 0) {
+            return mkldnn::memory(md, eng, nullptr);
+        }
+        if (size > capacity) {
+            mem = std::make_shared<MKLDNNMemory>(eng);
+            mem->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8,
+                                              Shape(InferenceEngine::SizeVector{size})));
+            capacity = size;
+        }
+        return mkldnn::memory(md, eng, mem->GetData());
+    }
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+private:
+    mkldnn::engine eng;
+    MKLDNNMemoryPtr mem;
+    size_t capacity = 0ul;
+};
+
+using MKLDNNScratchPadPtr = std::shared_ptr<MKLDNNScratchPad>;
+
+}  // namespace MKLDNNPlugin
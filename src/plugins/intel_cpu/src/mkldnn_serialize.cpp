@@ -3,6 +3,9 @@
 //
 #include "mkldnn_serialize.h"
 
+#include <algorithm>
+#include <ie_shared_stream_buffer.hpp>
+#include <ie_version.hpp>
 #include <openvino/pass/serialize.hpp>
 
 #include <pugixml.hpp>
@@ -11,6 +14,22 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 namespace {
+    // Envelope written in front of the StreamSerialize payload. The payload itself is
+    // the serialized IR which gets recompiled on import, so the blob carries no
+    // machine-specific state; the envelope only pins down the container layout.
+    // Fixed-width fields keep the blob readable across 32/64-bit producers.
+    constexpr char BLOB_MAGIC[4] = {'O', 'V', 'C', 'M'};
+    // Bump on incompatible changes of the container layout (not of the IR itself).
+    constexpr uint32_t BLOB_FORMAT_VERSION = 1;
+
+    struct BlobEnvelope {
+        char magic[4];
+        uint32_t format_version;
+        // Length of the producer identification string which directly follows the
+        // envelope; the string is for diagnostics only and is never interpreted.
+        uint32_t producer_size;
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -117,7 +136,18 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
         xml_doc.save(stream);
     };
 
-    // Serialize to old representation in case of old API
+    const std::string producer = GetInferenceEngineVersion()->buildNumber;
+
+    BlobEnvelope envelope = {};
+    std::copy(std::begin(BLOB_MAGIC), std::end(BLOB_MAGIC), envelope.magic);
+    envelope.format_version = BLOB_FORMAT_VERSION;
+    envelope.producer_size = static_cast<uint32_t>(producer.size());
+
+    _ostream.write(reinterpret_cast<const char*>(&envelope), sizeof envelope);
+    _ostream.write(producer.c_str(), producer.size());
+
+    // Serialize to old representation in case of old API. The payload header records
+    // absolute stream offsets, so prepending the envelope keeps them valid.
     OPENVINO_SUPPRESS_DEPRECATED_START
     ov::pass::StreamSerialize serializer(_ostream, getCustomOpSets(), serializeInputsAndOutputs);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -135,6 +165,28 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     std::string xmlString, xmlInOutString;
     InferenceEngine::Blob::Ptr dataBlob;
 
+    const std::istream::pos_type blob_begin = _istream.tellg();
+
+    BlobEnvelope envelope = {};
+    _istream.read(reinterpret_cast<char*>(&envelope), sizeof envelope);
+    if (_istream.good() && std::equal(std::begin(BLOB_MAGIC), std::end(BLOB_MAGIC), envelope.magic)) {
+        if (envelope.format_version > BLOB_FORMAT_VERSION) {
+            std::string producer(envelope.producer_size, '\0');
+            _istream.read(const_cast<char*>(producer.c_str()), envelope.producer_size);
+            IE_THROW(NetworkNotRead)
+                << "The exported blob has format version " << envelope.format_version
+                << " while this plugin supports versions up to " << BLOB_FORMAT_VERSION
+                << " (blob produced by build " << producer << "). "
+                << "Recompile the model from its IR to produce a compatible blob.";
+        }
+        // The producer string is diagnostics-only, skip it.
+        _istream.seekg(envelope.producer_size, std::ios::cur);
+    } else {
+        // Legacy blob without an envelope, starts directly with the payload header.
+        _istream.clear();
+        _istream.seekg(blob_begin);
+    }
+
     StreamSerialize::DataHeader hdr = {};
     _istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
 
@@ -151,10 +203,26 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        const TensorDesc constsDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        auto sharedBuffer = dynamic_cast<SharedStreamBuffer*>(_istream.rdbuf());
+        if (sharedBuffer && sharedBuffer->getOwner() &&
+            hdr.consts_offset + hdr.consts_size <= sharedBuffer->getSize()) {
+            // The stream already exposes the whole blob in memory (e.g. a mapped
+            // cache file), so wrap the consts chunk directly and let constant data
+            // be paged in lazily instead of copying it up front.
+            auto constsBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
+                constsDesc,
+                reinterpret_cast<std::uint8_t*>(sharedBuffer->getData() + hdr.consts_offset));
+            auto owner = sharedBuffer->getOwner();
+            dataBlob = InferenceEngine::Blob::Ptr(constsBlob.get(), [constsBlob, owner](InferenceEngine::Blob*) mutable {
+                constsBlob.reset();
+                owner.reset();
+            });
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(constsDesc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -173,4 +241,77 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+namespace {
+    // Section trailing the StreamSerialize payload. The keys embed the oneDNN target
+    // format, so a reader on a machine which selects different layouts just misses
+    // on lookup and falls back to the regular reorders.
+    constexpr char PREPACKED_MAGIC[4] = {'O', 'V', 'P', 'W'};
+    constexpr uint32_t PREPACKED_FORMAT_VERSION = 1;
+}  // namespace
+
+void serializePrepackedWeights(std::ostream& ostream,
+                               const std::vector<std::pair<std::string, MKLDNNMemoryPtr>>& weights) {
+    ostream.write(PREPACKED_MAGIC, sizeof PREPACKED_MAGIC);
+    const uint32_t version = PREPACKED_FORMAT_VERSION;
+    ostream.write(reinterpret_cast<const char*>(&version), sizeof version);
+    const uint64_t count = weights.size();
+    ostream.write(reinterpret_cast<const char*>(&count), sizeof count);
+
+    for (const auto& entry : weights) {
+        const uint64_t key_size = entry.first.size();
+        ostream.write(reinterpret_cast<const char*>(&key_size), sizeof key_size);
+        ostream.write(entry.first.c_str(), entry.first.size());
+
+        const uint64_t data_size = entry.second->GetSize();
+        ostream.write(reinterpret_cast<const char*>(&data_size), sizeof data_size);
+        ostream.write(reinterpret_cast<const char*>(entry.second->GetData()), data_size);
+    }
+}
+
+PrepackedWeights::Ptr deserializePrepackedWeights(std::istream& istream) {
+    const std::istream::pos_type section_begin = istream.tellg();
+
+    auto missing = [&] () -> PrepackedWeights::Ptr {
+        istream.clear();
+        istream.seekg(section_begin);
+        return nullptr;
+    };
+
+    char magic[sizeof PREPACKED_MAGIC] = {};
+    uint32_t version = 0;
+    istream.read(magic, sizeof magic);
+    istream.read(reinterpret_cast<char*>(&version), sizeof version);
+    if (!istream.good()
+        || !std::equal(std::begin(PREPACKED_MAGIC), std::end(PREPACKED_MAGIC), magic)
+        || version > PREPACKED_FORMAT_VERSION) {
+        return missing();
+    }
+
+    uint64_t count = 0;
+    istream.read(reinterpret_cast<char*>(&count), sizeof count);
+
+    auto store = std::make_shared<PrepackedWeights>();
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t key_size = 0;
+        istream.read(reinterpret_cast<char*>(&key_size), sizeof key_size);
+        if (!istream.good())
+            return missing();
+        std::string key(key_size, '\0');
+        istream.read(const_cast<char*>(key.c_str()), key_size);
+
+        uint64_t data_size = 0;
+        istream.read(reinterpret_cast<char*>(&data_size), sizeof data_size);
+        if (!istream.good())
+            return missing();
+        std::vector<uint8_t> bytes(data_size);
+        istream.read(reinterpret_cast<char*>(bytes.data()), data_size);
+        if (!istream.good())
+            return missing();
+
+        store->add(key, std::move(bytes));
+    }
+
+    return store;
+}
+
 }  // namespace MKLDNNPlugin
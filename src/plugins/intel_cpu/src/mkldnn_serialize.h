@@ -3,9 +3,12 @@
 //
 #pragma once
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_weights_cache.hpp"
 
 #include <iostream>
 #include <functional>
+#include <utility>
+#include <vector>
 #include <cpp/ie_cnn_network.h>
 
 namespace MKLDNNPlugin {
@@ -36,4 +39,20 @@ private:
 
 // const std::string& model, const Blob::CPtr& weights
 
+/**
+ * @brief Appends the packed weight bytes of a compiled graph to an exported blob
+ *
+ * Written after the serialized IR so readers unaware of the section simply stop
+ * at the end of the payload. Entries are keyed with MKLDNNWeightsSharing::MakeKey.
+ */
+void serializePrepackedWeights(std::ostream& ostream,
+                               const std::vector<std::pair<std::string, MKLDNNMemoryPtr>>& weights);
+
+/**
+ * @brief Reads the packed weights section which may follow the blob payload
+ * @return the restored store, or nullptr when the section is absent (legacy blob)
+ *         or has an unsupported version
+ */
+PrepackedWeights::Ptr deserializePrepackedWeights(std::istream& istream);
+
 }  // namespace MKLDNNPlugin
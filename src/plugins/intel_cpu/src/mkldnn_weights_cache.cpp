@@ -5,6 +5,7 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cstring>
 #include <memory>
 
 namespace MKLDNNPlugin {
@@ -70,6 +71,35 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void PrepackedWeights::add(const std::string& key, std::vector<uint8_t>&& bytes) {
+    std::unique_lock<std::mutex> lock(guard);
+    packedWeights[key] = std::move(bytes);
+}
+
+bool PrepackedWeights::copyTo(const std::string& key, void* dst, size_t size) const {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = packedWeights.find(key);
+    if (found == packedWeights.end() || found->second.size() != size)
+        return false;
+    std::memcpy(dst, found->second.data(), size);
+    return true;
+}
+
+bool PrepackedWeights::empty() const {
+    std::unique_lock<std::mutex> lock(guard);
+    return packedWeights.empty();
+}
+
+void PrepackedWeights::clear() {
+    std::unique_lock<std::mutex> lock(guard);
+    packedWeights.clear();
+}
+
+NumaNodesWeights& NumaNodesWeights::getInstance() {
+    static NumaNodesWeights instance;
+    return instance;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
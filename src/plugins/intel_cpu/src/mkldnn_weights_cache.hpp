@@ -13,6 +13,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -95,12 +96,46 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    // Content-based key: precision, logical shape, target format, size and data hash,
+    // so identical weights of different nodes and models map to one entry. Precision
+    // and shape must be part of the key: byte-identical buffers (e.g. zero-filled
+    // weights) packed for different logical tensors must not share memory.
+    static std::string MakeKey(const MemoryDesc& desc, const unsigned char* data, size_t byteSize) {
+        return std::string(desc.getPrecision().name())
+                + "_" + desc.getShape().toString()
+                + "_" + desc.serializeFormat()
+                + "_" + std::to_string(byteSize)
+                + "_" + std::to_string(GetHashFunc().hash(data, byteSize));
+    }
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MKLDNNMemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * Raw packed weight bytes restored from an imported blob, keyed the same way as
+ * MKLDNNWeightsSharing entries. A hit in MKLDNNNode::prepareMemory replaces the
+ * weight reorder with a plain copy; a miss (e.g. different layout selected on
+ * this machine) falls back to the regular reorder.
+ *
+ * Is a thread safe
+ */
+class PrepackedWeights {
+public:
+    typedef std::shared_ptr<PrepackedWeights> Ptr;
+
+    void add(const std::string& key, std::vector<uint8_t>&& bytes);
+    bool copyTo(const std::string& key, void* dst, size_t size) const;
+    bool empty() const;
+    void clear();
+
+private:
+    mutable std::mutex guard;
+    std::unordered_map<std::string, std::vector<uint8_t>> packedWeights;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
@@ -113,6 +148,13 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * Process-wide store: all Engine (and therefore ov::Core) instances share it,
+     * so byte-identical constants of models loaded through different Core objects
+     * are kept in memory once per NUMA node.
+     */
+    static NumaNodesWeights& getInstance();
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
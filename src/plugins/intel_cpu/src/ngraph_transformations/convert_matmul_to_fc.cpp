@@ -6,14 +6,20 @@
 #include "op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/decompression.hpp>
 #include <transformations/utils/utils.hpp>
 
 NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
 MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    // weights of compressed fp16 models arrive as Constant->Convert pairs which are kept
+    // unfolded up to this point, so the pattern accepts both forms
+    auto weights_const_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ weights_const_m });
+    auto weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ weights_const_m, weights_convert_m });
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -27,7 +33,14 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
         // fc_input_a and fc_input_b - are the final inputs that will be set to FullyConnected of GemmIE operations.
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
-        auto fc_input_b = pattern_map.at(weights_m);
+        // The decompression Convert is dropped and FullyConnected takes the fp16 Constant as is:
+        // the plugin upconverts the weights once, together with the repacking reorder, so the
+        // fp32 copy never outlives the graph compilation
+        if (pattern_map.count(weights_convert_m) &&
+            !ov::is_decompression(pattern_map.at(weights_convert_m).get_node_shared_ptr())) {
+            return false;
+        }
+        auto fc_input_b = pattern_map.at(weights_const_m);
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
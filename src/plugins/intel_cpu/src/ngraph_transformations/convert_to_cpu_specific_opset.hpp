@@ -12,9 +12,12 @@
 #include "convert_broadcast_to_tiles.hpp"
 #include "convert_tile_to_seq_tiles.hpp"
 #include "convert_matmul_to_fc.hpp"
+#include "fuse_scaled_dot_product_attention.hpp"
+#include "merge_sibling_matmuls.hpp"
 #include "convert_to_power_static.hpp"
 #include "convert_to_leaky_relu.hpp"
 #include "convert_to_swish_cpu.hpp"
+#include "transformations/common_optimizations/convert_compression_only_to_legacy.hpp"
 #include "transformations/convert_precision.hpp"
 #include "transformations/utils/utils.hpp"
 #include "rnn_sequences_optimization.hpp"
@@ -23,6 +26,10 @@ namespace MKLDNNPlugin {
 
 inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
     ngraph::pass::Manager manager;
+    manager.register_pass<MergeSiblingMatMuls>();
+    // has to see the scalar Multiply and the MatMuls intact, i.e. run before
+    // ConvertToPowerStatic and ConvertMatMulToFC touch the pattern
+    manager.register_pass<FuseScaledDotProductAttention>();
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<AlignMatMulInputRanks>();
     manager.register_pass<ConvertTileToSeqTiles>();
@@ -34,6 +41,9 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     if (!ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc)) {
         manager.register_pass<ReshapeFullyConnectedFusion>();
     }
+    // decompression Converts which were not consumed by ConvertMatMulToFC (e.g. on Convolution
+    // weights) are folded back to FP32 constants here, as the common pipeline used to do
+    manager.register_pass<ov::pass::EnableDecompressionConvertConstantFolding>();
     manager.register_pass<ngraph::pass::ConstantFolding>();
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i64, ngraph::element::i32 }});
 
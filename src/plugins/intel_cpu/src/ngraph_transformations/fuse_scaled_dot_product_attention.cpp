@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_scaled_dot_product_attention.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/rt_info.hpp>
+#include "op/scaled_dot_product_attention.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FuseScaledDotProductAttention, "FuseScaledDotProductAttention", 0);
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+bool getSoftmaxAxis(const std::shared_ptr<ngraph::Node>& softmax, int64_t& axis) {
+    if (auto softmaxV1 = ov::as_type_ptr<ngraph::opset1::Softmax>(softmax)) {
+        axis = static_cast<int64_t>(softmaxV1->get_axis());
+        return true;
+    }
+    if (auto softmaxV8 = ov::as_type_ptr<ngraph::opset8::Softmax>(softmax)) {
+        axis = softmaxV8->get_axis();
+        if (axis < 0)
+            axis += softmax->get_input_partial_shape(0).size();
+        return true;
+    }
+    return false;
+}
+
+bool isBroadcastableMask(const ngraph::PartialShape& maskShape, const ngraph::Shape& scoresShape) {
+    // the fused kernel supports only the numpy-style broadcast of a mask of an equal rank,
+    // which covers the usual [batch, 1, 1, seq] and [1, 1, seq, seq] attention masks
+    if (maskShape.is_dynamic() || maskShape.size() != scoresShape.size())
+        return false;
+    for (size_t i = 0; i < scoresShape.size(); i++) {
+        const auto dim = maskShape[i].get_length();
+        if (dim != 1 && static_cast<size_t>(dim) != scoresShape[i])
+            return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::FuseScaledDotProductAttention::FuseScaledDotProductAttention() {
+    auto query = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto key = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto value = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto mask = ngraph::pattern::any_input();
+
+    auto qk = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({query, key}, ngraph::pattern::consumers_count(1));
+    auto scaleConst = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto scaled = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({qk, scaleConst},
+                                                                       ngraph::pattern::consumers_count(1));
+    auto qkOrScaled = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{scaled, qk});
+    auto masked = ngraph::pattern::wrap_type<ngraph::opset1::Add>({qkOrScaled, mask},
+                                                                  ngraph::pattern::consumers_count(1));
+    auto scores = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{masked, qkOrScaled});
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(
+        {scores},
+        ngraph::pattern::consumers_count(1));
+    auto attention = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, value});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+
+        auto scoresMatMul = ov::as_type_ptr<ngraph::opset1::MatMul>(patternMap.at(qk).get_node_shared_ptr());
+        auto outputMatMul = ov::as_type_ptr<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!scoresMatMul || !outputMatMul)
+            return false;
+
+        // the fused kernel computes Q x K^T and Softmax x V over the innermost dimensions
+        if (scoresMatMul->get_transpose_a() || !scoresMatMul->get_transpose_b())
+            return false;
+        if (outputMatMul->get_transpose_a() || outputMatMul->get_transpose_b())
+            return false;
+
+        const auto& queryOut = patternMap.at(query);
+        const auto& keyOut = patternMap.at(key);
+        const auto& valueOut = patternMap.at(value);
+        if (queryOut.get_element_type() != ngraph::element::f32 ||
+            keyOut.get_element_type() != ngraph::element::f32 ||
+            valueOut.get_element_type() != ngraph::element::f32)
+            return false;
+
+        const auto& queryShape = queryOut.get_shape();
+        const auto& keyShape = keyOut.get_shape();
+        const auto& valueShape = valueOut.get_shape();
+        const auto rank = queryShape.size();
+        if (rank < 3 || keyShape.size() != rank || valueShape.size() != rank)
+            return false;
+
+        // Q: [.., M, D], K: [.., N, D], V: [.., N, Dv]; the kernel doesn't broadcast batch dims
+        for (size_t i = 0; i + 2 < rank; i++) {
+            if (queryShape[i] != keyShape[i] || queryShape[i] != valueShape[i])
+                return false;
+        }
+        if (queryShape[rank - 1] != keyShape[rank - 1] || keyShape[rank - 2] != valueShape[rank - 2])
+            return false;
+
+        int64_t axis = 0;
+        if (!getSoftmaxAxis(patternMap.at(softmax).get_node_shared_ptr(), axis))
+            return false;
+        if (axis != static_cast<int64_t>(rank) - 1)
+            return false;
+
+        float scale = 1.0f;
+        if (patternMap.count(scaled)) {
+            auto constant = ov::as_type_ptr<ngraph::opset1::Constant>(patternMap.at(scaleConst).get_node_shared_ptr());
+            if (!constant || ngraph::shape_size(constant->get_shape()) != 1)
+                return false;
+            scale = constant->cast_vector<float>()[0];
+        }
+
+        ngraph::Shape scoresShape(queryShape.begin(), queryShape.end());
+        scoresShape[rank - 1] = keyShape[rank - 2];
+
+        std::shared_ptr<ScaledDotProductAttentionNode> fused;
+        if (patternMap.count(masked)) {
+            const auto& maskOut = patternMap.at(mask);
+            if (maskOut.get_element_type() != ngraph::element::f32 ||
+                !isBroadcastableMask(maskOut.get_partial_shape(), scoresShape))
+                return false;
+            fused = std::make_shared<ScaledDotProductAttentionNode>(queryOut, keyOut, valueOut, maskOut, scale);
+        } else {
+            fused = std::make_shared<ScaledDotProductAttentionNode>(queryOut, keyOut, valueOut, scale);
+        }
+
+        fused->set_friendly_name(outputMatMul->get_friendly_name());
+        ngraph::NodeVector fusedNodes{scoresMatMul, patternMap.at(softmax).get_node_shared_ptr(), outputMatMul};
+        if (patternMap.count(scaled))
+            fusedNodes.push_back(patternMap.at(scaled).get_node_shared_ptr());
+        if (patternMap.count(masked))
+            fusedNodes.push_back(patternMap.at(masked).get_node_shared_ptr());
+        ngraph::copy_runtime_info(fusedNodes, fused);
+        ngraph::replace_node(outputMatMul, fused);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(attention, "FuseScaledDotProductAttention");
+    this->register_matcher(m, callback);
+}
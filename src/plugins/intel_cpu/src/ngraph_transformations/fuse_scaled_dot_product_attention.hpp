@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @interface FuseScaledDotProductAttention
+ * @brief Fuses the transformer attention pattern
+ *        MatMul(Q, K^T) -> [Multiply(scale)] -> [Add(mask)] -> Softmax -> MatMul(V)
+ *        into a single ScaledDotProductAttention operation. The separate nodes materialize
+ *        the full [.., seq, seq] score tensor twice (MatMul output and Softmax output),
+ *        which blows the caches at long sequence lengths; the fused CPU node computes the
+ *        softmax blockwise and keeps only per-row running statistics instead.
+ */
+class FuseScaledDotProductAttention : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FuseScaledDotProductAttention();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "merge_sibling_matmuls.hpp"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MergeSiblingMatMuls, "MergeSiblingMatMuls", 0);
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::shared_ptr<ngraph::opset1::MatMul> getMergeableMatMul(const ngraph::Input<ngraph::Node>& consumer) {
+    // Only MatMuls which take the shared value as the activation (port 0) and read the weights
+    // from a constant can be merged: the concatenated weights are folded to a single Constant
+    // right away and the activations operand stays as is.
+    if (consumer.get_index() != 0)
+        return nullptr;
+
+    auto matmul = ov::as_type_ptr<ngraph::opset1::MatMul>(consumer.get_node()->shared_from_this());
+    if (!matmul)
+        return nullptr;
+
+    if (!ov::is_type<ngraph::opset1::Constant>(matmul->get_input_node_ptr(1)))
+        return nullptr;
+
+    if (matmul->get_output_partial_shape(0).rank().is_dynamic())
+        return nullptr;
+
+    // Keep network outputs intact: replacing a Result source would change the output tensor names.
+    for (const auto& target : matmul->get_output_target_inputs(0)) {
+        if (ov::is_type<ngraph::opset1::Result>(target.get_node()))
+            return nullptr;
+    }
+
+    return matmul;
+}
+
+std::string makeGroupKey(const std::shared_ptr<ngraph::opset1::MatMul>& matmul, size_t nAxis) {
+    const auto& weightsShape = matmul->get_input_shape(1);
+
+    std::ostringstream key;
+    key << matmul->get_transpose_a() << "_" << matmul->get_transpose_b() << "_"
+        << matmul->get_input_element_type(1) << "_";
+    for (size_t i = 0; i < weightsShape.size(); i++) {
+        // the dimension being concatenated is allowed to differ between the siblings
+        key << (i == nAxis ? 0 : weightsShape[i]) << "_";
+    }
+    return key.str();
+}
+
+}  // namespace
+
+bool MergeSiblingMatMuls::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    bool rewritten = false;
+
+    for (const auto& node : model->get_ordered_ops()) {
+        for (const auto& output : node->outputs()) {
+            std::map<std::string, std::vector<std::shared_ptr<ngraph::opset1::MatMul>>> groups;
+
+            for (const auto& consumer : output.get_target_inputs()) {
+                if (auto matmul = getMergeableMatMul(consumer)) {
+                    const auto weightsRank = matmul->get_input_shape(1).size();
+                    if (weightsRank < 2)
+                        continue;
+                    const size_t nAxis = matmul->get_transpose_b() ? weightsRank - 2 : weightsRank - 1;
+                    groups[makeGroupKey(matmul, nAxis)].push_back(matmul);
+                }
+            }
+
+            for (auto& group : groups) {
+                auto& matmuls = group.second;
+                if (matmuls.size() < 2)
+                    continue;
+
+                // get_target_inputs has no defined order, make the rewrite deterministic
+                std::sort(matmuls.begin(), matmuls.end(),
+                          [](const std::shared_ptr<ngraph::Node>& lhs, const std::shared_ptr<ngraph::Node>& rhs) {
+                              return lhs->get_friendly_name() < rhs->get_friendly_name();
+                          });
+
+                const auto weightsRank = matmuls[0]->get_input_shape(1).size();
+                const size_t nAxis = matmuls[0]->get_transpose_b() ? weightsRank - 2 : weightsRank - 1;
+
+                ngraph::OutputVector weights;
+                std::vector<int64_t> splitLengths;
+                for (const auto& matmul : matmuls) {
+                    weights.push_back(matmul->input_value(1));
+                    splitLengths.push_back(static_cast<int64_t>(matmul->get_input_shape(1)[nAxis]));
+                }
+
+                auto weightsCat = std::make_shared<ngraph::opset1::Concat>(weights, nAxis);
+                // ConvertMatMulToFC runs right after this pass and only matches Constant (or
+                // Constant->Convert) weights, while the pipeline-wide ConstantFolding runs at the
+                // very end, so the concatenation has to be folded eagerly here - otherwise the
+                // merged MatMul would stay a generic MatMul instead of becoming a FullyConnected.
+                auto weightsConst = ngraph::get_constant_from_source(weightsCat);
+                if (!weightsConst)
+                    continue;
+                weightsConst->set_friendly_name(weightsCat->get_friendly_name());
+                auto mergedMatMul = std::make_shared<ngraph::opset1::MatMul>(output,
+                                                                            weightsConst,
+                                                                            matmuls[0]->get_transpose_a(),
+                                                                            matmuls[0]->get_transpose_b());
+
+                const auto outRank = matmuls[0]->get_output_partial_shape(0).rank().get_length();
+                auto splitAxis = ngraph::opset1::Constant::create(ngraph::element::i64, {}, {outRank - 1});
+                auto splitLengthsConst = ngraph::opset1::Constant::create(ngraph::element::i64,
+                                                                          {splitLengths.size()},
+                                                                          splitLengths);
+                auto split = std::make_shared<ngraph::opset1::VariadicSplit>(mergedMatMul, splitAxis, splitLengthsConst);
+
+                mergedMatMul->set_friendly_name(matmuls[0]->get_friendly_name() + "/merged");
+                split->set_friendly_name(matmuls[0]->get_friendly_name() + "/split");
+
+                ngraph::NodeVector fusedNodes(matmuls.begin(), matmuls.end());
+                ngraph::copy_runtime_info(fusedNodes, {weightsConst, mergedMatMul, split});
+
+                for (size_t i = 0; i < matmuls.size(); i++) {
+                    ngraph::replace_node(matmuls[i], {split->output(i)});
+                }
+
+                rewritten = true;
+            }
+        }
+    }
+
+    return rewritten;
+}
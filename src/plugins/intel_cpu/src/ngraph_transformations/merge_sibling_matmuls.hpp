@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @interface MergeSiblingMatMuls
+ * @brief Merges sibling MatMul operations which share the same activation input and have constant
+ *        weights into a single MatMul over the concatenated weights followed by a VariadicSplit.
+ *        A typical example is the Q/K/V projections of a transformer attention block: three GEMMs
+ *        over the same activation collapse into one wider GEMM, so the activation is streamed
+ *        through the cache once and the per-primitive dispatch overhead is paid once.
+ */
+class MergeSiblingMatMuls : public ov::pass::ModelPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+};
+
+}  // namespace MKLDNNPlugin
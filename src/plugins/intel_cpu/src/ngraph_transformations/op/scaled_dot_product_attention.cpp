@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& query,
+                                                                           const ngraph::Output<Node>& key,
+                                                                           const ngraph::Output<Node>& value,
+                                                                           const float scale)
+    : Op({query, key, value}), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& query,
+                                                                           const ngraph::Output<Node>& key,
+                                                                           const ngraph::Output<Node>& value,
+                                                                           const ngraph::Output<Node>& mask,
+                                                                           const float scale)
+    : Op({query, key, value, mask}), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(
+    const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0),
+                                                                             new_args.at(1),
+                                                                             new_args.at(2),
+                                                                             m_scale);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0),
+                                                                             new_args.at(1),
+                                                                             new_args.at(2),
+                                                                             new_args.at(3),
+                                                                             m_scale);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    // Query: [.., M, D], Key: [.., N, D], Value: [.., N, Dv] -> Output: [.., M, Dv]
+    const auto query_pshape = get_input_partial_shape(0);
+    const auto value_pshape = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this,
+        query_pshape.rank().is_static() && value_pshape.rank().is_static() &&
+        query_pshape.size() >= 3 && query_pshape.size() == value_pshape.size(),
+        "Query and value inputs must have equal static ranks not less than 3.");
+
+    ngraph::PartialShape output_pshape = query_pshape;
+    output_pshape[output_pshape.size() - 1] = value_pshape[value_pshape.size() - 1];
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    visitor.on_attribute("scale", m_scale);
+    return true;
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fused scaled dot-product attention: softmax(Q x K^T * scale [+ mask]) x V.
+ * Produced by the FuseScaledDotProductAttention transformation from the
+ * MatMul->Softmax->MatMul pattern; the CPU node executing it computes the
+ * softmax blockwise and never materializes the [.., seq, seq] score matrix.
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node>& query,
+                                  const ngraph::Output<Node>& key,
+                                  const ngraph::Output<Node>& value,
+                                  const float scale);
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node>& query,
+                                  const ngraph::Output<Node>& key,
+                                  const ngraph::Output<Node>& value,
+                                  const ngraph::Output<Node>& mask,
+                                  const float scale);
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+
+private:
+    float m_scale = 1.0f;
+};
+
+}  // namespace MKLDNNPlugin
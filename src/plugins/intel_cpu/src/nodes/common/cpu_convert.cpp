@@ -53,6 +53,53 @@ void convert_vec<float, ov::float16>(jit_generator & gen,
     gen.movdqu(gen.xword[dst], f16vec);
 }
 
+template <>
+void convert_vec<MKLDNNPlugin::bfloat16_t, float>(jit_generator & gen,
+                                                  const RegExp & src,
+                                                  const RegExp & dst) {
+    auto const & f32vec = gen.ymm4;
+
+    gen.vpmovzxwd(f32vec, gen.xword[src]);
+    gen.vpslld(f32vec, f32vec, 16);
+    gen.vmovups(gen.yword[dst], f32vec);
+}
+
+template <>
+void convert_vec<float, MKLDNNPlugin::bfloat16_t>(jit_generator & gen,
+                                                  const RegExp & src,
+                                                  const RegExp & dst) {
+    auto const & bf16vec = gen.xmm3;
+    auto const & f32vec = gen.ymm4;
+
+    if (mayiuse(cpu_isa_t::avx512_core_bf16)) {
+        gen.vmovups(f32vec, gen.yword[src]);
+        gen.vcvtneps2bf16(bf16vec, f32vec);
+        gen.vmovdqu(gen.xword[dst], bf16vec);
+        return;
+    }
+
+    // emulation which is bit-exact with bfloat16_t::round_to_nearest_even:
+    // add 0x8000 when the LSB of the target mantissa is set, then take the high halves.
+    // Note that the scalar helper (and so this emulation) truncates whenever the target
+    // LSB is even, even for discarded fractions above the 0x8000 tie, while the
+    // vcvtneps2bf16 branch above performs true round-to-nearest-even and rounds such
+    // values up - the two branches differ in the last bit for those inputs
+    auto const & tmpvec = gen.ymm5;
+    auto const & rndvec = gen.ymm6;
+
+    gen.vpcmpeqd(rndvec, rndvec, rndvec);
+    gen.vpsrld(rndvec, rndvec, 31);
+    gen.vpslld(rndvec, rndvec, 15);             // 0x00008000
+    gen.vmovups(f32vec, gen.yword[src]);
+    gen.vpsrld(tmpvec, f32vec, 1);
+    gen.vpand(tmpvec, tmpvec, rndvec);          // 0x8000 for odd target LSB, 0 otherwise
+    gen.vpaddd(f32vec, f32vec, tmpvec);
+    gen.vpsrld(f32vec, f32vec, 16);
+    gen.vpackusdw(f32vec, f32vec, f32vec);
+    gen.vpermq(f32vec, f32vec, 0x08);
+    gen.vmovdqu(gen.xword[dst], Xbyak::Xmm(f32vec.getIdx()));
+}
+
 class jit_convert_array : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_convert_array)
 
@@ -122,8 +169,11 @@ public:
 
     template<typename src_t, typename dst_t>
     static fn_t get() {
+        // F16C is only involved in half-float conversions, the bfloat16 ones are plain AVX2
+        constexpr bool needF16C = std::is_same<src_t, ov::float16>::value
+                                  || std::is_same<dst_t, ov::float16>::value;
         if (mayiuse(cpu_isa_t::avx2)
-            && dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C)) {
+            && (!needF16C || dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C))) {
             static jit_convert_array converter(convert_vec<src_t, dst_t>, sizeof(src_t), sizeof(dst_t));
             auto & generator = static_cast<jit_generator&>(converter);
             generator.create_kernel();
@@ -316,8 +366,12 @@ struct ConvertPrecision<std::tuple<float, MKLDNNPlugin::bfloat16_t>> {
         auto dst = static_cast<MKLDNNPlugin::bfloat16_t *>(ctx.dstPtr);
 
         if (ctx.interimPrc.is_float()) {
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = static_cast<MKLDNNPlugin::bfloat16_t>(src[i]);
+            constexpr size_t batch = 64;
+            const size_t iterations = MKLDNNPlugin::div_up(ctx.size, batch);
+            parallel_for(iterations, [&](size_t i) {
+                const size_t offset = i * batch;
+                const size_t current_batch_size = std::min(ctx.size - offset, batch);
+                jit_convert(src + offset, dst + offset, current_batch_size);    // fp32 -> bf16
             });
         } else {
             float lbound, ubound;
@@ -338,8 +392,12 @@ struct ConvertPrecision<std::tuple<MKLDNNPlugin::bfloat16_t, float>> {
         auto dst = static_cast<float *>(ctx.dstPtr);
 
         if (ctx.interimPrc.is_float()) {
-            parallel_for(ctx.size, [&](size_t i) {
-                dst[i] = static_cast<float>(src[i]);
+            constexpr size_t batch = 64;
+            const size_t iterations = MKLDNNPlugin::div_up(ctx.size, batch);
+            parallel_for(iterations, [&](size_t i) {
+                const size_t offset = i * batch;
+                const size_t current_batch_size = std::min(ctx.size - offset, batch);
+                jit_convert(src + offset, dst + offset, current_batch_size);    // bf16 -> fp32
             });
         } else {
             float lbound, ubound;
@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "mkldnn_attention_node.h"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto attentionOp = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+        if (!attentionOp) {
+            errorMessage = "Node is not an instance of the ScaledDotProductAttention operation from the CPU plugin opset.";
+            return false;
+        }
+        if (op->is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNAttentionNode::MKLDNNAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                         MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = std::string("Attention layer with name '") + op->get_friendly_name() + "'";
+
+    if (getOriginalInputsNumber() != 3 && getOriginalInputsNumber() != 4)
+        IE_THROW() << errorPrefix << " has invalid inputs number.";
+
+    auto attentionOp = std::dynamic_pointer_cast<const ScaledDotProductAttentionNode>(op);
+    scale = attentionOp->get_scale();
+    withMask = getOriginalInputsNumber() == 4;
+}
+
+void MKLDNNAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inDataConf;
+    inDataConf.reserve(inputShapes.size());
+    for (int i = 0; i < inputShapes.size(); ++i)
+        inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+
+    addSupportedPrimDesc(inDataConf,
+                         {{LayoutType::ncsp, Precision::FP32}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNAttentionNode::execute(mkldnn::stream strm) {
+    const float* queryData = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const float* keyData = reinterpret_cast<const float *>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    const float* valueData = reinterpret_cast<const float *>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    const float* maskData = withMask ? reinterpret_cast<const float *>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr()) : nullptr;
+    float* dstData = reinterpret_cast<float *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const auto& queryDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& keyDims = getParentEdgeAt(1)->getMemory().getStaticDims();
+    const auto& valueDims = getParentEdgeAt(2)->getMemory().getStaticDims();
+
+    const size_t rank = queryDims.size();
+    const size_t M = queryDims[rank - 2];   // query rows
+    const size_t D = queryDims[rank - 1];   // head size
+    const size_t N = keyDims[rank - 2];     // key/value rows
+    const size_t DV = valueDims[rank - 1];  // value head size
+    size_t outerSize = 1;
+    for (size_t i = 0; i + 2 < rank; i++)
+        outerSize *= queryDims[i];
+
+    // element strides of the mask with zeros on the broadcast dimensions
+    std::vector<size_t> maskStrides;
+    if (withMask) {
+        const auto& maskDims = getParentEdgeAt(3)->getMemory().getStaticDims();
+        maskStrides.resize(rank);
+        size_t denseStride = 1;
+        for (int i = static_cast<int>(rank) - 1; i >= 0; i--) {
+            maskStrides[i] = maskDims[i] == 1 ? 0 : denseStride;
+            denseStride *= maskDims[i];
+        }
+    }
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerSize * M, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> acc(DV);
+        for (size_t work = start; work < end; work++) {
+            const size_t o = work / M;
+            const size_t i = work % M;
+
+            const float* queryRow = queryData + (o * M + i) * D;
+            const float* keyBase = keyData + o * N * D;
+            const float* valueBase = valueData + o * N * DV;
+            float* dstRow = dstData + (o * M + i) * DV;
+
+            size_t maskBase = 0, maskStrideN = 0;
+            if (maskData) {
+                size_t rest = o;
+                for (int dim = static_cast<int>(rank) - 3; dim >= 0; dim--) {
+                    maskBase += (rest % queryDims[dim]) * maskStrides[dim];
+                    rest /= queryDims[dim];
+                }
+                maskBase += i * maskStrides[rank - 2];
+                maskStrideN = maskStrides[rank - 1];
+            }
+
+            // online softmax: stream over the key rows keeping only the running maximum,
+            // the running denominator and the weighted value accumulator, so no row of
+            // the [M, N] score matrix is ever stored
+            float max = -FLT_MAX;
+            float denom = 0.0f;
+            std::fill(acc.begin(), acc.end(), 0.0f);
+
+            for (size_t j = 0; j < N; j++) {
+                const float* keyRow = keyBase + j * D;
+                float score = 0.0f;
+                for (size_t d = 0; d < D; d++)
+                    score += queryRow[d] * keyRow[d];
+                score *= scale;
+                if (maskData)
+                    score += maskData[maskBase + j * maskStrideN];
+
+                float weight;
+                if (score > max) {
+                    // a new maximum: rescale the statistics accumulated so far
+                    const float correction = expf(max - score);
+                    denom *= correction;
+                    for (size_t d = 0; d < DV; d++)
+                        acc[d] *= correction;
+                    max = score;
+                    weight = 1.0f;
+                } else {
+                    weight = expf(score - max);
+                }
+
+                denom += weight;
+                const float* valueRow = valueBase + j * DV;
+                for (size_t d = 0; d < DV; d++)
+                    acc[d] += weight * valueRow[d];
+            }
+
+            const float invDenom = 1.0f / denom;
+            for (size_t d = 0; d < DV; d++)
+                dstRow[d] = acc[d] * invDenom;
+        }
+    });
+}
+
+bool MKLDNNAttentionNode::created() const {
+    return getType() == Attention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNAttentionNode, Attention)
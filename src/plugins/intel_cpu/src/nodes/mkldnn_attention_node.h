@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+// Fused scaled dot-product attention: softmax(Q x K^T * scale [+ mask]) x V.
+// The softmax is computed online per query row while streaming over the key/value
+// rows, so the [.., seq, seq] score matrix is never materialized: only the running
+// maximum, the running denominator and a head-sized accumulator live between the
+// key blocks, which keeps the working set inside the caches at long sequences.
+class MKLDNNAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool needPrepareParams() const override { return false; };
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    bool withMask = false;
+    float scale = 1.0f;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -213,6 +213,58 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
     }
+
+    // The inplace configs above require an input to be a contiguous slice of the output, which can
+    // never hold for the channels-last layout: the concat axis is the innermost dimension in memory.
+    // A channels-last input is still a valid strided view over the output though, so publish an
+    // inplace config whose input descs carry the output strides and the per-input channel offset.
+    // Since the strides are fully defined here, a producer which cannot write with the foreign
+    // channel stride gets bridged by a reorder writing straight into the destination slice, and the
+    // concat itself becomes a no-op instead of copying every input once more.
+    if (axis == channelAxis) {
+        int nspcRefIndex = -1;
+        for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+            if (supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::ref &&
+                supportedPrimitiveDescriptors[i].getConfig().outConfs[0].desc->hasLayoutType(LayoutType::nspc)) {
+                nspcRefIndex = static_cast<int>(i);
+                break;
+            }
+        }
+        if (nspcRefIndex >= 0) {
+            const auto& refConfig = supportedPrimitiveDescriptors[nspcRefIndex].getConfig();
+            auto config = refConfig;
+
+            const auto outBlockedDesc = refConfig.outConfs[0].desc->as<CpuBlockedMemoryDesc>();
+            const auto &order = outBlockedDesc->getOrder();
+            const auto &blkDims = outBlockedDesc->getBlockDims();
+            auto numOfDim = blkDims.size();
+
+            SizeVector offsets(numOfDim, 0lu);
+            SizeVector strides(numOfDim);
+            strides.back() = 1lu;
+            for (size_t i = 2; i <= numOfDim; i++) {
+                strides[numOfDim - i] = strides[numOfDim - i + 1] * blkDims[numOfDim - i + 1];
+            }
+
+            config.outConfs[0].desc = std::make_shared<CpuBlockedMemoryDesc>(outputPrecision, dstShape, blkDims, order, 0, offsets, strides);
+
+            size_t channelOffset = 0;
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                const auto inpBlockedDesc = refConfig.inConfs[i].desc->as<CpuBlockedMemoryDesc>();
+
+                config.inConfs[i].inPlace = 0;
+                config.inConfs[i].desc = std::make_shared<CpuBlockedMemoryDesc>(inputPrecision,
+                                                                                inpBlockedDesc->getShape(),
+                                                                                inpBlockedDesc->getBlockDims(),
+                                                                                order,
+                                                                                channelOffset,
+                                                                                offsets,
+                                                                                strides);
+                channelOffset += getInputShapeAtPort(i).getStaticDims()[channelAxis];
+            }
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        }
+    }
 }
 
 void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
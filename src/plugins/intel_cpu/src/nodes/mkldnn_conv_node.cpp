@@ -10,7 +10,10 @@
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_concat_node.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include <cstring>
+#include <limits>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
@@ -533,6 +536,101 @@ MKLDNNConvolutionNode::createDescriptorInternal(const mkldnn::memory::desc& inpu
     return conv_desc;
 }
 
+void MKLDNNConvolutionNode::selectAlgorithmEmpirically(std::chrono::microseconds& timeBudget) {
+    if (!implPriorities.empty())
+        return;  // an explicit primitives priority overrides the measured choice
+    if (isWino || isDynamicNode() || canBeExecutedInInt8())
+        return;
+    if (!mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_common))
+        return;
+    if (getOriginalInputPrecisionAtPort(0) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return;
+    // winograd supports only constant weights and bias
+    const bool hasBias = getOriginalInputsNumber() == 3;
+    if (!(getParentEdgeAt(1)->getParent()->isConstant() && getParentEdgeAt(1)->getParent()->getType() == Input))
+        return;
+    if (hasBias && !(getParentEdgeAt(2)->getParent()->isConstant() && getParentEdgeAt(2)->getParent()->getType() == Input))
+        return;
+    if (!getInputShapeAtPort(0).isStatic() || !getOutputShapeAtPort(0).isStatic())
+        return;
+
+    mkldnn::memory::desc srcDesc(MKLDNNExtensionUtils::convertToDnnlDims(getInputShapeAtPort(0).getStaticDims()),
+                                 memory::data_type::f32, memory::format_tag::any);
+    mkldnn::memory::desc dstDesc(MKLDNNExtensionUtils::convertToDnnlDims(getOutputShapeAtPort(0).getStaticDims()),
+                                 memory::data_type::f32, memory::format_tag::any);
+    mkldnn::memory::desc wghDesc(MKLDNNExtensionUtils::convertToDnnlDims(weightDims),
+                                 memory::data_type::f32, memory::format_tag::any);
+    mkldnn::memory::desc biasDesc;
+    if (hasBias)
+        biasDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(biasesDims),
+                                        memory::data_type::f32, memory::format_tag::any);
+
+    // runs the candidate on zero-filled scratch tensors a few times and reports the best
+    // observed time; the warm-up run absorbs the kernel generation cost
+    auto measure = [&](mkldnn::algorithm alg, double& bestUs) {
+        const auto start = std::chrono::steady_clock::now();
+        auto accountSpentTime = [&]() {
+            timeBudget -= std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        };
+        try {
+            std::shared_ptr<mkldnn::convolution_forward::desc> desc;
+            if (hasBias) {
+                desc = createDescriptorInternal(srcDesc, wghDesc, biasDesc, dstDesc, alg);
+            } else {
+                desc = createDescriptorInternal(srcDesc, wghDesc, dstDesc, alg);
+            }
+            convolution_forward::primitive_desc pd(*desc, getEngine());
+
+            auto makeZeroedMemory = [&](const mkldnn::memory::desc& md) {
+                mkldnn::memory mem(md, getEngine());
+                memset(mem.get_data_handle(), 0, md.get_size());
+                return mem;
+            };
+            auto src = makeZeroedMemory(pd.src_desc());
+            auto wgh = makeZeroedMemory(pd.weights_desc());
+            auto dst = makeZeroedMemory(pd.dst_desc());
+            std::unordered_map<int, mkldnn::memory> args = {{DNNL_ARG_SRC, src},
+                                                            {DNNL_ARG_WEIGHTS, wgh},
+                                                            {DNNL_ARG_DST, dst}};
+            if (hasBias)
+                args[DNNL_ARG_BIAS] = makeZeroedMemory(pd.bias_desc());
+
+            convolution_forward prim(pd);
+            mkldnn::stream stream(getEngine());
+
+            prim.execute(stream, args);
+            stream.wait();
+
+            bestUs = std::numeric_limits<double>::max();
+            for (int run = 0; run < 3; run++) {
+                const auto runStart = std::chrono::steady_clock::now();
+                prim.execute(stream, args);
+                stream.wait();
+                const auto now = std::chrono::steady_clock::now();
+                bestUs = std::min(bestUs,
+                                  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(now - runStart).count()));
+                if (now - start > timeBudget)
+                    break;
+            }
+            accountSpentTime();
+            return true;
+        } catch (...) {
+            accountSpentTime();
+            return false;
+        }
+    };
+
+    double winoUs = 0.0;
+    double directUs = 0.0;
+    if (timeBudget.count() <= 0 || !measure(mkldnn::algorithm::convolution_winograd, winoUs))
+        return;
+    if (timeBudget.count() <= 0 || !measure(mkldnn::algorithm::convolution_direct, directUs))
+        return;
+
+    isWino = winoUs < directUs;
+}
+
 void MKLDNNConvolutionNode::createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                                              const std::vector<MemoryDescPtr>& outputDesc) {
     MemoryDescPtr inpDesc;
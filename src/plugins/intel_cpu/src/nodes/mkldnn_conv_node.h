@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -61,6 +62,11 @@ public:
 
     bool isWinograd() const { return isWino; }
 
+    // Measures the candidate oneDNN algorithms on this node's actual shapes and keeps the
+    // fastest one (see ov::hint::empirical_algorithm_selection). Has to be called before
+    // getSupportedDescriptors(); the spent time is subtracted from timeBudget.
+    void selectAlgorithmEmpirically(std::chrono::microseconds& timeBudget);
+
 protected:
     InferenceEngine::Precision fusedEltwisePrecision(const MKLDNNNodePtr& fusingNode) const;
 
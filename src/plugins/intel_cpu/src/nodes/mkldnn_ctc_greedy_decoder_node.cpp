@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include <ngraph/op/ctc_greedy_decoder.hpp>
 #include "ie_parallel.hpp"
+#include "common/cpu_memcpy.h"
 #include "mkldnn_ctc_greedy_decoder_node.h"
 
 using namespace MKLDNNPlugin;
@@ -89,10 +91,48 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
         sequenceLengths[b] = t;
     });
 
+    // Streaming pipelines re-feed the whole accumulated sequence on every chunk, so the leading
+    // frames of the input are usually byte-identical to the previous inference. Find how many
+    // leading T-slabs match the cached copy: their argmax results in decodedClasses are still
+    // valid and the first stage below only has to decode the frames that follow.
+    size_t verifiedT = 0lu;
+    if (!cacheDisabled && cachedT > 0lu && cachedB == B && cachedC == C) {
+        const size_t slabCount = std::min(cachedT, T);
+        std::vector<size_t> firstMismatch(parallel_get_max_threads(), slabCount);
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start(0lu), end(0lu);
+            splitter(slabCount, nthr, ithr, start, end);
+            for (size_t t = start; t < end; t++) {
+                if (std::memcmp(probabilities + t * BC, cachedProbs.data() + t * BC, BC * sizeof(float)) != 0) {
+                    firstMismatch[ithr] = t;
+                    break;
+                }
+            }
+        });
+        verifiedT = slabCount;
+        for (size_t m : firstMismatch)
+            verifiedT = std::min(verifiedT, m);
+    }
+    if (!cacheDisabled && cachedT > 0lu) {
+        if (verifiedT == 0lu) {
+            if (++cacheMisses >= CACHE_MISS_LIMIT) {
+                cacheDisabled = true;
+                std::vector<float>().swap(cachedProbs);
+                cachedT = 0lu;
+            }
+        } else {
+            cacheMisses = 0lu;
+        }
+    }
+
     size_t workAmount = 0;
+    std::vector<size_t> reuseLengths(B, 0lu);
     for (size_t b = 0; b < B; b++) {
-        workAmount += sequenceLengths[b];
+        if (verifiedT > 0lu)
+            reuseLengths[b] = std::min(std::min(verifiedT, cachedSeqLengths[b]), sequenceLengths[b]);
+        workAmount += sequenceLengths[b] - reuseLengths[b];
     }
+    decodedClasses.resize(T * B);
 
     // Parallelization could not be made directly by T due to output index depends on merged classes and
     // blank index, thus could not be shared between threads. Better to divide operation on two steps.
@@ -105,9 +145,9 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
             return;
         size_t tStart = 0lu, bStart = 0lu;
         for (; bStart < B; bStart++) {
-            tStart += sequenceLengths[bStart];
+            tStart += sequenceLengths[bStart] - reuseLengths[bStart];
             if (tStart >= start) {
-                tStart = start - (tStart - sequenceLengths[bStart]);
+                tStart = start - (tStart - (sequenceLengths[bStart] - reuseLengths[bStart]));
                 break;
             }
         }
@@ -115,11 +155,11 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
         size_t workCounter = start;
 
         for (size_t b = bStart; b < B; ++b) {
-            size_t outputIndex = b * T + tStart;
-            const float* probs = probabilities + b * C + BC * tStart;
-            size_t sequenceLength = sequenceLengths[b];
+            size_t t = reuseLengths[b] + tStart;
+            const float* probs = probabilities + b * C + BC * t;
+            const size_t sequenceLength = sequenceLengths[b];
 
-            for (size_t t = tStart; t < sequenceLength; ++t) {
+            for (; t < sequenceLength; ++t) {
                 int maxClassIdx = 0;
 
                 float maxProb = probs[0];
@@ -132,7 +172,7 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
                     }
                 }
                 probs += CB1;
-                outputSequences[outputIndex++] = static_cast<float>(maxClassIdx);
+                decodedClasses[t * B + b] = static_cast<float>(maxClassIdx);
 
                 if (++workCounter >= end) {
                     return;
@@ -148,17 +188,26 @@ void MKLDNNCTCGreedyDecoderNode::execute(mkldnn::stream strm) {
         int prevClassIdx = -1;
         size_t outputIndex = b * T;
         const size_t sequenceLength = sequenceLengths[b];
-        float* shiftedOut = outputSequences + b * T;
         for (size_t t = 0; t < sequenceLength; ++t) {
-            if (*shiftedOut < blankIndex &&
-                !(mergeRepeated && *shiftedOut == prevClassIdx)) {
-                outputSequences[outputIndex++] = *shiftedOut;
+            const int classIdx = static_cast<int>(decodedClasses[t * B + b]);
+            if (classIdx < blankIndex &&
+                !(mergeRepeated && classIdx == prevClassIdx)) {
+                outputSequences[outputIndex++] = static_cast<float>(classIdx);
             }
-            prevClassIdx = *shiftedOut;
-            shiftedOut++;
+            prevClassIdx = classIdx;
         }
         std::fill(outputSequences + outputIndex, outputSequences + (b + 1) * T, -1.f);
     });
+
+    if (!cacheDisabled) {
+        // only the frames past the verified prefix have to be refreshed in the cached copy
+        cachedProbs.resize(T * BC);
+        cpu_memcpy(cachedProbs.data() + verifiedT * BC, probabilities + verifiedT * BC, (T - verifiedT) * BC * sizeof(float));
+        cachedSeqLengths = sequenceLengths;
+        cachedT = T;
+        cachedB = B;
+        cachedC = C;
+    }
 }
 
 bool MKLDNNCTCGreedyDecoderNode::created() const {
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -26,6 +27,21 @@ private:
     const size_t SEQUENCE_LENGTH_INDEX = 1lu;
     bool mergeRepeated;
 
+    // Incremental decode cache for streaming pipelines that re-feed the growing sequence on
+    // every chunk. Leading frames whose probability slabs are byte-identical to the previous
+    // inference skip the per-frame argmax, so the decode cost is dominated by the new frames
+    // only (see execute()). The cache turns itself off once several inferences in a row come
+    // with a completely new input, so one-shot workloads pay nothing for it.
+    std::vector<float> cachedProbs;
+    std::vector<float> decodedClasses;
+    std::vector<size_t> cachedSeqLengths;
+    size_t cachedT = 0lu;
+    size_t cachedB = 0lu;
+    int cachedC = 0;
+    size_t cacheMisses = 0lu;
+    bool cacheDisabled = false;
+    const size_t CACHE_MISS_LIMIT = 8lu;
+
     std::string errorPrefix;
 };
 
@@ -134,6 +134,9 @@ void MKLDNNDetectionOutputNode::prepareParams() {
 
     detectionsCount.resize(imgNum * classesNum);
     numPriorsActual.resize(imgNum);
+    // per-class NMS keeps at most topK detections, so the global topk map never grows beyond that
+    if (keepTopK > -1)
+        confIndicesClassMap.reserve(classesNum * (topK > -1 ? std::min(topK, priorsNum) : priorsNum));
 }
 
 void MKLDNNDetectionOutputNode::initSupportedPrimitiveDescriptors() {
@@ -303,7 +306,7 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            confIndicesClassMap.clear();
 
             std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
@@ -104,6 +104,7 @@ private:
     std::vector<float> bboxSizes;
     std::vector<int> numPriorsActual;
     std::vector<int> confInfoForPrior;
+    std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
 
     std::string errorPrefix;
 };
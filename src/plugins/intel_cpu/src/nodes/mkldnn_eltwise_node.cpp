@@ -17,6 +17,7 @@
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_input_node.h"
 #include "common/cpu_convert.h"
+#include "cache/global_jit_cache.h"
 
 #include "emitters/jit_emitter.hpp"
 #include "emitters/jit_eltwise_emitters.hpp"
@@ -1238,6 +1239,23 @@ public:
                 }
             }
 
+            // An input broadcast over both innermost axes (a [1, C, 1, 1] channel bias, a scalar
+            // constant) stays a zero-stride scalar after the fold, so it does not actually
+            // conflict with collapsing the dense inputs' spatial axes into one long row. Allow
+            // the fold when every input either fully indexes both axes or is broadcast over both:
+            // the kernel then processes the whole collapsed extent in a single call with the
+            // broadcast value preloaded, instead of being invoked per innermost row with index
+            // arithmetic in between. The conservative rule is kept with a fused FakeQuantize,
+            // whose per-channel offsets cannot be folded the same way.
+            if (!canCollapse && !isFusedWith(FakeQuantize)) {
+                canCollapse = std::all_of(inpDims.begin(), inpDims.end(), [&](const VectorDims& dims) {
+                    const bool fullPair = dims[dims.size() - 1] == jep.dims[jep.dims.size() - 1] &&
+                                          dims[dims.size() - 2] == jep.dims[jep.dims.size() - 2];
+                    const bool broadcastPair = dims[dims.size() - 1] == 1 && dims[dims.size() - 2] == 1;
+                    return fullPair || broadcastPair;
+                });
+            }
+
             if (!canCollapse) {
                 break;
             }
@@ -1334,17 +1352,24 @@ public:
 
                 std::vector<size_t> counters(dims_out.size() - 1, 0);
                 auto args = jit_eltwise_call_args_indexes();
-                for (size_t iwork = start; iwork < end; ++iwork) {
-                    size_t tmp = iwork;
-                    for (ptrdiff_t j = dims_out.size() - 2; j >= 0; j--) {
-                        counters[j] = tmp % dims_out[j];
-                        tmp /= dims_out[j];
-                    }
+                size_t tmp = start;
+                for (ptrdiff_t j = dims_out.size() - 2; j >= 0; j--) {
+                    counters[j] = tmp % dims_out[j];
+                    tmp /= dims_out[j];
+                }
 
+                for (size_t iwork = start; iwork < end; ++iwork) {
                     for (size_t j = 0; j < counters.size(); j++)
                         args.indexes[j] = counters[j];
 
                     (*_pKernel)(&args_ptrs, &args);
+
+                    // advance the multi-index with a carry instead of re-dividing iwork per row
+                    for (ptrdiff_t j = counters.size() - 1; j >= 0; j--) {
+                        if (++counters[j] < dims_out[j])
+                            break;
+                        counters[j] = 0;
+                    }
                 }
             });
         }
@@ -1942,8 +1967,10 @@ void MKLDNNEltwiseNode::prepareParams() {
     }
     // end of TODO
 
-    auto cache = getRuntimeCache();
-    auto result = cache->getOrCreate(key, buildExecutor);
+    // The key is address-free and the executors are stateless wrappers around xbyak-generated code,
+    // so they are looked up in the process-wide cache: all streams, graphs and networks loaded into
+    // the process share one compiled kernel per unique set of codegen parameters.
+    auto result = GlobalJitCache::getInstance().getOrCreate(key, buildExecutor);
     execPtr = result.first;
 }
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -11,6 +12,15 @@
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
 
+#if defined(__GNUC__)
+#    define EMB_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <xmmintrin.h>
+#    define EMB_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0)
+#else
+#    define EMB_PREFETCH(ptr)
+#endif
+
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
@@ -52,6 +62,20 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
 
     const size_t outputBagsNum = outDataDims[0];
 
+    // The table rows are gathered from random positions of a tensor that typically does
+    // not fit in cache, so each lookup pays the full DRAM latency. Prefetching the rows
+    // this many lookups ahead of the accumulation overlaps the misses; only the head of
+    // a wide row is requested - the hardware prefetcher streams in the sequential rest.
+    const size_t prefetchAhead = 16lu;
+    const size_t prefetchBytes = std::min(_embDepth * sizeof(T), static_cast<size_t>(256lu));
+    auto prefetchRow = [&](const int* indices, size_t indicesSize, size_t inIdx) {
+        if (inIdx < indicesSize && indices[inIdx] >= 0 && static_cast<size_t>(indices[inIdx]) < inDataDims[0]) {
+            const auto* row = reinterpret_cast<const uint8_t*>(srcData + indices[inIdx] * _embDepth);
+            for (size_t b = 0lu; b < prefetchBytes; b += 64lu)
+                EMB_PREFETCH(row + b);
+        }
+    };
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(outputBagsNum, nthr, ithr, start, end);
@@ -70,6 +94,9 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
+                for (size_t p = 0lu; p < prefetchAhead; p++)
+                    prefetchRow(indices, indicesSize, p);
+
                 size_t inIdx = 0lu;
                 if (indices[inIdx] >= inDataDims[0]) {
                     IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
@@ -91,6 +118,7 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
                     if (indices[inIdx] >= inDataDims[0]) {
                         IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                     }
+                    prefetchRow(indices, indicesSize, inIdx + prefetchAhead);
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
                     if (withWeights) {
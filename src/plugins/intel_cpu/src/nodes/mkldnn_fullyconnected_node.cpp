@@ -5,8 +5,11 @@
 #include "mkldnn_fullyconnected_node.h"
 #include "mkldnn_eltwise_node.h"
 #include "mkldnn_fake_quantize_node.h"
+#include "mkldnn_input_node.h"
+#include "ie_parallel.hpp"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -201,7 +204,293 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+constexpr float MKLDNNFullyConnectedNode::sparseRateThreshold;
+
+bool MKLDNNFullyConnectedNode::tryPrepareSparseWeights() {
+    // The dense GEMM gains nothing from pruning, so for constant weights whose zero rate is above
+    // the threshold the node packs them into CSR and executes its own kernel, cutting the FLOPs
+    // roughly proportionally to the sparsity. The dense path stays intact for everything else.
+    if (isDynamicNode() || !fusedWith.empty())
+        return false;
+    if (getInputShapeAtPort(WEIGHTS_ID).getRank() != 2)
+        return false;
+    if (getParentEdgeAt(DATA_ID)->getMemory().GetDataType() != memory::data_type::f32 ||
+        getChildEdgesAtPort(0)[0]->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+    if (withBiases && getParentEdgeAt(BIAS_ID)->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+
+    // the weights edge may carry a reordered (blocked) copy, so the plain data is taken from
+    // the original constant input instead
+    auto weightsParent = getParentEdgeAt(WEIGHTS_ID)->getParent();
+    while (weightsParent->getType() == Reorder)
+        weightsParent = weightsParent->getParentEdgeAt(0)->getParent();
+    const auto weightsNode = dynamic_cast<MKLDNNInputNode*>(weightsParent.get());
+    if (!weightsNode || !weightsNode->isConstant())
+        return false;
+    const auto weightsMem = weightsNode->getMemoryPtr();
+    if (weightsMem->GetDataType() != memory::data_type::f32)
+        return false;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const float* weights = reinterpret_cast<const float*>(weightsMem->GetPtr());
+
+    size_t zeroCount = 0;
+    for (size_t i = 0; i < OC * IC; i++) {
+        if (weights[i] == 0.0f)
+            zeroCount++;
+    }
+    if (static_cast<float>(zeroCount) < sparseRateThreshold * OC * IC)
+        return false;
+
+    sparseWeightValues.reserve(OC * IC - zeroCount);
+    sparseWeightColumns.reserve(OC * IC - zeroCount);
+    sparseWeightRowPtrs.assign(OC + 1, 0);
+    for (size_t oc = 0; oc < OC; oc++) {
+        const float* row = weights + oc * IC;
+        for (size_t ic = 0; ic < IC; ic++) {
+            if (row[ic] != 0.0f) {
+                sparseWeightValues.push_back(row[ic]);
+                sparseWeightColumns.push_back(static_cast<int32_t>(ic));
+            }
+        }
+        sparseWeightRowPtrs[oc + 1] = static_cast<int32_t>(sparseWeightValues.size());
+    }
+
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    float* dst = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr())
+                                   : nullptr;
+
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, (size_t)1, std::multiplies<size_t>());
+    const size_t OC = sparseWeightRowPtrs.size() - 1;
+
+    parallel_for2d(M, OC, [&](const size_t m, const size_t oc) {
+        const float* srcRow = src + m * IC;
+        float sum = bias ? bias[oc] : 0.0f;
+        for (int32_t i = sparseWeightRowPtrs[oc]; i < sparseWeightRowPtrs[oc + 1]; i++) {
+            sum += sparseWeightValues[i] * srcRow[sparseWeightColumns[i]];
+        }
+        dst[m * OC + oc] = sum;
+    });
+}
+
+bool MKLDNNFullyConnectedNode::tryPrepareDynamicQuantWeights() {
+    if (!dynamicQuantizationEnabled || !fusedWith.empty())
+        return false;
+    if (getInputShapeAtPort(WEIGHTS_ID).getRank() != 2)
+        return false;
+    if (getParentEdgeAt(DATA_ID)->getMemory().GetDataType() != memory::data_type::f32 ||
+        getChildEdgesAtPort(0)[0]->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+    if (withBiases && getParentEdgeAt(BIAS_ID)->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+
+    // the weights edge may carry a reordered (blocked) copy, so the plain data is taken from
+    // the original constant input instead
+    auto weightsParent = getParentEdgeAt(WEIGHTS_ID)->getParent();
+    while (weightsParent->getType() == Reorder)
+        weightsParent = weightsParent->getParentEdgeAt(0)->getParent();
+    const auto weightsNode = dynamic_cast<MKLDNNInputNode*>(weightsParent.get());
+    if (!weightsNode || !weightsNode->isConstant())
+        return false;
+    const auto weightsMem = weightsNode->getMemoryPtr();
+    if (weightsMem->GetDataType() != memory::data_type::f32)
+        return false;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const float* weights = reinterpret_cast<const float*>(weightsMem->GetPtr());
+
+    // symmetric per-output-channel quantization: scale = absmax / 127, so no zero points are needed
+    // and -128 never appears in the packed weights
+    dynQuantWeights.resize(OC * IC);
+    dynQuantWeightScales.resize(OC);
+    parallel_for(OC, [&](const size_t oc) {
+        const float* row = weights + oc * IC;
+        float absMax = 0.0f;
+        for (size_t ic = 0; ic < IC; ic++)
+            absMax = std::max(absMax, std::abs(row[ic]));
+        const float scale = absMax / 127.0f;
+        dynQuantWeightScales[oc] = scale;
+        const float invScale = scale != 0.0f ? 1.0f / scale : 0.0f;
+        for (size_t ic = 0; ic < IC; ic++)
+            dynQuantWeights[oc * IC + ic] = static_cast<int8_t>(std::lround(row[ic] * invScale));
+    });
+
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::executeDynamicQuant() {
+    const auto& srcMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    float* dst = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr())
+                                   : nullptr;
+
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, (size_t)1, std::multiplies<size_t>());
+    const size_t OC = dynQuantWeightScales.size();
+
+    dynQuantSrcData.resize(M * IC);
+    dynQuantSrcScales.resize(M);
+
+    parallel_for(M, [&](const size_t m) {
+        const float* srcRow = src + m * IC;
+        int8_t* quantRow = dynQuantSrcData.data() + m * IC;
+        float absMax = 0.0f;
+        for (size_t ic = 0; ic < IC; ic++)
+            absMax = std::max(absMax, std::abs(srcRow[ic]));
+        const float scale = absMax / 127.0f;
+        dynQuantSrcScales[m] = scale;
+        const float invScale = scale != 0.0f ? 1.0f / scale : 0.0f;
+        for (size_t ic = 0; ic < IC; ic++)
+            quantRow[ic] = static_cast<int8_t>(std::lround(srcRow[ic] * invScale));
+    });
+
+    parallel_for2d(M, OC, [&](const size_t m, const size_t oc) {
+        const int8_t* srcRow = dynQuantSrcData.data() + m * IC;
+        const int8_t* weightRow = dynQuantWeights.data() + oc * IC;
+        int32_t sum = 0;
+        for (size_t ic = 0; ic < IC; ic++)
+            sum += static_cast<int32_t>(srcRow[ic]) * weightRow[ic];
+        float res = sum * dynQuantSrcScales[m] * dynQuantWeightScales[oc];
+        if (bias)
+            res += bias[oc];
+        dst[m * OC + oc] = res;
+    });
+}
+
+constexpr size_t MKLDNNFullyConnectedNode::int4GroupSize;
+
+bool MKLDNNFullyConnectedNode::tryPrepareInt4Weights() {
+    if (!int4WeightCompressionEnabled || !fusedWith.empty())
+        return false;
+    if (getInputShapeAtPort(WEIGHTS_ID).getRank() != 2)
+        return false;
+    if (getParentEdgeAt(DATA_ID)->getMemory().GetDataType() != memory::data_type::f32 ||
+        getChildEdgesAtPort(0)[0]->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+    if (withBiases && getParentEdgeAt(BIAS_ID)->getMemory().GetDataType() != memory::data_type::f32)
+        return false;
+
+    // the weights edge may carry a reordered (blocked) copy, so the plain data is taken from
+    // the original constant input instead
+    auto weightsParent = getParentEdgeAt(WEIGHTS_ID)->getParent();
+    while (weightsParent->getType() == Reorder)
+        weightsParent = weightsParent->getParentEdgeAt(0)->getParent();
+    const auto weightsNode = dynamic_cast<MKLDNNInputNode*>(weightsParent.get());
+    if (!weightsNode || !weightsNode->isConstant())
+        return false;
+    const auto weightsMem = weightsNode->getMemoryPtr();
+    if (weightsMem->GetDataType() != memory::data_type::f32)
+        return false;
+
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    // two codes per byte, so an odd IC would need tail handling that is not worth the branch
+    if (IC % 2 != 0)
+        return false;
+    const float* weights = reinterpret_cast<const float*>(weightsMem->GetPtr());
+
+    const size_t numGroups = div_up(IC, int4GroupSize);
+    int4Weights.resize(OC * IC / 2);
+    int4WeightScales.resize(OC * numGroups);
+
+    // symmetric group-wise quantization: scale = absmax / 7, codes in [-7, 7] stored as
+    // two's complement nibbles (low nibble holds the even input channel)
+    parallel_for(OC, [&](const size_t oc) {
+        const float* row = weights + oc * IC;
+        for (size_t g = 0; g < numGroups; g++) {
+            const size_t begin = g * int4GroupSize;
+            const size_t end = std::min(begin + int4GroupSize, IC);
+            float absMax = 0.0f;
+            for (size_t ic = begin; ic < end; ic++)
+                absMax = std::max(absMax, std::abs(row[ic]));
+            const float scale = absMax / 7.0f;
+            int4WeightScales[oc * numGroups + g] = scale;
+            const float invScale = scale != 0.0f ? 1.0f / scale : 0.0f;
+            for (size_t ic = begin; ic < end; ic += 2) {
+                const int8_t lo = static_cast<int8_t>(std::lround(row[ic] * invScale));
+                const int8_t hi = static_cast<int8_t>(std::lround(row[ic + 1] * invScale));
+                int4Weights[(oc * IC + ic) / 2] = static_cast<uint8_t>((lo & 0x0F) | (hi << 4));
+            }
+        }
+    });
+
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::executeInt4() {
+    const auto& srcMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    float* dst = reinterpret_cast<float*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemory().GetPtr())
+                                   : nullptr;
+
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t IC = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, (size_t)1, std::multiplies<size_t>());
+    const size_t numGroups = div_up(IC, int4GroupSize);
+    const size_t OC = int4WeightScales.size() / numGroups;
+
+    parallel_for2d(M, OC, [&](const size_t m, const size_t oc) {
+        const float* srcRow = src + m * IC;
+        const uint8_t* weightRow = int4Weights.data() + oc * IC / 2;
+        float sum = bias ? bias[oc] : 0.0f;
+        for (size_t g = 0; g < numGroups; g++) {
+            const size_t begin = g * int4GroupSize;
+            const size_t end = std::min(begin + int4GroupSize, IC);
+            float partial = 0.0f;
+            for (size_t ic = begin; ic < end; ic += 2) {
+                const uint8_t code = weightRow[ic / 2];
+                // shift-left then arithmetic shift-right sign-extends the nibble
+                const int8_t lo = static_cast<int8_t>(code << 4) >> 4;
+                const int8_t hi = static_cast<int8_t>(code) >> 4;
+                partial += srcRow[ic] * lo + srcRow[ic + 1] * hi;
+            }
+            sum += partial * int4WeightScales[oc * numGroups + g];
+        }
+        dst[m * OC + oc] = sum;
+    });
+}
+
 void MKLDNNFullyConnectedNode::prepareParams() {
+    if (!sparseWeightsChecked) {
+        sparseWeightsChecked = true;
+        useSparseWeights = tryPrepareSparseWeights();
+    }
+    if (useSparseWeights)
+        return;
+
+    // the exact sparse kernel takes precedence over both lossy modes; int4 wins over int8
+    // dynamic quantization when both are requested since it exists for memory capacity
+    if (!int4WeightsChecked) {
+        int4WeightsChecked = true;
+        useInt4Weights = tryPrepareInt4Weights();
+    }
+    if (useInt4Weights)
+        return;
+
+    if (!dynQuantWeightsChecked) {
+        dynQuantWeightsChecked = true;
+        useDynamicQuant = tryPrepareDynamicQuantWeights();
+    }
+    if (useDynamicQuant)
+        return;
+
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
@@ -223,6 +512,8 @@ void MKLDNNFullyConnectedNode::prepareParams() {
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
     AttrPtr attr = std::make_shared<mkldnn::primitive_attr>();
+    // scratch memory comes from the graph-wide arena instead of a buffer owned by the primitive
+    attr->set_scratchpad_mode(mkldnn::scratchpad_mode::user);
     setPostOps(*attr, dstMemPtr->getStaticDims());
 
     DnnlMemoryDescCPtr weightDesc = wghMemPtr->GetDescWithType<DnnlMemoryDesc>();
@@ -307,6 +598,8 @@ void MKLDNNFullyConnectedNode::prepareParams() {
         primArgs[DNNL_ARG_BIAS] = biasMemPtr->GetPrimitive();
     }
 
+    prepareScratchPadMem(*prim);
+
     appendPostOpArgs(*attr, primArgs, binaryPostOpsArgs);
 
     auto reshapeMemory = [this](int argType) {
@@ -327,6 +620,21 @@ void MKLDNNFullyConnectedNode::prepareParams() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (useSparseWeights) {
+        executeSparse();
+        return;
+    }
+
+    if (useInt4Weights) {
+        executeInt4();
+        return;
+    }
+
+    if (useDynamicQuant) {
+        executeDynamicQuant();
+        return;
+    }
+
     if (prim) {
         // in cases parameter -> FullyConnected or dynamic shapes
         // we keep old pointer to data in primArgs on second iteration with same input shapes
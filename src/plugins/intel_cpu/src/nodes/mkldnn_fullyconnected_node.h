@@ -63,8 +63,42 @@ private:
 
     void setPostOps(mkldnn::primitive_attr &attr, const VectorDims &dims, bool initWeights = false);
 
+    bool tryPrepareSparseWeights();
+    void executeSparse();
+
+    bool tryPrepareDynamicQuantWeights();
+    void executeDynamicQuant();
+
+    bool tryPrepareInt4Weights();
+    void executeInt4();
+
     bool withBiases = false;
 
+    // CSR representation of heavily pruned constant weights (see tryPrepareSparseWeights)
+    bool sparseWeightsChecked = false;
+    bool useSparseWeights = false;
+    std::vector<float> sparseWeightValues;
+    std::vector<int32_t> sparseWeightColumns;
+    std::vector<int32_t> sparseWeightRowPtrs;
+    static constexpr float sparseRateThreshold = 0.8f;
+
+    // int8 copy of constant weights with per-output-channel scales; activations are quantized
+    // per row at execution time (see tryPrepareDynamicQuantWeights)
+    bool dynQuantWeightsChecked = false;
+    bool useDynamicQuant = false;
+    std::vector<int8_t> dynQuantWeights;
+    std::vector<float> dynQuantWeightScales;
+    std::vector<int8_t> dynQuantSrcData;
+    std::vector<float> dynQuantSrcScales;
+
+    // int4 copy of constant weights, two codes per byte along IC, with one scale per
+    // int4GroupSize input channels of every output channel (see tryPrepareInt4Weights)
+    bool int4WeightsChecked = false;
+    bool useInt4Weights = false;
+    std::vector<uint8_t> int4Weights;
+    std::vector<float> int4WeightScales;
+    static constexpr size_t int4GroupSize = 64;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
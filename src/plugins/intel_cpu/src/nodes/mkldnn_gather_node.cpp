@@ -116,7 +116,28 @@ bool MKLDNNGatherNode::needPrepareParams() const {
     return result;
 }
 
-void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+template <typename dataType>
+void MKLDNNGatherNode::gatherElementwise() {
+    const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
+    const dataType* srcData = reinterpret_cast<const dataType*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
+    dataType* dstData = reinterpret_cast<dataType*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    parallel_for2d(batchSize, outerSize, [&](const size_t i, const size_t k) {
+        const int32_t* idxBase = srcIndexes + i * idxBatchStride;
+        const dataType* src = srcData + i * srcBatchStride + k * indexRange;
+        dataType* dst = dstData + i * dstBatchStride + k * idxBatchStride;
+
+        // Tight branchless loop over the indices: the compiler turns it into masked vector gathers,
+        // which is much faster than a cpu_memcpy call per single element.
+        for (size_t j = 0; j < idxBatchStride; ++j) {
+            const uint32_t idx = static_cast<uint32_t>(idxBase[j]);
+            // while negative indices are not supported, should set zero
+            dst[j] = idx < indexRange ? src[idx] : static_cast<dataType>(0);
+        }
+    });
+}
+
+void MKLDNNGatherNode::gatherBlocks() {
     const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
@@ -140,6 +161,22 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
     });
 }
 
+void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    // Single-element payloads (gather along the innermost axis) are the embedding-lookup pattern,
+    // where the per-index copy overhead of the generic path dominates. They are dispatched to a
+    // vectorizable elementwise implementation by the element size, which covers fp32/i32 (4 bytes),
+    // bf16/fp16 (2 bytes), i8/u8 (1 byte) and i64/fp64 (8 bytes) data.
+    if (dataLength == 1) {
+        switch (dataSize) {
+            case sizeof(uint64_t): gatherElementwise<uint64_t>(); return;
+            case sizeof(uint32_t): gatherElementwise<uint32_t>(); return;
+            case sizeof(uint16_t): gatherElementwise<uint16_t>(); return;
+            case sizeof(uint8_t):  gatherElementwise<uint8_t>();  return;
+        }
+    }
+    gatherBlocks();
+}
+
 void MKLDNNGatherNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
@@ -29,6 +29,10 @@ protected:
     void prepareParams() override;
 
 private:
+    template <typename dataType>
+    void gatherElementwise();
+    void gatherBlocks();
+
     int axis = 0;
     int batchDims = 0;
 
@@ -80,59 +80,17 @@ MKLDNNIfNode::MKLDNNIfNode(const std::shared_ptr<ov::Node>& op, const mkldnn::en
 void MKLDNNIfNode::getSupportedDescriptors() {
     auto ifOp = ov::as_type_ptr<ov::op::v8::If>(ovOp);
 
-    const std::shared_ptr<const ov::Model>& thenBody = ifOp->get_then_body();
-    const std::shared_ptr<const ov::Model>& elseBody = ifOp->get_else_body();
-    subGraphThen.CreateGraph(thenBody, ext_mng, weightCache);
-    subGraphElse.CreateGraph(elseBody, ext_mng, weightCache);
-
-    const auto &inMapThen = subGraphThen.GetInputNodesMap();
-    for (const auto &param : ifOp->get_then_body()->get_parameters()) {
-        auto inNode = inMapThen.find(param->get_friendly_name());
-        if (inNode != inMapThen.end()) {
-            inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
-        } else {
-            IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
-                    << param->get_friendly_name();
-        }
-    }
-
-    const auto &inMapElse = subGraphElse.GetInputNodesMap();
-    for (const auto &param : ifOp->get_else_body()->get_parameters()) {
-        auto inNode = inMapElse.find(param->get_friendly_name());
-        if (inNode != inMapElse.end()) {
-            inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
-        } else {
-            IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
-                    << param->get_friendly_name();
-        }
-    }
-
-    const auto &outMapThen = subGraphThen.GetOutputNodesMap();
-    for (const auto& out : ifOp->get_then_body()->get_results()) {
-        const auto prev = out->input_value(0);
-        const std::string inputID = ngraph::op::util::get_ie_output_name(prev);
-        auto outNode = outMapThen.find(inputID);
-        if (outNode != outMapThen.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            outputMemThen.push_back(outMem);
-        } else {
-            IE_THROW() << "Then body of node If with name " << getName() << " does not have output with name: "
-                    << inputID;
-        }
-    }
-
-    const auto &outMapElse = subGraphElse.GetOutputNodesMap();
-    for (const auto& out : ifOp->get_else_body()->get_results()) {
-        const auto prev = out->input_value(0);
-        const std::string inputID = ngraph::op::util::get_ie_output_name(prev);
-        auto outNode = outMapElse.find(inputID);
-        if (outNode != outMapElse.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            outputMemElse.push_back(outMem);
-        } else {
-            IE_THROW() << "Else body of node If with name " << getName() << " does not have output with name: "
-                    << inputID;
-        }
+    // An optional hint naming the branch that runs almost always: only that body is
+    // compiled and allocated at load time, the cold body is built on its first use.
+    const auto& rtInfo = ifOp->get_rt_info();
+    if (rtInfo.count("hotBranch")) {
+        const auto hot = rtInfo.at("hotBranch").as<std::string>();
+        if (hot != "then" && hot != "else")
+            IE_THROW() << "If node with name '" << getName() << "' has invalid hotBranch hint: " << hot;
+        buildBody(hot == "then");
+    } else {
+        buildBody(true);
+        buildBody(false);
     }
 
     // Port map: outputs
@@ -186,12 +144,55 @@ void MKLDNNIfNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MKLDNNIfNode::buildBody(const bool isThen) {
+    auto ifOp = ov::as_type_ptr<ov::op::v8::If>(ovOp);
+
+    const std::shared_ptr<const ov::Model>& body = isThen ? ifOp->get_then_body() : ifOp->get_else_body();
+    auto& subGraph = isThen ? subGraphThen : subGraphElse;
+    auto& inputMems = isThen ? inputMemThen : inputMemElse;
+    auto& outputMems = isThen ? outputMemThen : outputMemElse;
+    const std::string bodyName = isThen ? "Then" : "Else";
+
+    subGraph.CreateGraph(body, ext_mng, weightCache);
+
+    const auto &inMap = subGraph.GetInputNodesMap();
+    for (const auto &param : body->get_parameters()) {
+        auto inNode = inMap.find(param->get_friendly_name());
+        if (inNode != inMap.end()) {
+            inputMems.push_back(getToMemories(inNode->second.get(), 0));
+        } else {
+            IE_THROW() << bodyName << " body of node If with name " << getName() << " does not have input with name: "
+                    << param->get_friendly_name();
+        }
+    }
+
+    const auto &outMap = subGraph.GetOutputNodesMap();
+    for (const auto& out : body->get_results()) {
+        const auto prev = out->input_value(0);
+        const std::string inputID = ngraph::op::util::get_ie_output_name(prev);
+        auto outNode = outMap.find(inputID);
+        if (outNode != outMap.end()) {
+            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            outputMems.push_back(outMem);
+        } else {
+            IE_THROW() << bodyName << " body of node If with name " << getName() << " does not have output with name: "
+                    << inputID;
+        }
+    }
+
+    (isThen ? thenBodyBuilt : elseBodyBuilt) = true;
+}
+
 void MKLDNNIfNode::createPrimitive() {
     const auto& eng = getEngine();
-    prepareBeforeMappers(true, eng);
-    prepareBeforeMappers(false, eng);
-    prepareAfterMappers(true, eng);
-    prepareAfterMappers(false, eng);
+    if (thenBodyBuilt) {
+        prepareBeforeMappers(true, eng);
+        prepareAfterMappers(true, eng);
+    }
+    if (elseBodyBuilt) {
+        prepareBeforeMappers(false, eng);
+        prepareAfterMappers(false, eng);
+    }
 
     if (inputShapesDefined()) {
         updateLastInputDims();
@@ -232,6 +233,14 @@ std::deque<MKLDNNMemoryPtr> MKLDNNIfNode::getToMemories(const MKLDNNNode* node,
 void MKLDNNIfNode::execute(mkldnn::stream strm) {
     const bool condition = static_cast<const bool>((reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()))[0]);
 
+    // the cold branch of a hinted If is compiled and allocated on its first (rare) use
+    if (!(condition ? thenBodyBuilt : elseBodyBuilt)) {
+        buildBody(condition);
+        const auto& eng = getEngine();
+        prepareBeforeMappers(condition, eng);
+        prepareAfterMappers(condition, eng);
+    }
+
     auto& beforeMappers = condition ? beforeThenMappers : beforeElseMappers;
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
     auto& subGraph = condition ? subGraphThen : subGraphElse;
@@ -33,6 +33,7 @@ protected:
     bool needShapeInfer() const override { return false; }
 
 private:
+    void buildBody(const bool isThen);
     void prepareBeforeMappers(const bool isThen, const dnnl::engine& eng);
     void prepareAfterMappers(const bool isThen, const dnnl::engine& eng);
 
@@ -76,6 +77,11 @@ private:
         elseInputPortMap,
         elseOutputPortMap;
 
+    // with a "hotBranch" rt_info hint only the named branch is compiled at load time;
+    // the cold body is built (graph, memory, mappers) on its first actual execution
+    bool thenBodyBuilt = false;
+    bool elseBodyBuilt = false;
+
     const std::shared_ptr<ov::Node> ovOp;
 };
 
@@ -5,6 +5,7 @@
 #include "mkldnn_input_node.h"
 #include "common/cpu_memcpy.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_weights_cache.hpp"
 
 #include <string>
 #include <tuple>
@@ -330,12 +331,16 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
         return false;
     };
 
-    auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
-        return getName()
-                + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+    auto blobKey = [&] () {
+        // Content-based key: byte-identical constants with the same target layout are
+        // shared between nodes and models instead of being cloned per node.
+        const uint64_t data_hash = MKLDNNWeightsSharing::GetHashFunc().hash(
+                reinterpret_cast<const unsigned char *>(constOp->get_data_ptr()), constOp->get_byte_size());
+        return std::string("constant_") + prec.name()
+                + "_" + shape.toString()
+                + "_" + memDesc.serializeFormat()
+                + "_" + std::to_string(constOp->get_byte_size())
+                + "_" + std::to_string(data_hash);
     };
 
     if (weightCache) {
@@ -367,6 +372,10 @@ void MKLDNNInputNode::withMeanImage() {
     isMeanImage = true;
 }
 
+void MKLDNNInputNode::withExternalChannelsLast() {
+    externalChannelsLast = true;
+}
+
 MKLDNNMemoryCPtr MKLDNNInputNode::getMemoryPtr() const {
     return memoryPtr;
 }
@@ -398,6 +407,14 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
             precision = Precision::FP32;
         }
 
+        // When the user blob is channels-last, advertise the matching nspc descriptor first,
+        // so that the blob memory is mapped directly and the layout change (if consumers
+        // still need one) is performed by an in-graph reorder instead of an extra copy
+        // on the infer request boundary
+        if (externalChannelsLast && getParentEdges().empty()) {
+            addSupportedPrimDesc({}, {{LayoutType::nspc, precision}}, impl_desc_type::unknown);
+        }
+
         outPortConfs.push_back({LayoutType::ncsp, precision});
         if (!getParentEdges().empty()) {
             inPortConfs.push_back({LayoutType::ncsp, precision, true});
@@ -406,6 +423,10 @@ void MKLDNNInputNode::initSupportedPrimitiveDescriptors() {
         auto precision = getOriginalInputPrecisionAtPort(0);
         if (precision == Precision::U16) precision = Precision::FP32;
 
+        if (externalChannelsLast) {
+            addSupportedPrimDesc({{LayoutType::nspc, precision}}, {}, impl_desc_type::unknown);
+        }
+
         inPortConfs.push_back({LayoutType::ncsp, precision});
     }
 
@@ -23,6 +23,7 @@ public:
     bool created() const override;
 
     void withMeanImage();
+    void withExternalChannelsLast();
     MKLDNNMemoryCPtr getMemoryPtr() const;
 
     void executeDynamicImpl(mkldnn::stream strm) override {}
@@ -40,6 +41,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> constOp;
     MKLDNNMemoryCPtr memoryPtr;
     bool isMeanImage = false;
+    bool externalChannelsLast = false;
 };
 
 }  // namespace MKLDNNPlugin
@@ -2123,7 +2123,12 @@ void MKLDNNInterpolateNode::prepareParams() {
 
     auto buildExecutor = [&](const InterpolateKey& key) -> std::shared_ptr<InterpolateExecutor> {
         std::shared_ptr<InterpolateExecutor> executor;
-        if ((key.nodeAttrs.mode == InterpolateMode::nearest || key.nodeAttrs.mode == InterpolateMode::linear_onnx ||
+        if (isReplicationCase(key.nodeAttrs, key.srcDims, key.dstDims) && (*key.attr.get()).post_ops_.len() == 0) {
+            executor = std::make_shared<InterpolateReplicateExecutor>(key.nodeAttrs,
+                                                                      key.srcDims,
+                                                                      key.dstDims,
+                                                                      key.dataScales);
+        } else if ((key.nodeAttrs.mode == InterpolateMode::nearest || key.nodeAttrs.mode == InterpolateMode::linear_onnx ||
             key.nodeAttrs.mode == InterpolateMode::cubic) &&
             ((key.nodeAttrs.layout != InterpolateLayoutType::planar && mayiuse(cpu::x64::sse41)) ||
                 (mayiuse(cpu::x64::avx2) && key.nodeAttrs.inPrc == Precision::FP32))) {
@@ -3344,6 +3349,85 @@ MKLDNNInterpolateNode::InterpolateExecutor::InterpolateExecutor(const Interpolat
     }
 }
 
+// Nearest resize degrades to plain replication when every spatial axis is upscaled by a whole factor s
+// and the produced mapping is exactly index = floor(o / s). The latter holds for the combinations below:
+// with the asymmetric (i = o / s) and tf_half_pixel_for_nn (i = (o + 0.5) / s) transforms the floor
+// rounding lands on floor(o / s) directly, while with (pytorch_)half_pixel (i = (o + 0.5) / s - 0.5) the
+// fractional part stays strictly inside (-0.5, 0.5), so every round-to-nearest flavour collapses to
+// floor(o / s) as well.
+bool MKLDNNInterpolateNode::isReplicationCase(const InterpolateAttrs& attrs, const VectorDims& srcDims, const VectorDims& dstDims) {
+    if (attrs.mode != InterpolateMode::nearest || attrs.layout == InterpolateLayoutType::block)
+        return false;
+    // the executor copies raw pixels, any precision works as long as it is preserved
+    if (attrs.inPrc != attrs.outPrc)
+        return false;
+    for (size_t i = 0; i < attrs.padBegin.size(); i++)
+        if (attrs.padBegin[i] != 0)
+            return false;
+    for (size_t i = 0; i < attrs.padEnd.size(); i++)
+        if (attrs.padEnd[i] != 0)
+            return false;
+    if (srcDims.size() != dstDims.size() || srcDims.size() < 3)
+        return false;
+    if (srcDims[0] != dstDims[0] || srcDims[1] != dstDims[1])
+        return false;
+    for (size_t i = 2; i < srcDims.size(); i++) {
+        if (srcDims[i] == 0 || dstDims[i] < srcDims[i] || dstDims[i] % srcDims[i] != 0)
+            return false;
+    }
+
+    return ((attrs.coordTransMode == InterpolateCoordTransMode::asymmetric ||
+             attrs.coordTransMode == InterpolateCoordTransMode::tf_half_pixel_for_nn) &&
+            attrs.nearestMode == InterpolateNearestMode::floor) ||
+           ((attrs.coordTransMode == InterpolateCoordTransMode::half_pixel ||
+             attrs.coordTransMode == InterpolateCoordTransMode::pytorch_half_pixel) &&
+            (attrs.nearestMode == InterpolateNearestMode::round_prefer_floor ||
+             attrs.nearestMode == InterpolateNearestMode::round_prefer_ceil));
+}
+
+void MKLDNNInterpolateNode::InterpolateReplicateExecutor::replicatePlane(const uint8_t *in_plane, uint8_t *out_plane,
+                                                                         size_t IH, size_t IW, size_t sy, size_t sx, size_t pixelSize) {
+    const size_t outRowSize = IW * sx * pixelSize;
+    for (size_t ih = 0; ih < IH; ih++) {
+        const uint8_t *in_row = in_plane + ih * IW * pixelSize;
+        uint8_t *out_row = out_plane + ih * sy * outRowSize;
+        if (sx == 1) {
+            cpu_memcpy(out_row, in_row, outRowSize);
+        } else {
+            for (size_t iw = 0; iw < IW; iw++) {
+                for (size_t r = 0; r < sx; r++) {
+                    cpu_memcpy(out_row + (iw * sx + r) * pixelSize, in_row + iw * pixelSize, pixelSize);
+                }
+            }
+        }
+        for (size_t r = 1; r < sy; r++) {
+            cpu_memcpy(out_row + r * outRowSize, out_row, outRowSize);
+        }
+    }
+}
+
+void MKLDNNInterpolateNode::InterpolateReplicateExecutor::exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) {
+    size_t N = srcDimPad5d[0], C = srcDimPad5d[1], ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
+    size_t OD = dstDim5d[2];
+    const size_t sz = OD / ID;
+    const size_t sy = dstDim5d[3] / IH;
+    const size_t sx = dstDim5d[4] / IW;
+
+    if (configured_for_layout == InterpolateLayoutType::planar) {
+        parallel_for3d(N, C, OD, [&](size_t b, size_t c, size_t od) {
+            const uint8_t *in_plane = in_ptr_ + ((b * C + c) * ID + od / sz) * IH * IW * srcDataSize;
+            uint8_t *out_plane = out_ptr_ + ((b * C + c) * OD + od) * IH * sy * IW * sx * dstDataSize;
+            replicatePlane(in_plane, out_plane, IH, IW, sy, sx, srcDataSize);
+        });
+    } else {  // by_channel, the C lowest dimension makes a pixel a contiguous chunk of C elements
+        parallel_for2d(N, OD, [&](size_t b, size_t od) {
+            const uint8_t *in_plane = in_ptr_ + (b * ID + od / sz) * IH * IW * C * srcDataSize;
+            uint8_t *out_plane = out_ptr_ + (b * OD + od) * IH * sy * IW * sx * C * dstDataSize;
+            replicatePlane(in_plane, out_plane, IH, IW, sy, sx, C * srcDataSize);
+        });
+    }
+}
+
 MKLDNNInterpolateNode::InterpolateJitExecutor::InterpolateJitExecutor(const InterpolateAttrs& interpAttrs,
                                                                       const VectorDims &srcDims,
                                                                       const VectorDims &dstDims,
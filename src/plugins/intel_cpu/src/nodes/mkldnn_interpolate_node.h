@@ -200,6 +200,27 @@ private:
             std::shared_ptr<jit_uni_interpolate_kernel> interpolateKernel = nullptr;
     };
 
+    // Nearest mode with whole integer upscale factors and a floor-like coordinate mapping degrades to
+    // pure pixel replication: every input pixel is copied sx times along W and each produced row sy
+    // times along H, so neither coordinate computation nor the per-pixel index gather is needed.
+    // Selected automatically from the static attributes, see isReplicationCase().
+    class InterpolateReplicateExecutor : public InterpolateExecutor {
+        public:
+            InterpolateReplicateExecutor(const InterpolateAttrs& interpAttrs,
+                                         const VectorDims &srcDims,
+                                         const VectorDims &dstDims,
+                                         const std::vector<float> &dataScales) :
+                InterpolateExecutor(interpAttrs, srcDims, dstDims, dataScales) {}
+
+            void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) override;
+
+        private:
+            void replicatePlane(const uint8_t *in_plane, uint8_t *out_plane, size_t IH, size_t IW,
+                                size_t sy, size_t sx, size_t pixelSize);
+    };
+
+    static bool isReplicationCase(const InterpolateAttrs& attrs, const VectorDims& srcDims, const VectorDims& dstDims);
+
     class InterpolateRefExecutor : public InterpolateExecutor {
         public:
             InterpolateRefExecutor(const InterpolateAttrs& interpAttrs,
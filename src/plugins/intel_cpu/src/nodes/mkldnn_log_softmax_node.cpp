@@ -93,13 +93,18 @@ void MKLDNNLogSoftmaxNode::execute(mkldnn::stream strm) {
             float *dstDataPtr = &dstData[i * reducedAxisSize];
 
             float reduceProd = 0.0f;
-            const float max = *std::max_element(srcDataPtr, srcDataPtr + reducedAxisSize);
+            float max = std::numeric_limits<float>::lowest();
+            for (size_t j = 0; j < reducedAxisSize; ++j) {
+                if (srcDataPtr[j] * inputScale > max)
+                    max = srcDataPtr[j] * inputScale;
+            }
+
             for (size_t j = 0; j < reducedAxisSize; ++j)
-                reduceProd += expf(srcDataPtr[j] - max);
+                reduceProd += expf(srcDataPtr[j] * inputScale - max);
 
             reduceProd = logf(reduceProd);
             for (size_t j = 0; j < reducedAxisSize; ++j)
-                dstDataPtr[j] = srcDataPtr[j] - max - reduceProd;
+                dstDataPtr[j] = srcDataPtr[j] * inputScale - max - reduceProd;
         });
     } else {
         parallel_for2d(axisStep, reducedAxisStride, [&](size_t k, size_t i) {
@@ -109,16 +114,16 @@ void MKLDNNLogSoftmaxNode::execute(mkldnn::stream strm) {
             float reduceProd = 0.0f;
             float max = std::numeric_limits<float>::min();
             for (size_t j = 0; j < reducedAxisSize; ++j) {
-                if (srcDataPtr[j * reducedAxisStride] > max)
-                    max = srcDataPtr[j * reducedAxisStride];
+                if (srcDataPtr[j * reducedAxisStride] * inputScale > max)
+                    max = srcDataPtr[j * reducedAxisStride] * inputScale;
             }
 
             for (size_t j = 0; j < reducedAxisSize; ++j)
-                reduceProd += expf(srcDataPtr[j * reducedAxisStride] - max);
+                reduceProd += expf(srcDataPtr[j * reducedAxisStride] * inputScale - max);
 
             reduceProd = logf(reduceProd);
             for (size_t j = 0; j < reducedAxisSize; ++j)
-                dstDataPtr[j * reducedAxisStride] = srcDataPtr[j * reducedAxisStride] - max - reduceProd;
+                dstDataPtr[j * reducedAxisStride] = srcDataPtr[j * reducedAxisStride] * inputScale - max - reduceProd;
         });
     }
 }
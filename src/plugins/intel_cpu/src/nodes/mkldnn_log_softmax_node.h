@@ -24,8 +24,15 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    // folds a preceding multiplication by a scalar (e.g. a temperature divisor) into the
+    // single log-softmax pass; used by the graph optimizer
+    void fuseInputScale(float scale) {
+        inputScale *= scale;
+    }
+
 private:
     int axis;
+    float inputScale = 1.0f;
     size_t reducedAxisSize = 0;
     size_t reducedAxisStride = 1;
     size_t axisStep = 1;
@@ -175,6 +175,9 @@ void MKLDNNMatMulNode::setPostOps(mkldnn::primitive_attr &attr, const VectorDims
 MKLDNNNode::AttrPtr MKLDNNMatMulNode::initPrimitiveAttr(const VectorDims &dims) {
     auto attr = std::make_shared<mkldnn::primitive_attr>(mkldnn::primitive_attr());
 
+    // scratch memory comes from the graph-wide arena instead of a buffer owned by the primitive
+    attr->set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+
     setPostOps(*attr, dims, true);
 
     return attr;
@@ -485,6 +488,8 @@ void MKLDNNMatMulNode::prepareParams() {
     if (withBiases)
         primArgs[DNNL_ARG_BIAS] = getParentEdgeAt(2)->getMemoryPtr()->GetPrimitive();
 
+    prepareScratchPadMem(*prim);
+
     appendPostOpArgs(*attr, primArgs, binaryPostOpsArgs);
 }
 
@@ -95,6 +95,15 @@ static inline bool isFloatCompatible(memory::data_type type) {
     return memory::data_type::f32 == type || memory::data_type::bf16 == type;
 }
 
+// The single-pass form sum((x-mean)^2) == sum(x^2) - N*mean^2 subtracts two nearly equal numbers
+// when the data mean dominates its spread (e.g. LayerNorm activations with a large offset); once
+// most mantissa bits cancel the fp32 difference is noise. The estimate is trusted only while the
+// subtraction retains a safe share of sum(x^2), otherwise the caller recomputes the variance with
+// the two-pass kernel.
+static inline bool isSinglePassVarianceAccurate(float variance_sum, float sqsum) {
+    return variance_sum >= 0.01f * sqsum;
+}
+
 // normalize_variance = false : src->mean
 // normalize_variance = true : src+mean->variance:sqr(x-mean)
 template <cpu_isa_t isa>
@@ -120,6 +129,10 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
         } else {
             mov(reg_sum, ptr[reg_params + GET_OFF(sum)]);
             uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+            if (jcp_.single_pass) {
+                mov(reg_variance, ptr[reg_params + GET_OFF(variance)]);
+                uni_vpxor(vmm_variance, vmm_variance, vmm_variance);
+            }
         }
         mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
         mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
@@ -147,26 +160,10 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
             // hsum+store
             if (!jcp_.normalize_variance && !isFloatCompatible(jcp_.src_prc))
                 uni_vcvtdq2ps(vmm_sum, vmm_sum);
-            Vmm vmm_dst = jcp_.normalize_variance ? vmm_variance : vmm_sum;
-            if (isa == cpu::x64::sse41) {
-                hsum_store(vmm_dst);
-            } else if (isa == cpu::x64::avx2) {
-                Xbyak::Ymm ymm_sum = Xbyak::Ymm(vmm_dst.getIdx());
-                vextractf128(xmm_aux1, ymm_sum, 0);
-                vextractf128(xmm_aux2, ymm_sum, 1);
-                uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
-                hsum_store(xmm_aux1);
-            } else {
-                Xbyak::Zmm zmm_sum = Xbyak::Zmm(vmm_dst.getIdx());
-                vextractf32x4(xmm_aux1, zmm_sum, 0);
-                vextractf32x4(xmm_aux2, zmm_sum, 1);
-                uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
-                vextractf32x4(xmm_aux2, zmm_sum, 2);
-                vextractf32x4(xmm_aux3, zmm_sum, 3);
-                uni_vaddps(xmm_aux2, xmm_aux2, xmm_aux3);
-                uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
-                hsum_store(xmm_aux1);
-            }
+            reduce_sum_store(jcp_.normalize_variance ? vmm_variance : vmm_sum,
+                             jcp_.normalize_variance ? reg_variance : reg_sum);
+            if (jcp_.single_pass)
+                reduce_sum_store(vmm_variance, reg_variance);
         } else {
             // blk+nspc
             int repeats = (isa == cpu::x64::sse41) ? 2 : 1; // block size is also 8 on cpu::x64::sse41 with two step process
@@ -192,6 +189,10 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
                         // sum for mean kernel
                         add(reg_sum, offset_sse42 * sizeof(float));
                         uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+                        if (jcp_.single_pass) {
+                            add(reg_variance, offset_sse42 * sizeof(float));
+                            uni_vpxor(vmm_variance, vmm_variance, vmm_variance);
+                        }
                     }
                     add(reg_oc_off, offset_sse42 * sizeof(float));
                 }
@@ -242,6 +243,13 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
                         uni_vaddps(vmm_sum, vmm_sum, vmm_val);
                     }
                     uni_vmovups(ptr[reg_sum], vmm_sum);
+                    if (jcp_.single_pass) {
+                        if (!jcp_.across_channels) {
+                            uni_vmovups(vmm_val, ptr[reg_variance]);
+                            uni_vaddps(vmm_variance, vmm_variance, vmm_val);
+                        }
+                        uni_vmovups(ptr[reg_variance], vmm_variance);
+                    }
                 }
 
                 L(label_empty_2half_sse42);
@@ -308,6 +316,8 @@ private:
                 uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
             else
                 uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            if (jcp_.single_pass)
+                uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
         }
     }
 
@@ -330,6 +340,8 @@ private:
                 uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
             else
                 uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            if (jcp_.single_pass)
+                uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
         }
     }
 
@@ -390,19 +402,39 @@ private:
                 uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
             else
                 uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            if (jcp_.single_pass)
+                uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
         }
     }
 
-    inline void hsum_store(Xbyak::Xmm xmm_sum) {
+    inline void reduce_sum_store(Vmm vmm_src, Xbyak::Reg64 reg_dst) {
+        if (isa == cpu::x64::sse41) {
+            hsum_store(Xbyak::Xmm(vmm_src.getIdx()), reg_dst);
+        } else if (isa == cpu::x64::avx2) {
+            Xbyak::Ymm ymm_sum = Xbyak::Ymm(vmm_src.getIdx());
+            vextractf128(xmm_aux1, ymm_sum, 0);
+            vextractf128(xmm_aux2, ymm_sum, 1);
+            uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1, reg_dst);
+        } else {
+            Xbyak::Zmm zmm_sum = Xbyak::Zmm(vmm_src.getIdx());
+            vextractf32x4(xmm_aux1, zmm_sum, 0);
+            vextractf32x4(xmm_aux2, zmm_sum, 1);
+            uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
+            vextractf32x4(xmm_aux2, zmm_sum, 2);
+            vextractf32x4(xmm_aux3, zmm_sum, 3);
+            uni_vaddps(xmm_aux2, xmm_aux2, xmm_aux3);
+            uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
+            hsum_store(xmm_aux1, reg_dst);
+        }
+    }
+
+    inline void hsum_store(Xbyak::Xmm xmm_sum, Xbyak::Reg64 reg_dst) {
         uni_vmovshdup(xmm_aux3, xmm_sum);  //  sum:1,2,3,4; aux3:2,2,4,4
         uni_vaddps(xmm_sum, xmm_sum, xmm_aux3);     //  sum:1+2,2+2,3+4,4+4
         uni_vmovhlps(xmm_aux3, xmm_aux3, xmm_sum);   //  aux3:3+4,4+4,4,4
         uni_vaddps(xmm_sum, xmm_sum,  xmm_aux3);     //  sum:1+2+3+4,...
-        if (jcp_.normalize_variance) {
-            uni_vmovss(ptr[reg_variance], xmm_sum);
-        } else {
-            uni_vmovss(ptr[reg_sum], xmm_sum);
-        }
+        uni_vmovss(ptr[reg_dst], xmm_sum);
     }
 };
 
@@ -850,6 +882,15 @@ MKLDNNMVNNode::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
     jcp.planar_layout = mvnAttrs.planar_layout;
     jcp.normalize_variance = mvnAttrs.normalizeVariance_;
     jcp.across_channels = mvnAttrs.execAcrossChannels_;
+    // with a float compatible source the mean kernel accumulates the sum of squares along with
+    // the sum, so the source is normally read twice instead of three times (variance is restored
+    // as E[x^2] - mean^2 on the host side). That subtraction cancels catastrophically when the
+    // data mean dominates its spread, so the dedicated variance kernel is still generated as a
+    // two-pass fallback and engaged when the host-side check detects cancellation. For int-family
+    // sources the sum is accumulated in integers and squares would overflow, so they always take
+    // the separate pass.
+    jcp.single_pass = mvnAttrs.normalizeVariance_ && isFloatCompatible(jcp.src_prc);
+    singlePass = jcp.single_pass;
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = mvnAttrs.shape5D;
     if (mayiuse(cpu::x64::avx512_common)) {
@@ -858,6 +899,7 @@ MKLDNNMVNNode::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
+            jcp.single_pass = false;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
         }
     } else if (mayiuse(cpu::x64::avx2)) {
@@ -866,6 +908,7 @@ MKLDNNMVNNode::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
+            jcp.single_pass = false;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
         }
     } else if (mayiuse(cpu::x64::sse41)) {
@@ -874,6 +917,7 @@ MKLDNNMVNNode::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
         if (mvnAttrs.normalizeVariance_) {
             jcp.normalize_variance = true;
+            jcp.single_pass = false;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
         }
     } else {
@@ -1055,16 +1099,21 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* ds
             // Parallel sum for each channel
             float C3inv = 1.f / static_cast<float>(C3);
             float mean_temp = 0.0f;
+            std::vector<float> sqsum_buffer(singlePass ? parallel_get_num_threads() : 0, 0.f);
             mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
                 float mean_internal = 0.0f;
+                float sqsum_internal = 0.0f;
                 size_t cc = cb + c * C2;
                 auto arg = jit_mvn_call_args();
                 arg.src = src_data + cc * src_data_size;
                 arg.sum = static_cast<float*>(&mean_internal);
+                arg.variance = static_cast<float*>(&sqsum_internal);
                 arg.src_stride = src_stride_size;
                 arg.work_amount = static_cast<size_t>(C2 / blk_size); // for vector part
                 arg.post_op_data = post_ops_data_;
                 (*mvn_mean_kernel)(&arg);
+                if (singlePass)
+                    sqsum_buffer[parallel_get_thread_num()] += sqsum_internal;
                 return mean_internal;
             });
 
@@ -1074,19 +1123,31 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* ds
             // parallel sum for each channel
             if (mvnAttrs.normalizeVariance_) {
                 float variance_temp = 0.0f;
-                variance_temp = parallel_sum(C, variance_temp, [&](size_t c)->float {
-                    float variance_internal = 0.0f;
-                    size_t cc = cb + c * C2;
-                    auto arg = jit_mvn_call_args();
-                    arg.src = src_data + cc * src_data_size;
-                    arg.mean = static_cast<float*>(&mean);
-                    arg.variance = static_cast<float*>(&variance_internal);
-                    arg.src_stride = src_stride_size;
-                    arg.work_amount = static_cast<size_t>(C2 / blk_size);  // vector part
-                    arg.post_op_data = post_ops_data_;
-                    (*mvn_variance_kernel)(&arg);
-                    return variance_internal;
-                });
+                bool singlePassAccurate = false;
+                if (singlePass) {
+                    // sum((x-mean)^2) == sum(x^2) - N * mean^2
+                    float sqsum = 0.0f;
+                    for (size_t i = 0; i < sqsum_buffer.size(); i++)
+                        sqsum += sqsum_buffer[i];
+                    variance_temp = (std::max)(sqsum - static_cast<float>(C3) * mean * mean, 0.f);
+                    singlePassAccurate = isSinglePassVarianceAccurate(variance_temp, sqsum);
+                }
+                if (!singlePassAccurate) {
+                    variance_temp = 0.0f;
+                    variance_temp = parallel_sum(C, variance_temp, [&](size_t c)->float {
+                        float variance_internal = 0.0f;
+                        size_t cc = cb + c * C2;
+                        auto arg = jit_mvn_call_args();
+                        arg.src = src_data + cc * src_data_size;
+                        arg.mean = static_cast<float*>(&mean);
+                        arg.variance = static_cast<float*>(&variance_internal);
+                        arg.src_stride = src_stride_size;
+                        arg.work_amount = static_cast<size_t>(C2 / blk_size);  // vector part
+                        arg.post_op_data = post_ops_data_;
+                        (*mvn_variance_kernel)(&arg);
+                        return variance_internal;
+                    });
+                }
 
                 float variance = 1.f;
                 if (mvnAttrs.epsMode_ == INSIDE_SQRT)
@@ -1129,12 +1190,14 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* ds
             parallel_for(C, [&](size_t c) {
                 // mean for this channel
                 float mean = 0.f;
+                float sqsum = 0.f;
                 size_t cc = cb + c * C2;
                 // the same arg for three kernels
                 auto arg = jit_mvn_call_args();
                 arg.src = src_data + cc * src_data_size;
                 arg.dst = dst_data + cc * dst_data_size;
                 arg.sum = static_cast<float*>(&mean);
+                arg.variance = static_cast<float*>(&sqsum);
                 arg.src_stride = src_stride_size;
                 arg.dst_stride = dst_stride_size;
                 arg.work_amount = static_cast<size_t>(C2 / blk_size);
@@ -1147,9 +1210,17 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* ds
                 if (mvnAttrs.normalizeVariance_) {
                     // variance for this channel
                     float variance = 0.f;
+                    bool singlePassAccurate = false;
                     arg.mean = static_cast<float*>(&mean);
                     arg.variance = static_cast<float*>(&variance);
-                    (*mvn_variance_kernel)(&arg);
+                    if (singlePass) {
+                        variance = (std::max)(sqsum - static_cast<float>(C2) * mean * mean, 0.f);
+                        singlePassAccurate = isSinglePassVarianceAccurate(variance, sqsum);
+                    }
+                    if (!singlePassAccurate) {
+                        variance = 0.f;
+                        (*mvn_variance_kernel)(&arg);
+                    }
 
                     if (mvnAttrs.epsMode_ == INSIDE_SQRT)
                         variance = 1.f / sqrtf(variance * C2inv + mvnAttrs.epsValue_);
@@ -1299,6 +1370,7 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
             // mean for this instance in batch
             float C5inv = 1.f / static_cast<float>(C5);
             float mean_temp = 0.0f;
+            std::vector<float> sqsum_buffer(singlePass ? threads_num : 0, 0.f);
             mean_temp = parallel_sum3d(CB, D, H, mean_temp, [&](size_t cb, size_t d, size_t h)->float {
                 size_t src_offset = mvnAttrs.is_nhwc ? b_offset + d * C1 + h * C0 + cb * blk_size
                                             : b_offset + cb * C2 + d * C1 + h * C0;
@@ -1314,12 +1386,14 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
                 //                      // \|/
                 /////////////////////////////////
                 auto mean_buffer_ptr = &mean_buffer[blk_size * parallel_get_thread_num()];
+                auto sqsum_buffer_ptr = &variance_buffer[blk_size * parallel_get_thread_num()];
                 for (int i = 0; i < blk_size; i++)
                     mean_buffer_ptr[i] = 0.f;
 
                 auto arg = jit_mvn_call_args();
                 arg.src = src_data + src_offset * src_data_size;
                 arg.sum = mean_buffer_ptr;
+                arg.variance = sqsum_buffer_ptr;
                 arg.src_stride = src_stride_size;
                 arg.work_amount = static_cast<size_t>(W);
                 arg.oc_off = static_cast<size_t>(cb * blk_size * sizeof(float));  // for tail process
@@ -1328,6 +1402,12 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
                 size_t min_cb = (std::min)(blk_size, C - cb * blk_size);
                 for (int i = 0; i < min_cb; i++)
                     mean_internal += mean_buffer_ptr[i];
+                if (singlePass) {
+                    float sqsum_internal = 0.0f;
+                    for (int i = 0; i < min_cb; i++)
+                        sqsum_internal += sqsum_buffer_ptr[i];
+                    sqsum_buffer[parallel_get_thread_num()] += sqsum_internal;
+                }
                 return mean_internal;
             });
             float mean = mean_temp * C5inv;
@@ -1335,30 +1415,42 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
             if (mvnAttrs.normalizeVariance_) {
                 // variance: sum((x-mean)*(x-mean)) for one instance in batch
                 float variance_temp = 0.0f;
-                variance_temp = parallel_sum3d(CB, D, H, variance_temp, [&](size_t cb, size_t d, size_t h)->float {
-                    size_t src_offset = mvnAttrs.is_nhwc ? b_offset + d * C1 + h * C0 + cb * blk_size
-                                                : b_offset + cb * C2 + d * C1 + h * C0;
+                bool singlePassAccurate = false;
+                if (singlePass) {
+                    // sum((x-mean)^2) == sum(x^2) - N * mean^2
+                    float sqsum = 0.0f;
+                    for (size_t i = 0; i < sqsum_buffer.size(); i++)
+                        sqsum += sqsum_buffer[i];
+                    variance_temp = (std::max)(sqsum - static_cast<float>(C5) * mean * mean, 0.f);
+                    singlePassAccurate = isSinglePassVarianceAccurate(variance_temp, sqsum);
+                }
+                if (!singlePassAccurate) {
+                    variance_temp = 0.0f;
+                    variance_temp = parallel_sum3d(CB, D, H, variance_temp, [&](size_t cb, size_t d, size_t h)->float {
+                        size_t src_offset = mvnAttrs.is_nhwc ? b_offset + d * C1 + h * C0 + cb * blk_size
+                                                    : b_offset + cb * C2 + d * C1 + h * C0;
 
-                    float variance_internal = 0.0f;
-                    auto variance_buffer_ptr = &variance_buffer[blk_size * parallel_get_thread_num()];
-                    for (int i = 0; i < blk_size; i++)
-                        variance_buffer_ptr[i] = 0.f;
+                        float variance_internal = 0.0f;
+                        auto variance_buffer_ptr = &variance_buffer[blk_size * parallel_get_thread_num()];
+                        for (int i = 0; i < blk_size; i++)
+                            variance_buffer_ptr[i] = 0.f;
 
-                    auto arg = jit_mvn_call_args();
-                    arg.src = src_data + src_offset * src_data_size;
-                    arg.mean = static_cast<float*>(&mean);
-                    arg.variance = variance_buffer_ptr;
-                    arg.src_stride = src_stride_size;
-                    arg.work_amount = static_cast<size_t>(W);
-                    arg.oc_off = cb * blk_size * sizeof(float);
-                    arg.post_op_data = post_ops_data_;
-                    (*mvn_variance_kernel)(&arg);
+                        auto arg = jit_mvn_call_args();
+                        arg.src = src_data + src_offset * src_data_size;
+                        arg.mean = static_cast<float*>(&mean);
+                        arg.variance = variance_buffer_ptr;
+                        arg.src_stride = src_stride_size;
+                        arg.work_amount = static_cast<size_t>(W);
+                        arg.oc_off = cb * blk_size * sizeof(float);
+                        arg.post_op_data = post_ops_data_;
+                        (*mvn_variance_kernel)(&arg);
 
-                    size_t min_cb = (std::min)(blk_size, C - cb * blk_size);
-                    for (int i = 0; i < min_cb; i++)
-                        variance_internal += variance_buffer_ptr[i];
-                    return variance_internal;
-                });
+                        size_t min_cb = (std::min)(blk_size, C - cb * blk_size);
+                        for (int i = 0; i < min_cb; i++)
+                            variance_internal += variance_buffer_ptr[i];
+                        return variance_internal;
+                    });
+                }
 
                 float variance = 1.f;
                 if (mvnAttrs.epsMode_ == INSIDE_SQRT)
@@ -1402,6 +1494,10 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
             float size_inv = 1.f / static_cast<float>(D * H * W);
             for (int i = 0; i < mean_buffer.size(); i++)
                 mean_buffer[i] = 0.f;
+            if (singlePass) {
+                for (int i = 0; i < variance_buffer.size(); i++)
+                    variance_buffer[i] = 0.f;
+            }
 
             // one thread for one C*W size(the same H) to get C size result for the same H, added to last group result
             // keep the compute order the same as planar
@@ -1414,6 +1510,7 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
                     auto arg = jit_mvn_call_args();
                     arg.src = src_data + src_offset * src_data_size;
                     arg.sum = mean_buffer_ptr;
+                    arg.variance = &variance_buffer[blk_size * cb + aux_buffer_size * thr_idx];
                     arg.src_stride = src_stride_size;
                     arg.work_amount = static_cast<size_t>(W);
                     arg.oc_off = cb * blk_size * sizeof(float);
@@ -1430,36 +1527,57 @@ void MKLDNNMVNNode::MVNJitExecutor::mvn_blk(const uint8_t* src_data, uint8_t* ds
                 mean_buffer[c] *= size_inv;
 
             if (mvnAttrs.normalizeVariance_) {
-                for (int i = 0; i < variance_buffer.size(); i++)
-                    variance_buffer[i] = 0.f;
-
-                parallel_for2d(D, H, [&](size_t thr_idx, size_t d, size_t h) {
-                    for (size_t cb = 0; cb < CB; cb++) {
-                        size_t src_offset = mvnAttrs.is_nhwc ? b_offset + d * C1 + h * C0 + cb * blk_size
-                                                    : b_offset + cb * C2 + d * C1 + h * C0;
-                        auto mean_buffer_ptr = &mean_buffer[blk_size * cb];
-                        auto variance_buffer_ptr = &variance_buffer[blk_size * cb + aux_buffer_size * thr_idx];
-
-                        auto arg = jit_mvn_call_args();
-                        arg.src = src_data + src_offset * src_data_size;
-                        arg.mean = mean_buffer_ptr;
-                        arg.variance = variance_buffer_ptr;
-                        arg.src_stride = src_stride_size;
-                        arg.work_amount = static_cast<size_t>(W);
-                        arg.oc_off = cb * blk_size * sizeof(float);
-                        arg.post_op_data = post_ops_data_;
-                        (*mvn_variance_kernel)(&arg);
+                bool twoPass = !singlePass;
+                if (singlePass) {
+                    for (size_t i = 1; i < threads_num; i++) {
+                        for (size_t c = 0; c < C; c++)
+                            variance_buffer[c] += variance_buffer[c + aux_buffer_size * i];
+                    }
+                    // the buffer holds sum(x^2), restore sum((x-mean)^2)/N per channel; the whole
+                    // estimate is discarded when any channel cancels, since the fallback kernel
+                    // sweeps all channels anyway
+                    for (size_t c = 0; c < C; c++) {
+                        const float sqsum = variance_buffer[c] * size_inv;
+                        variance_buffer[c] = (std::max)(sqsum - mean_buffer[c] * mean_buffer[c], 0.f);
+                        if (!isSinglePassVarianceAccurate(variance_buffer[c], sqsum))
+                            twoPass = true;
+                    }
+                }
+                if (twoPass) {
+                    for (int i = 0; i < variance_buffer.size(); i++)
+                        variance_buffer[i] = 0.f;
+
+                    parallel_for2d(D, H, [&](size_t thr_idx, size_t d, size_t h) {
+                        for (size_t cb = 0; cb < CB; cb++) {
+                            size_t src_offset = mvnAttrs.is_nhwc ? b_offset + d * C1 + h * C0 + cb * blk_size
+                                                        : b_offset + cb * C2 + d * C1 + h * C0;
+                            auto mean_buffer_ptr = &mean_buffer[blk_size * cb];
+                            auto variance_buffer_ptr = &variance_buffer[blk_size * cb + aux_buffer_size * thr_idx];
+
+                            auto arg = jit_mvn_call_args();
+                            arg.src = src_data + src_offset * src_data_size;
+                            arg.mean = mean_buffer_ptr;
+                            arg.variance = variance_buffer_ptr;
+                            arg.src_stride = src_stride_size;
+                            arg.work_amount = static_cast<size_t>(W);
+                            arg.oc_off = cb * blk_size * sizeof(float);
+                            arg.post_op_data = post_ops_data_;
+                            (*mvn_variance_kernel)(&arg);
+                        }
+                    });
+                    for (size_t i = 1; i < threads_num; i++) {
+                        for (size_t c = 0; c < C; c++)
+                            variance_buffer[c] += variance_buffer[c + aux_buffer_size * i];
                     }
-                });
-                for (size_t i = 1; i < threads_num; i++) {
                     for (size_t c = 0; c < C; c++)
-                        variance_buffer[c] += variance_buffer[c + aux_buffer_size * i];
+                        variance_buffer[c] *= size_inv;
                 }
                 for (size_t c = 0; c < C; c++) {
+                    // variance_buffer now holds sum((x-mean)^2)/N for both paths
                     if (mvnAttrs.epsMode_ == INSIDE_SQRT)
-                        variance_buffer[c] = 1.f / sqrtf(variance_buffer[c] * size_inv + mvnAttrs.epsValue_);
+                        variance_buffer[c] = 1.f / sqrtf(variance_buffer[c] + mvnAttrs.epsValue_);
                     else if (mvnAttrs.epsMode_ == OUTSIDE_SQRT)
-                        variance_buffer[c] = 1.f / (sqrtf(variance_buffer[c] * size_inv) + mvnAttrs.epsValue_);
+                        variance_buffer[c] = 1.f / (sqrtf(variance_buffer[c]) + mvnAttrs.epsValue_);
                 }
 
                 parallel_for2d(D, H, [&](size_t d, size_t h) {
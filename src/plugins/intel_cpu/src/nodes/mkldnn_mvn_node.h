@@ -16,6 +16,7 @@ struct jit_mvn_config_params {
     bool planar_layout;
     bool across_channels;
     bool normalize_variance;
+    bool single_pass;  // mean kernel also accumulates the sum of squares to skip the variance pass
     InferenceEngine::Precision src_prc;
     InferenceEngine::Precision dst_prc;
     int src_data_size;
@@ -151,6 +152,7 @@ private:
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_mean_kernel;
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_variance_kernel;
             std::shared_ptr<jit_uni_mvn_kernel> mvn_kernel;
+            bool singlePass = false;
     };
 
     class MVNRefExecutor : public MVNExecutor {
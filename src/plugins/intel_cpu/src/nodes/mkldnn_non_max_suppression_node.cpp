@@ -881,11 +881,13 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);  // score, box_id, suppress_begin_index
+        std::vector<boxInfo> candidateBoxes;
         for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
             if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                candidateBoxes.push_back(boxInfo({scoresPtr[box_idx], box_idx, 0}));
         }
+        // heapify in O(N) instead of N pushes; score, box_id, suppress_begin_index
+        std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less, std::move(candidateBoxes));
         size_t sortedBoxSize = sorted_boxes.size();
         size_t maxSeletedBoxNum = std::min(sortedBoxSize, maxOutputBoxesPerClass);
         selectedBoxes.reserve(maxSeletedBoxNum);
@@ -999,24 +1001,36 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            // Selection usually terminates at maxOutputBoxesPerClass long before the tail of the candidate
+            // list is reached, so pop the candidates lazily from a heap instead of fully sorting them.
+            // The examination order stays strictly score descending with box index as a tie-breaker,
+            // so the produced selection is identical to the fully sorted one.
+            auto worse = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                return (l.first < r.first || ((l.first == r.first) && (l.second > r.second)));
+            };
+            std::make_heap(sorted_boxes.begin(), sorted_boxes.end(), worse);
+            auto nextCandidate = [&]() {
+                std::pop_heap(sorted_boxes.begin(), sorted_boxes.begin() + sortedBoxSize, worse);
+                return sorted_boxes[--sortedBoxSize];
+            };
+
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            auto candidateBox = nextCandidate();
+            filtBoxes[offset + 0] = filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
             io_selection_size++;
-            if (sortedBoxSize > 1) {
+            if (sortedBoxSize > 0) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
-
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+                    // at most max_out_box boxes are ever selected, no need to keep coordinates for the rest
+                    size_t selectedCapacity = std::min(sortedBoxSize + 1, static_cast<size_t>(std::max(max_out_box, 1)));
+                    std::vector<float> boxCoord0(selectedCapacity, 0.0f);
+                    std::vector<float> boxCoord1(selectedCapacity, 0.0f);
+                    std::vector<float> boxCoord2(selectedCapacity, 0.0f);
+                    std::vector<float> boxCoord3(selectedCapacity, 0.0f);
+
+                    boxCoord0[0] = boxesPtr[candidateBox.second * 4];
+                    boxCoord1[0] = boxesPtr[candidateBox.second * 4 + 1];
+                    boxCoord2[0] = boxesPtr[candidateBox.second * 4 + 2];
+                    boxCoord3[0] = boxesPtr[candidateBox.second * 4 + 3];
 
                     auto arg = jit_nms_args();
                     arg.iou_threshold = static_cast<float*>(&iouThreshold);
@@ -1028,27 +1042,29 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                     arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
                     arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
 
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while ((sortedBoxSize > 0) && (io_selection_size < max_out_box)) {
+                        candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
+                        arg.candidate_box = static_cast<const float*>(&boxesPtr[candidateBox.second * 4]);
                         arg.candidate_status = static_cast<int*>(&candidateStatus);
                         (*nms_kernel)(&arg);
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
+                            boxCoord0[io_selection_size] = boxesPtr[candidateBox.second * 4];
+                            boxCoord1[io_selection_size] = boxesPtr[candidateBox.second * 4 + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[candidateBox.second * 4 + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[candidateBox.second * 4 + 3];
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while ((sortedBoxSize > 0) && (io_selection_size < max_out_box)) {
+                        candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
+                            float iou = intersectionOverUnion(&boxesPtr[candidateBox.second * 4],
                                 &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
                             if (iou >= iouThreshold) {
                                 candidateStatus = NMSCandidateStatus::SUPPRESSED;
@@ -1058,7 +1074,7 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
 
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
@@ -14,6 +14,8 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/opsets/opset1.hpp>
 
+#include "common/cpu_memcpy.h"
+
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
@@ -122,6 +124,17 @@ void MKLDNNPriorBoxClusteredNode::execute(mkldnn::stream strm) {
     float* dst_data = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
     const auto& out_shape = getChildEdgeAt(0)->getMemory().GetShape().getStaticDims();
 
+    // The output is a pure function of the four shape values, which stay the same between
+    // inferences unless the input resolution changes. Reusing the cached result turns the
+    // per-frame prior generation into a memcpy; the copy is needed since the destination
+    // buffer is shared with other intermediate tensors of the graph.
+    const std::array<int, 4> shape_key = {{layer_height, layer_width, img_height, img_width}};
+    const size_t output_size = 2lu * out_shape[1];
+    if (shape_key == cached_shape_key && cached_priors.size() == output_size) {
+        cpu_memcpy(dst_data, cached_priors.data(), output_size * sizeof(float));
+        return;
+    }
+
     size_t var_size = variances.size();
     parallel_for2d(layer_height, layer_width, [&](int64_t h, int64_t w) {
         float center_x = (w + offset) * step_w;
@@ -161,6 +174,9 @@ void MKLDNNPriorBoxClusteredNode::execute(mkldnn::stream strm) {
             }
         }
     });
+
+    cached_shape_key = shape_key;
+    cached_priors.assign(dst_data, dst_data + output_size);
 }
 
 bool MKLDNNPriorBoxClusteredNode::created() const {
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <array>
 #include <vector>
 
 #include <ie_common.h>
@@ -41,6 +42,11 @@ private:
     float offset;
 
     int number_of_priors;
+
+    // the priors are a pure function of the four shape values below; the last computed
+    // result is kept so repeated inferences with the same shapes skip the recomputation
+    std::array<int, 4> cached_shape_key = {{-1, -1, -1, -1}};
+    std::vector<float> cached_priors;
 };
 
 }  // namespace MKLDNNPlugin
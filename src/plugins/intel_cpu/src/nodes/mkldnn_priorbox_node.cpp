@@ -14,6 +14,8 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph/opsets/opset1.hpp>
 
+#include "common/cpu_memcpy.h"
+
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
@@ -166,6 +168,17 @@ void MKLDNNPriorBoxNode::execute(mkldnn::stream strm) {
 
     float* dst_data = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
+    // The output is a pure function of the four shape values, which stay the same between
+    // inferences unless the input resolution changes. Reusing the cached result turns the
+    // per-frame prior generation into a memcpy; the copy is needed since the destination
+    // buffer is shared with other intermediate tensors of the graph.
+    const std::array<int, 4> shape_key = {{H, W, IH, IW}};
+    const size_t output_size = 2lu * static_cast<size_t>(OH);
+    if (shape_key == cached_shape_key && cached_priors.size() == output_size) {
+        cpu_memcpy(dst_data, cached_priors.data(), output_size * sizeof(float));
+        return;
+    }
+
     float step_ = step;
     auto min_size_ = min_size;
     if (!scale_all_sizes) {
@@ -315,6 +328,9 @@ void MKLDNNPriorBoxNode::execute(mkldnn::stream strm) {
             }
         });
     }
+
+    cached_shape_key = shape_key;
+    cached_priors.assign(dst_data, dst_data + output_size);
 }
 
 bool MKLDNNPriorBoxNode::created() const {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -47,6 +48,11 @@ private:
     std::vector<float> variance;
 
     int number_of_priors;
+
+    // the priors are a pure function of the four shape values below; the last computed
+    // result is kept so repeated inferences with the same shapes skip the recomputation
+    std::array<int, 4> cached_shape_key = {{-1, -1, -1, -1}};
+    std::vector<float> cached_priors;
 };
 
 }  // namespace MKLDNNPlugin
@@ -9,6 +9,7 @@
 #include "proposal_imp.hpp"
 
 using proposal_conf = InferenceEngine::Extensions::Cpu::proposal_conf;
+using proposal_workspace = InferenceEngine::Extensions::Cpu::proposal_workspace;
 
 namespace MKLDNNPlugin {
 
@@ -34,6 +35,7 @@ private:
     const size_t PROBABILITIES_OUT_IDX = 1lu;
 
     proposal_conf conf;
+    proposal_workspace workspace;
     std::vector<float> anchors;
     std::vector<int> roi_indices;
     bool store_prob;  // store blob with proposal probabilities
@@ -9,6 +9,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include <ie_memcpy.h>
 #include "utils/general_utils.h"
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include "nodes/common/cpu_memcpy.h"
@@ -405,7 +406,9 @@ void MKLDNNReorderNode::reorderData(const MKLDNNMemory &input, const MKLDNNMemor
         auto dstPtr = static_cast<uint8_t*>(output.GetPtr());
 
         auto copySize = size == 0 ? output.GetSize() : size;
-        cpu_memcpy(dstPtr, srcPtr, copySize);
+        // this path handles plain blob copies at the API boundary as well, where tensors can be
+        // hundreds of megabytes - split those across threads instead of copying at one core's bandwidth
+        ie_memcpy_parallel(dstPtr, output.GetSize(), srcPtr, copySize);
     } else {
         std::unique_ptr<mkldnn::reorder> pReorder;
         std::shared_ptr<mkldnn::memory> srcMemoryPtr;
@@ -125,6 +125,23 @@ void MKLDNNReshapeNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+bool MKLDNNReshapeNode::canShareSrcMemory() {
+    if (shareSrcMemory < 0) {
+        const auto& srcEdge = getParentEdgesAtPort(0)[0];
+        // The input memory must be an individually owned buffer: edges with an undefined upper bound are
+        // allocated outside the shared workspace, while workspace regions and in-place views have their
+        // lifetime planned by the memory solver and must not be read past the reshape execution step.
+        bool sharable = !srcEdge->getMemoryPtr()->hasExternalStorage();
+        // Constant data is filled once on load, so it must stay untouchable: an in-place consumer of the
+        // reshape output would write through the view right into the constant.
+        sharable = sharable && !srcEdge->getParent()->isConstant();
+        // The producer port must have no other consumers for the same reason.
+        sharable = sharable && srcEdge->getParent()->getChildEdgesAtPort(srcEdge->getInputNum()).size() == 1;
+        shareSrcMemory = sharable ? 1 : 0;
+    }
+    return shareSrcMemory == 1;
+}
+
 void MKLDNNReshapeNode::executeDynamicImpl(mkldnn::stream strm) {
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -134,6 +151,13 @@ void MKLDNNReshapeNode::executeDynamicImpl(mkldnn::stream strm) {
     }
     if (count != dstMemPtr->GetShape().getElementsCount())
         IE_THROW() << errorPrefix << " has different elements number in input and output buffers";
+    if (canShareSrcMemory()) {
+        // Reshape never changes the data, only its interpretation, so the output memory is redefined
+        // as a zero-copy view over the input buffer. The output descriptor has already been set to the
+        // inferred shape by redefineOutputMemory, it is only repointed here.
+        dstMemPtr->redefineDesc(dstMemPtr->getDesc(), srcMemPtr->GetData());
+        return;
+    }
     cpu_memcpy(dstMemPtr->GetPtr(), srcMemPtr->GetPtr(), count * MKLDNNExtensionUtils::sizeOfDataType(srcMemPtr->GetDataType()));
 }
 
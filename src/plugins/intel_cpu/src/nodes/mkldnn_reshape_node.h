@@ -32,7 +32,11 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
+    bool canShareSrcMemory();
+
     mutable std::vector<int> lastSecondInputValues;
+    // lazily evaluated canShareSrcMemory() result: -1 - not evaluated yet, 0 - copy, 1 - alias
+    int shareSrcMemory = -1;
 
     std::string errorPrefix;
 };
@@ -806,10 +806,16 @@ void MKLDNNRNN::prepareParams() {
         outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, memory::data_type::f32, memory::format_tag::ldnc);
     }
 
+    // Long sequences with a small hidden state are dominated by the recurrent GEMM which re-reads
+    // the iteration weights on every timestep. Let oneDNN pick a packed (blocked) weights format
+    // there, so the gates kernel works on weights that stay cache resident across the whole
+    // sequence instead of streaming plain ldigo weights from memory each step.
+    const bool smallHiddenSeq = !is_cell && SL > 1 && SC <= packedWeightsMaxStateSize;
+
     bool wFormatWasChanged = false;
     // WA To avoid different weights layer and iter formats in FP32 case.
     if (dataPrecision == Precision::FP32) {
-        if (SL != 1 || B < optimalBatchSize) {
+        if (!smallHiddenSeq && (SL != 1 || B < optimalBatchSize)) {
             if (wFormat != mkldnn::memory::format_tag::ldigo) {
                 wFormat = mkldnn::memory::format_tag::ldigo;
                 wFormatWasChanged = true;
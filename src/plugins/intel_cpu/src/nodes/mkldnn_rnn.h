@@ -116,6 +116,9 @@ private:
 
     static constexpr size_t optimalBatchSize = 16lu;
     static constexpr size_t batchDimDummyValue = 64lu;
+    // Up to this state size the per-direction iteration weights (4 * SC^2 floats for LSTM) fit L2,
+    // so a packed weights format pays off for sequence execution regardless of the batch
+    static constexpr size_t packedWeightsMaxStateSize = 256lu;
 
     bool wasMemoryPrepared = false;
 };
@@ -874,14 +874,32 @@ void MKLDNNROIAlignNode::executeSpecified() {
         }
     }
 
-    std::vector<int> numSamples(realRois);
-    std::vector<std::vector<float>> weightsTbl(realRois);
-    std::vector<std::vector<size_t>> srcAddressListTbl;
-    std::vector<std::vector<int>> srcIndexTbl;
+    // Size the flat parameter tables with a cheap serial prescan over the ROI geometry: one slice
+    // per ROI instead of a fresh vector per ROI, so for ~1000 regions the per-inference allocations
+    // collapse into (at most) one resize which is a no-op once the buffers have grown.
+    numSamples.resize(realRois);
+    paramOffsets.resize(realRois + 1);
+    paramOffsets[0] = 0;
+    for (int n = 0; n < realRois; n++) {
+        const float* srcRoiPtr = &srcRoi[n * 4];
+        float x1 = srcRoiPtr[0] * spatialScale;
+        float y1 = srcRoiPtr[1] * spatialScale;
+        float x2 = srcRoiPtr[2] * spatialScale;
+        float y2 = srcRoiPtr[3] * spatialScale;
+
+        float binHeight = std::max(y2 - y1, 1.0f) / pooledH;
+        float binWidth = std::max(x2 - x1, 1.0f) / pooledW;
+
+        auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
+        auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
+        paramOffsets[n + 1] = paramOffsets[n] +
+            static_cast<size_t>(BLIParamsNum) * samplingRatioX * samplingRatioY * binCount;
+    }
+    weightsTbl.resize(paramOffsets[realRois]);
     if (!isPlainFmt)
-        srcAddressListTbl.resize(realRois);
+        srcAddressListTbl.resize(paramOffsets[realRois]);
     else
-        srcIndexTbl.resize(realRois);
+        srcIndexTbl.resize(paramOffsets[realRois]);
 
     parallel_for(realRois, [&](size_t n) {
         int roiOff = n * 4;
@@ -911,16 +929,9 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
         float sampleDistanceX = binWidth / samplingRatioX;
         float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
-        size_t paramsSize = BLIParamsNum * numSamplesInBin * binCount;
-        weightsTbl[n] = std::vector<float>(paramsSize, 0.f);
-        if (!isPlainFmt)
-            srcAddressListTbl[n] = std::vector<size_t>(paramsSize, 0);
-        else
-            srcIndexTbl[n] = std::vector<int>(paramsSize, 0);
-
         size_t batchSrcOffset = roiBatchInd * batchInputStride;
-        int idxIter = 0;
+        // iterate over this ROI's slice of the flat sampling tables
+        size_t idxIter = paramOffsets[n];
 
         // |__|__|     |     |
         // |__|__|__ __|__ __|
@@ -941,13 +952,13 @@ void MKLDNNROIAlignNode::executeSpecified() {
                             if (!isPlainFmt) {
                                 auto startPoint = reinterpret_cast<size_t>(&srcData[batchSrcOffset]);
                                 for (int i = 0; i < BLIParamsNum; i++)
-                                    srcAddressListTbl[n][idxIter + i] = startPoint;
+                                    srcAddressListTbl[idxIter + i] = startPoint;
                             } else {
                                 for (int i = 0; i < BLIParamsNum; i++)
-                                    srcIndexTbl[n][idxIter + i] = 0;
+                                    srcIndexTbl[idxIter + i] = 0;
                             }
                             for (int i = 0; i < BLIParamsNum; i++)
-                                weightsTbl[n][idxIter + i] = 0.f;
+                                weightsTbl[idxIter + i] = 0.f;
                             idxIter += BLIParamsNum;
                             continue;
                         }
@@ -973,21 +984,21 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
                         if (!isPlainFmt) {
                             size_t srcOffset = batchSrcOffset + sampleYLow * W * lastBlockDim + sampleXLow * lastBlockDim;
-                            srcAddressListTbl[n][idxIter] = reinterpret_cast<size_t>(&srcData[srcOffset]);
+                            srcAddressListTbl[idxIter] = reinterpret_cast<size_t>(&srcData[srcOffset]);
 
                             srcOffset = batchSrcOffset + sampleYLow * W * lastBlockDim + sampleXHigh * lastBlockDim;
-                            srcAddressListTbl[n][idxIter + 1] = reinterpret_cast<size_t>(&srcData[srcOffset]);
+                            srcAddressListTbl[idxIter + 1] = reinterpret_cast<size_t>(&srcData[srcOffset]);
 
                             srcOffset = batchSrcOffset + sampleYHigh * W * lastBlockDim + sampleXLow * lastBlockDim;
-                            srcAddressListTbl[n][idxIter + 2] = reinterpret_cast<size_t>(&srcData[srcOffset]);
+                            srcAddressListTbl[idxIter + 2] = reinterpret_cast<size_t>(&srcData[srcOffset]);
 
                             srcOffset = batchSrcOffset + sampleYHigh * W * lastBlockDim + sampleXHigh * lastBlockDim;
-                            srcAddressListTbl[n][idxIter + 3] = reinterpret_cast<size_t>(&srcData[srcOffset]);
+                            srcAddressListTbl[idxIter + 3] = reinterpret_cast<size_t>(&srcData[srcOffset]);
                         } else {
-                            srcIndexTbl[n][idxIter] = sampleYLow  * W + sampleXLow;
-                            srcIndexTbl[n][idxIter + 1] = sampleYLow  * W + sampleXHigh;
-                            srcIndexTbl[n][idxIter + 2] = sampleYHigh * W + sampleXLow;
-                            srcIndexTbl[n][idxIter + 3] = sampleYHigh * W + sampleXHigh;
+                            srcIndexTbl[idxIter] = sampleYLow  * W + sampleXLow;
+                            srcIndexTbl[idxIter + 1] = sampleYLow  * W + sampleXHigh;
+                            srcIndexTbl[idxIter + 2] = sampleYHigh * W + sampleXLow;
+                            srcIndexTbl[idxIter + 3] = sampleYHigh * W + sampleXHigh;
                         }
 
                         // weight calculation for bilinear interpolation
@@ -996,10 +1007,10 @@ void MKLDNNROIAlignNode::executeSpecified() {
                         auto hy = 1.0f - ly;
                         auto hx = 1.0f - lx;
 
-                        weightsTbl[n][idxIter] = hy * hx;
-                        weightsTbl[n][idxIter + 1] = hy * lx;
-                        weightsTbl[n][idxIter + 2] = ly * hx;
-                        weightsTbl[n][idxIter + 3] = ly * lx;
+                        weightsTbl[idxIter] = hy * hx;
+                        weightsTbl[idxIter + 1] = hy * lx;
+                        weightsTbl[idxIter + 2] = ly * hx;
+                        weightsTbl[idxIter + 3] = ly * lx;
 
                         idxIter += BLIParamsNum;
                     }
@@ -1010,18 +1021,17 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
     if (roi_align_kernel) {
         if (!isPlainFmt) {
-            std::vector<float> workingBuf;
             int bufSize = rnd_up(C, 16);
             size_t threadsNum = parallel_get_num_threads();
             workingBuf.resize(bufSize * threadsNum, 0.f);
             parallel_for3d(realRois, pooledH, pooledW, [&](int n, int yBinInd, int xBinInd) {
                 int numSamplesROI = numSamples[n];
                 // each sample have 4 values for srcAddressList and weight
-                size_t binOffset = numSamplesROI * BLIParamsNum * pooledW * yBinInd + numSamplesROI * BLIParamsNum * xBinInd;
+                size_t binOffset = paramOffsets[n] + numSamplesROI * BLIParamsNum * pooledW * yBinInd + numSamplesROI * BLIParamsNum * xBinInd;
 
                 auto arg = jit_roi_align_call_args();
-                arg.src = static_cast<const void*>(&srcAddressListTbl[n][binOffset]);
-                arg.weights = static_cast<const float*>(&weightsTbl[n][binOffset]);
+                arg.src = static_cast<const void*>(&srcAddressListTbl[binOffset]);
+                arg.weights = static_cast<const float*>(&weightsTbl[binOffset]);
                 arg.work_amount = C;
                 arg.num_samples = numSamplesROI;
                 float numSamplesInBinInvert = 1.f / numSamplesROI;
@@ -1042,14 +1052,14 @@ void MKLDNNROIAlignNode::executeSpecified() {
                 size_t binOffset = yBinInd * pooledW + xBinInd;
                 size_t binDstOffset = n * batchOutputStride + cIdx * binCount + binOffset;
                 int numSamplesROI = numSamples[n];
-                size_t paramOffset = binOffset * BLIParamsNum * numSamplesROI;
+                size_t paramOffset = paramOffsets[n] + binOffset * BLIParamsNum * numSamplesROI;
 
                 auto arg = jit_roi_align_call_args();
                 arg.src = static_cast<const void*>(&srcData[channelSrcOffset]);
                 arg.dst = static_cast<void*>(&dst[binDstOffset]);
                 // buffer with absolute index
-                arg.buffer = static_cast<void*>(&srcIndexTbl[n][paramOffset]);
-                arg.weights = static_cast<const float*>(&weightsTbl[n][paramOffset]);
+                arg.buffer = static_cast<void*>(&srcIndexTbl[paramOffset]);
+                arg.weights = static_cast<const float*>(&weightsTbl[paramOffset]);
                 float numSamplesInBinInvert = 1.f / numSamplesROI;
                 arg.scale = static_cast<const float*>(&numSamplesInBinInvert);
                 arg.num_samples = numSamplesROI;
@@ -1064,21 +1074,21 @@ void MKLDNNROIAlignNode::executeSpecified() {
             size_t channelSrcOffset = batchSrcOffset + cIdx * H * W;
             size_t binOffset = yBinInd * pooledW + xBinInd;
             size_t binDstOffset = n * batchOutputStride + cIdx * binCount + binOffset;
-            int paramOffset = binOffset * BLIParamsNum * numSamplesROI;
+            size_t paramOffset = paramOffsets[n] + binOffset * BLIParamsNum * numSamplesROI;
             float numSamplesInBinInvert = 1.f / numSamplesROI;
 
             float pooledValue = 0;
             for (unsigned int binSampleInd = 0; binSampleInd < numSamplesROI; binSampleInd++) {
-                float src0 = srcData[channelSrcOffset + srcIndexTbl[n][paramOffset]];
-                float src1 = srcData[channelSrcOffset + srcIndexTbl[n][paramOffset + 1]];
-                float src2 = srcData[channelSrcOffset + srcIndexTbl[n][paramOffset + 2]];
-                float src3 = srcData[channelSrcOffset + srcIndexTbl[n][paramOffset + 3]];
+                float src0 = srcData[channelSrcOffset + srcIndexTbl[paramOffset]];
+                float src1 = srcData[channelSrcOffset + srcIndexTbl[paramOffset + 1]];
+                float src2 = srcData[channelSrcOffset + srcIndexTbl[paramOffset + 2]];
+                float src3 = srcData[channelSrcOffset + srcIndexTbl[paramOffset + 3]];
 
                 float sampleValue =
-                        weightsTbl[n][paramOffset] * src0 +
-                        weightsTbl[n][paramOffset + 1] * src1 +
-                        weightsTbl[n][paramOffset + 2] * src2 +
-                        weightsTbl[n][paramOffset + 3] * src3;
+                        weightsTbl[paramOffset] * src0 +
+                        weightsTbl[paramOffset + 1] * src1 +
+                        weightsTbl[paramOffset + 2] * src2 +
+                        weightsTbl[paramOffset + 3] * src3;
                 paramOffset += BLIParamsNum;
 
                 switch (getAlgorithm()) {
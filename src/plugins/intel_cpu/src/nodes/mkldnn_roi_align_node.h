@@ -85,6 +85,14 @@ private:
     void createJitKernel(const InferenceEngine::Precision& dataPrec, const ROIAlignLayoutType& selectLayout);
     std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel = nullptr;
 
+    // flat per-ROI sampling tables reused between inferences, sliced via paramOffsets
+    std::vector<int> numSamples;
+    std::vector<size_t> paramOffsets;
+    std::vector<float> weightsTbl;
+    std::vector<size_t> srcAddressListTbl;
+    std::vector<int> srcIndexTbl;
+    std::vector<float> workingBuf;
+
     std::string errorPrefix;
 };
 
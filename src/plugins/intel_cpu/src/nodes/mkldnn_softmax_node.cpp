@@ -21,6 +21,7 @@ struct SoftmaxKey {
     DnnlMemoryDescCPtr inp0;
     impl_desc_type implType;
     size_t axis;
+    bool logMode;
 
     size_t hash() const;
     bool operator==(const SoftmaxKey& rhs) const;
@@ -35,6 +36,7 @@ size_t SoftmaxKey::hash() const {
     seed = hash_combine(seed, get_md_hash(inp0->getDnnlDesc().data));
     seed = hash_combine(seed, implType);
     seed = hash_combine(seed, axis);
+    seed = hash_combine(seed, logMode);
     return seed;
 }
 
@@ -44,7 +46,7 @@ bool SoftmaxKey::operator==(const SoftmaxKey& rhs) const {
         retVal = retVal && inp0 && rhs.inp0 && inp0->getDnnlDesc() == rhs.inp0->getDnnlDesc();
     }
 
-    retVal = retVal && implType == rhs.implType && axis == rhs.axis;
+    retVal = retVal && implType == rhs.implType && axis == rhs.axis && logMode == rhs.logMode;
     return retVal;
 }
 }  // namespace
@@ -135,9 +137,15 @@ void MKLDNNSoftMaxNode::createDescriptor(const std::vector<MemoryDescPtr> &input
     DnnlMemoryDescPtr definedInpMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(inpDesc);
     auto in_candidate = definedInpMemDesc->getDnnlDesc();
 
-    MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
-            new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
-    descs.push_back(desc);
+    if (logMode) {
+        MKLDNNDescriptor desc(std::shared_ptr<logsoftmax_forward::desc>(
+                new logsoftmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
+        descs.push_back(desc);
+    } else {
+        MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
+                new softmax_forward::desc(prop_kind::forward_scoring, in_candidate, axis)));
+        descs.push_back(desc);
+    }
 }
 
 void MKLDNNSoftMaxNode::prepareParams() {
@@ -147,12 +155,14 @@ void MKLDNNSoftMaxNode::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
-    SoftmaxKey key = {inpDesc, selected_pd->getImplementationType(), axis};
+    SoftmaxKey key = {inpDesc, selected_pd->getImplementationType(), axis, logMode};
     auto engine = getEngine();
     auto builder = [&engine](const SoftmaxKey& key) -> std::shared_ptr<mkldnn::primitive> {
-        softmax_forward::primitive_desc prim_desc;
-        MKLDNNDescriptor desc(std::shared_ptr<softmax_forward::desc>(
-            new softmax_forward::desc(prop_kind::forward_scoring, key.inp0->getDnnlDesc(), key.axis)));
+        MKLDNNDescriptor desc = key.logMode
+            ? MKLDNNDescriptor(std::shared_ptr<logsoftmax_forward::desc>(
+                  new logsoftmax_forward::desc(prop_kind::forward_scoring, key.inp0->getDnnlDesc(), key.axis)))
+            : MKLDNNDescriptor(std::shared_ptr<softmax_forward::desc>(
+                  new softmax_forward::desc(prop_kind::forward_scoring, key.inp0->getDnnlDesc(), key.axis)));
         primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine);
 
         while (itpd) {
@@ -163,13 +173,14 @@ void MKLDNNSoftMaxNode::prepareParams() {
                 // optimized case in advance in case of dynamic shapes, but in runtime the shape could be suitable for
                 // the optimized implementation, so we have to select the optimized one.
                 (ref_any == key.implType && (impl_type & jit))) {
-                prim_desc = itpd.get();
-                break;
+                if (key.logMode)
+                    return std::make_shared<logsoftmax_forward>(logsoftmax_forward::primitive_desc(itpd.get()));
+                return std::make_shared<softmax_forward>(softmax_forward::primitive_desc(itpd.get()));
             }
             if (!itpd.next_impl())
                 return nullptr;
         }
-        return std::make_shared<softmax_forward>(prim_desc);
+        return nullptr;
     };
 
     auto cache = getRuntimeCache();
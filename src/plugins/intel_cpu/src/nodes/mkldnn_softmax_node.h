@@ -28,8 +28,15 @@ public:
     void executeDynamicImpl(mkldnn::stream strm) override;
     std::vector<VectorDims> shapeInfer() const override;
 
+    // switches the node to compute log(softmax(x)) in a single pass; used by the
+    // graph optimizer when a Log consumer is fused into the softmax
+    void fuseLog() {
+        logMode = true;
+    }
+
 private:
     size_t axis = 0;
+    bool logMode = false;
 };
 
 }  // namespace MKLDNNPlugin
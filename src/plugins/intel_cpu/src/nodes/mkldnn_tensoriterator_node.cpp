@@ -4,8 +4,10 @@
 
 #include "mkldnn_tensoriterator_node.h"
 
+#include <limits>
 #include <string>
 #include <vector>
+#include <ie_parallel.hpp>
 #include <mkldnn_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
 #include <utils/general_utils.h>
@@ -77,6 +79,16 @@ static void redefineToMemories(const std::vector<MKLDNNMemoryPtr>& to_mems, cons
     }
 }
 
+// A reorder between equal dense descriptors degenerates to a plain byte copy. Detecting
+// that at prepare time lets the per-iteration path run a single memcpy from pre-resolved
+// pointers instead of launching a reorder primitive (and skips its creation altogether).
+static bool isDirectCopy(const mkldnn::memory::desc& src, const mkldnn::memory::desc& dst) {
+    if (!(src == dst))
+        return false;
+    mkldnn::impl::memory_desc_wrapper wrapper(src.data);
+    return wrapper.is_dense(false) && wrapper.offset0() == 0;
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
@@ -121,17 +133,36 @@ public:
             mem_holder_src = from->GetPrimitive();
             mem_holder_dst = chunk_mem;
         }
-        reorder = {mem_holder_src, mem_holder_dst};
+
+        direct_copy = isDirectCopy(mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        if (direct_copy) {
+            direct_copy_size_in_byte = part_blob->GetSize();
+        } else {
+            reorder = {mem_holder_src, mem_holder_dst};
+            reorder_args = {{DNNL_ARG_SRC, mem_holder_src}, {DNNL_ARG_DST, mem_holder_dst}};
+        }
     }
 
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                                 chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (direct_copy) {
+            auto &flat_mem = sliced_src ? mem_holder_dst : mem_holder_src;
+            auto flat_ptr = static_cast<uint8_t *>(flat_mem.get_data_handle());
+            if (sliced_src)
+                cpu_memcpy(flat_ptr, chunk_ptr, direct_copy_size_in_byte);
+            else
+                cpu_memcpy(chunk_ptr, flat_ptr, direct_copy_size_in_byte);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                                          chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
-        reorder.execute(strm, mem_holder_src, mem_holder_dst);
+        reorder.execute(strm, reorder_args);
     }
 
 private:
@@ -149,12 +180,25 @@ public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
         mem_holder_src = from->GetPrimitive();
         mem_holder_dst = to->GetPrimitive();
-        reorder = {mem_holder_src, mem_holder_dst};
+
+        direct_copy = isDirectCopy(mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        if (direct_copy) {
+            direct_copy_size_in_byte = from->GetSize();
+        } else {
+            reorder = {mem_holder_src, mem_holder_dst};
+            reorder_args = {{DNNL_ARG_SRC, mem_holder_src}, {DNNL_ARG_DST, mem_holder_dst}};
+        }
     }
 
     void execute(mkldnn::stream strm, int iter) override {
         if (iter != 0) {
-            reorder.execute(strm, mem_holder_src, mem_holder_dst);
+            if (direct_copy) {
+                cpu_memcpy(static_cast<uint8_t *>(mem_holder_dst.get_data_handle()),
+                           static_cast<const uint8_t *>(mem_holder_src.get_data_handle()),
+                           direct_copy_size_in_byte);
+            } else {
+                reorder.execute(strm, reorder_args);
+            }
         }
     }
 };
@@ -492,6 +536,7 @@ void MKLDNNTensorIteratorNode::prepareParams() {
     if (!isDynamicNode()) {
         prepareOutputPorts();
         prepareBackEdges();
+        prepareParallelExecution();
     }
 }
 
@@ -501,23 +546,45 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
 
+    // iterations proven independent at prepare time run as a parallel map over body clones
+    if (parallel_max_iter > 0 && continue_cond && max_num_iter > 1 && max_num_iter <= parallel_max_iter) {
+        executeParallel(strm, max_num_iter);
+        return;
+    }
+
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
-    // use  "i != max_num_iter" only to allow "-1" works like infinite loop
-    for (int i = 0; i != max_num_iter && continue_cond; i++) {
-        // copy data to subgraph iteration
-        for (auto &mapper : before_mappers)
-            mapper->execute(strm, i);
+    if (loopBodyConditionOutputIdx == -1 && max_num_iter >= 0) {
+        // the body has no condition output, so the trip count fully defines the loop:
+        // run the iterations back to back without polling the condition memory
+        if (continue_cond) {
+            for (int i = 0; i < max_num_iter; i++) {
+                for (auto &mapper : before_mappers)
+                    mapper->execute(strm, i);
 
-        sub_graph.Infer();
+                sub_graph.Infer();
 
-        continue_cond = continue_cond_check->getStatus();
+                for (auto &mapper : after_mappers)
+                    mapper->execute(strm, i);
+            }
+        }
+    } else {
+        // use  "i != max_num_iter" only to allow "-1" works like infinite loop
+        for (int i = 0; i != max_num_iter && continue_cond; i++) {
+            // copy data to subgraph iteration
+            for (auto &mapper : before_mappers)
+                mapper->execute(strm, i);
 
-        // copy data from subgraph iteration to outputs
-        // or to the next iteration inputs
-        for (auto &mapper : after_mappers)
-            mapper->execute(strm, i);
+            sub_graph.Infer();
+
+            continue_cond = continue_cond_check->getStatus();
+
+            // copy data from subgraph iteration to outputs
+            // or to the next iteration inputs
+            for (auto &mapper : after_mappers)
+                mapper->execute(strm, i);
+        }
     }
 
     for (auto &mapper : last_mappers)
@@ -657,6 +724,176 @@ void MKLDNNTensorIteratorNode::prepareTripCount() {
     lastUsedTripCount = trip_count_check->getStatus();
 }
 
+/* *==============* Parallel independent-iteration execution *==============* */
+
+static bool isFlatCopyableMemory(const MKLDNNMemoryPtr& mem) {
+    mkldnn::impl::memory_desc_wrapper wrapper(mem->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc().data);
+    return wrapper.is_dense(false) && wrapper.offset0() == 0;
+}
+
+void MKLDNNTensorIteratorNode::prepareParallelExecution() {
+    parallel_max_iter = 0;
+    parallel_input_slices.clear();
+    parallel_output_slices.clear();
+    parallel_invariant_inputs.clear();
+    parallel_last_value_outputs.clear();
+
+    // iterations are independent only when no value flows from one iteration to the
+    // next: no back edges and no body condition output to propagate
+    if (!backEdges.empty() || loopBodyConditionOutputIdx != -1 || isDynamicNode())
+        return;
+
+    int max_iter = std::numeric_limits<int>::max();
+
+    // a chunk of a dense tensor is flat-copyable only when the sliced axis is
+    // effectively outermost (all preceding dims are 1)
+    auto resolveSlice = [&max_iter](const MKLDNNMemoryPtr& ext_mem, const MKLDNNMemoryPtr& body_mem,
+                                    const PortMap& rule, int body_port, IterationSlice& slice) -> bool {
+        if (!isFlatCopyableMemory(ext_mem) || !isFlatCopyableMemory(body_mem) ||
+            ext_mem->GetDataType() != body_mem->GetDataType())
+            return false;
+
+        const auto& dims = ext_mem->getStaticDims();
+        const auto abs_stride = std::abs(rule.stride);
+        if (rule.axis < 0 || static_cast<size_t>(rule.axis) >= dims.size() || dims[rule.axis] % abs_stride != 0)
+            return false;
+        for (int d = 0; d < rule.axis; d++)
+            if (dims[d] != 1)
+                return false;
+
+        const int iter_count = static_cast<int>(dims[rule.axis] / abs_stride);
+        const size_t chunk_bytes = ext_mem->GetSize() / iter_count;
+        if (chunk_bytes != body_mem->GetSize())
+            return false;
+
+        slice.ext_mem = ext_mem;
+        slice.body_port = body_port;
+        slice.size_in_byte = chunk_bytes;
+        slice.stride_in_byte = rule.stride > 0 ? chunk_bytes : -static_cast<ptrdiff_t>(chunk_bytes);
+        slice.offset_in_byte = rule.stride > 0 ? 0 : (iter_count - 1) * chunk_bytes;
+        max_iter = std::min(max_iter, iter_count);
+        return true;
+    };
+
+    std::vector<IterationSlice> in_slices, out_slices;
+    std::vector<std::pair<MKLDNNMemoryPtr, int>> invariant_inputs;
+    std::vector<std::pair<int, MKLDNNMemoryPtr>> last_value_outputs;
+
+    for (const auto& rule : inputPortMap) {
+        auto& ext_mem = getParentEdgesAtPort(rule.from)[0]->getMemoryPtr();
+        auto& body_mem = input_mems[rule.to].front();
+        if (rule.axis == -1) {
+            if (!isFlatCopyableMemory(ext_mem) || !isFlatCopyableMemory(body_mem) ||
+                ext_mem->GetSize() != body_mem->GetSize())
+                return;
+            invariant_inputs.emplace_back(ext_mem, rule.to);
+        } else {
+            IterationSlice slice;
+            if (!resolveSlice(ext_mem, body_mem, rule, rule.to, slice))
+                return;
+            in_slices.push_back(slice);
+        }
+    }
+
+    for (const auto& rule : outputPortMap) {
+        auto& ext_mem = getChildEdgesAtPort(rule.from)[0]->getMemoryPtr();
+        auto& body_mem = output_mem[rule.to];
+        if (rule.axis == -1) {
+            // a non-concatenated output keeps the value of the last iteration
+            if (!isFlatCopyableMemory(ext_mem) || !isFlatCopyableMemory(body_mem) ||
+                ext_mem->GetSize() != body_mem->GetSize())
+                return;
+            last_value_outputs.emplace_back(rule.to, ext_mem);
+        } else {
+            IterationSlice slice;
+            if (!resolveSlice(ext_mem, body_mem, rule, rule.to, slice))
+                return;
+            out_slices.push_back(slice);
+        }
+    }
+
+    // without a sliced port nothing bounds the trip count and every iteration would
+    // compute the same values - nothing to parallelize
+    if (max_iter == std::numeric_limits<int>::max())
+        return;
+
+    const int n_clones = std::min(max_iter, parallel_get_max_threads());
+    if (n_clones < 2) {
+        parallel_clones.clear();
+        return;
+    }
+
+    if (static_cast<int>(parallel_clones.size()) != n_clones) {
+        parallel_clones.clear();
+        auto tiOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
+        const std::shared_ptr<const ov::Model> body = tiOp->get_function();
+        for (int w = 0; w < n_clones; w++) {
+            auto clone = std::make_shared<BodyClone>();
+            clone->graph.CreateGraph(body, ext_mng, weightCache);
+
+            const auto& inMap = clone->graph.GetInputNodesMap();
+            for (const auto& param : body->get_parameters()) {
+                auto inNode = inMap.find(param->get_friendly_name());
+                if (inNode != inMap.end())
+                    clone->input_mems.push_back(getToMemories(inNode->second.get(), 0).front());
+            }
+
+            const auto& outMap = clone->graph.GetOutputNodesMap();
+            for (const auto& out : body->get_results()) {
+                const auto prev = out->input_value(0);
+                const auto inputID = ngraph::op::util::create_ie_output_name(prev);
+                auto outNode = outMap.find(inputID);
+                if (outNode != outMap.end())
+                    clone->output_mems.push_back(outNode->second->getParentEdgeAt(0)->getMemoryPtr());
+            }
+
+            parallel_clones.push_back(clone);
+        }
+    }
+
+    parallel_input_slices = std::move(in_slices);
+    parallel_output_slices = std::move(out_slices);
+    parallel_invariant_inputs = std::move(invariant_inputs);
+    parallel_last_value_outputs = std::move(last_value_outputs);
+    parallel_max_iter = max_iter;
+}
+
+void MKLDNNTensorIteratorNode::executeParallel(mkldnn::stream strm, int num_iter) {
+    const int n_clones = static_cast<int>(parallel_clones.size());
+
+    // invariant inputs are the same for every iteration - broadcast them once
+    for (auto& clone : parallel_clones)
+        for (auto& inv : parallel_invariant_inputs)
+            cpu_memcpy(clone->input_mems[inv.second]->GetPtr(), inv.first->GetPtr(), inv.first->GetSize());
+
+    parallel_for(n_clones, [&](int w) {
+        auto& clone = parallel_clones[w];
+        for (int i = w; i < num_iter; i += n_clones) {
+            for (auto& slice : parallel_input_slices)
+                cpu_memcpy(clone->input_mems[slice.body_port]->GetPtr(),
+                           reinterpret_cast<const uint8_t*>(slice.ext_mem->GetPtr()) +
+                                   slice.offset_in_byte + slice.stride_in_byte * i,
+                           slice.size_in_byte);
+
+            for (auto idx : loopBodyCurrentIterationIdx)
+                *reinterpret_cast<int32_t*>(clone->input_mems[idx]->GetPtr()) = i;
+
+            clone->graph.Infer();
+
+            for (auto& slice : parallel_output_slices)
+                cpu_memcpy(reinterpret_cast<uint8_t*>(slice.ext_mem->GetPtr()) +
+                                   slice.offset_in_byte + slice.stride_in_byte * i,
+                           clone->output_mems[slice.body_port]->GetPtr(),
+                           slice.size_in_byte);
+        }
+    });
+
+    for (auto& out : parallel_last_value_outputs) {
+        auto& last_clone = parallel_clones[(num_iter - 1) % n_clones];
+        cpu_memcpy(out.second->GetPtr(), last_clone->output_mems[out.first]->GetPtr(), out.second->GetSize());
+    }
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 void MKLDNNTensorIteratorNode::reshapeSubgraphInput() {
@@ -8,6 +8,7 @@
 #include <mkldnn_graph.h>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <common/memory_desc_wrapper.hpp>
 
@@ -39,6 +40,12 @@ protected:
     mkldnn::reorder reorder;
     mkldnn::memory mem_holder_src;
     mkldnn::memory mem_holder_dst;
+    // pre-built argument map - reorder.execute(strm, src, dst) constructs one on every call
+    std::unordered_map<int, mkldnn::memory> reorder_args;
+    // identical dense layouts degenerate to a flat memcpy of this many bytes;
+    // the reorder primitive is not even created then
+    size_t direct_copy_size_in_byte = 0;
+    bool direct_copy = false;
 };
 
 
@@ -126,6 +133,10 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Parallel independent-iteration execution */
+    void prepareParallelExecution();
+    void executeParallel(mkldnn::stream strm, int num_iter);
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(mkldnn::stream strm);
@@ -157,6 +168,29 @@ private:
     std::vector<PortMap> outputPortMap;  //!< Output ports map
     std::vector<PortMap> backEdges;  //!< Back edges map
 
+    /* Parallel independent-iteration execution: when the body carries no value from one
+     * iteration to the next (no back edges, no condition output) the loop is a parallel
+     * map, executed over per-worker body clones with flat pre-resolved memory slices */
+    struct BodyClone {
+        MKLDNNGraph graph;
+        std::vector<MKLDNNMemoryPtr> input_mems;   // first edge memory per body input
+        std::vector<MKLDNNMemoryPtr> output_mems;  // memory per body output
+    };
+
+    struct IterationSlice {
+        MKLDNNMemoryPtr ext_mem;    //!< TI-side tensor the chunks are taken from / written to
+        int body_port;              //!< index of the body input/output memory
+        ptrdiff_t offset_in_byte;   //!< chunk position of iteration 0
+        ptrdiff_t stride_in_byte;   //!< per-iteration advance (signed)
+        size_t size_in_byte;        //!< chunk size
+    };
+
+    std::vector<std::shared_ptr<BodyClone>> parallel_clones;
+    std::vector<IterationSlice> parallel_input_slices, parallel_output_slices;
+    std::vector<std::pair<MKLDNNMemoryPtr, int>> parallel_invariant_inputs;   // TI mem -> body input
+    std::vector<std::pair<int, MKLDNNMemoryPtr>> parallel_last_value_outputs; // body output -> TI mem
+    int parallel_max_iter = 0;  //!< largest trip count the slices cover, 0 - parallel path disabled
+
     std::vector<int> loopBodyCurrentIterationIdx;
     int loopBodyConditionOutputIdx = -1;
     int loopTripCountIdx = -1;
@@ -15,6 +15,7 @@
 #include <ngraph/op/topk.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <algorithm>
+#include <utility>
 
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
@@ -2132,6 +2133,8 @@ void MKLDNNTopKNode::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8
             });
         }
     } else { // [planar layout] [blocked layout with topk on non-C]
+        if (topk_partitioned_process(in_ptr, out_ptr, out_idx_ptr))
+            return;
         parallel_for2d(O, I / blk_size, [&](size_t o, size_t k) {
             const uint8_t *in_ptr_a = in_ptr + (o * A * I + k * blk_size) * data_size;
             uint8_t *process_ptr_a = process_ptr + (o * A * I + k * blk_size) * data_size;
@@ -2157,6 +2160,81 @@ void MKLDNNTopKNode::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8
     }
 }
 
+// [planar layout with topk on innermost] partitioned selection for long axes
+// The heap sort kernel is run serially along the whole topk axis, so for a small number of outer rows
+// (e.g. a single 1M-element score vector) most of the stream's cores stay idle. Since the kernel is shape
+// agnostic (axis_dim, top_k and the original index sequence all come from the call args), the axis can be
+// split into per-thread chunks: each chunk yields its own top_k winners with globally correct indices by
+// shifting both src and idx_seq_buf by the chunk offset, and the winners are merged afterwards.
+bool MKLDNNTopKNode::topk_partitioned_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    if (algorithm != TopKAlgorithm::topk_heap_sort || !topk_kernel)
+        return false;
+    // the merge of the per-chunk winners below is done on fp32 values
+    if (topk_kernel->jcp_.precision != Precision::FP32)
+        return false;
+
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (O >= nthr) // enough row-level parallelism already
+        return false;
+
+    const size_t k = static_cast<size_t>(top_k);
+    // each chunk must keep at least top_k elements, and too short chunks would be dominated by the merge
+    const size_t min_chunk = std::max(k * 2, static_cast<size_t>(4096));
+    const size_t parts = std::min(div_up(nthr, O), axis_dim / min_chunk);
+    if (parts < 2)
+        return false;
+
+    const size_t chunk = axis_dim / parts;
+    std::vector<float> part_vals(O * parts * k);
+    std::vector<int32_t> part_idx(O * parts * k);
+
+    parallel_for2d(O, parts, [&](size_t o, size_t p) {
+        const size_t start = p * chunk;
+        const size_t len = (p == parts - 1) ? axis_dim - start : chunk;
+        auto arg = jit_topk_call_args();
+        arg.src = static_cast<const void *>(in_ptr + (o * axis_dim + start) * data_size);
+        arg.dst = static_cast<void *>(&part_vals[(o * parts + p) * k]);
+        arg.index = static_cast<void *>(&part_idx[(o * parts + p) * k]);
+        arg.axis_dim = len;
+        arg.top_k = k;
+        arg.work_amount = 1;
+        arg.sort_stride = I;
+        arg.idx_seq_buf = vec_idx_seq.data() + start;
+        arg.idx_block_buf = vec_idx_block.data();
+        arg.bitonic_idx_buf = vec_bitonic_idx.data();
+        arg.bitonic_k_idx_buf = vec_bitonic_k_idx.data();
+        (*topk_kernel)(&arg);
+    });
+
+    parallel_for(O, [&](size_t o) {
+        std::vector<std::pair<float, int32_t>> candidates(parts * k);
+        for (size_t i = 0; i < parts * k; i++)
+            candidates[i] = std::make_pair(part_vals[o * parts * k + i], part_idx[o * parts * k + i]);
+
+        auto better = [&](const std::pair<float, int32_t>& l, const std::pair<float, int32_t>& r) {
+            if (l.first != r.first)
+                return mode_max ? l.first > r.first : l.first < r.first;
+            return l.second < r.second; // the lower index wins the ties
+        };
+        std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end(), better);
+        if (sort_index) {
+            std::sort(candidates.begin(), candidates.begin() + k,
+                      [](const std::pair<float, int32_t>& l, const std::pair<float, int32_t>& r) {
+                          return l.second < r.second;
+                      });
+        }
+
+        float *dst_data = reinterpret_cast<float *>(out_ptr) + o * k;
+        int32_t *dst_idx = reinterpret_cast<int32_t *>(out_idx_ptr) + o * k;
+        for (size_t i = 0; i < k; i++) {
+            dst_data[i] = candidates[i].first;
+            dst_idx[i] = candidates[i].second;
+        }
+    });
+
+    return true;
+}
+
 inline void MKLDNNTopKNode::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
@@ -20,6 +20,43 @@ namespace Extensions {
 namespace Cpu {
 namespace XARCH {
 
+#if defined(HAVE_AVX2)
+// vector expf() for the box size decode below (Cephes-style polynomial, accurate to a few ulp)
+static inline __m256 exp_avx2(__m256 x) {
+    const __m256 exp_hi = _mm256_set1_ps(88.3762626647949f);
+    const __m256 exp_lo = _mm256_set1_ps(-88.3762626647949f);
+    const __m256 log2e = _mm256_set1_ps(1.44269504088896341f);
+    const __m256 c1 = _mm256_set1_ps(0.693359375f);
+    const __m256 c2 = _mm256_set1_ps(-2.12194440e-4f);
+    const __m256 p0 = _mm256_set1_ps(1.9875691500e-4f);
+    const __m256 p1 = _mm256_set1_ps(1.3981999507e-3f);
+    const __m256 p2 = _mm256_set1_ps(8.3334519073e-3f);
+    const __m256 p3 = _mm256_set1_ps(4.1665795894e-2f);
+    const __m256 p4 = _mm256_set1_ps(1.6666665459e-1f);
+    const __m256 p5 = _mm256_set1_ps(5.0000001201e-1f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+
+    x = _mm256_max_ps(_mm256_min_ps(x, exp_hi), exp_lo);
+
+    // x = n * ln(2) + r, exp(x) = 2^n * exp(r)
+    __m256 fx = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(x, log2e), _mm256_set1_ps(0.5f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, c1));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, c2));
+
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 y = p0;
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), p1);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), p2);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), p3);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), p4);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), p5);
+    y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(y, z), x), one);
+
+    __m256i pow2n = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(fx), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+#endif
+
 static
 void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, const float* anchors,
                              float* proposals, const int num_anchors, const int bottom_H,
@@ -34,6 +71,160 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
     const float* p_anchors_wp = anchors + 2 * num_anchors;
     const float* p_anchors_hp = anchors + 3 * num_anchors;
 
+#if defined(HAVE_AVX2)
+    // for a fixed anchor the deltas and scores of neighbouring spatial positions are contiguous in
+    // memory, so 8 boxes along W are decoded per iteration with the lanes mapped to consecutive w
+    parallel_for2d(bottom_H, num_anchors, [&](size_t h, size_t anchor) {
+        const float* p_dx      = d_anchor4d + (anchor * 4 + 0) * bottom_area + h * bottom_W;
+        const float* p_dy      = d_anchor4d + (anchor * 4 + 1) * bottom_area + h * bottom_W;
+        const float* p_d_log_w = d_anchor4d + (anchor * 4 + 2) * bottom_area + h * bottom_W;
+        const float* p_d_log_h = d_anchor4d + (anchor * 4 + 3) * bottom_area + h * bottom_W;
+        const float* p_sc      = bottom4d + anchor * bottom_area + h * bottom_W;
+
+        const __m256 vcoord_scale = _mm256_set1_ps(box_coordinate_scale);
+        const __m256 vsize_scale = _mm256_set1_ps(box_size_scale);
+        const __m256 vhalf = _mm256_set1_ps(0.5f);
+        const __m256 voffset = _mm256_set1_ps(coordinates_offset);
+        const __m256 vzero = _mm256_setzero_ps();
+        const __m256 vimg_W = _mm256_set1_ps(img_W);
+        const __m256 vimg_H = _mm256_set1_ps(img_H);
+        const __m256 vclip_W = _mm256_set1_ps(img_W - coordinates_offset);
+        const __m256 vclip_H = _mm256_set1_ps(img_H - coordinates_offset);
+        const __m256 vmin_W = _mm256_set1_ps(min_box_W);
+        const __m256 vmin_H = _mm256_set1_ps(min_box_H);
+        const __m256 vanchor_wm = _mm256_set1_ps(p_anchors_wm[anchor]);
+        const __m256 vanchor_hm = _mm256_set1_ps(p_anchors_hm[anchor]);
+        const __m256 vanchor_wp = _mm256_set1_ps(p_anchors_wp[anchor]);
+        const __m256 vanchor_hp = _mm256_set1_ps(p_anchors_hp[anchor]);
+        const __m256 vlane = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+        const __m256 vfeat_stride = _mm256_set1_ps(static_cast<float>(feat_stride));
+        const __m256 vfixed = _mm256_set1_ps(static_cast<float>(h * feat_stride));
+
+        int w = 0;
+        for (; w <= bottom_W - 8; w += 8) {
+            const __m256 vvar = _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps(static_cast<float>(w)), vlane), vfeat_stride);
+            const __m256 vx = swap_xy ? vfixed : vvar;
+            const __m256 vy = swap_xy ? vvar : vfixed;
+
+            const __m256 vdx = _mm256_div_ps(_mm256_loadu_ps(p_dx + w), vcoord_scale);
+            const __m256 vdy = _mm256_div_ps(_mm256_loadu_ps(p_dy + w), vcoord_scale);
+            const __m256 vd_log_w = _mm256_div_ps(_mm256_loadu_ps(p_d_log_w + w), vsize_scale);
+            const __m256 vd_log_h = _mm256_div_ps(_mm256_loadu_ps(p_d_log_h + w), vsize_scale);
+            __m256 vscore = _mm256_loadu_ps(p_sc + w);
+
+            __m256 vx0 = _mm256_add_ps(vx, vanchor_wm);
+            __m256 vy0 = _mm256_add_ps(vy, vanchor_hm);
+            __m256 vx1 = _mm256_add_ps(vx, vanchor_wp);
+            __m256 vy1 = _mm256_add_ps(vy, vanchor_hp);
+
+            if (initial_clip) {
+                vx0 = _mm256_max_ps(vzero, _mm256_min_ps(vx0, vimg_W));
+                vy0 = _mm256_max_ps(vzero, _mm256_min_ps(vy0, vimg_H));
+                vx1 = _mm256_max_ps(vzero, _mm256_min_ps(vx1, vimg_W));
+                vy1 = _mm256_max_ps(vzero, _mm256_min_ps(vy1, vimg_H));
+            }
+
+            const __m256 vww = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), voffset);
+            const __m256 vhh = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), voffset);
+            const __m256 vctr_x = _mm256_add_ps(vx0, _mm256_mul_ps(vhalf, vww));
+            const __m256 vctr_y = _mm256_add_ps(vy0, _mm256_mul_ps(vhalf, vhh));
+
+            const __m256 vpred_ctr_x = _mm256_add_ps(_mm256_mul_ps(vdx, vww), vctr_x);
+            const __m256 vpred_ctr_y = _mm256_add_ps(_mm256_mul_ps(vdy, vhh), vctr_y);
+            const __m256 vpred_w = _mm256_mul_ps(exp_avx2(vd_log_w), vww);
+            const __m256 vpred_h = _mm256_mul_ps(exp_avx2(vd_log_h), vhh);
+
+            vx0 = _mm256_sub_ps(vpred_ctr_x, _mm256_mul_ps(vhalf, vpred_w));
+            vy0 = _mm256_sub_ps(vpred_ctr_y, _mm256_mul_ps(vhalf, vpred_h));
+            vx1 = _mm256_add_ps(vpred_ctr_x, _mm256_mul_ps(vhalf, vpred_w));
+            vy1 = _mm256_add_ps(vpred_ctr_y, _mm256_mul_ps(vhalf, vpred_h));
+
+            if (clip_before_nms) {
+                vx0 = _mm256_max_ps(vzero, _mm256_min_ps(vx0, vclip_W));
+                vy0 = _mm256_max_ps(vzero, _mm256_min_ps(vy0, vclip_H));
+                vx1 = _mm256_max_ps(vzero, _mm256_min_ps(vx1, vclip_W));
+                vy1 = _mm256_max_ps(vzero, _mm256_min_ps(vy1, vclip_H));
+            }
+
+            const __m256 vbox_w = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), voffset);
+            const __m256 vbox_h = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), voffset);
+            const __m256 vkeep = _mm256_and_ps(_mm256_cmp_ps(vmin_W, vbox_w, _CMP_LE_OS),
+                                               _mm256_cmp_ps(vmin_H, vbox_h, _CMP_LE_OS));
+            vscore = _mm256_and_ps(vscore, vkeep);
+
+            float res[5][8];
+            _mm256_storeu_ps(res[0], vx0);
+            _mm256_storeu_ps(res[1], vy0);
+            _mm256_storeu_ps(res[2], vx1);
+            _mm256_storeu_ps(res[3], vy1);
+            _mm256_storeu_ps(res[4], vscore);
+            for (int l = 0; l < 8; ++l) {
+                float* p_proposal = proposals + (h * bottom_W + w + l) * num_anchors * 5 + 5 * anchor;
+                p_proposal[0] = res[0][l];
+                p_proposal[1] = res[1][l];
+                p_proposal[2] = res[2][l];
+                p_proposal[3] = res[3][l];
+                p_proposal[4] = res[4][l];
+            }
+        }
+
+        // tail
+        for (; w < bottom_W; ++w) {
+            const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
+            const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
+
+            const float dx = p_dx[w] / box_coordinate_scale;
+            const float dy = p_dy[w] / box_coordinate_scale;
+            const float d_log_w = p_d_log_w[w] / box_size_scale;
+            const float d_log_h = p_d_log_h[w] / box_size_scale;
+            const float score = p_sc[w];
+
+            float x0 = x + p_anchors_wm[anchor];
+            float y0 = y + p_anchors_hm[anchor];
+            float x1 = x + p_anchors_wp[anchor];
+            float y1 = y + p_anchors_hp[anchor];
+
+            if (initial_clip) {
+                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W));
+                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H));
+                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W));
+                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H));
+            }
+
+            const float ww = x1 - x0 + coordinates_offset;
+            const float hh = y1 - y0 + coordinates_offset;
+            const float ctr_x = x0 + 0.5f * ww;
+            const float ctr_y = y0 + 0.5f * hh;
+
+            const float pred_ctr_x = dx * ww + ctr_x;
+            const float pred_ctr_y = dy * hh + ctr_y;
+            const float pred_w = std::exp(d_log_w) * ww;
+            const float pred_h = std::exp(d_log_h) * hh;
+
+            x0 = pred_ctr_x - 0.5f * pred_w;
+            y0 = pred_ctr_y - 0.5f * pred_h;
+            x1 = pred_ctr_x + 0.5f * pred_w;
+            y1 = pred_ctr_y + 0.5f * pred_h;
+
+            if (clip_before_nms) {
+                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W - coordinates_offset));
+                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H - coordinates_offset));
+                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W - coordinates_offset));
+                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H - coordinates_offset));
+            }
+
+            const float box_w = x1 - x0 + coordinates_offset;
+            const float box_h = y1 - y0 + coordinates_offset;
+
+            float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5 + 5 * anchor;
+            p_proposal[0] = x0;
+            p_proposal[1] = y0;
+            p_proposal[2] = x1;
+            p_proposal[3] = y1;
+            p_proposal[4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
+        }
+    });
+#else
     parallel_for2d(bottom_H, bottom_W, [&](size_t h, size_t w) {
         const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
         const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
@@ -105,6 +296,7 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
             p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
         }
     });
+#endif
 }
 
 static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn, bool store_prob) {
@@ -305,7 +497,8 @@ static void retrieve_rois_cpu(const int num_rois, const int item_index,
 void proposal_exec(const float* input0, const float* input1,
              std::vector<size_t> dims0, std::array<float, 4> img_info,
              const float* anchors, int* roi_indices,
-             float* output0, float* output1, proposal_conf &conf) {
+             float* output0, float* output1, proposal_conf &conf,
+             proposal_workspace &ws) {
     // Prepare memory
     const float *p_bottom_item = input0;
     const float *p_d_anchor_item = input1;
@@ -350,10 +543,14 @@ void proposal_exec(const float* input0, const float* input1,
         float y1;
         float score;
     };
-    std::vector<ProposalBox> proposals_(num_proposals);
+    // resize is a no-op after the first inference on the same shapes, the capacity is kept
+    ws.proposals.resize(num_proposals * 5);
     const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-    std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-    std::vector<int> is_dead(pre_nms_topn);
+    ws.unpacked_boxes.resize(unpacked_boxes_buffer_size);
+    ws.is_dead.resize(pre_nms_topn);
+    ProposalBox *proposals_ = reinterpret_cast<ProposalBox *>(ws.proposals.data());
+    float *unpacked_boxes = ws.unpacked_boxes.data();
+    int *is_dead = ws.is_dead.data();
 
     // Execute
     int nn = dims0[0];
@@ -365,7 +562,7 @@ void proposal_exec(const float* input0, const float* input1,
                                 min_box_H, min_box_W, conf.feat_stride_,
                                 conf.box_coordinate_scale_, conf.box_size_scale_,
                                 conf.coordinates_offset, conf.initial_clip, conf.swap_xy, conf.clip_before_nms);
-        std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
+        std::partial_sort(proposals_, proposals_ + pre_nms_topn, proposals_ + num_proposals,
                           [](const ProposalBox &struct1, const ProposalBox &struct2) {
                               return (struct1.score > struct2.score);
                           });
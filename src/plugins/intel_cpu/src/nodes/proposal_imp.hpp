@@ -35,12 +35,22 @@ struct proposal_conf {
     bool shift_anchors;    // shift anchors by half size of the box
 };
 
+// Scratch buffers reused between inferences: the vectors keep their capacity after the first
+// run, so the per-inference allocations disappear. The workspace belongs to the node instance
+// and so is private to the stream executing it.
+struct proposal_workspace {
+    std::vector<float> proposals;       // (x0, y0, x1, y1, score) per box
+    std::vector<float> unpacked_boxes;  // boxes transposed to structure-of-arrays form for nms
+    std::vector<int> is_dead;
+};
+
 namespace XARCH {
 
 void proposal_exec(const float* input0, const float* input1,
         std::vector<size_t> dims0, std::array<float, 4> img_info,
         const float* anchors, int* roi_indices,
-        float* output0, float* output1, proposal_conf &conf);
+        float* output0, float* output1, proposal_conf &conf,
+        proposal_workspace &ws);
 
 }  // namespace XARCH
 }  // namespace Cpu
@@ -15,6 +15,7 @@
 #include <mkldnn_debug.h>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn/ie_mkldnn.h"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
@@ -77,7 +78,23 @@ void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
         return false;
     };
 
-    const Precision supportedPrecision = Precision::FP32;
+    // The kernel always computes in FP32 vector registers, but on AVX512-BF16 machines loads and stores
+    // can convert on the fly. Keeping BF16 descriptors avoids reorders around the subgraph when the rest
+    // of the graph was switched to BF16 by EnforceBF16. Mixed per-port precisions are not supported since
+    // offset arithmetic in define_schedule assumes a uniform element size.
+    auto isBF16Executable = [this]() -> bool {
+        if (!mayiuse(avx512_core_bf16))
+            return false;
+        for (size_t i = 0; i < getOriginalInputsNumber(); i++)
+            if (getOriginalInputPrecisionAtPort(i) != Precision::BF16)
+                return false;
+        for (size_t i = 0; i < getOriginalOutputsNumber(); i++)
+            if (getOriginalOutputPrecisionAtPort(i) != Precision::BF16)
+                return false;
+        return true;
+    };
+
+    const Precision supportedPrecision = isBF16Executable() ? Precision::BF16 : Precision::FP32;
 
     bool dimRanksAreEqual = true;
     for (size_t i = 0; dimRanksAreEqual && i < inputShapes.size(); i++) {
@@ -429,6 +446,53 @@ void MKLDNNSnippetNode::define_schedule() {
         return collapsedDims;
     };
 
+    auto find_dims_to_split = [this, dataSize]() -> void {
+        // The inverse of collapsing: when the innermost jit-ed dimension alone streams more data than
+        // fits the per-core L2, every kernel call evicts its own lines and the fusion win is mostly
+        // lost. Splitting that dimension into cache-resident chunks also feeds the parallel outer
+        // loop with more iterations, so large flat subgraphs scale across cores.
+        if (tileRank != 1)
+            return;
+        const size_t lastIdx = dims_out[max_rank_out_desc_idx].size() - 1;
+        const int64_t inner = dims_out[max_rank_out_desc_idx][lastIdx];
+        // every element of the innermost dimension is touched once per input and output tensor
+        const int64_t bytesPerElement = dataSize * (dims_in.size() + dims_out.size());
+        const int64_t cacheBudget = mkldnn::utils::get_cache_size(2, true) / 2;
+        if (cacheBudget <= 0 || inner * bytesPerElement <= cacheBudget)
+            return;
+        // the second-to-last position must be vacant in every tensor to host the outer part of the split,
+        // and inputs must either span the whole innermost dimension or be broadcast along it
+        for (const auto& dims : dims_in) {
+            if (dims[lastIdx - 1] != 1 || (dims[lastIdx] != inner && dims[lastIdx] != 1))
+                return;
+        }
+        for (const auto& dims : dims_out) {
+            if (dims[lastIdx - 1] != 1 || dims[lastIdx] != inner)
+                return;
+        }
+        const int64_t minimalJitWorkAmount = 256;
+        const int64_t budgetElements = cacheBudget / bytesPerElement;
+        int64_t split = 0;
+        for (int64_t k = 2; inner / k >= minimalJitWorkAmount; k++) {
+            if (inner % k == 0 && inner / k <= budgetElements) {
+                split = k;
+                break;
+            }
+        }
+        if (split == 0)
+            return;
+        for (auto& dims : dims_in) {
+            if (dims[lastIdx] == inner) {
+                dims[lastIdx - 1] = split;
+                dims[lastIdx] = inner / split;
+            }
+        }
+        for (auto& dims : dims_out) {
+            dims[lastIdx - 1] = split;
+            dims[lastIdx] = inner / split;
+        }
+    };
+
     auto initSchedulingInfo = [this, dataSize](const size_t tensorRank) -> void {
         // initialize scheduling information
         sch_offsets_in.resize(offsets_in.size(), 0);
@@ -468,6 +532,8 @@ void MKLDNNSnippetNode::define_schedule() {
     const int collapsedDims = find_dims_to_collapse();
     batchDimIdx = tensorRank - outBlockingDesc_maxRank->getBlockDims().size() + collapsedDims;
 
+    find_dims_to_split();
+
     initOffsets(tensorRank);
     initSchedulingInfo(tensorRank);
 }
@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "chrome_trace.h"
+
+#include "mkldnn_node.h"
+
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+int processId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+}  // namespace
+
+ChromeTraceSink::ChromeTraceSink(const std::string& _pathPrefix, uint32_t _graphId, size_t capacity)
+        : pathPrefix(_pathPrefix), graphId(_graphId), events(std::max<size_t>(capacity, 1)) {
+    for (auto& event : events)
+        event.node = nullptr;
+    // fix the process-wide origin before the first span is recorded
+    nowUs();
+}
+
+double ChromeTraceSink::nowUs() {
+    static const auto processOrigin = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - processOrigin).count();
+}
+
+void ChromeTraceSink::dump() {
+    if (dumped)
+        return;
+    dumped = true;
+
+    const std::string path =
+        pathPrefix + "_" + std::to_string(processId()) + "_" + std::to_string(graphId) + ".json";
+    std::ofstream file(path);
+    if (!file)
+        return;
+
+    // the ring overwrites the oldest events, so the chronological order starts at nextEvent
+    const size_t total = std::min(nextEvent, events.size());
+    const size_t first = nextEvent % events.size();
+
+    file << "{\"traceEvents\":[\n";
+    bool comma = false;
+    for (size_t i = 0; i < total; i++) {
+        const auto& event = events[(first + i) % events.size()];
+        if (!event.node)
+            continue;
+        if (comma)
+            file << ",\n";
+        comma = true;
+        file << "{\"name\":\"" << escapeJson(event.node->getName()) << "\",\"cat\":\""
+             << escapeJson(event.node->getTypeStr()) << "\",\"ph\":\"X\",\"pid\":" << processId()
+             << ",\"tid\":" << graphId << ",\"ts\":" << event.startUs << ",\"dur\":" << event.durUs
+             << ",\"args\":{\"infer\":" << event.inferIndex << ",\"exec_id\":" << event.node->getExecIndex()
+             << "}}";
+    }
+    file << "\n],\n";
+    file << "\"displayTimeUnit\":\"ms\",\n";
+    file << "\"otherData\":{\"tid_meaning\":\"stream graph id\"}\n";
+    file << "}\n";
+}
+
+}  // namespace MKLDNNPlugin
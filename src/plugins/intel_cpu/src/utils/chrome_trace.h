@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNNode;
+
+/**
+ * @brief An in-memory ring of node execution spans dumped as Chrome trace JSON
+ * (chrome://tracing / perfetto), see KEY_CPU_CHROME_TRACE.
+ *
+ * Recording is a single slot write into a preallocated ring by the stream thread that owns the
+ * graph, so it is cheap enough for production use; when the ring wraps, the oldest spans are
+ * overwritten, which keeps the most recent history - exactly the part that contains a latency
+ * spike under investigation. The ring is resolved to node names and serialized only once, when
+ * the graph is released.
+ */
+class ChromeTraceSink {
+public:
+    typedef std::shared_ptr<ChromeTraceSink> Ptr;
+
+    ChromeTraceSink(const std::string& pathPrefix, uint32_t graphId, size_t capacity = 1 << 16);
+
+    // spans are timed against a process-wide origin so all graphs share one timeline
+    static double nowUs();
+
+    void recordSpan(const MKLDNNNode* node, int inferIndex, double startUs, double endUs) {
+        auto& event = events[nextEvent % events.size()];
+        event.node = node;
+        event.inferIndex = inferIndex;
+        event.startUs = startUs;
+        event.durUs = endUs - startUs;
+        nextEvent++;
+    }
+
+    /**
+     * @brief Serializes the collected spans to `<prefix>_<pid>_<graphId>.json`.
+     * Has to be called while the recorded nodes are still alive; never throws, a filesystem
+     * error only loses the trace.
+     */
+    void dump();
+
+private:
+    struct TraceEvent {
+        const MKLDNNNode* node;
+        int inferIndex;
+        double startUs;
+        double durUs;
+    };
+
+    std::string pathPrefix;
+    uint32_t graphId;
+    std::vector<TraceEvent> events;
+    size_t nextEvent = 0;
+    bool dumped = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#ifdef CPU_DEBUG_CAPS
+
+#include "kernel_bench.h"
+
+#include "mkldnn_edge.h"
+#include "mkldnn_node.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// bytes the kernel moves through the memory subsystem: all its inputs plus all its outputs
+uint64_t nodeBytes(const MKLDNNNodePtr& node) {
+    uint64_t bytes = 0;
+    for (size_t port = 0; port < node->getParentEdges().size(); port++) {
+        const auto edge = node->getParentEdgeAt(port);
+        if (edge)
+            bytes += edge->getMemory().GetSize();
+    }
+    for (size_t port = 0; port < node->getChildEdges().size(); port++) {
+        const auto edge = node->getChildEdgeAt(port);
+        if (edge)
+            bytes += edge->getMemory().GetSize();
+    }
+    return bytes;
+}
+
+// Estimated floating point operations for the kernel families where the estimate is clean;
+// 0 means unknown (only GB/s is reported then)
+uint64_t nodeFlops(const MKLDNNNodePtr& node) {
+    const auto outEdge = node->getChildEdges().empty() ? nullptr : node->getChildEdgeAt(0);
+    if (!outEdge)
+        return 0;
+    const auto& outShape = outEdge->getMemory().GetShape();
+    const uint64_t outElems = outShape.getElementsCount();
+
+    switch (node->getType()) {
+    case Eltwise:
+        // one op per element plus one per fused post-op
+        return outElems * (1 + node->getFusedWith().size());
+    case Convolution:
+    case Deconvolution: {
+        // per output point: one MAC per weight element of its output channel,
+        // so total = outSpatial * weightElems (exact for grouped convolutions as well)
+        if (node->getParentEdges().size() < 2 || outShape.getRank() < 2)
+            return 0;
+        const uint64_t weightElems = node->getParentEdgeAt(1)->getMemory().GetShape().getElementsCount();
+        const uint64_t outChannels = outShape.getStaticDims()[1];
+        return outChannels ? 2 * (outElems / outChannels) * weightElems : 0;
+    }
+    case FullyConnected:
+    case MatMul: {
+        // 2 * M * N * K: the second input holds K * N elements per batch
+        if (node->getParentEdges().size() < 2)
+            return 0;
+        const auto& dims = outShape.getStaticDims();
+        const uint64_t lastDim = dims.empty() ? 0 : dims.back();
+        const uint64_t weightElems = node->getParentEdgeAt(1)->getMemory().GetShape().getElementsCount();
+        return lastDim ? 2 * outElems * (weightElems / lastDim) : 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+}  // namespace
+
+void benchmarkGraphKernels(MKLDNNGraph& graph, const std::string& itersConfig) {
+    if (graph.getConfig().lazyPrimitiveInit) {
+        std::cout << "ov_cpu_kernel_bench: skipped, not compatible with the lazy primitive initialization mode"
+                  << std::endl;
+        return;
+    }
+
+    int iterations = atoi(itersConfig.c_str());
+    if (iterations < 1)
+        iterations = 100;
+    constexpr int warmupIterations = 3;
+
+    mkldnn::stream stream(graph.getEngine());
+    std::cout << "ov_cpu_kernel_bench: " << graph.GetName() << ", " << iterations << " iterations per kernel"
+              << std::endl;
+    std::cout << "exec_id;type;name;impl;avg_us;GB/s;GFLOPS" << std::endl;
+
+    for (const auto& node : graph.GetNodes()) {
+        if (node->isConstant() || !node->isExecutable() || node->isDynamicNode())
+            continue;
+
+        try {
+            for (int i = 0; i < warmupIterations; i++)
+                node->execute(stream);
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++)
+                node->execute(stream);
+            const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            const double avgSeconds = seconds / iterations;
+            const uint64_t bytes = nodeBytes(node);
+            const uint64_t flops = nodeFlops(node);
+
+            std::cout << node->getExecIndex() << ";" << node->getTypeStr() << ";" << node->getName() << ";"
+                      << node->getPrimitiveDescriptorType() << ";" << std::fixed << std::setprecision(2)
+                      << avgSeconds * 1e6 << ";";
+            if (avgSeconds > 0 && bytes)
+                std::cout << bytes / avgSeconds / 1e9;
+            else
+                std::cout << "-";
+            std::cout << ";";
+            if (avgSeconds > 0 && flops)
+                std::cout << flops / avgSeconds / 1e9;
+            else
+                std::cout << "-";
+            std::cout << std::endl;
+        } catch (const std::exception& e) {
+            std::cout << node->getExecIndex() << ";" << node->getTypeStr() << ";" << node->getName()
+                      << ";skipped: " << e.what() << std::endl;
+        }
+    }
+}
+
+}  // namespace MKLDNNPlugin
+#endif  // CPU_DEBUG_CAPS
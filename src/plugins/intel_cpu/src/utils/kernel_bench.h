@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#ifdef CPU_DEBUG_CAPS
+#pragma once
+
+#include "mkldnn_graph.h"
+
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes every executable node of the compiled graph in isolation over the shapes the model
+ * actually uses and prints the per-kernel time, GB/s and (where a clean estimate exists) GFLOPS,
+ * so a kernel-level regression can be localized without bisecting with full models.
+ * Enabled by the OV_CPU_KERNEL_BENCH environment variable (see kernel_benchmark.md).
+ */
+void benchmarkGraphKernels(MKLDNNGraph& graph, const std::string& itersConfig);
+
+}  // namespace MKLDNNPlugin
+#endif  // CPU_DEBUG_CAPS
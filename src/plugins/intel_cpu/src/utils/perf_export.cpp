@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_export.h"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+PerfCountersExport::PerfCountersExport(const std::string& directory, uint32_t graphId, size_t capacity)
+        : recordCapacity(capacity) {
+#ifdef __linux__
+    filePath = directory + "/ov_cpu_perf_" + std::to_string(getpid()) + "_" + std::to_string(graphId) + ".bin";
+
+    const size_t size = sizeof(PerfExportHeader) + capacity * sizeof(PerfExportRecord);
+    const int fd = open(filePath.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0)
+        return;
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        unlink(filePath.c_str());
+        return;
+    }
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // the mapping keeps the file open
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        unlink(filePath.c_str());
+        return;
+    }
+
+    mapping = ptr;
+    mappingSize = size;
+
+    auto* header = reinterpret_cast<PerfExportHeader*>(mapping);
+    header->magic = MAGIC;
+    header->version = VERSION;
+    header->graphId = graphId;
+    header->recordCount = 0;
+    header->recordSize = sizeof(PerfExportRecord);
+    header->reserved = 0;
+#else
+    (void)directory;
+    (void)graphId;
+#endif
+}
+
+PerfCountersExport::~PerfCountersExport() {
+#ifdef __linux__
+    if (mapping) {
+        munmap(mapping, mappingSize);
+        unlink(filePath.c_str());
+    }
+#endif
+}
+
+PerfExportRecord* PerfCountersExport::registerNode(uint32_t execIndex, const std::string& type,
+                                                   const std::string& name) {
+    if (!mapping || registeredRecords >= recordCapacity)
+        return nullptr;
+
+    auto* header = reinterpret_cast<PerfExportHeader*>(mapping);
+    auto* records = reinterpret_cast<PerfExportRecord*>(header + 1);
+    auto* record = &records[registeredRecords++];
+
+    std::memset(record, 0, sizeof(PerfExportRecord));
+    record->graphId = header->graphId;
+    record->execIndex = execIndex;
+    strncpy(record->type, type.c_str(), sizeof(record->type) - 1);
+    strncpy(record->name, name.c_str(), sizeof(record->name) - 1);
+    // publish the record only after it is fully initialized
+    header->recordCount = static_cast<uint32_t>(registeredRecords);
+
+    return record;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Reads the invariant TSC (or a steady clock on non-x86 targets).
+ * Raw rdtsc is used deliberately: a pair of reads plus two additions is cheap enough to stay
+ * always-on, unlike the PERF/ITT profiling infrastructure.
+ */
+inline uint64_t perfReadCycles() {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    return __rdtsc();
+#elif defined(__i386__) || defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * @brief One exported counter record per executable node of a stream graph.
+ * The stream thread owning the graph is the only writer and updates the counters with plain
+ * stores, so recording needs no locks or atomics; the scraping agent reads the file
+ * asynchronously and has to tolerate torn counter values (they self-correct on the next scrape).
+ */
+struct PerfExportRecord {
+    uint32_t graphId;
+    uint32_t execIndex;
+    char type[32];
+    char name[96];
+    uint64_t executeCount;
+    uint64_t totalCycles;
+};
+
+/**
+ * @brief A file-backed shared-memory region holding the counter records of one stream graph.
+ *
+ * The file `<directory>/ov_cpu_perf_<pid>_<graphId>.bin` starts with a PerfExportHeader followed
+ * by the registered records; it is mapped MAP_SHARED, so the in-place counter updates are visible
+ * to any process that maps or reads the file. Point the directory to a tmpfs mount (e.g.
+ * /dev/shm) to keep the export off the disk. The file is removed when the graph is destroyed.
+ */
+class PerfCountersExport {
+public:
+    typedef std::shared_ptr<PerfCountersExport> Ptr;
+
+    struct PerfExportHeader {
+        uint32_t magic;        // 'OVPC'
+        uint32_t version;
+        uint32_t graphId;
+        uint32_t recordCount;  // registered so far; records past this index are not valid yet
+        uint32_t recordSize;
+        uint32_t reserved;
+    };
+
+    static constexpr uint32_t MAGIC = 0x4350564f;  // "OVPC", little-endian
+    static constexpr uint32_t VERSION = 1;
+
+    PerfCountersExport(const std::string& directory, uint32_t graphId, size_t recordCapacity);
+    ~PerfCountersExport();
+
+    PerfCountersExport(const PerfCountersExport&) = delete;
+    PerfCountersExport& operator=(const PerfCountersExport&) = delete;
+
+    // false when the mapping could not be created (unsupported platform or filesystem error)
+    bool isValid() const {
+        return mapping != nullptr;
+    }
+
+    /**
+     * @brief Appends a record for the node and returns its in-region address, or nullptr when
+     * the export is not valid or the capacity is exhausted.
+     */
+    PerfExportRecord* registerNode(uint32_t execIndex, const std::string& type, const std::string& name);
+
+private:
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    size_t registeredRecords = 0;
+    size_t recordCapacity = 0;
+    std::string filePath;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pmu_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef __linux__
+
+namespace {
+
+int openCounter(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    // this thread, any cpu
+    return syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+}  // namespace
+
+PmuCounters::PmuCounters() {
+    groupFd = openCounter(PERF_COUNT_HW_CACHE_MISSES, -1);
+    if (groupFd < 0)
+        return;
+    refsFd = openCounter(PERF_COUNT_HW_CACHE_REFERENCES, groupFd);
+    if (refsFd < 0) {
+        close(groupFd);
+        groupFd = -1;
+        return;
+    }
+    ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PmuCounters::~PmuCounters() {
+    if (refsFd >= 0)
+        close(refsFd);
+    if (groupFd >= 0)
+        close(groupFd);
+}
+
+PmuCounters::Sample PmuCounters::read() const {
+    Sample sample;
+    if (groupFd < 0)
+        return sample;
+
+    struct {
+        uint64_t nr;
+        uint64_t values[2];
+    } data;
+    if (::read(groupFd, &data, sizeof(data)) == sizeof(data) && data.nr == 2) {
+        sample.llcMisses = data.values[0];
+        sample.llcRefs = data.values[1];
+    }
+    return sample;
+}
+
+#else  // !__linux__
+
+PmuCounters::PmuCounters() {}
+PmuCounters::~PmuCounters() {}
+
+PmuCounters::Sample PmuCounters::read() const {
+    return {};
+}
+
+#endif  // __linux__
+
+PmuCounters& PmuCounters::get() {
+    thread_local PmuCounters counters;
+    return counters;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief A per-thread pair of hardware PMU counters (LLC misses and LLC references) read around
+ * node execution to attribute memory traffic per node (see KEY_CPU_PMU_COUNTERS).
+ *
+ * The counters are opened through perf_event_open for the calling thread only, so the readings
+ * of the stream threads do not mix. Opening can fail without privileges
+ * (kernel.perf_event_paranoid) or off Linux - the instance then reports !isValid() and the
+ * attribution is silently skipped.
+ */
+class PmuCounters {
+public:
+    struct Sample {
+        uint64_t llcMisses = 0;
+        uint64_t llcRefs = 0;
+    };
+
+    // the per-thread instance; counters are opened lazily on first access
+    static PmuCounters& get();
+
+    ~PmuCounters();
+
+    PmuCounters(const PmuCounters&) = delete;
+    PmuCounters& operator=(const PmuCounters&) = delete;
+
+    bool isValid() const {
+        return groupFd >= 0;
+    }
+
+    Sample read() const;
+
+private:
+    PmuCounters();
+
+    int groupFd = -1;
+    int refsFd = -1;
+};
+
+}  // namespace MKLDNNPlugin
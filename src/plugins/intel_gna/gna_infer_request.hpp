@@ -11,6 +11,7 @@
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp/ie_infer_request.hpp"
 #include "gna_plugin.hpp"
+#include <threading/ie_executor_manager.hpp>
 
 namespace GNAPluginNS {
 
@@ -37,6 +38,10 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
  protected:
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // Serves the wait + callback part of callback-based StartAsync() flows; the device completes
+    // requests in submission order, so one shared thread is enough
+    InferenceEngine::ITaskExecutor::Ptr _waitExecutor =
+        InferenceEngine::ExecutorManager::getInstance()->getExecutor("GNAWait");
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
@@ -87,21 +92,26 @@ class GNAInferRequest : public InferenceEngine::IInferRequestInternal {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
         inferRequestIdx = plg->QueueInference(_inputs, _outputs);
-        // workaround to unblock callback-based flows
+        // Callback-based flows get unblocked on a separate executor, so StartAsync() returns right
+        // after the request is queued and the next frame can be quantized and queued into another
+        // request while the device is still busy with this one.
         if (_callback) {
-            auto res = Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
-            std::exception_ptr exceptionPtr;
-            if (res != InferenceEngine::StatusCode::OK) {
-                try {
-                    IE_EXCEPTION_SWITCH(res, ExceptionType,
-                        InferenceEngine::details::ThrowNow<ExceptionType>{}
-                            <<= std::stringstream{} << IE_LOCATION
-                            <<  InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
-                } catch (...) {
-                    exceptionPtr = std::current_exception();
+            auto self = std::static_pointer_cast<GNAInferRequest>(shared_from_this());
+            _waitExecutor->run([self]() {
+                auto res = self->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+                std::exception_ptr exceptionPtr;
+                if (res != InferenceEngine::StatusCode::OK) {
+                    try {
+                        IE_EXCEPTION_SWITCH(res, ExceptionType,
+                            InferenceEngine::details::ThrowNow<ExceptionType>{}
+                                <<= std::stringstream{} << IE_LOCATION
+                                <<  InferenceEngine::details::ExceptionTraits<ExceptionType>::string());
+                    } catch (...) {
+                        exceptionPtr = std::current_exception();
+                    }
                 }
-            }
-            _callback(exceptionPtr);
+                self->_callback(exceptionPtr);
+            });
         }
     }
 
@@ -25,7 +25,10 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
         {METRIC_KEY(AVAILABLE_DEVICES), [this]() {return GetAvailableDevices();}},
         {METRIC_KEY(SUPPORTED_CONFIG_KEYS), [this]() {return config.GetSupportedKeys();}},
         {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), [this]() {
-            uint32_t nireq = 1;
+            // Each of the LIB_N_THREADS request configs owns a separate input/output region, so
+            // that many requests in flight let quantization of the next frame overlap device
+            // execution of the current one
+            uint32_t nireq = gnaFlags->gna_lib_async_threads_num;
             return nireq;
         }},
         {METRIC_KEY(FULL_DEVICE_NAME), [&options, this]() {
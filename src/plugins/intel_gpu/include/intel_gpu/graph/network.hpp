@@ -206,6 +206,15 @@ private:
     std::unordered_map<primitive_id, event::ptr> _events;
     output_chains_map _output_chains;
 
+    // Stretch of the execution order pre-recorded into a stream command list, replayed with a
+    // single host call instead of per-kernel enqueues. See execute_impl().
+    struct captured_range {
+        command_list::ptr list;
+        std::vector<std::shared_ptr<primitive_inst>> insts;
+    };
+    std::vector<captured_range> _captured_ranges;
+    bool _capture_done = false;
+
     void build_exec_order();
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include "ie_blob.h"
@@ -38,11 +39,23 @@ public:
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
     std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
 
+    // Keeps the source (untransformed) model so graph variants for other input shapes can be
+    // compiled later; only called when the per-shape graph cache is enabled
+    void SetSourceNetwork(const InferenceEngine::CNNNetwork& network);
+    // Returns the graph compiled for the given input shapes, building and caching it on first use
+    std::shared_ptr<Graph> GetGraphForShapes(const std::map<std::string, InferenceEngine::SizeVector>& shapes);
+
     std::vector<std::shared_ptr<Graph>> m_graphs;
     InferenceEngine::gpu::ClContext::Ptr m_context;
     Config m_config;
     InferenceEngine::ITaskExecutor::Ptr m_taskExecutor;
     InferenceEngine::ITaskExecutor::Ptr m_waitExecutor;
+
+private:
+    InferenceEngine::CNNNetwork m_srcNetwork;
+    bool m_hasSrcNetwork = false;
+    std::mutex m_shapeGraphsMutex;
+    std::map<std::string, std::shared_ptr<Graph>> m_shapeGraphs;
 };
 
 }  // namespace intel_gpu
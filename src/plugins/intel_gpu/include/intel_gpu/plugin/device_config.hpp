@@ -28,6 +28,9 @@ struct Config {
                                           enableInt8(true),
                                           nv12_two_inputs(false),
                                           enable_fp16_for_quantized_models(true),
+                                          enable_auto_fp16(false),
+                                          enable_per_shape_graph_cache(false),
+                                          compilation_memory_budget(0),
                                           queuePriority(cldnn::priority_mode_types::disabled),
                                           queueThrottle(cldnn::throttle_mode_types::disabled),
                                           max_dynamic_batch(1),
@@ -64,6 +67,9 @@ struct Config {
     bool enableInt8;
     bool nv12_two_inputs;
     bool enable_fp16_for_quantized_models;
+    bool enable_auto_fp16;
+    bool enable_per_shape_graph_cache;
+    uint64_t compilation_memory_budget;  // in bytes, 0 means no limit
     cldnn::priority_mode_types queuePriority;
     cldnn::throttle_mode_types queueThrottle;
     int max_dynamic_batch;
@@ -21,6 +21,15 @@ struct buf_info {
     size_t buf_size;
 };
 
+// A small device-side program (resample + reorder) which turns a raw camera-sized
+// frame into the network input, so the resize does not occupy host cores.
+struct device_resize_stage {
+    std::shared_ptr<cldnn::network> network;
+    cldnn::memory::ptr input_mem;
+    cldnn::layout src_layout = cldnn::layout(cldnn::data_types::f32, cldnn::format::bfyx, cldnn::tensor());
+    InferenceEngine::Blob::Ptr src_blob;
+};
+
 class CompiledModel;
 
 class InferRequest : public InferenceEngine::IInferRequestInternal {
@@ -79,16 +88,25 @@ private:
     bool m_useStreams = false;
     bool m_useExternalQueue = false;
     std::shared_ptr<Graph> m_graph;
+    // Graph compiled for the shapes of the currently set inputs; pins the request to this
+    // variant instead of the per-stream graph while the per-shape graph cache is in use
+    std::shared_ptr<Graph> m_shapeVariantGraph;
 
     // dynamic batch stuff
     std::map<std::string, std::vector<buf_info>> batchInputs;
     std::map<std::string, std::vector<buf_info>> batchOutputs;
     InferenceEngine::IStreamsExecutor* streamExecutor = nullptr;
 
+    std::map<std::string, device_resize_stage> _deviceResizeStages;
+
     void prepare_input(const cldnn::primitive_id &inputName, InferenceEngine::Blob::Ptr &inputBlob,
                        std::vector<cldnn::event::ptr>& dependencies);
     void prepare_output(const cldnn::primitive_id& outputName, InferenceEngine::Blob::Ptr& outputBlob);
 
+    bool try_device_preprocessing(const std::string& name, const InferenceEngine::Blob::Ptr& data,
+                                  const InferenceEngine::InputInfo::Ptr& inputInfo);
+    void run_device_resize_stage(const std::string& inputName, std::vector<cldnn::event::ptr>& dependencies);
+
     InferenceEngine::Blob::Ptr create_host_blob(const InferenceEngine::TensorDesc& desc,
                                                 std::shared_ptr<InferenceEngine::IAllocator> alloc = nullptr);
     InferenceEngine::Blob::Ptr create_device_blob(const InferenceEngine::TensorDesc& desc, const cldnn::layout& layout);
@@ -99,6 +117,7 @@ private:
                          buf_info* bi = nullptr);
 
     InferenceEngine::Blob::Ptr create_shared_device_blob(const InferenceEngine::TensorDesc& desc, const cldnn::layout& layout, void* usm_host_mem);
+    void rebind_to_shape_variant(const std::string& inputName, const InferenceEngine::TensorDesc& blobDesc);
     void allocate_inputs();
     void allocate_outputs();
     void allocate_inputs_dynamic();
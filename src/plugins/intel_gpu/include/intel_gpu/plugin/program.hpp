@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <mutex>
 
 #include <cpp/ie_cnn_network.h>
@@ -105,6 +107,12 @@ public:
     const Config& GetConfig() const { return m_config; }
     int GetMaxBatchSizeForSingleProgram();
 
+    // Runs the given constant tensor upload on the engine task executor so it overlaps with the
+    // translation of the remaining operations; the copies are joined by WaitForConstantCopies()
+    // before the cldnn program build starts reading the constant memory
+    void ScheduleConstantCopy(std::function<void()> copy_task);
+    void WaitForConstantCopies();
+
     bool IsOpSupported(const InferenceEngine::CNNNetwork& network, const std::shared_ptr<ngraph::Node>& op);
     bool IsDynBatchModel(const std::shared_ptr<ov::Model>& model,
                          std::map<std::string, ov::PartialShape>& shapes,
@@ -155,6 +163,7 @@ private:
     std::vector<std::shared_ptr<cldnn::program>> m_programs;
     std::shared_ptr<cldnn::engine> m_engine;
     Config m_config;
+    std::vector<std::future<void>> m_constantCopyFutures;
 
     std::shared_ptr<cldnn::topology> m_topology;
     InferenceEngine::InputsDataMap m_networkInputs;
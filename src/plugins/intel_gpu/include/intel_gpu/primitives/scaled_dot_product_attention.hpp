@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Fused scaled dot-product attention primitive.
+///
+/// @details Computes output = softmax(query x key^T * scale [+ mask]) x value in a single
+///          kernel. Compared with the discrete gemm - softmax - gemm chain the fused kernel
+///          never stores the [.., seq_q, seq_kv] score tensor in global memory: key/value
+///          tiles are staged in local memory and the softmax is computed online per query row.
+/// @n
+/// @n@b Requirements:
+/// @n - @c inputs: query [b, f, seq_q, head_size], key [b, f, seq_kv, head_size],
+/// @n   value [b, f, seq_kv, head_size_v] and an optional additive mask broadcastable
+/// @n   to [b, f, seq_q, seq_kv].
+struct scaled_dot_product_attention : public primitive_base<scaled_dot_product_attention> {
+    CLDNN_DECLARE_PRIMITIVE(scaled_dot_product_attention)
+
+    /// @brief Constructs scaled_dot_product_attention primitive.
+    /// @param id This primitive id.
+    /// @param inputs Query, key and value primitive ids followed by an optional mask id.
+    /// @param scale Scale applied to the query x key^T scores before the softmax.
+    scaled_dot_product_attention(const primitive_id& id,
+                                 const std::vector<primitive_id>& inputs,
+                                 const data_types data_type,
+                                 const float scale = 1.0f,
+                                 const primitive_id& ext_prim_id = "",
+                                 const padding& output_padding = padding())
+        : primitive_base(id, inputs, ext_prim_id, output_padding, optional_data_type{ data_type }),
+          scale(scale) {
+        if (inputs.size() != 3 && inputs.size() != 4) {
+            throw std::invalid_argument("Invalid inputs count - scaled_dot_product_attention expects three or four inputs");
+        }
+    }
+
+    /// @brief Scale applied to the query x key^T scores before the softmax.
+    float scale;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
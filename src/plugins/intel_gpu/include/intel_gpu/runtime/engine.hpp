@@ -119,6 +119,17 @@ public:
     /// Subtracts @p bytes count from currently used memory size of the specified allocation @p type
     void subtract_memory_used(uint64_t bytes, allocation_type type);
 
+    /// Adds @p bytes count to the amount of memory parked in released-buffer pools of this engine
+    void add_released_pool_memory(uint64_t bytes);
+
+    /// Subtracts @p bytes count from the amount of memory parked in released-buffer pools of this engine
+    void subtract_released_pool_memory(uint64_t bytes);
+
+    /// Returns the amount of memory currently parked in released-buffer pools of this engine.
+    /// This memory counts as used from the driver point of view but serves no live buffer, so a
+    /// growing value against a steady workload indicates pool fragmentation.
+    uint64_t get_released_pool_memory() const;
+
     /// Returns true if USM is enabled in engine config and device/driver supports required features
     bool use_unified_shared_memory() const;
 
@@ -175,6 +186,7 @@ protected:
 
     std::map<allocation_type, std::atomic<uint64_t>> _memory_usage_map;
     std::map<allocation_type, std::atomic<uint64_t>> _peak_memory_usage_map;
+    std::atomic<uint64_t> _released_pool_usage{0};
 };
 
 }  // namespace cldnn
@@ -71,6 +71,14 @@ struct engine_configuration {
 
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
 
+    bool use_deferred_buffer_release;         ///< Keeps released memory pool buffers for reuse by any network of this
+                                              ///< engine instead of returning them to the driver. Trades higher memory
+                                              ///< consumption for allocation-free steady-state execution.
+
+    uint64_t kernels_build_memory_budget;     ///< Estimated host memory budget in bytes for concurrent OpenCL kernel
+                                              ///< compilations. 0 (default) keeps the compilation parallelism limited
+                                              ///< only by the task executor.
+
     /// @brief Constructs engine configuration with specified options.
     /// @param enable_profiling Enable per-primitive profiling.
     /// @param queue_type Specifies type of queue used by the runtime
@@ -83,6 +91,8 @@ struct engine_configuration {
     /// @param n_threads Max number of host threads used in gpu plugin
     /// @param throughput_streams Number of queues/streams executed in parallel by GPU plugin
     /// @param tuning_cache_path Path to tuning kernel cache
+    /// @param use_deferred_buffer_release Controls whether released memory pool buffers are kept for cross-network reuse
+    /// @param kernels_build_memory_budget Host memory budget in bytes for concurrent kernel compilations (0 - no limit)
     engine_configuration(
         bool enable_profiling = false,
         queue_types queue_type = queue_types::out_of_order,
@@ -93,7 +103,9 @@ struct engine_configuration {
         bool use_unified_shared_memory = true,
         const std::string& kernels_cache_path = "",
         uint16_t throughput_streams = 1,
-        const std::string& tuning_cache_path = "cache.json")
+        const std::string& tuning_cache_path = "cache.json",
+        bool use_deferred_buffer_release = false,
+        uint64_t kernels_build_memory_budget = 0)
         : enable_profiling(enable_profiling)
         , queue_type(queue_type)
         , sources_dumps_dir(sources_dumps_dir)
@@ -103,7 +115,9 @@ struct engine_configuration {
         , use_unified_shared_memory(use_unified_shared_memory)
         , kernels_cache_path(kernels_cache_path)
         , throughput_streams(throughput_streams)
-        , tuning_cache_path(tuning_cache_path) { }
+        , tuning_cache_path(tuning_cache_path)
+        , use_deferred_buffer_release(use_deferred_buffer_release)
+        , kernels_build_memory_budget(kernels_build_memory_budget) { }
 };
 
 /// @}
@@ -66,6 +66,9 @@ struct memory {
 
     virtual event::ptr copy_from(stream& /* stream */, const memory& /* other */) = 0;
     virtual event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */) = 0;
+    // Non-blocking device-to-host readback. Returns nullptr when the memory type can't read back
+    // asynchronously; the caller is expected to fall back to lock()/memcpy.
+    virtual event::ptr copy_to(stream& /* stream */, void* /* host_ptr */) = 0;
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
     virtual dnnl::memory get_onednn_memory(dnnl::memory::desc /* desc */, int64_t offset = 0) {
@@ -103,6 +106,7 @@ struct simple_attached_memory : memory {
 
     event::ptr copy_from(stream& /* stream */, const memory& /* other */) override { return nullptr; };
     event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */) override { return nullptr; }
+    event::ptr copy_to(stream& /* stream */, void* /* host_ptr */) override { return nullptr; }
 
 private:
     void* _pointer;
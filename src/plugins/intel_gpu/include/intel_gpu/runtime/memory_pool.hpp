@@ -55,6 +55,11 @@ struct memory_record {
     memory_record(memory_set users, memory_ptr& memory, uint32_t net_id, allocation_type type);
 };
 
+struct released_memory_record {
+    memory_ptr _memory;
+    allocation_type _type;
+};
+
 struct padded_pool_comparer {
     bool operator()(const layout& ll, const layout& rl) const {
         if (ll.format != rl.format)
@@ -92,10 +97,18 @@ class memory_pool {
 
     memory_ptr alloc_memory(const layout& layout, allocation_type type);
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t network_id);
+    static uint64_t align_to_size_class(uint64_t size);
+
+    memory_ptr claim_released_memory(const layout& layout, allocation_type type);
+    void defer_release(const memory_record& record);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
     std::multimap<uint64_t, memory_record> _no_reusable_pool;
+    // buffers with no remaining users, keyed by their byte capacity; when deferred release is enabled
+    // subsequent requests of any network of this engine claim them instead of allocating from the driver
+    std::multimap<uint64_t, released_memory_record> _released_pool;
+    bool _reuse_released_memory = false;
     engine* _engine;
 
 public:
@@ -125,6 +138,9 @@ public:
     void clear_pool();
     void clear_pool_for_network(uint32_t network_id);
     void release_memory(memory* memory, const primitive_id& id, uint32_t network_id);
+    // returns every parked released buffer to the driver, so its address space can be
+    // coalesced; called automatically when a driver allocation fails
+    void trim_released_memory();
 };
 
 }  // namespace cldnn
@@ -17,6 +17,13 @@
 
 namespace cldnn {
 
+/// Opaque handle to a pre-recorded sequence of kernels which can be resubmitted with a single
+/// host call, see stream::begin_command_list_capture().
+struct command_list {
+    using ptr = std::shared_ptr<command_list>;
+    virtual ~command_list() = default;
+};
+
 class stream {
 public:
     using ptr = std::shared_ptr<stream>;
@@ -39,6 +46,19 @@ public:
     virtual event::ptr create_user_event(bool set) = 0;
     virtual event::ptr create_base_event() = 0;
 
+    /// Starts recording subsequently enqueued kernels into a persistent command list in addition to
+    /// executing them, so the same sequence can later be resubmitted via replay_command_list()
+    /// without the per-kernel enqueue cost. Kernel arguments are captured at record time.
+    /// Returns nullptr when the stream cannot record (no runtime support, profiling enabled or
+    /// an out-of-order queue), in which case enqueues simply proceed as usual.
+    virtual command_list::ptr begin_command_list_capture() { return nullptr; }
+    /// Finishes the recording started by begin_command_list_capture().
+    virtual void end_command_list_capture() {}
+    /// Submits a previously recorded command list with a single host call.
+    /// Returns false when the list cannot be replayed; the caller is expected to fall back
+    /// to regular per-kernel enqueues.
+    virtual bool replay_command_list(const command_list::ptr& /* list */) { return false; }
+
     queue_types get_queue_type() const { return queue_type; }
 
     static queue_types detect_queue_type(engine_types engine_type, void* queue_handle);
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "program_helpers.h"
+#include "pass_manager.h"
+
+#include "eltwise_inst.h"
+#include "gemm_inst.h"
+#include "scaled_dot_product_attention_inst.h"
+#include "softmax_inst.h"
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <vector>
+
+using namespace cldnn;
+
+// Replaces the discrete transformer attention chain
+//     gemm(Q, K^T) -> [eltwise sum with a mask] -> softmax over X -> gemm(.., V)
+// with a single scaled_dot_product_attention primitive. The separate primitives
+// materialize the [.., seq_q, seq_kv] score tensor twice in global memory; the fused
+// kernel keeps the key/value tiles in local memory and only per-row softmax statistics
+// between them.
+void fuse_attention::run(program& p) {
+    bool update_processing_order = false;
+
+    std::list<program_node*> candidates;
+    for (auto& node : p.get_processing_order()) {
+        if (node->is_type<softmax>())
+            candidates.push_back(node);
+    }
+
+    for (auto* candidate : candidates) {
+        auto& softmax_node = candidate->as<softmax>();
+        if (softmax_node.get_primitive()->dimension != softmax::normalize_x)
+            continue;
+        if (softmax_node.get_users().size() != 1 || softmax_node.is_output())
+            continue;
+
+        // the only user has to be the gemm with the value input
+        auto& user_node = *softmax_node.get_users().front();
+        if (!user_node.is_type<gemm>())
+            continue;
+        auto& out_gemm_node = user_node.as<gemm>();
+        auto out_prim = out_gemm_node.typed_desc();
+        if (&out_gemm_node.get_dependency(0) != &softmax_node)
+            continue;
+        if (out_gemm_node.get_dependencies().size() != 2 ||
+            out_prim->transpose_input0 || out_prim->transpose_input1 ||
+            out_prim->alpha != 1.0f || out_prim->beta != 0.0f)
+            continue;
+
+        // the scores are produced by gemm(Q, K^T), optionally with an additive mask on top;
+        // the gemm alpha carries the softmax scale
+        program_node* scores_node = &softmax_node.get_dependency(0);
+        program_node* masked_node = nullptr;
+        program_node* mask_node = nullptr;
+        if (scores_node->is_type<eltwise>()) {
+            auto& eltwise_node = scores_node->as<eltwise>();
+            if (eltwise_node.get_primitive()->mode != eltwise_mode::sum ||
+                eltwise_node.get_dependencies().size() != 2 ||
+                eltwise_node.get_users().size() != 1 || eltwise_node.is_output())
+                continue;
+            masked_node = scores_node;
+            mask_node = &eltwise_node.get_dependency(1);
+            scores_node = &eltwise_node.get_dependency(0);
+        }
+        if (!scores_node->is_type<gemm>())
+            continue;
+        auto& scores_gemm_node = scores_node->as<gemm>();
+        auto scores_prim = scores_gemm_node.typed_desc();
+        if (scores_gemm_node.get_users().size() != 1 || scores_gemm_node.is_output())
+            continue;
+        if (scores_gemm_node.get_dependencies().size() != 2 ||
+            scores_prim->transpose_input0 || !scores_prim->transpose_input1 ||
+            scores_prim->beta != 0.0f)
+            continue;
+
+        auto& query_node = scores_gemm_node.get_dependency(0);
+        auto& key_node = scores_gemm_node.get_dependency(1);
+        auto& value_node = out_gemm_node.get_dependency(1);
+
+        auto query_layout = query_node.get_output_layout();
+        auto key_layout = key_node.get_output_layout();
+        auto value_layout = value_node.get_output_layout();
+
+        // the fused kernel supports fp16/fp32 bfyx tensors without batch broadcast:
+        // Q: [b, f, seq_q, head_size], K: [b, f, seq_kv, head_size], V: [b, f, seq_kv, head_size_v]
+        if (query_layout.format != format::bfyx || key_layout.format != format::bfyx ||
+            value_layout.format != format::bfyx)
+            continue;
+        if (query_layout.data_type != key_layout.data_type || query_layout.data_type != value_layout.data_type)
+            continue;
+        if (query_layout.data_type != data_types::f32 && query_layout.data_type != data_types::f16)
+            continue;
+        if (query_layout.size.batch[0] != key_layout.size.batch[0] ||
+            query_layout.size.batch[0] != value_layout.size.batch[0] ||
+            query_layout.size.feature[0] != key_layout.size.feature[0] ||
+            query_layout.size.feature[0] != value_layout.size.feature[0])
+            continue;
+        if (query_layout.size.spatial[0] != key_layout.size.spatial[0] ||
+            key_layout.size.spatial[1] != value_layout.size.spatial[1])
+            continue;
+
+        if (mask_node) {
+            auto mask_layout = mask_node->get_output_layout();
+            if (mask_layout.format != format::bfyx || mask_layout.data_type != query_layout.data_type)
+                continue;
+            // the mask has to be broadcastable to the [b, f, seq_q, seq_kv] scores
+            if ((mask_layout.size.batch[0] != 1 && mask_layout.size.batch[0] != query_layout.size.batch[0]) ||
+                (mask_layout.size.feature[0] != 1 && mask_layout.size.feature[0] != query_layout.size.feature[0]) ||
+                (mask_layout.size.spatial[1] != 1 && mask_layout.size.spatial[1] != query_layout.size.spatial[1]) ||
+                (mask_layout.size.spatial[0] != 1 && mask_layout.size.spatial[0] != key_layout.size.spatial[1]))
+                continue;
+        }
+
+        const primitive_id out_gemm_id = out_gemm_node.id();
+        const float scale = scores_prim->alpha;
+
+        std::vector<primitive_id> input_ids = { query_node.id(), key_node.id(), value_node.id() };
+        if (mask_node)
+            input_ids.push_back(mask_node->id());
+
+        auto was_output = out_gemm_node.is_output();
+        if (was_output) {
+            out_gemm_node.set_output(false);
+            auto& outputs = p.get_outputs();
+            outputs.erase(std::remove(outputs.begin(), outputs.end(), &out_gemm_node), outputs.end());
+        }
+        auto rename_id = out_gemm_id + "_tmp";
+        p.rename(out_gemm_node, rename_id);
+
+        auto attention_prim = std::make_shared<scaled_dot_product_attention>(out_gemm_id,
+                                                                             input_ids,
+                                                                             query_layout.data_type,
+                                                                             scale);
+        program_node& new_node = p.get_or_create(attention_prim);
+        auto& attention_node = new_node.as<scaled_dot_product_attention>();
+
+        p.add_connection(query_node, attention_node);
+        p.add_connection(key_node, attention_node);
+        p.add_connection(value_node, attention_node);
+        if (mask_node)
+            p.add_connection(*mask_node, attention_node);
+
+        auto out_gemm_node_itr = p.nodes_map.find(rename_id);
+        if (out_gemm_node_itr != p.nodes_map.end()) {
+            p.replace_all_usages(*out_gemm_node_itr->second, attention_node);
+        }
+
+        // drop the replaced chain; the intermediate nodes have no users left by now
+        for (auto* fused_node : { static_cast<program_node*>(&out_gemm_node), masked_node,
+                                  static_cast<program_node*>(&softmax_node),
+                                  static_cast<program_node*>(&scores_gemm_node) }) {
+            if (fused_node == nullptr)
+                continue;
+            p.remove_all_connections(*fused_node);
+            p.remove_if_dangling(*fused_node);
+        }
+
+        if (was_output) {
+            attention_node.set_output(true);
+            p.get_outputs().push_back(&attention_node);
+        }
+
+        p.mark_if_data_flow(attention_node);
+        attention_node.recalc_output_layout(true);
+
+        update_processing_order = true;
+    }
+
+    if (update_processing_order) {
+        p.get_processing_order().calc_processing_order(p);
+    }
+}
@@ -103,6 +103,14 @@ private:
     void conv_stride_extend(program& p, program_node& node, cldnn::tensor& tensor);
 };
 
+class fuse_attention : public base_pass {
+public:
+    fuse_attention() : base_pass("fuse_attention") {}
+
+private:
+    void run(program& p) override;
+};
+
 class graph_initializations : public base_pass {
 public:
     graph_initializations() : base_pass("init") {}
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "intel_gpu/primitives/scaled_dot_product_attention.hpp"
+#include "primitive_inst.h"
+
+#include <string>
+
+namespace cldnn {
+
+template <>
+struct typed_program_node<scaled_dot_product_attention> : public typed_program_node_base<scaled_dot_product_attention> {
+    using parent = typed_program_node_base<scaled_dot_product_attention>;
+
+public:
+    using parent::parent;
+
+    program_node& query() const { return get_dependency(0); }
+    program_node& key() const { return get_dependency(1); }
+    program_node& value() const { return get_dependency(2); }
+    program_node& mask() const { return get_dependency(3); }
+    bool has_mask() const { return get_dependencies().size() == 4; }
+};
+
+using scaled_dot_product_attention_node = typed_program_node<scaled_dot_product_attention>;
+
+template <>
+class typed_primitive_inst<scaled_dot_product_attention> : public typed_primitive_inst_base<scaled_dot_product_attention> {
+    using parent = typed_primitive_inst_base<scaled_dot_product_attention>;
+
+public:
+    static layout calc_output_layout(scaled_dot_product_attention_node const& node);
+    static std::string to_string(scaled_dot_product_attention_node const& node);
+
+public:
+    typed_primitive_inst(network& network, scaled_dot_product_attention_node const& node);
+};
+
+using scaled_dot_product_attention_inst = typed_primitive_inst<scaled_dot_product_attention>;
+
+}  // namespace cldnn
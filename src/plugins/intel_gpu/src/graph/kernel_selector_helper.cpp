@@ -9,6 +9,7 @@
 #include "to_string_utils.h"
 #include "program_node.h"
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -852,6 +853,11 @@ void set_params(const program_node& node, kernel_selector::params& params) {
     params.engineInfo.maxThreadsPerDevice = params.engineInfo.maxThreadsPerExecutionUnit * device_info.execution_units_count;
     params.engineInfo.deviceCache = program.get_tuning_cache();
     params.engineInfo.driverVersion = device_info.driver_version;
+    {
+        std::ostringstream device_id;
+        device_id << "0x" << std::hex << device_info.device_id;
+        params.engineInfo.deviceId = device_id.str();
+    }
     params.engineInfo.supportedSimdSizes = device_info.supported_simd_sizes;
 
     auto impl_forcing_bo = program.get_options().get<build_option_type::force_implementations>();
@@ -325,6 +325,10 @@ void network::set_arguments() {
         prim->set_arguments();
     }
     _reset_arguments = false;
+    // Recorded command lists keep the argument values captured at record time, so any
+    // argument change invalidates them and the next execution re-records.
+    _captured_ranges.clear();
+    _capture_done = false;
 }
 
 void network::reset_execution(bool wait) {
@@ -680,7 +684,70 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
     auto surf_lock = surfaces_lock::create(get_engine().type(), in_out_mem, get_stream());
 
     set_arguments();
-    for (auto& inst : _exec_order) {
+
+    // Stretches of the execution order whose arguments stay fixed between set_arguments() calls
+    // (no mutable inputs, not outputs) are pre-recorded into stream command lists on the first
+    // execution and afterwards resubmitted with a single host call each, which removes most of the
+    // per-kernel enqueue overhead. Streams that can't record (see begin_command_list_capture())
+    // simply keep the regular path.
+    GPU_DEBUG_IF(debug_config->verbose >= 1 || debug_config->dump_layers_path.length() > 0) {
+        // Debug paths need per-primitive execution and events
+        _captured_ranges.clear();
+        _capture_done = true;
+    }
+    const bool recording = !_capture_done;
+    bool capture_supported = true;
+    command_list::ptr open_list = nullptr;
+    std::vector<std::shared_ptr<primitive_inst>> open_list_insts;
+    size_t next_range = 0;
+
+    auto is_recordable = [](const std::shared_ptr<primitive_inst>& inst) {
+        return !inst->has_mutable_input() && !inst->is_output() && !inst->can_be_optimized() &&
+               inst->get_impl() != nullptr && !inst->get_impl()->is_cpu();
+    };
+    auto close_capture = [&]() {
+        get_stream().end_command_list_capture();
+        if (open_list_insts.size() >= 2)
+            _captured_ranges.push_back({open_list, open_list_insts});
+        open_list = nullptr;
+        open_list_insts.clear();
+    };
+
+    for (auto it = _exec_order.begin(); it != _exec_order.end(); ++it) {
+        auto& inst = *it;
+
+        if (!recording && next_range < _captured_ranges.size() &&
+            _captured_ranges[next_range].insts.front() == inst) {
+            auto& range = _captured_ranges[next_range];
+            if (get_stream().replay_command_list(range.list)) {
+                // Replayed kernels don't produce per-primitive events. Recording is limited to
+                // in-order queues where execution is synchronized by queue order, so completed
+                // user events are enough to keep the downstream bookkeeping valid.
+                for (auto& skipped : range.insts)
+                    _events[skipped->id()] = get_stream().create_user_event(true);
+                next_range++;
+                std::advance(it, range.insts.size() - 1);
+                continue;
+            }
+            // The driver rejected the recorded list - fall back to regular execution for good.
+            // Arguments set by set_arguments() are still valid, so nothing else has to change.
+            _captured_ranges.clear();
+        }
+
+        if (recording && capture_supported) {
+            if (is_recordable(inst)) {
+                if (!open_list) {
+                    open_list = get_stream().begin_command_list_capture();
+                    if (!open_list)
+                        capture_supported = false;
+                }
+                if (open_list)
+                    open_list_insts.push_back(inst);
+            } else if (open_list) {
+                close_capture();
+            }
+        }
+
         GPU_DEBUG_IF(debug_config->dump_layers_path.length() > 0) {
             auto& node = _program->get_node(inst->id());
             const std::string layer_name = node.id();
@@ -719,6 +786,12 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
         }
     }
 
+    if (recording) {
+        if (open_list)
+            close_capture();
+        _capture_done = true;
+    }
+
     for (auto& inst : _program->get_processing_order()) {
         // Special handling for mutable data. The event should be the same as the user or dependency with highest
         // processing_num as the mutable_data can be updated when is both user or dependency.
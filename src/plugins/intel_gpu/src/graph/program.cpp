@@ -496,6 +496,9 @@ void program::pre_optimize_graph(bool is_internal) {
     if (options.get<build_option_type::optimize_data>()->enabled()) {
         apply_opt_pass<pre_replace_deconv>(lo);
 
+        // has to see the discrete gemm - softmax - gemm chain before per-primitive fusing
+        apply_opt_pass<fuse_attention>();
+
         apply_opt_pass<prepare_primitive_fusing>(lo);
 
         apply_opt_pass<reorder_inputs>(lo, rf);
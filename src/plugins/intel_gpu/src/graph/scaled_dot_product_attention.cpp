@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_inst.h"
+#include "primitive_type_base.h"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+primitive_type_id scaled_dot_product_attention::type_id() {
+    static primitive_type_base<scaled_dot_product_attention> instance;
+    return &instance;
+}
+
+layout scaled_dot_product_attention_inst::calc_output_layout(scaled_dot_product_attention_node const& node) {
+    auto query_layout = node.query().get_non_padded_output_layout();
+    auto value_layout = node.value().get_non_padded_output_layout();
+    auto output_type = node.get_primitive()->output_data_type ? *node.get_primitive()->output_data_type : query_layout.data_type;
+
+    // output keeps the query shape with the innermost dimension taken from value: [b, f, seq_q, head_size_v]
+    auto output_size = query_layout.size;
+    output_size.spatial[0] = value_layout.size.spatial[0];
+
+    return layout(output_type, query_layout.format, output_size);
+}
+
+std::string scaled_dot_product_attention_inst::to_string(scaled_dot_product_attention_node const& node) {
+    auto node_info = node.desc_to_json();
+    auto desc = node.get_primitive();
+
+    std::stringstream primitive_description;
+
+    json_composite attention_info;
+    attention_info.add("query id", node.query().id());
+    attention_info.add("key id", node.key().id());
+    attention_info.add("value id", node.value().id());
+    if (node.has_mask())
+        attention_info.add("mask id", node.mask().id());
+    attention_info.add("scale", desc->scale);
+
+    node_info->add("scaled dot product attention info", attention_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+scaled_dot_product_attention_inst::typed_primitive_inst(network& network, scaled_dot_product_attention_node const& node)
+    : parent(network, node) {}
+}  // namespace cldnn
@@ -27,7 +27,8 @@ protected:
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
         return {FusedOpType::QUANTIZE,
                 FusedOpType::SCALE,
-                FusedOpType::ACTIVATION};
+                FusedOpType::ACTIVATION,
+                FusedOpType::ELTWISE};
     }
 };
 }  // namespace kernel_selector
@@ -21,7 +21,8 @@ public:
     std::vector<FusedOpType> GetSupportedFusedOps() const override {
         return {FusedOpType::QUANTIZE,
                 FusedOpType::SCALE,
-                FusedOpType::ACTIVATION};
+                FusedOpType::ACTIVATION,
+                FusedOpType::ELTWISE};
     }
 };
 }  // namespace kernel_selector
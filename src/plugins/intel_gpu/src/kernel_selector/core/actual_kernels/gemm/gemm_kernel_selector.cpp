@@ -5,6 +5,7 @@
 #include "gemm_kernel_selector.h"
 #include "gemm_kernel_ref.h"
 #include "gemm_kernel_tiled_opt.h"
+#include "gemm_kernel_slm_skinny.h"
 #include "gemm_kernel_mmad_int8.h"
 #include "gemm_kernel_mmad_int8_slm.h"
 
@@ -12,6 +13,7 @@ namespace kernel_selector {
 gemm_kernel_selector::gemm_kernel_selector() {
     Attach<GemmKernelRef>();
     Attach<GemmKernelTiledOpt>();
+    Attach<GemmKernelSlmSkinny>();
     Attach<GemmKernelMMADint8>();
     Attach<GemmKernelMMADslmInt8>();
 }
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gemm_kernel_slm_skinny.h"
+
+namespace kernel_selector {
+ParamsKey GemmKernelSlmSkinny::GetSupportedKey() const {
+    ParamsKey k;
+
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::UINT8);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableInputLayout(DataLayout::bfzyx);
+    k.EnableOutputLayout(DataLayout::bfzyx);
+    k.EnableInputLayout(DataLayout::bfwzyx);
+    k.EnableOutputLayout(DataLayout::bfwzyx);
+
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+
+    return k;
+}
+
+GemmKernelSlmSkinny::GemmTuningData GemmKernelSlmSkinny::SetTuningParams(const gemm_params& params) const {
+    GemmTuningData tuning_data;
+
+    auto k_size = params.inputs[0].X().v;
+
+    tuning_data.simd_size = 16;
+    // short reduction dimensions do not give every slice enough work to amortize the final
+    // cross-subgroup reduction, so fall back to a smaller work group
+    tuning_data.k_slices = k_size >= 512 ? 8 : 4;
+
+    return tuning_data;
+}
+
+GemmKernelBase::DispatchData GemmKernelSlmSkinny::SetDefault(const gemm_params& params) const {
+    const auto& output = params.output;
+
+    DispatchData dispatchData;
+    GemmTuningData td = SetTuningParams(params);
+
+    auto m_size = output.Y().v;
+    auto n_size = output.X().v;
+    auto total_batches = output.LogicalSize() / (n_size * m_size);
+
+    dispatchData.gws[0] = Align(n_size, td.simd_size);
+    dispatchData.gws[1] = m_size * td.k_slices;
+    dispatchData.gws[2] = total_batches;
+
+    dispatchData.lws[0] = td.simd_size;
+    dispatchData.lws[1] = td.k_slices;
+    dispatchData.lws[2] = 1;
+
+    return dispatchData;
+}
+
+JitConstants GemmKernelSlmSkinny::GetJitConstants(const gemm_params& params) const {
+    JitConstants jit = Parent::GetJitConstants(params);
+
+    const auto& output = params.output;
+    GemmTuningData tuning_data = SetTuningParams(params);
+
+    auto m_size = output.Y().v;
+    auto n_size = output.X().v;
+    auto k_size = params.inputs[0].X().v;
+
+    jit.Merge(MakeTypeJitConstants(params.inputs[0].GetDType(), "ACCUMULATOR"));
+
+    jit.AddConstants({
+        MakeJitConstant("M", m_size),
+        MakeJitConstant("K", k_size),
+        MakeJitConstant("N", n_size),
+        MakeJitConstant("SIMD_WIDTH", tuning_data.simd_size),
+        MakeJitConstant("K_SLICES", tuning_data.k_slices),
+        MakeJitConstant("SLM_TILE_K", tuning_data.simd_size * tuning_data.k_slices),
+        MakeJitConstant("N_NOT_DIVISIBLE", n_size % tuning_data.simd_size != 0),
+    });
+
+    if (!params.fused_ops.empty()) {
+        auto input_dt = GetActivationType(params);
+        FusedOpsConfiguration conf = { "", {"b", "f", "y", "x"},
+                                       "dequantized",
+                                       input_dt,
+                                       1,
+                                       LoadType::LT_UNALIGNED,
+                                       BoundaryCheck::ENABLED,
+                                       IndexType::TENSOR_COORD };
+        jit.Merge(MakeFusedOpsJitConstants(params, { conf }));
+    }
+
+    return jit;
+}
+
+KernelsData GemmKernelSlmSkinny::GetKernelsData(const Params& params, const optional_params& options) const {
+    return GetCommonKernelsData(params, options);
+}
+
+KernelsPriority GemmKernelSlmSkinny::GetKernelsPriority(const Params& params, const optional_params& /*options*/) const {
+    const auto& gmm_params = static_cast<const gemm_params&>(params);
+
+    // beat the square-tiled kernel only on the clearly skinny shapes, it stays ahead
+    // once there are enough output rows to occupy the machine on its own
+    return gmm_params.output.Y().v <= 8 ? FORCE_PRIORITY_2 : FORCE_PRIORITY_4;
+}
+
+bool GemmKernelSlmSkinny::Validate(const Params& params, const optional_params& options) const {
+    if (!Parent::Validate(params, options))
+        return false;
+
+    const auto& gmm_params = static_cast<const gemm_params&>(params);
+
+    // transposed cases keep the cooperative loads from being coalesced, leave them to gemm_tiled_opt
+    if (gmm_params.transpose_input0 || gmm_params.transpose_input1)
+        return false;
+
+    GemmTuningData td = SetTuningParams(gmm_params);
+    auto m_size = gmm_params.output.Y().v;
+    auto n_size = gmm_params.output.X().v;
+    auto k_size = gmm_params.inputs[0].X().v;
+
+    // the kernel only pays off while the M dimension is too small to fill the machine with
+    // the square tiling; the K splitting needs a reduction dimension worth slicing
+    if (m_size > 16 || n_size < td.simd_size || k_size < 64)
+        return false;
+
+    for (size_t i = 1; i < gmm_params.inputs.size(); i++)
+        if (gmm_params.inputs[0].GetDType() != gmm_params.inputs[i].GetDType())
+            return false;
+
+    return true;
+}
+}  // namespace kernel_selector
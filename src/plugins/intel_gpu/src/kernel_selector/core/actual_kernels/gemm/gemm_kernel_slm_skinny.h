@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "gemm_kernel_base.h"
+#include <vector>
+
+namespace kernel_selector {
+// GEMM kernel for skinny shapes (small M, large K and N) that the square-tiled kernels
+// cannot fill the machine with: the whole A row is staged in SLM once per work group and
+// the K dimension is split across several subgroups, so every output column tile gets
+// K_SLICES cooperating subgroups instead of a single one.
+class GemmKernelSlmSkinny : public GemmKernelBase {
+public:
+    using Parent = GemmKernelBase;
+
+    struct GemmTuningData {
+        size_t simd_size = 16;
+        size_t k_slices = 8;
+    };
+
+    GemmKernelSlmSkinny() : GemmKernelBase("gemm_slm_skinny") {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    std::vector<FusedOpType> GetSupportedFusedOps() const override {
+        return { FusedOpType::QUANTIZE,
+                 FusedOpType::ACTIVATION,
+                 FusedOpType::SCALE,
+                 FusedOpType::ELTWISE };
+    }
+    bool Validate(const Params& params, const optional_params& options) const override;
+    DispatchData SetDefault(const gemm_params& params) const override;
+    JitConstants GetJitConstants(const gemm_params& params) const override;
+    GemmTuningData SetTuningParams(const gemm_params& params) const;
+};
+}  // namespace kernel_selector
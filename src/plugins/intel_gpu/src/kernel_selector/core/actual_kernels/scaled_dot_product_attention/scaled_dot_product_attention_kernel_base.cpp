@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_base.h"
+#include "kernel_selector_utils.h"
+#include <vector>
+
+namespace kernel_selector {
+
+static constexpr size_t query_block_size = 16;
+static constexpr size_t key_block_size = 16;
+
+bool ScaledDotProductAttentionKernelBase::Validate(const Params& params, const optional_params& options) const {
+    if (!KernelBaseOpenCL::Validate(params, options))
+        return false;
+
+    const auto& prim_params = static_cast<const scaled_dot_product_attention_params&>(params);
+    const size_t expected_inputs = prim_params.has_mask ? 4 : 3;
+    if (prim_params.inputs.size() != expected_inputs)
+        return false;
+
+    return true;
+}
+
+JitConstants ScaledDotProductAttentionKernelBase::GetJitConstants(const scaled_dot_product_attention_params& params,
+                                                                  ScaledDotProductAttentionKernelBase::DispatchData) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+    jit.Merge(MakeTypeJitConstants(Datatype::F32, "ACCUMULATOR"));
+    jit.AddConstant(MakeJitConstant("SCALE", params.scale));
+    jit.AddConstant(MakeJitConstant("HAS_MASK", params.has_mask));
+    jit.AddConstant(MakeJitConstant("QUERY_BLOCK_SIZE", query_block_size));
+    jit.AddConstant(MakeJitConstant("KEY_BLOCK_SIZE", key_block_size));
+
+    return jit;
+}
+
+ScaledDotProductAttentionKernelBase::DispatchData ScaledDotProductAttentionKernelBase::SetDefault(
+    const scaled_dot_product_attention_params& params) const {
+    const auto& output = params.output;
+
+    // one work item per query row; rows of the same [b, f] slice are grouped so the
+    // work group can stage the shared key/value tiles in local memory
+    DispatchData dispatchData;
+    dispatchData.gws = { output.Batch().v * output.Feature().v, Align(output.Y().v, query_block_size), 1 };
+    dispatchData.lws = { 1, query_block_size, 1 };
+
+    return dispatchData;
+}
+
+KernelsData ScaledDotProductAttentionKernelBase::GetCommonKernelsData(const Params& params,
+                                                                      const optional_params& options) const {
+    assert(params.GetType() == KernelType::SCALED_DOT_PRODUCT_ATTENTION);
+
+    if (!Validate(params, options))
+        return {};
+
+    const scaled_dot_product_attention_params& orgParams = static_cast<const scaled_dot_product_attention_params&>(params);
+
+    DispatchData dispatchData = SetDefault(orgParams);
+
+    KernelData kd = KernelData::Default<scaled_dot_product_attention_params>(params);
+
+    auto cldnn_jit = GetJitConstants(orgParams, dispatchData);
+    auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, params, options);
+    auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel,
+                     dispatchData,
+                     params.engineInfo,
+                     kernelName,
+                     jit,
+                     entry_point,
+                     "",
+                     false,
+                     false,
+                     static_cast<uint32_t>(orgParams.inputs.size()),
+                     GetFusedPrimitiveInputsCount(params));
+
+    return {kd};
+}
+
+}  // namespace kernel_selector
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+#include "kernel_selector_params.h"
+#include <string>
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_params : public base_params {
+    scaled_dot_product_attention_params() : base_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION) {}
+
+    float scale = 1.0f;
+    bool has_mask = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// scaled_dot_product_attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct scaled_dot_product_attention_optional_params : optional_params {
+    scaled_dot_product_attention_optional_params() : optional_params(KernelType::SCALED_DOT_PRODUCT_ATTENTION) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ScaledDotProductAttentionKernelBase
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class ScaledDotProductAttentionKernelBase : public KernelBaseOpenCL {
+public:
+    using KernelBaseOpenCL::KernelBaseOpenCL;
+    virtual ~ScaledDotProductAttentionKernelBase() {}
+    using DispatchData = CommonDispatchData;
+
+protected:
+    bool Validate(const Params& params, const optional_params& options) const override;
+    virtual JitConstants GetJitConstants(const scaled_dot_product_attention_params& params, DispatchData dispatchData) const;
+    virtual DispatchData SetDefault(const scaled_dot_product_attention_params& params) const;
+    KernelsData GetCommonKernelsData(const Params& params, const optional_params&) const;
+};
+}  // namespace kernel_selector
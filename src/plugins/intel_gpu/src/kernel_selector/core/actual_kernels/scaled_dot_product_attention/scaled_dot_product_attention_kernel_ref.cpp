@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_kernel_ref.h"
+
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+ParamsKey ScaledDotProductAttentionKernelRef::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+
+    k.EnableDifferentTypes();
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    return k;
+}
+
+KernelsData ScaledDotProductAttentionKernelRef::GetKernelsData(const Params& params, const optional_params& optParams) const {
+    return GetCommonKernelsData(params, optParams);
+}
+
+KernelsPriority ScaledDotProductAttentionKernelRef::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_9;
+}
+
+}  // namespace kernel_selector
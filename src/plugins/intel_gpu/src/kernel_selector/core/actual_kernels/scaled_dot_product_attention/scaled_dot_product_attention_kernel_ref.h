@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "scaled_dot_product_attention_kernel_base.h"
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+class ScaledDotProductAttentionKernelRef : public ScaledDotProductAttentionKernelBase {
+public:
+    using Parent = ScaledDotProductAttentionKernelBase;
+    ScaledDotProductAttentionKernelRef() : ScaledDotProductAttentionKernelBase("scaled_dot_product_attention_ref") {}
+    virtual ~ScaledDotProductAttentionKernelRef() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+};
+}  // namespace kernel_selector
@@ -139,18 +139,33 @@ TuningCache::Entry TuningCache::LoadKernel_v1(const Params& params, uint32_t com
     return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
 }
 
+std::string TuningCache::DeviceKey(const Params& params, uint32_t computeUnitsCount) {
+    auto computeUnitsStr = std::to_string(computeUnitsCount);
+    if (params.engineInfo.deviceId.empty())
+        return computeUnitsStr;
+    return params.engineInfo.deviceId + "_" + computeUnitsStr;
+}
+
 TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t computeUnitsCount) {
+    auto result = LoadKernel_v2(params, DeviceKey(params, computeUnitsCount));
+    // Fall back to entries keyed by compute units only - caches tuned before the device id became
+    // part of the key, including the bundled offline caches.
+    if (std::get<0>(result).empty() && !params.engineInfo.deviceId.empty())
+        result = LoadKernel_v2(params, std::to_string(computeUnitsCount));
+    return result;
+}
+
+TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, const std::string& deviceKey) {
     Entry result = std::make_tuple<std::string, int>("", 0);
 
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
 
     auto v2It = cache.FindMember(version2Marker);
     if (v2It == cache.MemberEnd())
         return result;
 
-    auto computeUnitsIt = v2It->value.FindMember(computeUnitsStr.c_str());
+    auto computeUnitsIt = v2It->value.FindMember(deviceKey.c_str());
     if (computeUnitsIt == v2It->value.MemberEnd())
         return result;
 
@@ -173,22 +188,22 @@ void TuningCache::StoreKernel(const Params& params, const std::string& implement
 void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount, const std::string& implementationName, int tuneIndex) {
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
+    auto deviceKeyStr = DeviceKey(params, computeUnitsCount);
     auto& v2Cache = cache[version2Marker];
 
-    if (!v2Cache.HasMember(computeUnitsStr.c_str())) {
-        auto newName = rapidjson::Value(computeUnitsStr.c_str(), cache.GetAllocator());
+    if (!v2Cache.HasMember(deviceKeyStr.c_str())) {
+        auto newName = rapidjson::Value(deviceKeyStr.c_str(), cache.GetAllocator());
         auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
         v2Cache.AddMember(newName, newObj, cache.GetAllocator());
     }
 
-    if (!v2Cache[computeUnitsStr.c_str()].HasMember(kTypeStr.c_str())) {
+    if (!v2Cache[deviceKeyStr.c_str()].HasMember(kTypeStr.c_str())) {
         auto newName = rapidjson::Value(kTypeStr.c_str(), cache.GetAllocator());
         auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
-        v2Cache[computeUnitsStr.c_str()].AddMember(newName, newObj, cache.GetAllocator());
+        v2Cache[deviceKeyStr.c_str()].AddMember(newName, newObj, cache.GetAllocator());
     }
 
-    auto& deviceCache = v2Cache[computeUnitsStr.c_str()][kTypeStr.c_str()];
+    auto& deviceCache = v2Cache[deviceKeyStr.c_str()][kTypeStr.c_str()];
 
     auto paramName = rapidjson::Value(paramStr.c_str(), cache.GetAllocator());
     auto implDetails = rapidjson::Value(rapidjson::Type::kArrayType);
@@ -236,15 +251,23 @@ bool TuningCache::RemoveKernel_v1(const Params& params, uint32_t computeUnitsCou
 }
 
 bool TuningCache::RemoveKernel_v2(const Params& params, uint32_t computeUnitsCount) {
+    bool removed = RemoveKernel_v2(params, DeviceKey(params, computeUnitsCount));
+    // Remove a stale entry keyed by compute units only as well, so it doesn't keep shadowing the
+    // device-keyed one through the legacy fallback.
+    if (!params.engineInfo.deviceId.empty())
+        removed |= RemoveKernel_v2(params, std::to_string(computeUnitsCount));
+    return removed;
+}
+
+bool TuningCache::RemoveKernel_v2(const Params& params, const std::string& deviceKey) {
     auto kTypeStr = toString(params.GetType());
     auto paramStr = params.to_cache_string_v2();
-    auto computeUnitsStr = std::to_string(computeUnitsCount);
 
     auto v2It = cache.FindMember(version2Marker);
     if (v2It == cache.MemberEnd())
         return false;
 
-    auto computeUnitsIt = v2It->value.FindMember(computeUnitsStr.c_str());
+    auto computeUnitsIt = v2It->value.FindMember(deviceKey.c_str());
     if (computeUnitsIt == v2It->value.MemberEnd())
         return false;
 
@@ -48,11 +48,18 @@ public:
     bool NeedsSave() const { return needsSave; }
 
 private:
+    // Version 2 entries are keyed by device id and compute units count, so caches tuned for
+    // different SKUs with the same EU count can share one file. Caches written before the device id
+    // became part of the key are still readable through the plain compute units entry.
+    static std::string DeviceKey(const Params& params, uint32_t computeUnitsCount);
+
     Entry LoadKernel_v1(const Params& params, uint32_t computeUnitsCount);
     Entry LoadKernel_v2(const Params& params, uint32_t computeUnitsCount);
+    Entry LoadKernel_v2(const Params& params, const std::string& deviceKey);
 
     bool RemoveKernel_v1(const Params& params, uint32_t computeUnitsCount);
     bool RemoveKernel_v2(const Params& params, uint32_t computeUnitsCount);
+    bool RemoveKernel_v2(const Params& params, const std::string& deviceKey);
 
 
     rapidjson::Document cache;
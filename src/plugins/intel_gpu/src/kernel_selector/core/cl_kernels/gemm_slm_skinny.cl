@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/fetch_data.cl"
+#include "include/batch_headers/data_types.cl"
+
+#define unroll_for __attribute__((opencl_unroll_hint)) for
+
+inline uint FUNC(get_input0_batch_offset)(uint b, uint f, uint w, uint z) {
+#if INPUT0_SIMPLE
+    return GET_DATA_INDEX_6D_SAFE(INPUT0, b, f, w, z, 0, 0);
+#else // INPUT0_SIMPLE
+#   error gemm_slm_skinny.cl : Unsupported input 0 format
+#endif // INPUT0_SIMPLE
+}
+
+inline uint FUNC(get_input1_batch_offset)(uint b, uint f, uint w, uint z) {
+#if INPUT1_SIMPLE
+    return GET_DATA_INDEX_6D_SAFE(INPUT1, b, f, w, z, 0, 0);
+#else // INPUT1_SIMPLE
+#   error gemm_slm_skinny.cl : Unsupported input 1 format
+#endif // INPUT1_SIMPLE
+}
+
+#ifdef INPUT2_TYPE
+inline uint FUNC(get_input2_batch_offset)(uint b, uint f, uint w, uint z) {
+#if INPUT2_SIMPLE
+    return GET_DATA_INDEX_6D_SAFE(INPUT2, b, f, w, z, 0, 0);
+#else // INPUT2_SIMPLE
+#   error gemm_slm_skinny.cl : Unsupported input 2 format
+#endif // INPUT2_SIMPLE
+}
+#endif // INPUT2_TYPE
+
+inline uint FUNC(get_output_batch_offset)(uint b, uint f, uint w, uint z) {
+#if OUTPUT_SIMPLE
+    return GET_DATA_INDEX_6D(OUTPUT, b, f, w, z, 0, 0);
+#else // OUTPUT_SIMPLE
+#   error gemm_slm_skinny.cl : Unsupported output format
+#endif // OUTPUT_SIMPLE
+}
+
+// GEMM kernel for skinny shapes: M is too small for the square tiling to fill the machine,
+// so the K dimension is split across K_SLICES subgroups of one work group. The A row strip
+// is staged in SLM with a single coalesced load shared by all slices, each slice accumulates
+// a partial dot product over its part of the strip, and the first subgroup folds the partial
+// sums and writes the SIMD_WIDTH-wide output column tile.
+__attribute__((intel_reqd_sub_group_size(SIMD_WIDTH)))
+__attribute__((reqd_work_group_size(SIMD_WIDTH, K_SLICES, 1)))
+KERNEL(gemm_slm_skinny)(
+    const __global INPUT0_TYPE* input0,
+    const __global INPUT1_TYPE* input1,
+#ifdef INPUT2_TYPE
+    const __global INPUT2_TYPE* input2,
+#endif // INPUT2_TYPE
+    __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif // HAS_FUSED_OPS_DECLS
+    )
+{
+    const uint sglid = (uint)get_sub_group_local_id();
+    const uint slice = (uint)get_local_id(1);
+    const uint tile_n_offset = (uint)get_group_id(0) * SIMD_WIDTH;
+    const uint x = tile_n_offset + sglid;
+    const uint y = (uint)get_group_id(1);
+    uint batch_number = (uint)get_global_id(2);
+
+    const uint z = batch_number % OUTPUT_SIZE_Z;
+    batch_number /= OUTPUT_SIZE_Z;
+    const uint w = batch_number % OUTPUT_SIZE_W;
+    batch_number /= OUTPUT_SIZE_W;
+    const uint f = batch_number % OUTPUT_FEATURE_NUM;
+    batch_number /= OUTPUT_FEATURE_NUM;
+    const uint b = batch_number % OUTPUT_BATCH_NUM;
+
+    const uint batch_offset_input0 = FUNC_CALL(get_input0_batch_offset)(b, f, w, z);
+    const uint batch_offset_input1 = FUNC_CALL(get_input1_batch_offset)(b, f, w, z);
+#ifdef INPUT2_TYPE
+    const uint batch_offset_input2 = FUNC_CALL(get_input2_batch_offset)(b, f, w, z);
+#endif // INPUT2_TYPE
+    const uint batch_offset_output = FUNC_CALL(get_output_batch_offset)(b, f, w, z);
+
+    const __global INPUT0_TYPE* a_ptr = input0 + batch_offset_input0 + y * K;
+    const __global INPUT1_TYPE* b_ptr = input1 + batch_offset_input1;
+
+    __local INPUT0_TYPE a_slm[SLM_TILE_K];
+    __local ACCUMULATOR_TYPE acc_slm[K_SLICES * SIMD_WIDTH];
+
+    const uint lid = slice * SIMD_WIDTH + sglid;
+    ACCUMULATOR_TYPE acc = ACCUMULATOR_VAL_ZERO;
+
+    for (uint kb = 0; kb < K; kb += SLM_TILE_K) {
+        // the whole work group stages the next strip of the A row with one coalesced load
+        const uint k_load = kb + lid;
+        a_slm[lid] = k_load < K ? a_ptr[k_load] : INPUT0_VAL_ZERO;
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        // each subgroup consumes its own SIMD_WIDTH-wide part of the staged strip
+        const uint k_base = kb + slice * SIMD_WIDTH;
+        unroll_for (uint i = 0; i < SIMD_WIDTH; i++) {
+            const uint k = k_base + i;
+            if (k < K) {
+#if N_NOT_DIVISIBLE
+                INPUT1_TYPE b_read = x < N ? b_ptr[k * N + x] : INPUT1_VAL_ZERO;
+#else // N_NOT_DIVISIBLE
+                INPUT1_TYPE b_read = BLOCK_READN(INPUT1_TYPE, 1, b_ptr, k * N + tile_n_offset);
+#endif // N_NOT_DIVISIBLE
+                acc = mad(TO_ACCUMULATOR_TYPE(a_slm[slice * SIMD_WIDTH + i]), TO_ACCUMULATOR_TYPE(b_read), acc);
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    acc_slm[lid] = acc;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // the first subgroup folds the per-slice partial sums and writes the column tile
+    if (slice == 0) {
+        unroll_for (uint s = 1; s < K_SLICES; s++) {
+            acc += acc_slm[s * SIMD_WIDTH + sglid];
+        }
+
+        if (x < N) {
+#ifdef INPUT2_TYPE
+            ACCUMULATOR_TYPE dequantized = TO_ACCUMULATOR_TYPE(ALPHA) * acc +
+                                           TO_ACCUMULATOR_TYPE(BETA) * TO_ACCUMULATOR_TYPE(input2[batch_offset_input2 + y * N + x]);
+#else // INPUT2_TYPE
+            ACCUMULATOR_TYPE dequantized = TO_ACCUMULATOR_TYPE(ALPHA) * acc;
+#endif // INPUT2_TYPE
+
+            const uint dst_index = batch_offset_output + y * N + x;
+#if HAS_FUSED_OPS
+            FUSED_OPS;
+            OUTPUT_TYPE res = FUSED_OPS_RESULT;
+            output[dst_index] = res;
+#else // HAS_FUSED_OPS
+            output[dst_index] = TO_OUTPUT_TYPE(dequantized);
+#endif // HAS_FUSED_OPS
+        }
+    }
+}
+
+#undef unroll_for
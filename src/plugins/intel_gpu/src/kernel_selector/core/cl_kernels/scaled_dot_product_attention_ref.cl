@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/data_types.cl"
+#include "include/batch_headers/fetch_data.cl"
+
+#define HEAD_SIZE       INPUT0_SIZE_X
+#define VALUE_HEAD_SIZE INPUT2_SIZE_X
+#define SEQ_Q           INPUT0_SIZE_Y
+#define SEQ_KV          INPUT1_SIZE_Y
+
+// Fused softmax(query x key^T * SCALE [+ mask]) x value.
+// Each work item owns one query row and the softmax is computed online while streaming
+// over the key/value rows, so the [SEQ_Q, SEQ_KV] score matrix is never written to global
+// memory. The work group covers QUERY_BLOCK_SIZE rows of the same [b, f] slice and stages
+// the key/value tiles shared by those rows in local memory, KEY_BLOCK_SIZE rows at a time.
+__attribute__((reqd_work_group_size(1, QUERY_BLOCK_SIZE, 1)))
+KERNEL(scaled_dot_product_attention_ref)(
+    const __global INPUT0_TYPE* query,
+    const __global INPUT1_TYPE* key,
+    const __global INPUT2_TYPE* value,
+#if HAS_MASK
+    const __global INPUT3_TYPE* mask,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint bf = get_global_id(0);
+    const uint b = bf / OUTPUT_FEATURE_NUM;
+    const uint f = bf % OUTPUT_FEATURE_NUM;
+    const uint m = get_global_id(1);
+    const uint lid = get_local_id(1);
+
+    __local ACCUMULATOR_TYPE key_tile[KEY_BLOCK_SIZE * HEAD_SIZE];
+    __local ACCUMULATOR_TYPE value_tile[KEY_BLOCK_SIZE * VALUE_HEAD_SIZE];
+
+    ACCUMULATOR_TYPE query_row[HEAD_SIZE];
+    if (m < SEQ_Q) {
+        for (uint d = 0; d < HEAD_SIZE; d++)
+            query_row[d] = TO_ACCUMULATOR_TYPE(query[INPUT0_GET_INDEX(b, f, m, d)]);
+    }
+
+    ACCUMULATOR_TYPE running_max = -ACCUMULATOR_VAL_MAX;
+    ACCUMULATOR_TYPE denom = ACCUMULATOR_VAL_ZERO;
+    ACCUMULATOR_TYPE acc[VALUE_HEAD_SIZE];
+    for (uint d = 0; d < VALUE_HEAD_SIZE; d++)
+        acc[d] = ACCUMULATOR_VAL_ZERO;
+
+    for (uint j0 = 0; j0 < SEQ_KV; j0 += KEY_BLOCK_SIZE) {
+        const uint block = min((uint)KEY_BLOCK_SIZE, SEQ_KV - j0);
+
+        // cooperative load of the key/value tiles shared by the whole work group
+        for (uint idx = lid; idx < block * HEAD_SIZE; idx += QUERY_BLOCK_SIZE)
+            key_tile[idx] = TO_ACCUMULATOR_TYPE(key[INPUT1_GET_INDEX(b, f, j0 + idx / HEAD_SIZE, idx % HEAD_SIZE)]);
+        for (uint idx = lid; idx < block * VALUE_HEAD_SIZE; idx += QUERY_BLOCK_SIZE)
+            value_tile[idx] = TO_ACCUMULATOR_TYPE(value[INPUT2_GET_INDEX(b, f, j0 + idx / VALUE_HEAD_SIZE, idx % VALUE_HEAD_SIZE)]);
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (m < SEQ_Q) {
+            for (uint jj = 0; jj < block; jj++) {
+                ACCUMULATOR_TYPE score = ACCUMULATOR_VAL_ZERO;
+                for (uint d = 0; d < HEAD_SIZE; d++)
+                    score += query_row[d] * key_tile[jj * HEAD_SIZE + d];
+                score *= TO_ACCUMULATOR_TYPE(SCALE);
+#if HAS_MASK
+                const uint j = j0 + jj;
+                score += TO_ACCUMULATOR_TYPE(mask[INPUT3_GET_INDEX(b % INPUT3_BATCH_NUM,
+                                                                   f % INPUT3_FEATURE_NUM,
+                                                                   m % INPUT3_SIZE_Y,
+                                                                   j % INPUT3_SIZE_X)]);
+#endif
+
+                ACCUMULATOR_TYPE weight;
+                if (score > running_max) {
+                    // a new maximum: rescale the statistics accumulated so far
+                    const ACCUMULATOR_TYPE correction = exp(running_max - score);
+                    denom *= correction;
+                    for (uint d = 0; d < VALUE_HEAD_SIZE; d++)
+                        acc[d] *= correction;
+                    running_max = score;
+                    weight = ACCUMULATOR_VAL_ONE;
+                } else {
+                    weight = exp(score - running_max);
+                }
+
+                denom += weight;
+                for (uint d = 0; d < VALUE_HEAD_SIZE; d++)
+                    acc[d] += weight * value_tile[jj * VALUE_HEAD_SIZE + d];
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (m < SEQ_Q) {
+        const ACCUMULATOR_TYPE inv_denom = ACCUMULATOR_VAL_ONE / denom;
+        for (uint d = 0; d < VALUE_HEAD_SIZE; d++)
+            output[OUTPUT_GET_INDEX(b, f, m, d)] = TO_OUTPUT_TYPE(acc[d] * inv_denom);
+    }
+}
+
+#undef HEAD_SIZE
+#undef VALUE_HEAD_SIZE
+#undef SEQ_Q
+#undef SEQ_KV
@@ -8,8 +8,10 @@
 #include "intel_gpu/plugin/infer_request.hpp"
 #include "intel_gpu/plugin/compiled_model.hpp"
 #include "intel_gpu/plugin/async_infer_request.hpp"
+#include "intel_gpu/plugin/transformations_pipeline.hpp"
 
 #include <description_buffer.hpp>
+#include <ie_ngraph_utils.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "threading/ie_cpu_streams_executor.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
@@ -171,6 +173,45 @@ std::shared_ptr<InferenceEngine::RemoteContext> CompiledModel::GetContext() cons
     return m_context;
 }
 
+void CompiledModel::SetSourceNetwork(const InferenceEngine::CNNNetwork& network) {
+    m_srcNetwork = InferenceEngine::details::cloneNetwork(network);
+    m_hasSrcNetwork = true;
+}
+
+std::shared_ptr<Graph> CompiledModel::GetGraphForShapes(const std::map<std::string, InferenceEngine::SizeVector>& shapes) {
+    if (m_graphs.empty())
+        IE_THROW(NetworkNotLoaded);
+    if (m_config.throughput_streams > 1 || m_config.max_dynamic_batch > 1)
+        IE_THROW() << "Per-shape graph cache is not supported with multiple streams or dynamic batch";
+    if (!m_hasSrcNetwork)
+        IE_THROW() << "Per-shape graph cache requires the source network to be retained on network load";
+
+    std::string key;
+    for (auto& shape : shapes) {
+        key += shape.first + ":";
+        for (auto& dim : shape.second)
+            key += std::to_string(dim) + ",";
+        key += ";";
+    }
+
+    std::lock_guard<std::mutex> lock(m_shapeGraphsMutex);
+    auto it = m_shapeGraphs.find(key);
+    if (it != m_shapeGraphs.end())
+        return it->second;
+
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "CompiledModel::GetGraphForShapes");
+    auto reshapedNetwork = InferenceEngine::details::cloneNetwork(m_srcNetwork);
+    reshapedNetwork.reshape(shapes);
+
+    auto func = reshapedNetwork.getFunction();
+    TransformationsPipeline transformations(m_config, m_graphs.front()->GetEngine()->get_device_info());
+    transformations.apply(func);
+
+    auto graph = std::make_shared<Graph>(reshapedNetwork, m_context, m_config, 0);
+    m_shapeGraphs[key] = graph;
+    return graph;
+}
+
 }  // namespace intel_gpu
 }  // namespace runtime
 }  // namespace ov
@@ -301,6 +301,34 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
             } else {
                 IE_THROW(NotFound) << "Unsupported KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS flag value: " << val;
             }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_ENABLE_AUTO_FP16) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                enable_auto_fp16 = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                enable_auto_fp16 = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported KEY_GPU_ENABLE_AUTO_FP16 flag value: " << val;
+            }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_ENABLE_PER_SHAPE_GRAPH_CACHE) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                enable_per_shape_graph_cache = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                enable_per_shape_graph_cache = false;
+            } else {
+                IE_THROW(NotFound) << "Unsupported KEY_GPU_ENABLE_PER_SHAPE_GRAPH_CACHE flag value: " << val;
+            }
+        } else if (key.compare(GPUConfigParams::KEY_GPU_COMPILATION_MEMORY_BUDGET) == 0) {
+            try {
+                int val_i = std::stoi(val);
+                if (val_i < 0) {
+                    IE_THROW() << "Negative value";
+                }
+                compilation_memory_budget = static_cast<uint64_t>(val_i) * 1024 * 1024;
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << GPUConfigParams::KEY_GPU_COMPILATION_MEMORY_BUDGET << ": " << val
+                                   << "\nSpecify the compilation memory budget as a non-negative integer number of megabytes"
+                                   << " (0 disables the limit).";
+            }
         } else if (key.compare(GPUConfigParams::KEY_GPU_MAX_NUM_THREADS) == 0) {
             int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
             try {
@@ -370,6 +398,18 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS] = PluginConfigParams::NO;
 
+    if (enable_auto_fp16)
+        key_config_map[GPUConfigParams::KEY_GPU_ENABLE_AUTO_FP16] = PluginConfigParams::YES;
+    else
+        key_config_map[GPUConfigParams::KEY_GPU_ENABLE_AUTO_FP16] = PluginConfigParams::NO;
+
+    if (enable_per_shape_graph_cache)
+        key_config_map[GPUConfigParams::KEY_GPU_ENABLE_PER_SHAPE_GRAPH_CACHE] = PluginConfigParams::YES;
+    else
+        key_config_map[GPUConfigParams::KEY_GPU_ENABLE_PER_SHAPE_GRAPH_CACHE] = PluginConfigParams::NO;
+
+    key_config_map[GPUConfigParams::KEY_GPU_COMPILATION_MEMORY_BUDGET] = std::to_string(compilation_memory_budget / (1024 * 1024));
+
     {
         if (queuePriority == cldnn::priority_mode_types::high && task_exec_config._threadPreferredCoreType == IStreamsExecutor::Config::BIG) {
             key_config_map[GPUConfigParams::KEY_GPU_MODEL_PRIORITY] = GPUConfigParams::GPU_MODEL_PRIORITY_HIGH;
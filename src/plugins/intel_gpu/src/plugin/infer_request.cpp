@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <functional>
@@ -13,8 +14,13 @@
 #include "intel_gpu/plugin/compiled_model.hpp"
 #include "intel_gpu/plugin/itt.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
+#include "intel_gpu/graph/topology.hpp"
+#include "intel_gpu/primitives/input_layout.hpp"
+#include "intel_gpu/primitives/resample.hpp"
+#include "intel_gpu/primitives/reorder.hpp"
 #include "openvino/core/preprocess/input_tensor_info.hpp"
 #include <ie_algorithm.hpp>
+#include <ie_memcpy.h>
 #include <debug.h>
 
 using namespace InferenceEngine;
@@ -79,9 +85,10 @@ void copyResultToOutputBlob(cldnn::memory::ptr src, Blob::Ptr dst, ov::runtime::
             }
         }
     } else {
-        for (size_t i = 0; i < n; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        // Dense layout and matching precision - gather the (sub-)batch with one bulk copy instead
+        // of an elementwise loop; with dynamic batch this runs per sub-network on every inference.
+        // Large outputs are split across host threads, a single core cannot saturate the memory bus
+        ie_memcpy_parallel(dst_ptr, n * sizeof(T), src_ptr, n * sizeof(T));
     }
 }
 
@@ -194,6 +201,9 @@ Blob::Ptr InferRequest::GetBlob(const std::string& name) {
         auto it = _preProcData.find(name);
         if (it != _preProcData.end()) {
             data = it->second->getRoiBlob();
+        } else if (_deviceResizeStages.find(name) != _deviceResizeStages.end()) {
+            // the raw frame blob which is resized on the device
+            data = _deviceResizeStages.at(name).src_blob;
         } else {
             data = _inputs[name];
             if (!isDynamic)
@@ -238,7 +248,7 @@ void InferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
     auto blobDesc = data->getTensorDesc();
 
     bool is_input = findInputAndOutputBlobByName(name, foundInput, foundOutput);
-    const TensorDesc& desc = is_input
+    TensorDesc desc = is_input
         ? foundInput->getTensorDesc()
         : foundOutput->getTensorDesc();
 
@@ -262,9 +272,18 @@ void InferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
 
     if (!isDynamic &&
         dataBinSize != netReqBinSize && !compoundBlobPassed && !preProcResize) {
-        IE_THROW() << "Incorrect binary data size for " << (is_input ? "input" : "output") <<
-                      " blob with name: \'" << name <<  "\' " <<
-                      "Current: " << dataBinSize << " Required: " << netReqBinSize;
+        if (is_input && m_graph != nullptr && m_graph->getConfig().enable_per_shape_graph_cache &&
+            blobDesc.getDims().size() == desc.getDims().size()) {
+            // The blob is valid but differently shaped: switch the request to the graph variant
+            // compiled for the new shapes and redo the lookup against the reshaped inputs
+            rebind_to_shape_variant(name, blobDesc);
+            is_input = findInputAndOutputBlobByName(name, foundInput, foundOutput);
+            desc = is_input ? foundInput->getTensorDesc() : foundOutput->getTensorDesc();
+        } else {
+            IE_THROW() << "Incorrect binary data size for " << (is_input ? "input" : "output") <<
+                          " blob with name: \'" << name <<  "\' " <<
+                          "Current: " << dataBinSize << " Required: " << netReqBinSize;
+        }
     }
 
     auto remote_ptr = data->as<gpu::ClBlob>();
@@ -329,16 +348,24 @@ void InferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
 
         if (!is_remote) {
             if (preProcessingRequired(foundInput, data)) {
-                // Stores the given blob as ROI blob. It will be used to fill in network input
-                // during pre-processing
-                if (_inputs[name]->is<gpu::ClBlob>()) {
-                    Blob::Ptr inputHostBlob = create_host_blob(desc);
-                    _inputs[name] = inputHostBlob;
+                if (try_device_preprocessing(name, data, foundInput)) {
+                    // the raw frame is resized by a small device-side program ahead of the
+                    // network, so no host-side pre-processing is needed for this input
+                    _preProcData.erase(name);
+                } else {
+                    _deviceResizeStages.erase(name);
+                    // Stores the given blob as ROI blob. It will be used to fill in network input
+                    // during pre-processing
+                    if (_inputs[name]->is<gpu::ClBlob>()) {
+                        Blob::Ptr inputHostBlob = create_host_blob(desc);
+                        _inputs[name] = inputHostBlob;
+                    }
+                    _preProcData[name] = CreatePreprocDataHelper();
+                    _preProcData[name]->isApplicable(data, _inputs[name]);
+                    _preProcData[name]->setRoiBlob(data);
                 }
-                _preProcData[name] = CreatePreprocDataHelper();
-                _preProcData[name]->isApplicable(data, _inputs[name]);
-                _preProcData[name]->setRoiBlob(data);
             } else {
+                _deviceResizeStages.erase(name);
                 if (compoundBlobPassed) {
                     IE_THROW(NotImplemented) << cannot_set_compound;
                 }
@@ -362,6 +389,36 @@ void InferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
                 if (data->buffer() == nullptr)
                     IE_THROW(NotAllocated) << str_input_not_allocated << " Input name: \'" << name << "\'";
                 _inputs[name] = data;
+
+                // The default input blob shares its USM host allocation with the device, so filling
+                // it through GetBlob() needs no copy at all. A user-provided host blob makes that
+                // zero-copy path unreachable, and on discrete devices keeping the staging blob in
+                // USM host memory would additionally make every kernel read cross PCIe. Stage such
+                // inputs in device-local USM memory instead - prepare_input() then performs a
+                // single host-to-device transfer per inference. I16/U16 inputs are skipped as their
+                // conversion path writes to the staging blob through a host mapping.
+                if (!isDynamic && desc.getPrecision() != Precision::I16 && desc.getPrecision() != Precision::U16 &&
+                    m_graph->GetEngine()->use_unified_shared_memory() &&
+                    m_graph->GetEngine()->get_device_info().dev_type == cldnn::device_type::discrete_gpu) {
+                    auto deviceInputIt = _deviceInputs.find(name);
+                    auto layoutIt = m_graph->GetInputLayouts().find(name);
+                    if (deviceInputIt != _deviceInputs.end() && layoutIt != m_graph->GetInputLayouts().end() &&
+                        deviceInputIt->second->is<gpu::ClBlob>()) {
+                        auto impl = getBlobImpl(deviceInputIt->second->as<gpu::ClBlob>());
+                        if (impl->getMemory()->get_allocation_type() == cldnn::allocation_type::usm_host) {
+                            auto blobPtr = std::make_shared<RemoteUSMbuffer>(m_graph->GetContext(),
+                                                                             m_graph->GetNetwork()->get_stream(),
+                                                                             desc,
+                                                                             layoutIt->second,
+                                                                             nullptr,
+                                                                             0,
+                                                                             0,
+                                                                             RemoteBlobImpl::BlobType::BT_USM_DEVICE_INTERNAL);
+                            getBlobImpl(blobPtr.get())->allocate();
+                            _deviceInputs[name] = blobPtr;
+                        }
+                    }
+                }
             }
         }
     } else {
@@ -525,6 +582,33 @@ void InferRequest::SetGraph(std::shared_ptr<Graph> graph) {
     }
 }
 
+void InferRequest::rebind_to_shape_variant(const std::string& inputName, const TensorDesc& blobDesc) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::rebind_to_shape_variant");
+    // collect the full set of input shapes this request will run with: the new shape for the
+    // blob being set and the currently bound shapes for the remaining inputs
+    std::map<std::string, SizeVector> shapes;
+    for (auto& input : _networkInputs) {
+        if (input.first == inputName) {
+            shapes[input.first] = blobDesc.getDims();
+        } else {
+            auto in = _inputs.find(input.first);
+            shapes[input.first] = (in != _inputs.end()) ? in->second->getTensorDesc().getDims()
+                                                        : input.second->getTensorDesc().getDims();
+        }
+    }
+
+    auto graph = static_cast<CompiledModel*>(_exeNetwork.get())->GetGraphForShapes(shapes);
+
+    m_shapeVariantGraph = graph;
+    _networkInputs = graph->GetNetworkInputs();
+    _networkOutputs = graph->GetNetworkOutputs();
+    _inputs.clear();
+    _deviceInputs.clear();
+    _outputs.clear();
+    _deviceOutputs.clear();
+    SetGraph(graph);
+}
+
 void InferRequest::SetBatch(int new_batch) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::SetBatch");
     if (m_graph->GetMaxDynamicBatchSize() < 0)
@@ -728,6 +812,9 @@ void InferRequest::enqueue() {
                 prepare_input(y_name, nv12_ptr->y(), dependencies);
                 prepare_input(uv_name, nv12_ptr->uv(), dependencies);
             }
+        } else if (_deviceResizeStages.find(inputName) != _deviceResizeStages.end()) {
+            // the raw frame is resized on the device; the stage output feeds the network input
+            run_device_resize_stage(inputName, dependencies);
         } else {
             // regular blob
             prepare_input(inputName, inputBlob, dependencies);
@@ -766,7 +853,13 @@ void InferRequest::wait() {
         IE_THROW() << "Inference was not started!\n";
     }
 
-    // wait for completion & collect outputs as requested by the model
+    // wait for completion & collect outputs as requested by the model.
+    // Direct readbacks (matching precision, no padding) are issued asynchronously for all outputs
+    // first and waited for at the end, so the device-to-host transfers overlap each other and the
+    // elementwise conversions of the remaining outputs instead of being mapped one by one.
+    std::vector<InferenceEngine::LockedMemory<void>> readback_locks;
+    std::vector<cldnn::event::ptr> readback_events;
+    std::vector<std::pair<cldnn::memory::ptr, Blob::Ptr>> converted_outputs;
     for (auto& no : _networkOutputs) {
         Blob::Ptr bptr = _outputs[no.first];
         std::string outputID = outputsMap.at(no.first);
@@ -782,11 +875,33 @@ void InferRequest::wait() {
                 same_mem = same_host_mem(outputMemory, dst_ptr);
             }
             if (!same_mem) {
-                copy_output_data(outputMemory, bptr);
+                auto src_layout = outputMemory->get_layout();
+                bool direct_copy = !src_layout.data_padding &&
+                                   src_layout.data_type == DataTypeFromPrecision(bptr->getTensorDesc().getPrecision()) &&
+                                   bptr->byteSize() == outputMemory->size();
+                if (direct_copy) {
+                    auto dst_lock = bptr->buffer();
+                    auto ev = outputMemory->copy_to(m_graph->GetNetwork()->get_stream(), dst_lock.as<void*>());
+                    if (ev != nullptr) {
+                        readback_locks.emplace_back(std::move(dst_lock));
+                        readback_events.emplace_back(std::move(ev));
+                        continue;
+                    }
+                }
+                converted_outputs.emplace_back(outputMemory, bptr);
             }
         }
     }
 
+    for (auto& out : converted_outputs) {
+        copy_output_data(out.first, out.second);
+    }
+
+    for (auto& ev : readback_events) {
+        ev->wait();
+    }
+    readback_locks.clear();
+
     // finally collect profiling info
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
@@ -846,6 +961,12 @@ void InferRequest::wait_dynamic() {
 // ---------------------------- internal utils --------- ----------------------------------- //
 // ----------------------------------------------------------------------------------------- //
 void InferRequest::setup_stream_graph() {
+    if (m_shapeVariantGraph != nullptr) {
+        // the request is pinned to the graph variant compiled for the current input shapes,
+        // the per-stream graphs still hold the originally compiled shapes
+        m_graph = m_shapeVariantGraph;
+        return;
+    }
     int streamID = 0;
     auto& streamGraphs = static_cast<CompiledModel*>(_exeNetwork.get())->m_graphs;
     if (nullptr != streamExecutor) {
@@ -1099,6 +1220,102 @@ std::map<std::string, InferenceEngineProfileInfo> InferRequest::GetPerformanceCo
     }
 }
 
+bool InferRequest::try_device_preprocessing(const std::string& name, const Blob::Ptr& data,
+                                            const InputInfo::Ptr& inputInfo) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::try_device_preprocessing");
+    // Spatial resize of a raw frame can run on the device instead of the host G-API
+    // kernels: a small auxiliary program (resample into the expected input layout)
+    // is executed ahead of the network and its output feeds the network input
+    // directly. Color conversion and mean subtraction are not handled here - the
+    // former still needs the host path, the latter is already applied on the device
+    // by the in-program input reorder.
+    if (m_graph->GetMaxDynamicBatchSize() > 1)
+        return false;
+
+    const auto& preProcess = inputInfo->getPreProcess();
+    if (preProcess.getResizeAlgorithm() != ResizeAlgorithm::RESIZE_BILINEAR)
+        return false;
+    const auto colorFormat = preProcess.getColorFormat();
+    if (colorFormat != ColorFormat::RAW && colorFormat != ColorFormat::BGR)
+        return false;
+
+    if (!data->is<MemoryBlob>() || data->is<CompoundBlob>())
+        return false;
+
+    const auto& srcDesc = data->getTensorDesc();
+    const auto& netDesc = inputInfo->getTensorDesc();
+    const auto& srcDims = srcDesc.getDims();
+    const auto& netDims = netDesc.getDims();
+    if (srcDims.size() != 4 || netDims.size() != 4)
+        return false;
+    // only the spatial dimensions may differ
+    if (srcDims[0] != netDims[0] || srcDims[1] != netDims[1])
+        return false;
+
+    const auto layout = srcDesc.getLayout();
+    if (layout != netDesc.getLayout() || (layout != InferenceEngine::Layout::NCHW && layout != InferenceEngine::Layout::NHWC))
+        return false;
+
+    const auto precision = srcDesc.getPrecision();
+    if (precision != Precision::U8 && precision != Precision::FP32 && precision != Precision::FP16)
+        return false;
+
+    auto inputLayoutItr = m_graph->GetInputLayouts().find(name);
+    if (inputLayoutItr == m_graph->GetInputLayouts().end())
+        return false;
+
+    cldnn::layout srcLayout(DataTypeFromPrecision(precision),
+                            FormatFromLayout(layout),
+                            tensor_from_dims(srcDims));
+
+    auto& stage = _deviceResizeStages[name];
+    stage.src_blob = data;
+    if (stage.network != nullptr && stage.src_layout == srcLayout)
+        return true;
+
+    // the stage program is built once per source size and reused across inferences
+    const cldnn::layout& netInputLayout = inputLayoutItr->second;
+    cldnn::topology topology;
+    topology.add(cldnn::input_layout("input", srcLayout));
+    topology.add(cldnn::resample("resample", "input", netInputLayout.size, 0, cldnn::resample_type::caffe_bilinear));
+    topology.add(cldnn::reorder("resize_out", "resample", netInputLayout));
+
+    cldnn::build_options options;
+    options.set_option(cldnn::build_option::outputs(std::vector<cldnn::primitive_id>{ "resize_out" }));
+
+    auto engine = m_graph->GetEngine();
+    stage.network = std::make_shared<cldnn::network>(*engine, topology, options);
+    stage.input_mem = engine->allocate_memory(srcLayout, false);
+    stage.src_layout = srcLayout;
+    return true;
+}
+
+void InferRequest::run_device_resize_stage(const std::string& inputName, std::vector<cldnn::event::ptr>& dependencies) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::run_device_resize_stage");
+    auto& stage = _deviceResizeStages.at(inputName);
+    auto& stream = m_graph->GetNetwork()->get_stream();
+
+    std::vector<cldnn::event::ptr> upload_events;
+    {
+        auto src_lock = stage.src_blob->cbuffer();
+        auto src_ptr = src_lock.as<uint8_t*>();
+        if (src_ptr == nullptr)
+            IE_THROW() << str_input_not_allocated << " Input name: \'" << inputName << "\'";
+        if (!same_host_mem(stage.input_mem, src_ptr)) {
+            auto ev = stage.input_mem->copy_from(stream, src_ptr);
+            if (ev != nullptr)
+                upload_events.push_back(ev);
+        }
+    }
+
+    stage.network->set_input_data("input", stage.input_mem);
+    auto stage_outputs = stage.network->execute(upload_events);
+    auto& resized = stage_outputs.at("resize_out");
+
+    m_graph->GetNetwork()->set_input_data("parameter:" + inputName, resized.get_memory());
+    dependencies.push_back(resized.get_event());
+}
+
 void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr& inputBlob,
                                       std::vector<cldnn::event::ptr>& dependencies) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::prepare_input");
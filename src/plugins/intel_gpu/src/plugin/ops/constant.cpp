@@ -179,35 +179,42 @@ void createClDnnConstant(Program& p, const ngraph::Shape& constDims, const std::
             GPU_DEBUG_COUT << "[" << initialconstPrimID << ": constant]" << std::endl;
         }
         cldnn::memory::ptr mem = p.GetEngine().allocate_memory(constLayout, false);
-        auto& stream = p.GetEngine().get_program_stream();
-        cldnn::mem_lock<char> lock{mem, stream};
-        auto buf = lock.data();
-        auto bufSize = constLayout.bytes_count();
-
-        // Do actual weights reorder and change O and I channels order
-        if (props.swapOI) {
-            auto elementSize = cldnn::data_type_traits::size_of(constLayout.data_type);
-            size_t spatial_dim_off = props.hasGroupDimension ? 3 : 2;
-            size_t featureSize = elementSize;
-            for (size_t i = spatial_dim_off; i < constDims.size(); i++) {
-                featureSize *= constDims[i];
-            }
+        auto& engine = p.GetEngine();
+
+        // The payload upload is staged on the engine task executor, so copying the weights (several GB
+        // for large models) overlaps with the translation of the remaining operations; the op shared
+        // pointer is captured to keep the source buffer alive until the copy is joined
+        p.ScheduleConstantCopy([&engine, mem, constLayout, op, data, props, constDims,
+                                groups, inputFeatureElements, outputFeatureElements]() {
+            cldnn::mem_lock<char> lock{mem, engine.get_program_stream()};
+            auto buf = lock.data();
+            auto bufSize = constLayout.bytes_count();
+
+            // Do actual weights reorder and change O and I channels order
+            if (props.swapOI) {
+                auto elementSize = cldnn::data_type_traits::size_of(constLayout.data_type);
+                size_t spatial_dim_off = props.hasGroupDimension ? 3 : 2;
+                size_t featureSize = elementSize;
+                for (size_t i = spatial_dim_off; i < constDims.size(); i++) {
+                    featureSize *= constDims[i];
+                }
 
-            for (size_t g = 0; g < groups; g++) {
-                for (size_t i = 0; i < inputFeatureElements; i++) {
-                    for (size_t o = 0; o < outputFeatureElements; o++) {
-                        size_t outputShift = ((g*outputFeatureElements + o)*inputFeatureElements + i)*featureSize;
-                        size_t inputShift = ((g*inputFeatureElements + i)*outputFeatureElements + o)*featureSize;
+                for (size_t g = 0; g < groups; g++) {
+                    for (size_t i = 0; i < inputFeatureElements; i++) {
+                        for (size_t o = 0; o < outputFeatureElements; o++) {
+                            size_t outputShift = ((g*outputFeatureElements + o)*inputFeatureElements + i)*featureSize;
+                            size_t inputShift = ((g*inputFeatureElements + i)*outputFeatureElements + o)*featureSize;
 
-                        for (size_t b = 0; b < featureSize; b++) {
-                            buf[outputShift + b] = data[inputShift + b];
+                            for (size_t b = 0; b < featureSize; b++) {
+                                buf[outputShift + b] = data[inputShift + b];
+                            }
                         }
                     }
                 }
+            } else {
+                std::memcpy(&buf[0], &data[0], bufSize);
             }
-        } else {
-            std::memcpy(&buf[0], &data[0], bufSize);
-        }
+        });
         p.AddPrimitive(cldnn::data(initialconstPrimID, mem, op->get_friendly_name()));
         p.blobMemCache[std::make_pair(data, newDims)] = initialconstPrimID;
         constPrimID = initialconstPrimID;
@@ -279,6 +279,8 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
     {
         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Plugin::LoadExeNetworkImpl::CreateExeNetwork");
         CompiledModel::Ptr exeNetwork = std::make_shared<CompiledModel>(transformedNetwork, context, conf);
+        if (conf.enable_per_shape_graph_cache)
+            exeNetwork->SetSourceNetwork(network);
         UpdateStatistics(context);
         return exeNetwork;
     }
@@ -300,7 +302,10 @@ IExecutableNetworkInternal::Ptr Plugin::LoadExeNetworkImpl(const InferenceEngine
     UpdateConfig(conf, network, config);
 
     auto transformedNetwork = CloneAndTransformNetwork(network, conf);
-    return std::make_shared<CompiledModel>(transformedNetwork, casted, conf);
+    auto exeNetwork = std::make_shared<CompiledModel>(transformedNetwork, casted, conf);
+    if (conf.enable_per_shape_graph_cache)
+        exeNetwork->SetSourceNetwork(network);
+    return exeNetwork;
 }
 
 InferenceEngine::RemoteContext::Ptr Plugin::CreateContext(const AnyMap& params) {
@@ -312,11 +312,47 @@ void Program::PrepareBuild(InferenceEngine::InputsDataMap networkInputs, Inferen
 }
 
 void Program::CleanupBuild() {
+    // make sure no constant upload is still writing into memory objects referenced by the topology
+    WaitForConstantCopies();
     m_topology.reset();
     m_networkInputs.clear();
     m_networkOutputs.clear();
 }
 
+void Program::ScheduleConstantCopy(std::function<void()> copy_task) {
+    auto task_executor = m_engine->get_task_executor();
+    if (task_executor == nullptr) {
+        copy_task();
+        return;
+    }
+
+    auto completion = std::make_shared<std::promise<void>>();
+    m_constantCopyFutures.emplace_back(completion->get_future());
+    task_executor->run([copy_task, completion] {
+        try {
+            copy_task();
+            completion->set_value();
+        } catch (...) {
+            completion->set_exception(std::current_exception());
+        }
+    });
+}
+
+void Program::WaitForConstantCopies() {
+    std::exception_ptr exception = nullptr;
+    for (auto& copy_future : m_constantCopyFutures) {
+        try {
+            copy_future.get();
+        } catch (...) {
+            if (exception == nullptr)
+                exception = std::current_exception();
+        }
+    }
+    m_constantCopyFutures.clear();
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
 std::shared_ptr<cldnn::program> Program::BuildProgram(const std::vector<std::shared_ptr<ngraph::Node>>& ops,
                                                       InferenceEngine::InputsDataMap networkInputs,
                                                       InferenceEngine::OutputsDataMap networkOutputs,
@@ -337,6 +373,9 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(const std::vector<std::sha
     for (const auto& op : ops) {
         CreateSingleLayerPrimitive(*m_topology, op);
     }
+    // constant uploads scheduled during the loop above must reach device memory before the program
+    // build starts reading it (e.g. in the constant propagation pass)
+    WaitForConstantCopies();
     if (createTopologyOnly) {
         return {};
     } else {
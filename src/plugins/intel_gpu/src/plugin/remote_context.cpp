@@ -326,7 +326,10 @@ ExecutionContextImpl::ExecutionContextImpl(const std::shared_ptr<IInferencePlugi
                                          m_config.memory_pool_on,
                                          engine_params.use_unified_shared_memory,
                                          m_config.kernels_cache_dir,
-                                         m_config.throughput_streams),
+                                         m_config.throughput_streams,
+                                         "cache.json",
+                                         false,
+                                         m_config.compilation_memory_budget),
                                      engine_params.task_executor);
 }
 
@@ -13,6 +13,7 @@
 #include <memory>
 
 #include "intel_gpu/plugin/transformations_pipeline.hpp"
+#include "intel_gpu/runtime/debug_configuration.hpp"
 
 #include "ie_metric_helpers.hpp"
 #include "ie_plugin_config.hpp"
@@ -20,6 +21,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/constant_folding.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -419,6 +421,74 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
         lptManager.run_passes(func);
     }
 
+    if (config.enable_auto_fp16 && device_info.supports_fp16 && !enableInt8) {
+        OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "TransformationsPipeline::apply::auto_fp16");
+        {
+            ngraph::pass::Manager manager;
+            manager.register_pass<ngraph::pass::ConvertPrecision>(
+                precisions_array {{ ngraph::element::f32, ngraph::element::f16 }});
+            manager.run_passes(func);
+        }
+
+        // reductions accumulate many small terms and normalizations divide by such a sum, so these
+        // operations keep FP32 computation: their FP16 producers are promoted through a Convert and
+        // the result is demoted back, while the elementwise bulk of the network runs in half precision
+        auto is_fp16_sensitive = [](const std::shared_ptr<ngraph::Node>& node) {
+            return ov::is_type<ngraph::op::v1::Softmax>(node) ||
+                   ov::is_type<ngraph::op::v8::Softmax>(node) ||
+                   ov::is_type<ngraph::op::v0::MVN>(node) ||
+                   ov::is_type<ngraph::op::v6::MVN>(node) ||
+                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
+                   ov::is_type<ngraph::op::v1::ReduceMean>(node) ||
+                   ov::is_type<ngraph::op::v1::ReduceSum>(node);
+        };
+
+        for (auto& node : func->get_ordered_ops()) {
+            if (!is_fp16_sensitive(node))
+                continue;
+            bool promoted = false;
+            for (size_t i = 0; i < node->get_input_size(); i++) {
+                auto input = node->input(i);
+                if (input.get_element_type() != ngraph::element::f16)
+                    continue;
+                auto convert =
+                    std::make_shared<ngraph::opset1::Convert>(input.get_source_output(), ngraph::element::f32);
+                convert->set_friendly_name(node->get_friendly_name() + "/fp32_promotion_" + std::to_string(i));
+                input.replace_source_output(convert);
+                promoted = true;
+            }
+            if (!promoted)
+                continue;
+            node->validate_and_infer_types();
+            for (size_t i = 0; i < node->get_output_size(); i++) {
+                auto output = node->output(i);
+                if (output.get_element_type() != ngraph::element::f32)
+                    continue;
+                // consumers were built for the converted network, so they get the FP16 view back
+                auto targets = output.get_target_inputs();
+                if (targets.empty())
+                    continue;
+                auto convert = std::make_shared<ngraph::opset1::Convert>(output, ngraph::element::f16);
+                convert->set_friendly_name(node->get_friendly_name() + "/fp16_demotion_" + std::to_string(i));
+                for (auto& target : targets) {
+                    target.replace_source_output(convert);
+                }
+            }
+        }
+
+        GPU_DEBUG_GET_INSTANCE(debug_config);
+        GPU_DEBUG_IF(debug_config->verbose >= 1) {
+            for (auto& node : func->get_ordered_ops()) {
+                if (node->get_output_size() == 0 || ov::is_type<ngraph::op::v0::Constant>(node) ||
+                    ov::is_type<ngraph::op::v0::Parameter>(node) || ov::is_type<ngraph::op::v0::Result>(node))
+                    continue;
+                const bool runs_fp16 = node->get_output_element_type(0) == ngraph::element::f16;
+                GPU_DEBUG_COUT << "[auto fp16] " << (runs_fp16 ? "converted to fp16: " : "kept fp32: ")
+                               << node->get_friendly_name() << std::endl;
+            }
+        }
+    }
+
     {
         OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "TransformationsPipeline::apply::run_passes");
         ngraph::pass::Manager manager;
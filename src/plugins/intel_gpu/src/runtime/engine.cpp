@@ -167,9 +167,22 @@ std::map<std::string, uint64_t> engine::get_memory_statistics() const {
         oss << m.first;
         statistics[oss.str()] = m.second.load();
     }
+    statistics["released_pool"] = _released_pool_usage.load();
     return statistics;
 }
 
+void engine::add_released_pool_memory(uint64_t bytes) {
+    _released_pool_usage += bytes;
+}
+
+void engine::subtract_released_pool_memory(uint64_t bytes) {
+    _released_pool_usage -= bytes;
+}
+
+uint64_t engine::get_released_pool_memory() const {
+    return _released_pool_usage.load();
+}
+
 void engine::add_memory_used(size_t bytes, allocation_type type) {
     std::lock_guard<std::mutex> guard(_mutex);
     if (!_memory_usage_map.count(type) && !_peak_memory_usage_map.count(type)) {
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <sstream>
 #include <fstream>
 #include <set>
@@ -129,6 +130,15 @@ inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
 
+// Rough peak of host memory taken by one driver compilation of a batch. The frontend keeps
+// the parsed sources and build intermediates which exceed the raw source size by roughly
+// two orders of magnitude, plus a fixed per-compilation base (empirically measured on NEO).
+uint64_t estimate_batch_build_memory(size_t source_bytes) {
+    constexpr uint64_t per_compilation_base = 64 * 1024 * 1024;
+    constexpr uint64_t source_expansion_factor = 128;
+    return per_compilation_base + source_expansion_factor * static_cast<uint64_t>(source_bytes);
+}
+
 }  // namespace
 
 namespace cldnn {
@@ -200,6 +210,7 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
         auto& current_batch = current_bucket.back();
         current_batch.dump_custom_program = dump_custom_program;
         current_batch.entry_point_to_id[entry_point] = code.id;
+        current_batch.min_kernel_ordinal = std::min(current_batch.min_kernel_ordinal, code.ordinal);
 
         current_batch.source.push_back(std::move(full_code));
         current_batch.kernels_counter++;
@@ -208,15 +219,21 @@ void kernels_cache::get_program_source(const kernels_code& kernels_source_code,
     // Compute hash value for each batch
     // Hash calculation might require additional optimizations, but currently execution time of this part is much smaller than loading
     // of the precompiled binaries or get_undef_jit calls
-    // Hash is computed for string that contains compilation options + driver version +
-    // full source code (jit + template + undef sections) of all kernels in the batches
+    // Hash is computed for string that contains compilation options + device + driver version +
+    // full source code (jit + template + undef sections) of all kernels in the batches.
+    // Device name and id are included since program binaries are device specific, so a cache
+    // directory shared between nodes with different GPUs must not mix their entries
+    const auto& device_info = _engine.get_device_info();
     for (auto& c : program_buckets) {
         auto options = c.first;
         auto& batches = c.second;
         for (auto& b : batches) {
-            std::string full_code = options + " " + _engine.get_device_info().driver_version;
-            for (auto& ss : b.source)
+            std::string full_code = options + " " + device_info.dev_name + " " +
+                                    std::to_string(device_info.device_id) + " " + device_info.driver_version;
+            for (auto& ss : b.source) {
                 full_code += ss;
+                b.source_bytes += ss.size();
+            }
             b.hash_value = std::hash<std::string>()(full_code);
             all_batches->push_back(b);
         }
@@ -234,7 +251,7 @@ kernel_id kernels_cache::set_kernel_source(
     const auto kernel_num = _kernels.size() + _kernels_code.size();
     kernel_id id = kernel_string->entry_point + "_" + std::to_string(kernel_num);
 
-    auto res = _kernels_code.emplace(kernel_string, id, dump_custom_program);
+    auto res = _kernels_code.emplace(kernel_string, id, dump_custom_program, kernel_num);
 
     assert(_kernels.find(id) == _kernels.end());
     if (res.second) {
@@ -334,9 +351,19 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                 saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
             }
         } else {
-            cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
-            program.build(cl_build_engine.get_cl_device(), batch.options.c_str());
-            program.createKernels(&kernels);
+            try {
+                cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
+                program.build(cl_build_engine.get_cl_device(), batch.options.c_str());
+                program.createKernels(&kernels);
+            } catch (const cl::Error&) {
+                // cached binary is unusable (e.g. got stale after a driver update or is corrupted) -
+                // fall back to source compilation and refresh the cache entry
+                kernels.clear();
+                cl::Program program(cl_build_engine.get_cl_context(), batch.source);
+                program.build(cl_build_engine.get_cl_device(), batch.options.c_str());
+                program.createKernels(&kernels);
+                saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
+            }
         }
         {
             std::lock_guard<std::mutex> lock(_mutex);
@@ -419,17 +446,48 @@ void kernels_cache::build_all() {
         get_program_source(_kernels_code, &batches);
     }
 
+    const uint64_t memory_budget = _engine.configuration().kernels_build_memory_budget;
+    if (memory_budget > 0) {
+        // Batches holding the kernels registered first are submitted first, so the kernels
+        // executed at the head of the network leave the compilation queue as early as possible
+        std::sort(batches.begin(), batches.end(), [](const batch_program& lhs, const batch_program& rhs) {
+            return lhs.min_kernel_ordinal < rhs.min_kernel_ordinal;
+        });
+    }
+
     auto _task_executor = _engine.get_task_executor();
     std::exception_ptr exception;
+    std::mutex budget_mutex;
+    std::condition_variable budget_cv;
+    uint64_t in_flight_memory = 0;
     std::vector<InferenceEngine::Task> tasks;
     for (int idx = 0; idx < batches.size(); idx++) {
         auto& batch = batches[idx];
-        tasks.push_back([this, &_build_engine, batch, &exception] {
+        tasks.push_back([this, &_build_engine, batch, &exception, &budget_mutex, &budget_cv, &in_flight_memory, memory_budget] {
+            // Hold an estimated share of the memory budget for the whole driver compilation, so
+            // the total peak of concurrent builds stays bounded. A batch bigger than the whole
+            // budget is clamped and still builds, just with no other compilation in flight.
+            uint64_t estimate = 0;
+            if (memory_budget > 0) {
+                estimate = std::min(estimate_batch_build_memory(batch.source_bytes), memory_budget);
+                std::unique_lock<std::mutex> lock(budget_mutex);
+                budget_cv.wait(lock, [&] {
+                    return in_flight_memory == 0 || in_flight_memory + estimate <= memory_budget;
+                });
+                in_flight_memory += estimate;
+            }
             try {
                 build_batch(*_build_engine, batch);
             } catch(...) {
                 exception = std::current_exception();
             }
+            if (memory_budget > 0) {
+                {
+                    std::lock_guard<std::mutex> lock(budget_mutex);
+                    in_flight_memory -= estimate;
+                }
+                budget_cv.notify_all();
+            }
         });
     }
     _task_executor->runAndWait(tasks);
@@ -7,6 +7,7 @@
 #include "intel_gpu/runtime/engine.hpp"
 #include "intel_gpu/runtime/kernel.hpp"
 
+#include <cstdint>
 #include <map>
 #include <mutex>
 #include <vector>
@@ -27,6 +28,8 @@ public:
         size_t hash_value;
         uint32_t kernels_counter;
         source_code source;
+        size_t source_bytes;
+        size_t min_kernel_ordinal;
         std::string options;
         bool dump_custom_program;
         std::map<std::string, std::string> entry_point_to_id;
@@ -37,6 +40,8 @@ public:
               hash_value(0),
               kernels_counter(0),
               source(std::move(batch_header_str)),
+              source_bytes(0),
+              min_kernel_ordinal(SIZE_MAX),
               options(_options),
               dump_custom_program(false),
               entry_point_to_id({}) {
@@ -48,14 +53,17 @@ public:
         std::string id;
         bool dump_custom_program;
         size_t hash_value;
+        size_t ordinal;  // registration sequence number, approximates first-execution order
 
         kernel_code(const std::shared_ptr<kernel_string>& _kernel_strings,
                     const std::string& _id,
-                    bool _dump_custom_program)
+                    bool _dump_custom_program,
+                    size_t _ordinal)
             : kernel_strings(_kernel_strings),
               id(_id),
               dump_custom_program(_dump_custom_program),
-              hash_value(_kernel_strings->get_hash()) {}
+              hash_value(_kernel_strings->get_hash()),
+              ordinal(_ordinal) {}
 
         bool operator == (const kernel_code& rhs) const {
             return (hash_value == rhs.hash_value);
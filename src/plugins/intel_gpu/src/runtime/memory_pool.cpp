@@ -11,6 +11,7 @@
 #include "intel_gpu/runtime/memory_pool.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
+#include <limits>
 #include <list>
 #include <string>
 #include <utility>
@@ -25,10 +26,69 @@ memory_record::memory_record(memory_set users,
     : _users(users), _memory(memory), _network_id(net_id), _type(type) {}
 
 memory::ptr memory_pool::alloc_memory(const layout& layout, allocation_type type) {
-    return _engine->allocate_memory(layout, type);
+    if (_released_pool.empty())
+        return _engine->allocate_memory(layout, type);
+    try {
+        return _engine->allocate_memory(layout, type);
+    } catch (const std::exception&) {
+        // the driver may be out of memory only because buffers are still parked in the
+        // released list; return them all and retry once before giving up
+        trim_released_memory();
+        return _engine->allocate_memory(layout, type);
+    }
 }
 
-memory_pool::~memory_pool() {}
+uint64_t memory_pool::align_to_size_class(uint64_t size) {
+    // page-align small buffers; round bigger ones up to 1/8 of the enclosing power of two,
+    // which caps the overallocation introduced by the bucketing at 12.5%
+    constexpr uint64_t min_alignment = 4096;
+    uint64_t step = min_alignment;
+    while (step * 8 < size)
+        step *= 2;
+    return (size + step - 1) & ~(step - 1);
+}
+
+memory::ptr memory_pool::claim_released_memory(const layout& layout, allocation_type type) {
+    if (!_reuse_released_memory)
+        return nullptr;
+    if (layout.format == format::fs_b_yx_fsv32 ||
+        ((layout.format == format::b_fs_yx_fsv32 || layout.format == format::b_fs_zyx_fsv32) &&
+         (layout.size.feature[0] % 32 != 0)))
+        return nullptr;
+
+    auto it = _released_pool.lower_bound(layout.bytes_count());
+    while (it != _released_pool.end()) {
+        if (it->second._type == type &&
+            it->second._memory->get_layout().format != format::fs_b_yx_fsv32) {
+            auto mem = it->second._memory;
+            _engine->subtract_released_pool_memory(it->first);
+            _released_pool.erase(it);
+            return mem;
+        }
+        ++it;
+    }
+    return nullptr;
+}
+
+void memory_pool::defer_release(const memory_record& record) {
+    if (_reuse_released_memory) {
+        const auto bytes = record._memory->get_layout().bytes_count();
+        _released_pool.emplace(bytes, released_memory_record{record._memory, record._type});
+        _engine->add_released_pool_memory(bytes);
+    }
+}
+
+void memory_pool::trim_released_memory() {
+    for (auto const& entry : _released_pool) {
+        _engine->subtract_released_pool_memory(entry.first);
+    }
+    _released_pool.clear();
+}
+
+memory_pool::~memory_pool() {
+    // drop the accounting of still-parked buffers; the buffers themselves go away with the map
+    trim_released_memory();
+}
 
 bool memory_pool::has_conflict(const memory_set& a,
                                const std::set<primitive_id>& b,
@@ -69,7 +129,8 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
                     user_it = it->second._users.erase(user_it);
                 }
                 if (it->second._users.empty()) {
-                    // if this was the only user of the memory, then free it up
+                    // if this was the only user of the memory, then free it up (or keep it for reuse)
+                    defer_release(it->second);
                     it = _non_padded_pool.erase(it);
                 }
 
@@ -98,7 +159,8 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
                         user_it = list_itr->_users.erase(user_it);
                     }
                     if (list_itr->_users.empty()) {
-                        // if this was the only user of the memory, then free it up
+                        // if this was the only user of the memory, then free it up (or keep it for reuse)
+                        defer_release(*list_itr);
                         list.erase(list_itr);
                     }
 
@@ -141,12 +203,29 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
     GPU_DEBUG_IF(debug_config->verbose >= 2) {
         GPU_DEBUG_COUT << "[" << id << ": output]" << std::endl;
     }
-    // didn't find anything for you? create new resource
-    auto mem = alloc_memory(layout, type);
+    // didn't find anything for you? claim a released buffer or create new resource
+    auto mem = claim_released_memory(layout, type);
+    if (!mem) {
+        auto alloc_layout = layout;
+        if (_reuse_released_memory) {
+            // bucket fresh allocations into size classes, so a later slightly larger request
+            // can still be served by this buffer once it is released
+            const auto bucket_bytes = align_to_size_class(layout.bytes_count());
+            if (bucket_bytes > layout.bytes_count() &&
+                bucket_bytes <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+                alloc_layout = cldnn::layout(data_types::u8, format::bfyx,
+                                             tensor(1, 1, static_cast<tensor::value_type>(bucket_bytes), 1));
+            }
+        }
+        mem = alloc_memory(alloc_layout, type);
+    }
     {
-        _non_padded_pool.emplace(layout.bytes_count(),
+        _non_padded_pool.emplace(mem->get_layout().bytes_count(),
                                  memory_record({{id, network_id}}, mem, network_id, type));
     }
+    // the stored buffer may be larger than the request (size class rounding or released buffer reuse)
+    if (!(mem->get_layout() == layout))
+        return _engine->reinterpret_buffer(*mem, layout);
     return mem;
 }
 
@@ -174,7 +253,11 @@ memory::ptr memory_pool::get_from_padded_pool(const layout& layout,
                 return ret_mem;
             }
         }
-        auto mem = alloc_memory(layout, type);
+        auto mem = claim_released_memory(layout, type);
+        if (mem)
+            mem = _engine->reinterpret_buffer(*mem, layout);
+        else
+            mem = alloc_memory(layout, type);
         first_level_cache->second.emplace_back(
             memory_record({{id, network_id}}, mem, network_id, type));
         return mem;
@@ -183,7 +266,11 @@ memory::ptr memory_pool::get_from_padded_pool(const layout& layout,
     GPU_DEBUG_IF(debug_config->verbose >= 2) {
         GPU_DEBUG_COUT << "[" << id << ": output]" << std::endl;
     }
-    auto mem = alloc_memory(layout, type);
+    auto mem = claim_released_memory(layout, type);
+    if (mem)
+        mem = _engine->reinterpret_buffer(*mem, layout);
+    else
+        mem = alloc_memory(layout, type);
     std::list<memory_record> list = {memory_record({{id, network_id}}, mem, network_id, type)};
     _padded_pool.emplace(layout, std::move(list));
     return mem;
@@ -245,7 +332,10 @@ memory::ptr memory_pool::get_memory(const layout& layout,
     }
 }
 
-void memory_pool::clear_pool() { _non_padded_pool.clear(); }
+void memory_pool::clear_pool() {
+    _non_padded_pool.clear();
+    trim_released_memory();
+}
 
 void memory_pool::clear_pool_for_network(uint32_t network_id) {
     // free up _non_padded_pool for this network
@@ -256,6 +346,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
             auto& record = itr->second;
 
             if (record._network_id == network_id) {
+                defer_release(record);
                 itr = _non_padded_pool.erase(itr);
             } else {
                 itr++;
@@ -273,6 +364,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
 
             while (list_itr != list.end()) {
                 if (list_itr->_network_id == network_id) {
+                    defer_release(*list_itr);
                     list_itr = list.erase(list_itr);
                 } else {
                     list_itr++;
@@ -295,6 +387,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
             auto& record = itr->second;
 
             if (record._network_id == network_id) {
+                defer_release(record);
                 itr = _no_reusable_pool.erase(itr);
             } else {
                 itr++;
@@ -303,6 +396,7 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
     }
 }
 
-memory_pool::memory_pool(engine& engine) : _engine(&engine) { }
+memory_pool::memory_pool(engine& engine)
+    : _reuse_released_memory(engine.configuration().use_deferred_buffer_release), _engine(&engine) { }
 
 }  // namespace cldnn
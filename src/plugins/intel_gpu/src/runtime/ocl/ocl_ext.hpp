@@ -155,6 +155,58 @@ T load_entrypoint(const cl_command_queue queue, const std::string name) {
 }
 }  // namespace
 
+// cl_khr_command_buffer
+// Only the subset needed for recording and replaying NDRange kernel sequences is declared here,
+// the headers we build against may not contain the extension yet. Entry points are loaded at
+// runtime through clGetExtensionFunctionAddressForPlatform.
+#ifndef cl_khr_command_buffer
+#define cl_khr_command_buffer 1
+
+typedef cl_bitfield         cl_device_command_buffer_capabilities_khr;
+typedef struct _cl_command_buffer_khr* cl_command_buffer_khr;
+typedef cl_uint             cl_sync_point_khr;
+typedef cl_uint             cl_command_buffer_state_khr;
+typedef cl_ulong            cl_command_buffer_properties_khr;
+typedef struct _cl_mutable_command_khr* cl_mutable_command_khr;
+typedef cl_ulong            cl_ndrange_kernel_command_properties_khr;
+
+#define CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR           0x12A9
+
+#endif  // cl_khr_command_buffer
+
+typedef CL_API_ENTRY cl_command_buffer_khr(CL_API_CALL *PFN_clCreateCommandBufferKHR)(
+    cl_uint /* num_queues */,
+    const cl_command_queue* /* queues */,
+    const cl_command_buffer_properties_khr* /* properties */,
+    cl_int* /* errcode_ret */);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *PFN_clFinalizeCommandBufferKHR)(
+    cl_command_buffer_khr /* command_buffer */);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *PFN_clReleaseCommandBufferKHR)(
+    cl_command_buffer_khr /* command_buffer */);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *PFN_clEnqueueCommandBufferKHR)(
+    cl_uint /* num_queues */,
+    cl_command_queue* /* queues */,
+    cl_command_buffer_khr /* command_buffer */,
+    cl_uint /* num_events_in_wait_list */,
+    const cl_event* /* event_wait_list */,
+    cl_event* /* event */);
+
+typedef CL_API_ENTRY cl_int(CL_API_CALL *PFN_clCommandNDRangeKernelKHR)(
+    cl_command_buffer_khr /* command_buffer */,
+    cl_command_queue /* command_queue */,
+    const cl_ndrange_kernel_command_properties_khr* /* properties */,
+    cl_kernel /* kernel */,
+    cl_uint /* work_dim */,
+    const size_t* /* global_work_offset */,
+    const size_t* /* global_work_size */,
+    const size_t* /* local_work_size */,
+    cl_uint /* num_sync_points_in_wait_list */,
+    const cl_sync_point_khr* /* sync_point_wait_list */,
+    cl_sync_point_khr* /* sync_point */,
+    cl_mutable_command_khr* /* mutable_handle */);
 
 namespace cl {
 
@@ -110,6 +110,14 @@ event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr) {
     return ev;
 }
 
+event::ptr gpu_buffer::copy_to(stream& stream, void* host_ptr) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    cl_stream.get_cl_queue().enqueueReadBuffer(_buffer, false, 0, size(), host_ptr, nullptr, &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::memory gpu_buffer::get_onednn_memory(dnnl::memory::desc desc, int64_t offset) {
     auto onednn_engine = _engine->get_onednn_engine();
@@ -244,6 +252,10 @@ event::ptr gpu_image2d::copy_from(stream& /* stream */, const void* /* host_ptr
     throw std::runtime_error("[clDNN] copy_from is not implemented for gpu_image2d");
 }
 
+event::ptr gpu_image2d::copy_to(stream& /* stream */, void* /* host_ptr */) {
+    return nullptr;
+}
+
 gpu_media_buffer::gpu_media_buffer(ocl_engine* engine,
                                    const layout& new_layout,
                                    shared_mem_params params)
@@ -395,6 +407,21 @@ event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr) {
     return ev;
 }
 
+event::ptr gpu_usm::copy_to(stream& stream, void* host_ptr) {
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    cl::Event ev_ocl;
+    auto src_ptr = get_buffer().get();
+    cl_stream.get_usm_helper().enqueue_memcpy(cl_stream.get_cl_queue(),
+                                              host_ptr,
+                                              src_ptr,
+                                              _bytes_count,
+                                              false,
+                                              nullptr,
+                                              &ev_ocl);
+
+    return std::make_shared<ocl_event>(ev_ocl);
+}
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
 dnnl::memory gpu_usm::get_onednn_memory(dnnl::memory::desc desc, int64_t offset) {
     auto onednn_engine = _engine->get_onednn_engine();
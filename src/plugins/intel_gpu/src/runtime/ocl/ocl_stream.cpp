@@ -255,7 +255,13 @@ void set_arguments_impl(ocl_kernel_type& kernel,
 }
 
 sync_methods get_expected_sync_method(const engine_configuration &config) {
-    return config.enable_profiling ? sync_methods::events : config.queue_type == queue_types::out_of_order ? sync_methods::barriers
+    // Out of order queue relies on per-primitive event dependencies rather than barriers: a barrier
+    // orders the whole queue, so any join between branches also waits for unrelated primitives and
+    // independent subgraphs get serialized. Events express only the real data dependencies, which
+    // lets the driver overlap disjoint branches. Memory reuse is safe under such concurrent
+    // execution since oooq_memory_dependencies marks any two mutually unreachable nodes as
+    // conflicting when buffers are assigned.
+    return config.enable_profiling ? sync_methods::events : config.queue_type == queue_types::out_of_order ? sync_methods::events
                                                                                                            : sync_methods::none;
 }
 
@@ -381,9 +387,116 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
         throw ocl_error(err);
     }
 
+    if (_capture_list)
+        record_kernel(kern, global, local);
+
     return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
 }
 
+const ocl_stream::command_buffer_entry_points& ocl_stream::get_command_buffer_entry_points() {
+    if (!_cmd_buffer_fns.loaded) {
+        _cmd_buffer_fns.loaded = true;
+        if (_engine.extension_supported("cl_khr_command_buffer")) {
+            auto ctx = _engine.get_cl_context().get();
+            _cmd_buffer_fns.create_fn = try_load_entrypoint<PFN_clCreateCommandBufferKHR>(ctx, "clCreateCommandBufferKHR");
+            _cmd_buffer_fns.finalize_fn = try_load_entrypoint<PFN_clFinalizeCommandBufferKHR>(ctx, "clFinalizeCommandBufferKHR");
+            _cmd_buffer_fns.release_fn = try_load_entrypoint<PFN_clReleaseCommandBufferKHR>(ctx, "clReleaseCommandBufferKHR");
+            _cmd_buffer_fns.enqueue_fn = try_load_entrypoint<PFN_clEnqueueCommandBufferKHR>(ctx, "clEnqueueCommandBufferKHR");
+            _cmd_buffer_fns.command_ndrange_fn = try_load_entrypoint<PFN_clCommandNDRangeKernelKHR>(ctx, "clCommandNDRangeKernelKHR");
+        }
+    }
+    return _cmd_buffer_fns;
+}
+
+command_list::ptr ocl_stream::begin_command_list_capture() {
+    // Recording is limited to the plain execution mode: an in-order queue without per-kernel
+    // events runs the sequence back to back, so a replayed list is equivalent to the regular
+    // enqueue loop. With profiling or an out-of-order queue each enqueue produces events/barriers
+    // which a command buffer would not reproduce, so those modes keep the usual path.
+    if (queue_type != queue_types::in_order || sync_method != sync_methods::none)
+        return nullptr;
+    if (_capture_list)
+        return nullptr;
+
+    const auto& fns = get_command_buffer_entry_points();
+    if (!fns.valid())
+        return nullptr;
+
+    cl_int err = CL_SUCCESS;
+    cl_command_queue queue = _command_queue.get();
+    cl_command_buffer_khr handle = fns.create_fn(1, &queue, nullptr, &err);
+    if (err != CL_SUCCESS || handle == nullptr)
+        return nullptr;
+
+    auto list = std::make_shared<ocl_command_list>();
+    list->handle = handle;
+    list->release_fn = fns.release_fn;
+    _capture_list = list;
+    return list;
+}
+
+void ocl_stream::end_command_list_capture() {
+    if (!_capture_list)
+        return;
+
+    auto list = _capture_list;
+    _capture_list = nullptr;
+
+    if (list->handle == nullptr)
+        return;
+
+    if (list->recorded_kernels == 0 || _cmd_buffer_fns.finalize_fn(list->handle) != CL_SUCCESS) {
+        _cmd_buffer_fns.release_fn(list->handle);
+        list->handle = nullptr;
+    }
+}
+
+bool ocl_stream::replay_command_list(const command_list::ptr& list) {
+    auto ocl_list = std::dynamic_pointer_cast<ocl_command_list>(list);
+    if (!ocl_list || ocl_list->handle == nullptr)
+        return false;
+
+    cl_int err = _cmd_buffer_fns.enqueue_fn(0, nullptr, ocl_list->handle, 0, nullptr, nullptr);
+    if (err != CL_SUCCESS) {
+        _cmd_buffer_fns.release_fn(ocl_list->handle);
+        ocl_list->handle = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void ocl_stream::record_kernel(const cl::Kernel& kernel, const cl::NDRange& global, const cl::NDRange& local) {
+    if (_capture_list->handle == nullptr)
+        return;
+
+    // Sync points chain every command to the previous one, which keeps the original enqueue order
+    // independently of the in-order/out-of-order capability reported for command buffers.
+    cl_sync_point_khr sync_point = 0;
+    cl_int err = _cmd_buffer_fns.command_ndrange_fn(_capture_list->handle,
+                                                    nullptr,
+                                                    nullptr,
+                                                    kernel.get(),
+                                                    static_cast<cl_uint>(global.dimensions()),
+                                                    nullptr,
+                                                    static_cast<const size_t*>(global),
+                                                    local.dimensions() != 0 ? static_cast<const size_t*>(local) : nullptr,
+                                                    _capture_list->has_sync_point ? 1 : 0,
+                                                    _capture_list->has_sync_point ? &_capture_list->last_sync_point : nullptr,
+                                                    &sync_point,
+                                                    nullptr);
+    if (err != CL_SUCCESS) {
+        // Recording is best effort - drop the list and keep going through regular enqueues.
+        _cmd_buffer_fns.release_fn(_capture_list->handle);
+        _capture_list->handle = nullptr;
+        _capture_list = nullptr;
+        return;
+    }
+
+    _capture_list->last_sync_point = sync_point;
+    _capture_list->has_sync_point = true;
+    _capture_list->recorded_kernels++;
+}
+
 void ocl_stream::enqueue_barrier() {
     _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
 }
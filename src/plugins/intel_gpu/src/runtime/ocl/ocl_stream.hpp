@@ -45,6 +45,22 @@ enum class sync_methods {
     /* No explicit syncronization is needed. Applicable for in-order queue only */
     none = 2
 };
+
+// Command list recorded through cl_khr_command_buffer. The handle keeps the kernel sequence
+// with the argument values captured at record time, so replaying costs a single enqueue call.
+struct ocl_command_list : public command_list {
+    cl_command_buffer_khr handle = nullptr;
+    cl_sync_point_khr last_sync_point = 0;
+    bool has_sync_point = false;
+    size_t recorded_kernels = 0;
+    PFN_clReleaseCommandBufferKHR release_fn = nullptr;
+
+    ~ocl_command_list() override {
+        if (handle && release_fn)
+            release_fn(handle);
+    }
+};
+
 class ocl_stream : public stream {
 public:
     const ocl_queue_type& get_cl_queue() const { return _command_queue; }
@@ -78,6 +94,10 @@ public:
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
 
+    command_list::ptr begin_command_list_capture() override;
+    void end_command_list_capture() override;
+    bool replay_command_list(const command_list::ptr& list) override;
+
     const cl::UsmHelper& get_usm_helper() const { return _engine.get_usm_helper(); }
 
     static queue_types detect_queue_type(void* queue_handle);
@@ -88,6 +108,21 @@ public:
 
 private:
     void sync_events(std::vector<event::ptr> const& deps, bool is_output = false);
+    void record_kernel(const cl::Kernel& kernel, const cl::NDRange& global, const cl::NDRange& local);
+
+    struct command_buffer_entry_points {
+        bool loaded = false;
+        PFN_clCreateCommandBufferKHR create_fn = nullptr;
+        PFN_clFinalizeCommandBufferKHR finalize_fn = nullptr;
+        PFN_clReleaseCommandBufferKHR release_fn = nullptr;
+        PFN_clEnqueueCommandBufferKHR enqueue_fn = nullptr;
+        PFN_clCommandNDRangeKernelKHR command_ndrange_fn = nullptr;
+
+        bool valid() const {
+            return create_fn && finalize_fn && release_fn && enqueue_fn && command_ndrange_fn;
+        }
+    };
+    const command_buffer_entry_points& get_command_buffer_entry_points();
 
     const ocl_engine& _engine;
     ocl_queue_type _command_queue;
@@ -97,6 +132,9 @@ private:
 
     sync_methods sync_method;
 
+    command_buffer_entry_points _cmd_buffer_fns;
+    std::shared_ptr<ocl_command_list> _capture_list = nullptr;
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::stream> _onednn_stream = nullptr;
 #endif
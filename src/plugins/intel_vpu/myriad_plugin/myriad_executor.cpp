@@ -343,6 +343,23 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
                              graphHeaderDesc.first,
                              static_cast<unsigned>(graphHeaderDesc.second));
     if (status != NC_OK) {
+        if (status == NC_OUT_OF_MEMORY) {
+            // The firmware can't spill tensors back to the host, so a model whose weights and
+            // intermediate tensors exceed device DDR can't be executed; report the exceeded
+            // budget instead of the bare status code.
+            int deviceMemorySize = 0;
+            int deviceMemoryUsed = 0;
+            unsigned int sizeLength = sizeof(deviceMemorySize);
+            unsigned int usedLength = sizeof(deviceMemoryUsed);
+            if (ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_MEMORY_SIZE,
+                                  &deviceMemorySize, &sizeLength) == NC_OK &&
+                ncDeviceGetOption(device->_deviceHandle, NC_RO_DEVICE_CURRENT_MEMORY_USED,
+                                  &deviceMemoryUsed, &usedLength) == NC_OK) {
+                IE_THROW() << "Failed to allocate graph: " << ncStatusToStr(nullptr, status)
+                           << " (graph blob is " << graphFileContent.size() << " bytes, device memory used "
+                           << deviceMemoryUsed << " of " << deviceMemorySize << " bytes)";
+            }
+        }
         IE_THROW() << "Failed to allocate graph: " << ncStatusToStr(nullptr, status);
     }
 
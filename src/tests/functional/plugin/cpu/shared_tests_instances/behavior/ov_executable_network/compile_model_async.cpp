@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "behavior/ov_executable_network/compile_model_async.hpp"
+#include "ie_plugin_config.hpp"
+
+using namespace ov::test::behavior;
+namespace {
+
+    const std::vector<ov::AnyMap> configs = {
+            {},
+    };
+    const std::vector<ov::AnyMap> multiConfigs = {
+            {{ InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU}}
+    };
+
+    INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVCompileModelAsyncTests,
+                            ::testing::Combine(
+                                    ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                    ::testing::ValuesIn(configs)),
+                            OVCompileModelAsyncTests::getTestCaseName);
+
+    INSTANTIATE_TEST_SUITE_P(smoke_Multi_BehaviorTests, OVCompileModelAsyncTests,
+                            ::testing::Combine(
+                                    ::testing::Values(CommonTestUtils::DEVICE_MULTI),
+                                    ::testing::ValuesIn(multiConfigs)),
+                            OVCompileModelAsyncTests::getTestCaseName);
+
+    INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, OVCompileModelAsyncTests,
+                            ::testing::Combine(
+                                    ::testing::Values(CommonTestUtils::DEVICE_AUTO),
+                                    ::testing::ValuesIn(multiConfigs)),
+                            OVCompileModelAsyncTests::getTestCaseName);
+}  // namespace
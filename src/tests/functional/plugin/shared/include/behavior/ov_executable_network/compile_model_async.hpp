@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <future>
+#include <vector>
+
+#include "base/ov_behavior_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+class OVCompileModelAsyncTests : public testing::WithParamInterface<InferRequestParams>,
+                                 public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<InferRequestParams> obj) {
+        std::string targetDevice;
+        ov::AnyMap configuration;
+        std::tie(targetDevice, configuration) = obj.param;
+        std::ostringstream result;
+        result << "targetDevice=" << targetDevice << "_";
+        if (!configuration.empty()) {
+            for (auto& configItem : configuration) {
+                result << "configItem=" << configItem.first << "_";
+                configItem.second.print(result);
+                result << "_";
+            }
+        }
+        return result.str();
+    }
+
+    void SetUp() override {
+        // Skip test according to plugin specific disabledTestPatterns() (if any)
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        std::tie(targetDevice, configuration) = this->GetParam();
+        function = ngraph::builder::subgraph::makeConvPoolRelu();
+    }
+
+    void TearDown() override {
+        if (!configuration.empty()) {
+            utils::PluginCache::get().reset();
+        }
+    }
+
+protected:
+    std::shared_ptr<ov::Core> core = utils::PluginCache::get().core();
+    std::string targetDevice;
+    ov::AnyMap configuration;
+    std::shared_ptr<ov::Model> function;
+};
+
+TEST_P(OVCompileModelAsyncTests, futureProvidesUsableCompiledModel) {
+    std::future<ov::CompiledModel> future;
+    OV_ASSERT_NO_THROW(future = core->compile_model_async(function, targetDevice, configuration));
+    ov::CompiledModel execNet;
+    OV_ASSERT_NO_THROW(execNet = future.get());
+    ov::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(req.infer());
+}
+
+TEST_P(OVCompileModelAsyncTests, compilationExceptionIsRethrownFromGet) {
+    // an unregistered device cannot fail scheduling, only the compilation task itself
+    std::future<ov::CompiledModel> future;
+    OV_ASSERT_NO_THROW(future = core->compile_model_async(function, "UnregisteredDevice", configuration));
+    ASSERT_THROW(future.get(), ov::Exception);
+}
+
+TEST_P(OVCompileModelAsyncTests, readExceptionIsRethrownFromGet) {
+    std::future<ov::CompiledModel> future;
+    OV_ASSERT_NO_THROW(future = core->compile_model_async("unexisting_model.xml", targetDevice, configuration));
+    ASSERT_THROW(future.get(), ov::Exception);
+}
+
+TEST_P(OVCompileModelAsyncTests, concurrentCompilationsAllComplete) {
+    constexpr size_t numModels = 4;
+    std::vector<std::future<ov::CompiledModel>> futures;
+    for (size_t i = 0; i < numModels; ++i) {
+        OV_ASSERT_NO_THROW(futures.emplace_back(core->compile_model_async(function, targetDevice, configuration)));
+    }
+    for (auto& future : futures) {
+        ov::CompiledModel execNet;
+        OV_ASSERT_NO_THROW(execNet = future.get());
+        ov::InferRequest req;
+        OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(req.infer());
+    }
+}
+
+TEST_P(OVCompileModelAsyncTests, futureOutlivesCore) {
+    std::future<ov::CompiledModel> future;
+    {
+        ov::Core localCore;
+        OV_ASSERT_NO_THROW(future = localCore.compile_model_async(function, targetDevice, configuration));
+    }
+    // the compilation task keeps a copy of the Core, so dropping the application's
+    // handle while the future is pending must not invalidate the result
+    ov::CompiledModel execNet;
+    OV_ASSERT_NO_THROW(execNet = future.get());
+    ov::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(req.infer());
+}
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
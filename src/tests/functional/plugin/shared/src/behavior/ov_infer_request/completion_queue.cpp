@@ -0,0 +1,154 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <future>
+#include <set>
+#include <thread>
+
+#include "behavior/ov_infer_request/completion_queue.hpp"
+#include "openvino/runtime/completion_queue.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+std::string OVInferRequestCompletionQueueTests::getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj) {
+    return OVInferRequestTests::getTestCaseName(obj);
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, canHarvestMultipleProducersWithOneQueue) {
+    constexpr size_t numRequests = 4;
+    ov::CompletionQueue queue;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; ++i) {
+        ov::InferRequest req;
+        OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(queue.subscribe(req, static_cast<int64_t>(i)));
+        requests.emplace_back(std::move(req));
+    }
+    for (auto& req : requests) {
+        OV_ASSERT_NO_THROW(req.start_async());
+    }
+    std::vector<ov::CompletionQueue::Completion> completions;
+    while (completions.size() < numRequests) {
+        size_t harvested = 0;
+        OV_ASSERT_NO_THROW(harvested = queue.wait(completions));
+        ASSERT_GT(harvested, 0u);
+    }
+    ASSERT_EQ(completions.size(), numRequests);
+    std::set<int64_t> tags;
+    for (auto& completion : completions) {
+        ASSERT_FALSE(completion.exception);
+        tags.insert(completion.tag);
+    }
+    ASSERT_EQ(tags.size(), numRequests);
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, waitForTimesOutOnIdleQueue) {
+    ov::CompletionQueue queue;
+    std::vector<ov::CompletionQueue::Completion> completions;
+    size_t harvested = 1;
+    OV_ASSERT_NO_THROW(harvested = queue.wait_for(completions, 1, std::chrono::milliseconds{10}));
+    ASSERT_EQ(harvested, 0u);
+    ASSERT_TRUE(completions.empty());
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, waitForHarvestsCompletionWithinTimeout) {
+    ov::CompletionQueue queue;
+    ov::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(queue.subscribe(req, 42));
+    OV_ASSERT_NO_THROW(req.start_async());
+    std::vector<ov::CompletionQueue::Completion> completions;
+    size_t harvested = 0;
+    OV_ASSERT_NO_THROW(harvested = queue.wait_for(completions, 1, std::chrono::minutes{1}));
+    ASSERT_EQ(harvested, 1u);
+    ASSERT_EQ(completions.front().tag, 42);
+    ASSERT_FALSE(completions.front().exception);
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, boundedHarvestLeavesRemainderForNextWait) {
+    constexpr size_t numRequests = 3;
+    ov::CompletionQueue queue;
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; ++i) {
+        ov::InferRequest req;
+        OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(queue.subscribe(req, static_cast<int64_t>(i)));
+        requests.emplace_back(std::move(req));
+    }
+    for (auto& req : requests) {
+        OV_ASSERT_NO_THROW(req.start_async());
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    // everything has completed, so bounded waits must drain the queue one completion at
+    // a time without ever blocking
+    std::set<int64_t> tags;
+    for (size_t i = 0; i < numRequests; ++i) {
+        std::vector<ov::CompletionQueue::Completion> completions;
+        size_t harvested = 0;
+        OV_ASSERT_NO_THROW(harvested = queue.wait(completions, 1));
+        ASSERT_EQ(harvested, 1u);
+        tags.insert(completions.front().tag);
+    }
+    ASSERT_EQ(tags.size(), numRequests);
+    std::vector<ov::CompletionQueue::Completion> completions;
+    ASSERT_EQ(queue.try_pop(completions), 0u);
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, completionOutlivesRequest) {
+    ov::CompletionQueue queue;
+    {
+        ov::InferRequest req;
+        OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+        OV_ASSERT_NO_THROW(queue.subscribe(req, 7));
+        OV_ASSERT_NO_THROW(req.start_async());
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    std::vector<ov::CompletionQueue::Completion> completions;
+    size_t harvested = 0;
+    OV_ASSERT_NO_THROW(harvested = queue.wait(completions));
+    ASSERT_EQ(harvested, 1u);
+    ASSERT_EQ(completions.front().tag, 7);
+    ASSERT_FALSE(completions.front().exception);
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, shutdownUnblocksWaitingHarvester) {
+    ov::CompletionQueue queue;
+    std::promise<size_t> harvestedPromise;
+    auto harvestedFuture = harvestedPromise.get_future();
+    std::thread harvester([&] {
+        std::vector<ov::CompletionQueue::Completion> completions;
+        harvestedPromise.set_value(queue.wait(completions));
+    });
+    // the harvester has nothing to harvest, so only shutdown() can release it
+    ASSERT_EQ(harvestedFuture.wait_for(std::chrono::milliseconds{100}), std::future_status::timeout);
+    OV_ASSERT_NO_THROW(queue.shutdown());
+    ASSERT_EQ(harvestedFuture.wait_for(std::chrono::minutes{1}), std::future_status::ready);
+    ASSERT_EQ(harvestedFuture.get(), 0u);
+    harvester.join();
+}
+
+TEST_P(OVInferRequestCompletionQueueTests, waitAfterShutdownStillReturnsQueuedCompletions) {
+    ov::CompletionQueue queue;
+    ov::InferRequest req;
+    OV_ASSERT_NO_THROW(req = execNet.create_infer_request());
+    OV_ASSERT_NO_THROW(queue.subscribe(req, 11));
+    OV_ASSERT_NO_THROW(req.start_async());
+    OV_ASSERT_NO_THROW(req.wait());
+    OV_ASSERT_NO_THROW(queue.shutdown());
+    std::vector<ov::CompletionQueue::Completion> completions;
+    size_t harvested = 0;
+    OV_ASSERT_NO_THROW(harvested = queue.wait(completions));
+    ASSERT_EQ(harvested, 1u);
+    ASSERT_EQ(completions.front().tag, 11);
+    // and once drained, wait() keeps returning immediately instead of deadlocking
+    completions.clear();
+    OV_ASSERT_NO_THROW(harvested = queue.wait(completions));
+    ASSERT_EQ(harvested, 0u);
+}
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+
+#include "behavior/ov_infer_request/infer_batch.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+std::string OVInferRequestInferBatchTests::getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj) {
+    return OVInferRequestTests::getTestCaseName(obj);
+}
+
+namespace {
+
+// a two-input Add keeps the per-sample arithmetic trivially checkable
+std::shared_ptr<ov::Model> makeAddModel() {
+    auto param_a = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto param_b = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto add = std::make_shared<ov::opset8::Add>(param_a, param_b);
+    return std::make_shared<ov::Model>(add, ov::ParameterVector{param_a, param_b});
+}
+
+ov::Tensor makeFilledTensor(float value) {
+    ov::Tensor tensor(ov::element::f32, ov::Shape{2, 2});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = value;
+    }
+    return tensor;
+}
+
+void expectFilledWith(const ov::Tensor& tensor, float value) {
+    const auto* data = tensor.data<const float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        ASSERT_EQ(data[i], value) << "at element " << i;
+    }
+}
+
+}  // namespace
+
+TEST_P(OVInferRequestInferBatchTests, perSampleOutputsAreReassembled) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+
+    constexpr size_t numSamples = 5;
+    std::vector<std::vector<ov::Tensor>> inputs, outputs;
+    for (size_t sample = 0; sample < numSamples; ++sample) {
+        inputs.push_back({makeFilledTensor(static_cast<float>(sample)), makeFilledTensor(1.0f)});
+        outputs.push_back({ov::Tensor(ov::element::f32, ov::Shape{2, 2})});
+    }
+
+    OV_ASSERT_NO_THROW(req.infer_batch(inputs, outputs));
+
+    // every sample's result must land in that sample's output tensor
+    for (size_t sample = 0; sample < numSamples; ++sample) {
+        expectFilledWith(outputs[sample][0], static_cast<float>(sample) + 1.0f);
+    }
+}
+
+TEST_P(OVInferRequestInferBatchTests, withoutOutputsLastSampleRemains) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+
+    std::vector<std::vector<ov::Tensor>> inputs = {
+        {makeFilledTensor(1.0f), makeFilledTensor(1.0f)},
+        {makeFilledTensor(2.0f), makeFilledTensor(1.0f)},
+        {makeFilledTensor(3.0f), makeFilledTensor(1.0f)},
+    };
+
+    OV_ASSERT_NO_THROW(req.infer_batch(inputs));
+
+    // consecutive samples reuse the request output tensors, so only the last result survives
+    expectFilledWith(req.get_output_tensor(0), 4.0f);
+}
+
+TEST_P(OVInferRequestInferBatchTests, singleSampleBehavesLikeInfer) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+
+    std::vector<std::vector<ov::Tensor>> inputs = {{makeFilledTensor(2.0f), makeFilledTensor(3.0f)}};
+    std::vector<std::vector<ov::Tensor>> outputs = {{ov::Tensor(ov::element::f32, ov::Shape{2, 2})}};
+
+    OV_ASSERT_NO_THROW(req.infer_batch(inputs, outputs));
+    expectFilledWith(outputs[0][0], 5.0f);
+}
+
+TEST_P(OVInferRequestInferBatchTests, emptyBatchThrows) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+    ASSERT_THROW(req.infer_batch({}), ov::Exception);
+}
+
+TEST_P(OVInferRequestInferBatchTests, mismatchedOutputSampleCountThrows) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+
+    std::vector<std::vector<ov::Tensor>> inputs = {
+        {makeFilledTensor(1.0f), makeFilledTensor(1.0f)},
+        {makeFilledTensor(2.0f), makeFilledTensor(1.0f)},
+    };
+    std::vector<std::vector<ov::Tensor>> outputs = {{ov::Tensor(ov::element::f32, ov::Shape{2, 2})}};
+
+    ASSERT_THROW(req.infer_batch(inputs, outputs), ov::Exception);
+}
+
+TEST_P(OVInferRequestInferBatchTests, incompleteSampleThrows) {
+    auto compiled = core->compile_model(makeAddModel(), targetDevice, configuration);
+    auto req = compiled.create_infer_request();
+
+    // the second sample misses one of the two model inputs
+    std::vector<std::vector<ov::Tensor>> inputs = {
+        {makeFilledTensor(1.0f), makeFilledTensor(1.0f)},
+        {makeFilledTensor(2.0f)},
+    };
+
+    ASSERT_THROW(req.infer_batch(inputs), ov::Exception);
+}
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
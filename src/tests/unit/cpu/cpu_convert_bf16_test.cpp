@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cstring>
+#include <vector>
+
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+float float_from_bits(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+bool is_bf16_nan(uint16_t bits) {
+    return (bits & 0x7F80) == 0x7F80 && (bits & 0x007F) != 0;
+}
+
+// What the fp32 -> bf16 kernel is expected to produce for a finite input. The AVX2
+// emulation is bit-exact with bfloat16_t::round_to_nearest_even, which truncates
+// whenever the target LSB is even; the vcvtneps2bf16 branch taken on
+// avx512_core_bf16 hosts performs true round-to-nearest-even and rounds
+// above-the-tie fractions up even for an even LSB.
+uint16_t expected_bf16_bits(float value) {
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_bf16)) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof bits);
+        const uint32_t lsb = (bits >> 16) & 1;
+        return static_cast<uint16_t>((bits + 0x7FFF + lsb) >> 16);
+    }
+    return bfloat16_t::round_to_nearest_even(value);
+}
+
+}  // namespace
+
+TEST(CpuConvertBF16Test, RoundingAroundTheTieMatchesScalarHelper) {
+    // sweep the discarded fraction below / at / above the 0x8000 tie for target
+    // values whose bf16 LSB is even (0x3F80 = 1.0f) and odd (0x3F81)
+    const uint16_t high_halves[] = {0x3F80, 0x3F81, 0xBF80, 0xBF81};
+    const uint16_t fractions[] = {0x0000, 0x0001, 0x7FFF, 0x8000, 0x8001, 0xFFFF};
+
+    std::vector<float> src;
+    for (auto high : high_halves) {
+        for (auto fraction : fractions) {
+            src.push_back(float_from_bits((static_cast<uint32_t>(high) << 16) | fraction));
+        }
+    }
+    // an odd total size also exercises the kernel's tail path
+    src.push_back(0.0f);
+
+    std::vector<bfloat16_t> dst(src.size());
+    cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::BF16, src.size());
+
+    for (size_t i = 0; i < src.size(); ++i) {
+        uint32_t src_bits;
+        std::memcpy(&src_bits, &src[i], sizeof src_bits);
+        EXPECT_EQ(dst[i].to_bits(), expected_bf16_bits(src[i]))
+            << "input bits 0x" << std::hex << src_bits;
+    }
+}
+
+TEST(CpuConvertBF16Test, SpecialValuesSurviveConversion) {
+    const std::vector<float> src = {
+        float_from_bits(0x7F800000),  // +inf
+        float_from_bits(0xFF800000),  // -inf
+        float_from_bits(0x7FC00000),  // quiet NaN
+        float_from_bits(0xFFC00001),  // negative NaN with payload
+        float_from_bits(0x00000000),  // +0
+        float_from_bits(0x80000000),  // -0
+    };
+
+    std::vector<bfloat16_t> dst(src.size());
+    cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::BF16, src.size());
+
+    EXPECT_EQ(dst[0].to_bits(), 0x7F80);
+    EXPECT_EQ(dst[1].to_bits(), 0xFF80);
+    EXPECT_TRUE(is_bf16_nan(dst[2].to_bits())) << std::hex << dst[2].to_bits();
+    EXPECT_TRUE(is_bf16_nan(dst[3].to_bits())) << std::hex << dst[3].to_bits();
+    EXPECT_EQ(dst[4].to_bits(), 0x0000);
+    EXPECT_EQ(dst[5].to_bits(), 0x8000);
+}
@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu/x64/jit_generator.hpp>
+#include <vector>
+
+#include "emitters/jit_amx_emitters.hpp"
+#include "utils/bfloat16.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+
+namespace {
+
+// Minimal kernel around the emitters: program the tile file, run one tile-GEMM
+// blocking and release the tiles, the same sequence a consuming kernel has to emit.
+class jit_amx_gemm_test_kernel : public x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_amx_gemm_test_kernel)
+
+public:
+    typedef void (*fn_t)(const void* a, const void* b, void* c);
+
+    jit_amx_gemm_test_kernel(Precision a_prc, Precision b_prc,
+                             int M, int N, int K,
+                             size_t lda, size_t ldb, size_t ldc,
+                             bool accumulate)
+        : a_prc_(a_prc), b_prc_(b_prc), M_(M), N_(N), K_(K),
+          lda_(lda), ldb_(ldb), ldc_(ldc), accumulate_(accumulate) {}
+
+    void generate() override {
+        auto config = std::make_shared<jit_amx_tile_config_emitter>(this, x64::avx512_core,
+                                                                    amx_tile_config_t::full_tiles());
+        auto gemm = std::make_shared<jit_amx_tile_gemm_emitter>(this, x64::avx512_core,
+                                                                a_prc_, b_prc_, M_, N_, K_,
+                                                                lda_, ldb_, ldc_, accumulate_);
+        auto release = std::make_shared<jit_amx_tile_release_emitter>(this, x64::avx512_core);
+
+        preamble();
+        config->emit_code({}, {});
+        gemm->emit_code({static_cast<size_t>(abi_param1.getIdx()),
+                         static_cast<size_t>(abi_param2.getIdx()),
+                         static_cast<size_t>(abi_param3.getIdx())}, {});
+        release->emit_code({}, {});
+        postamble();
+        config->emit_data();
+    }
+
+    fn_t compile() {
+        create_kernel();
+        return (fn_t)jit_ker();
+    }
+
+private:
+    Precision a_prc_;
+    Precision b_prc_;
+    int M_, N_, K_;
+    size_t lda_, ldb_, ldc_;
+    bool accumulate_;
+};
+
+// jit_generator::generate is pure virtual, the construction-rejection tests only need a host object
+class jit_dummy_host : public x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_dummy_host)
+    void generate() override {}
+};
+
+// element (k, n) of a VNNI-repacked B, g consecutive k values per packed row entry
+template <typename T>
+T& vnni_at(std::vector<T>& packed, size_t ldb_elements, int k, int n, int g) {
+    return packed[(k / g) * ldb_elements + n * g + k % g];
+}
+
+}  // namespace
+
+TEST(AmxEmittersTest, GemmEmitterRejectsUnsupportedPrecisionPair) {
+    // the precision check precedes the ISA check, so it is host-independent
+    jit_dummy_host host;
+    ASSERT_THROW(jit_amx_tile_gemm_emitter(&host, x64::avx512_core,
+                                           Precision::FP32, Precision::FP32,
+                                           16, 16, 32, 64, 64, 64, false),
+                 InferenceEngine::Exception);
+    ASSERT_THROW(jit_amx_tile_gemm_emitter(&host, x64::avx512_core,
+                                           Precision::BF16, Precision::I8,
+                                           16, 16, 32, 64, 64, 64, false),
+                 InferenceEngine::Exception);
+}
+
+TEST(AmxEmittersTest, EmittersRequireAmxSupport) {
+    if (x64::mayiuse(x64::amx_tile))
+        GTEST_SKIP() << "covers the rejection path on hosts without AMX";
+    jit_dummy_host host;
+    ASSERT_THROW(jit_amx_tile_config_emitter(&host, x64::avx512_core, amx_tile_config_t::full_tiles()),
+                 InferenceEngine::Exception);
+    ASSERT_THROW(jit_amx_tile_release_emitter(&host, x64::avx512_core),
+                 InferenceEngine::Exception);
+}
+
+TEST(AmxEmittersTest, GemmEmitterRejectsTails) {
+    if (!x64::mayiuse(x64::amx_bf16))
+        GTEST_SKIP() << "requires an AMX bf16 host";
+    jit_dummy_host host;
+    // M not a multiple of 16
+    ASSERT_THROW(jit_amx_tile_gemm_emitter(&host, x64::avx512_core,
+                                           Precision::BF16, Precision::BF16,
+                                           8, 16, 32, 64, 64, 64, false),
+                 InferenceEngine::Exception);
+    // K not a multiple of 64 / type_size
+    ASSERT_THROW(jit_amx_tile_gemm_emitter(&host, x64::avx512_core,
+                                           Precision::BF16, Precision::BF16,
+                                           16, 16, 17, 64, 64, 64, false),
+                 InferenceEngine::Exception);
+}
+
+TEST(AmxEmittersTest, Bf16GemmMatchesReference) {
+    if (!x64::mayiuse(x64::amx_bf16))
+        GTEST_SKIP() << "requires an AMX bf16 host";
+
+    constexpr int M = 32, N = 32, K = 64;
+    constexpr size_t lda = K * sizeof(bfloat16_t);
+    constexpr size_t ldb = N * 4;
+    constexpr size_t ldc = N * sizeof(float);
+    constexpr int g = 2;  // bf16 values per VNNI group
+
+    std::vector<bfloat16_t> a(M * K);
+    std::vector<bfloat16_t> b_vnni(K * N);
+    std::vector<float> b_plain(K * N);
+    for (int m = 0; m < M; ++m)
+        for (int k = 0; k < K; ++k)
+            a[m * K + k] = bfloat16_t(static_cast<float>((m + k) % 5));
+    for (int k = 0; k < K; ++k)
+        for (int n = 0; n < N; ++n) {
+            const float value = static_cast<float>((k * 3 + n) % 7) - 3.0f;
+            b_plain[k * N + n] = value;
+            vnni_at(b_vnni, ldb / sizeof(bfloat16_t), k, n, g) = bfloat16_t(value);
+        }
+
+    std::vector<float> c(M * N, 42.0f);
+    jit_amx_gemm_test_kernel kernel(Precision::BF16, Precision::BF16, M, N, K, lda, ldb, ldc, false);
+    auto fn = kernel.compile();
+    ASSERT_NE(fn, nullptr);
+    fn(a.data(), b_vnni.data(), c.data());
+
+    // the inputs are small integers, so f32 accumulation is exact
+    for (int m = 0; m < M; ++m)
+        for (int n = 0; n < N; ++n) {
+            float expected = 0.0f;
+            for (int k = 0; k < K; ++k)
+                expected += static_cast<float>(a[m * K + k]) * b_plain[k * N + n];
+            ASSERT_EQ(c[m * N + n], expected) << "at (" << m << ", " << n << ")";
+        }
+}
+
+TEST(AmxEmittersTest, Bf16GemmAccumulates) {
+    if (!x64::mayiuse(x64::amx_bf16))
+        GTEST_SKIP() << "requires an AMX bf16 host";
+
+    constexpr int M = 16, N = 16, K = 32;
+    constexpr size_t lda = K * sizeof(bfloat16_t);
+    constexpr size_t ldb = N * 4;
+    constexpr size_t ldc = N * sizeof(float);
+
+    std::vector<bfloat16_t> a(M * K, bfloat16_t(1.0f));
+    std::vector<bfloat16_t> b_vnni(K * N, bfloat16_t(1.0f));
+    std::vector<float> c(M * N, 10.0f);
+
+    jit_amx_gemm_test_kernel kernel(Precision::BF16, Precision::BF16, M, N, K, lda, ldb, ldc, true);
+    auto fn = kernel.compile();
+    ASSERT_NE(fn, nullptr);
+    fn(a.data(), b_vnni.data(), c.data());
+
+    for (int i = 0; i < M * N; ++i)
+        ASSERT_EQ(c[i], 10.0f + K) << "at " << i;
+}
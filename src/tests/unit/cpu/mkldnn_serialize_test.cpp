@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/opsets/opset1.hpp>
+#include <openvino/pass/serialize.hpp>
+#include <pugixml.hpp>
+#include <sstream>
+
+#include "mkldnn_serialize.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// Mirrors the envelope CNNNetworkSerializer writes in front of the payload; kept in
+// sync by hand on purpose so a layout change breaks these tests instead of only old blobs.
+struct TestBlobEnvelope {
+    char magic[4];
+    uint32_t format_version;
+    uint32_t producer_size;
+};
+constexpr uint32_t supportedFormatVersion = 1;
+
+std::shared_ptr<ngraph::Function> makeTestFunction() {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 2, 2});
+    param->set_friendly_name("in");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+    relu->set_friendly_name("out");
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                              ngraph::ParameterVector{param},
+                                              "serialize_test_net");
+}
+
+// The plugin builds the imported network with Core::ReadNetwork; for the container
+// tests re-reading the IR is irrelevant, so the builder just records what it was
+// handed and rebuilds the network from the original ngraph function.
+CNNNetworkDeserializer::cnn_network_builder makeRecordingBuilder(std::string& capturedModel) {
+    return [&capturedModel](const std::string& model, const Blob::CPtr&) {
+        capturedModel = model;
+        return CNNNetwork{makeTestFunction()};
+    };
+}
+
+}  // namespace
+
+TEST(MKLDNNSerializeTest, RoundTripRestoresPrecisionsAndLayouts) {
+    CNNNetwork network{makeTestFunction()};
+    network.getInputsInfo().at("in")->setPrecision(Precision::FP16);
+    network.getInputsInfo().at("in")->setLayout(Layout::NHWC);
+    network.getOutputsInfo().at("out")->setPrecision(Precision::FP16);
+
+    std::stringstream stream;
+    CNNNetworkSerializer serializer(stream, nullptr);
+    serializer << network;
+
+    std::string capturedModel;
+    CNNNetworkDeserializer deserializer(stream, makeRecordingBuilder(capturedModel));
+    CNNNetwork imported;
+    ASSERT_NO_THROW(deserializer >> imported);
+
+    EXPECT_NE(capturedModel.find("serialize_test_net"), std::string::npos);
+    EXPECT_EQ(imported.getInputsInfo().at("in")->getPrecision(), Precision::FP16);
+    EXPECT_EQ(imported.getInputsInfo().at("in")->getLayout(), Layout::NHWC);
+    EXPECT_EQ(imported.getOutputsInfo().at("out")->getPrecision(), Precision::FP16);
+}
+
+TEST(MKLDNNSerializeTest, NewerFormatVersionThrowsWithProducer) {
+    const std::string producer = "future-build-42";
+    TestBlobEnvelope envelope = {};
+    envelope.magic[0] = 'O';
+    envelope.magic[1] = 'V';
+    envelope.magic[2] = 'C';
+    envelope.magic[3] = 'M';
+    envelope.format_version = supportedFormatVersion + 1;
+    envelope.producer_size = static_cast<uint32_t>(producer.size());
+
+    std::stringstream stream;
+    stream.write(reinterpret_cast<const char*>(&envelope), sizeof envelope);
+    stream.write(producer.c_str(), producer.size());
+
+    std::string capturedModel;
+    CNNNetworkDeserializer deserializer(stream, makeRecordingBuilder(capturedModel));
+    CNNNetwork imported;
+    try {
+        deserializer >> imported;
+        FAIL() << "A blob with a newer format version must not import";
+    } catch (const NetworkNotRead& e) {
+        const std::string message = e.what();
+        EXPECT_NE(message.find(producer), std::string::npos) << message;
+        EXPECT_NE(message.find("format version 2"), std::string::npos) << message;
+    }
+    // the builder must not run on a rejected blob
+    EXPECT_TRUE(capturedModel.empty());
+}
+
+TEST(MKLDNNSerializeTest, LegacyBlobWithoutEnvelopeStillImports) {
+    // a legacy producer wrote the StreamSerialize payload directly, with no envelope
+    auto writeInputsAndOutputs = [](std::ostream& stream) {
+        pugi::xml_document doc;
+        pugi::xml_node root = doc.append_child("cnndata");
+        pugi::xml_node in = root.append_child("inputs").append_child("in");
+        in.append_attribute("name").set_value("in");
+        in.append_attribute("precision").set_value("FP16");
+        in.append_attribute("layout").set_value("NHWC");
+        pugi::xml_node out = root.append_child("outputs").append_child("out");
+        out.append_attribute("name").set_value("out");
+        out.append_attribute("precision").set_value("FP32");
+        out.append_attribute("layout").set_value("NCHW");
+        doc.save(stream);
+    };
+
+    std::stringstream stream;
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    ov::pass::StreamSerialize legacySerializer(stream, std::map<std::string, ngraph::OpSet>{}, writeInputsAndOutputs);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    legacySerializer.run_on_model(makeTestFunction());
+
+    std::string capturedModel;
+    CNNNetworkDeserializer deserializer(stream, makeRecordingBuilder(capturedModel));
+    CNNNetwork imported;
+    ASSERT_NO_THROW(deserializer >> imported);
+
+    EXPECT_NE(capturedModel.find("serialize_test_net"), std::string::npos);
+    EXPECT_EQ(imported.getInputsInfo().at("in")->getPrecision(), Precision::FP16);
+    EXPECT_EQ(imported.getInputsInfo().at("in")->getLayout(), Layout::NHWC);
+    EXPECT_EQ(imported.getOutputsInfo().at("out")->getPrecision(), Precision::FP32);
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/concat.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+static std::shared_ptr<op::v0::Concat> make_concat(size_t num_inputs, int64_t axis) {
+    OutputVector inputs;
+    for (size_t i = 0; i < num_inputs; ++i) {
+        inputs.push_back(std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic()));
+    }
+    return std::make_shared<op::v0::Concat>(inputs, axis);
+}
+
+TEST(StaticShapeInferenceTest, ConcatAlongAxis) {
+    auto concat = make_concat(2, 1);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 5, 4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(concat.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 8, 4}));
+}
+
+TEST(StaticShapeInferenceTest, ConcatNegativeAxis) {
+    auto concat = make_concat(2, -1);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 3, 6}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(concat.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3, 10}));
+}
+
+TEST(StaticShapeInferenceTest, ConcatThreeInputs) {
+    auto concat = make_concat(3, 0);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 4}, StaticShape{2, 4}, StaticShape{3, 4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(concat.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({6, 4}));
+}
+
+TEST(StaticShapeInferenceTest, ConcatInconsistentNonAxisDimension) {
+    auto concat = make_concat(2, 1);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{5, 3, 4}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(concat.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, ConcatAxisOutOfBounds) {
+    auto concat = make_concat(2, 3);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2, 3, 4}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(concat.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
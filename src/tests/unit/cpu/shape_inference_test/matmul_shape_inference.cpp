@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/matmul.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+static std::shared_ptr<op::v0::MatMul> make_matmul(bool transpose_a = false, bool transpose_b = false) {
+    auto a = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto b = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    return std::make_shared<op::v0::MatMul>(a, b, transpose_a, transpose_b);
+}
+
+TEST(StaticShapeInferenceTest, MatMulVectorByVector) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3}, StaticShape{3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulVectorByMatrix) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3}, StaticShape{2, 3, 4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulMatrixByVector) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 3}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTransposeA) {
+    auto matmul = make_matmul(true, false);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 2}, StaticShape{3, 4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTransposeB) {
+    auto matmul = make_matmul(false, true);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3}, StaticShape{4, 3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTransposeBoth) {
+    auto matmul = make_matmul(true, true);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 2}, StaticShape{4, 3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTransposeIgnoredForVector) {
+    // transposition attributes only apply to genuine matrices, not to promoted 1-D arguments
+    auto matmul = make_matmul(true, true);
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3}, StaticShape{4, 3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulBatchBroadcast) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 5, 3, 2}, StaticShape{7, 1, 2, 4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(matmul.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({7, 5, 3, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulIncompatibleMatrixDimensions) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3}, StaticShape{4, 5}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(matmul.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, MatMulIncompatibleBatchDimensions) {
+    auto matmul = make_matmul();
+    std::vector<StaticShape> static_input_shapes = {StaticShape{5, 3, 2}, StaticShape{4, 2, 4}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(matmul.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
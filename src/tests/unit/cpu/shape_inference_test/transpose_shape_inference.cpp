@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/transpose.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+
+TEST(StaticShapeInferenceTest, TransposeWithConstantOrder) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto order = op::v0::Constant::create(element::i64, Shape{4}, {0, 2, 3, 1});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 2, 3, 4}, StaticShape{4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 3, 4, 2}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeEmptyOrderReversesDimensions) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto order = op::v0::Constant::create(element::i64, Shape{0}, std::vector<int64_t>{});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{0}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4, 3, 2}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeWithOrderFromHostTensor) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto order = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{-1});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    int32_t order_val[] = {1, 0};
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> constant_data;
+    constant_data[1] =
+        std::make_shared<ngraph::runtime::HostTensor>(ngraph::element::Type_t::i32, ov::Shape{2}, order_val);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3}, StaticShape{2}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes, constant_data);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3, 2}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeOrderSizeMismatch) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto order = op::v0::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{2}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(transpose.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, TransposeOrderAxisOutOfRange) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto order = op::v0::Constant::create(element::i64, Shape{2}, {0, 2});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3}, StaticShape{2}},
+                             static_output_shapes = {StaticShape{}};
+    EXPECT_THROW(shape_inference(transpose.get(), static_input_shapes, static_output_shapes), NodeValidationFailure);
+}
@@ -203,6 +203,25 @@ TEST(NetworkContext_CNNNetwork, HashOfSame) {
               NetworkCompilationContext::computeHash(net2, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashChangesAfterInPlaceReshape) {
+    auto net = createNetwork();
+    auto hashBefore = NetworkCompilationContext::computeHash(net, {});
+
+    // the same Function instance mutated in place, as in read_model -> reshape -> compile_model
+    auto function = net.getFunction();
+    function->get_parameters()[0]->set_partial_shape(ov::PartialShape{6, 1, 2});
+    function->validate_nodes_and_infer_types();
+    auto hashAfter = NetworkCompilationContext::computeHash(net, {});
+    ASSERT_NE(hashBefore, hashAfter);
+
+    // the mutated model hashes consistently on repeated lookups
+    ASSERT_EQ(hashAfter, NetworkCompilationContext::computeHash(net, {}));
+
+    function->get_parameters()[0]->set_partial_shape(ov::PartialShape{3, 1, 2});
+    function->validate_nodes_and_infer_types();
+    ASSERT_EQ(hashBefore, NetworkCompilationContext::computeHash(net, {}));
+}
+
 TEST(NetworkContext_CNNNetwork, HashWithConfig) {
     auto net1 = createNetwork();
     auto net2 = createNetwork();
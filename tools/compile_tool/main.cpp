@@ -4,9 +4,13 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <iomanip>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -81,6 +85,22 @@ static constexpr char api1_message[] =
                                              "Optional. Compile model to legacy format for usage in Inference Engine API,\n"
 "                                             by default compiles to OV 2.0 API";
 
+static constexpr char model_list_message[] =
+                                             "Optional. Path to a manifest with models to compile, one per line:\n"
+"                                             <model_xml_file> [<config_file>]\n"
+"                                             Lines starting with # are skipped. Models are compiled concurrently\n"
+"                                             with a shared Core (see -jobs), typically to pre-warm the compiled\n"
+"                                             model cache (see -cache_dir); no .blob files are written.\n"
+"                                             Cannot be combined with -m or -ov_api_1_0.";
+
+static constexpr char jobs_message[] =
+                                             "Optional. Maximum number of models compiled concurrently in manifest mode.\n"
+"                                             Default value: number of hardware threads.";
+
+static constexpr char cache_dir_message[] =
+                                             "Optional. Directory for the compiled model cache (sets the CACHE_DIR config key),\n"
+"                                             so compilation results are stored for later fast loading.";
+
 // MYRIAD-specific
 static constexpr char number_of_shaves_message[] =
                                              "Optional. Specifies number of shaves.\n"
@@ -113,6 +133,9 @@ DEFINE_string(iml, "", inputs_model_layout_message);
 DEFINE_string(oml, "", outputs_model_layout_message);
 DEFINE_string(ioml, "", ioml_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
+DEFINE_string(mlist, "", model_list_message);
+DEFINE_int32(jobs, 0, jobs_message);
+DEFINE_string(cache_dir, "", cache_dir_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
@@ -590,6 +613,9 @@ static void showUsage() {
     std::cout << "    -oml                         <value>     "   << outputs_model_layout_message << std::endl;
     std::cout << "    -ioml                       \"<value>\"    "   << ioml_message               << std::endl;
     std::cout << "    -ov_api_1_0                              "   << api1_message                 << std::endl;
+    std::cout << "    -mlist                       <value>     "   << model_list_message           << std::endl;
+    std::cout << "    -jobs                        <value>     "   << jobs_message                 << std::endl;
+    std::cout << "    -cache_dir                   <value>     "   << cache_dir_message            << std::endl;
     std::cout                                                                                      << std::endl;
     std::cout << " MYRIAD-specific options:                    "                                   << std::endl;
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
@@ -606,8 +632,20 @@ static bool parseCommandLine(int* argc, char*** argv) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::invalid_argument("Path to model xml file is required");
+    if (FLAGS_m.empty() && FLAGS_mlist.empty()) {
+        throw std::invalid_argument("Path to model xml file (-m) or model manifest (-mlist) is required");
+    }
+
+    if (!FLAGS_m.empty() && !FLAGS_mlist.empty()) {
+        throw std::invalid_argument("Options -m and -mlist cannot be used together");
+    }
+
+    if (!FLAGS_mlist.empty() && FLAGS_ov_api_1_0) {
+        throw std::invalid_argument("Option -mlist is not supported with -ov_api_1_0");
+    }
+
+    if (FLAGS_jobs < 0) {
+        throw std::invalid_argument("Number of jobs must be a non-negative integer");
     }
 
     if (FLAGS_d.empty()) {
@@ -629,10 +667,10 @@ static bool parseCommandLine(int* argc, char*** argv) {
     return true;
 }
 
-static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+static std::map<std::string, std::string> parseConfigFile(const std::string& path, char comment = '#') {
     std::map<std::string, std::string> config;
 
-    std::ifstream file(FLAGS_c);
+    std::ifstream file(path);
     if (file.is_open()) {
         std::string option;
         while (std::getline(file, option)) {
@@ -653,7 +691,7 @@ static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
 
 static std::map<std::string, std::string> configure() {
     const bool isMYRIAD = FLAGS_d.find("MYRIAD") != std::string::npos;
-    auto config = parseConfigFile();
+    auto config = parseConfigFile(FLAGS_c);
 
     if (isMYRIAD) {
         if (!FLAGS_VPU_NUMBER_OF_SHAVES.empty()) {
@@ -734,6 +772,143 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+struct ManifestEntry {
+    std::string modelPath;
+    std::string configPath;
+};
+
+static std::vector<ManifestEntry> parseManifest(const std::string& path, char comment = '#') {
+    std::vector<ManifestEntry> entries;
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Model manifest " + path + " can't be opened for reading");
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == comment) {
+            continue;
+        }
+        std::istringstream lineStream(line);
+        ManifestEntry entry;
+        lineStream >> entry.modelPath >> entry.configPath;
+        if (entry.modelPath.empty()) {
+            continue;
+        }
+        entries.push_back(std::move(entry));
+    }
+
+    return entries;
+}
+
+struct CompileJobResult {
+    std::string modelPath;
+    TimeDiff readModelTimeElapsed {0};
+    TimeDiff compileTimeElapsed {0};
+    bool succeeded = false;
+    std::string error;
+};
+
+static int runManifestMode() {
+    const auto entries = parseManifest(FLAGS_mlist);
+    if (entries.empty()) {
+        throw std::invalid_argument("Model manifest " + FLAGS_mlist + " contains no models");
+    }
+
+    ov::Core core;
+    if (!FLAGS_log_level.empty()) {
+        core.set_property(FLAGS_d, {{CONFIG_KEY(LOG_LEVEL), FLAGS_log_level}});
+    }
+    if (!FLAGS_cache_dir.empty()) {
+        core.set_property(ov::cache_dir(FLAGS_cache_dir));
+    }
+    const auto globalConfig = configure();
+
+    auto jobs = FLAGS_jobs > 0 ? static_cast<size_t>(FLAGS_jobs)
+                               : static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()));
+    jobs = std::min(jobs, entries.size());
+    std::cout << "Compiling " << entries.size() << " models for " << FLAGS_d << " with " << jobs << " parallel jobs" << std::endl;
+
+    std::vector<CompileJobResult> results(entries.size());
+    std::atomic<size_t> nextJob {0};
+    std::mutex logMutex;
+
+    const auto timeBeforeAllJobs = std::chrono::steady_clock::now();
+    auto worker = [&]() {
+        for (size_t idx = nextJob++; idx < entries.size(); idx = nextJob++) {
+            const auto& entry = entries[idx];
+            auto& result = results[idx];
+            result.modelPath = entry.modelPath;
+            try {
+                auto config = globalConfig;
+                for (auto&& item : parseConfigFile(entry.configPath)) {
+                    config[item.first] = item.second;
+                }
+
+                auto timeBeforeReadModel = std::chrono::steady_clock::now();
+                auto model = core.read_model(entry.modelPath);
+                configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol,
+                                           FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+                auto timeBeforeCompile = std::chrono::steady_clock::now();
+                result.readModelTimeElapsed = std::chrono::duration_cast<TimeDiff>(timeBeforeCompile - timeBeforeReadModel);
+
+                core.compile_model(model, FLAGS_d, {config.begin(), config.end()});
+                result.compileTimeElapsed =
+                    std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeCompile);
+                result.succeeded = true;
+            } catch (const std::exception& error) {
+                result.error = error.what();
+            } catch (...) {
+                result.error = "Unknown/internal exception happened.";
+            }
+
+            std::lock_guard<std::mutex> lock(logMutex);
+            std::cout << "[" << (idx + 1) << "/" << entries.size() << "] " << entry.modelPath;
+            if (result.succeeded) {
+                std::cout << " ... " << result.compileTimeElapsed.count() << " ms" << std::endl;
+            } else {
+                std::cout << " FAILED: " << result.error << std::endl;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t n = 0; n < jobs; n++) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    const auto wallTimeElapsed =
+        std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeAllJobs);
+
+    TimeDiff totalCompileTime {0};
+    size_t failed = 0;
+    std::cout << std::endl << "Compilation report:" << std::endl;
+    for (const auto& result : results) {
+        std::cout << "    " << std::setw(12);
+        if (result.succeeded) {
+            std::cout << result.compileTimeElapsed.count() << " ms    ";
+        } else {
+            std::cout << "FAILED" << "       ";
+        }
+        std::cout << result.modelPath << std::endl;
+        totalCompileTime += result.compileTimeElapsed;
+        if (!result.succeeded) {
+            failed++;
+        }
+    }
+    std::cout << "Total compile time (sum over jobs): " << totalCompileTime.count() << " ms" << std::endl;
+    std::cout << "Wall time elapsed: " << wallTimeElapsed.count() << " ms" << std::endl;
+    if (failed != 0) {
+        std::cout << failed << " of " << results.size() << " models failed to compile" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -748,6 +923,9 @@ int main(int argc, char* argv[]) {
         if (!parseCommandLine(&argc, &argv)) {
             return EXIT_SUCCESS;
         }
+        if (!FLAGS_mlist.empty()) {
+            return runManifestMode();
+        }
         if (FLAGS_ov_api_1_0) {
             InferenceEngine::Core ie;
             if (!FLAGS_log_level.empty()) {
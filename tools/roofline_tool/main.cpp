@@ -0,0 +1,404 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "openvino/openvino.hpp"
+#include <exec_graph_info.hpp>
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char model_message[] =
+                                             "Required. Path to the XML model.";
+
+static constexpr char targetDeviceMessage[] =
+                                             "Optional. Specify a target device for which the roofline estimate is built.\n"
+"                                             The model is compiled for this device and the estimate is computed over the\n"
+"                                             resulting post-fusion execution graph. Default value: CPU.";
+
+static constexpr char config_message[] =
+                                             "Optional. Path to the configuration file with plugin compilation options.";
+
+static constexpr char peak_gflops_message[] =
+                                             "Optional. Peak compute capability of the device, GFLOP/s.\n"
+"                                             Overwrites the value from the capability database.";
+
+static constexpr char peak_gbps_message[] =
+                                             "Optional. Peak memory bandwidth of the device, GB/s.\n"
+"                                             Overwrites the value from the capability database.";
+
+static constexpr char db_message[] =
+                                             "Optional. Path to the device capability database file. Each non-comment line\n"
+"                                             has the format: <device> <peak_gflops> <peak_gbps>. The entry is matched\n"
+"                                             against the target device name up to the first ':'.";
+
+static constexpr char output_message[] =
+                                             "Optional. Path to the output CSV report. If omitted, only the text report\n"
+"                                             is printed to stdout.";
+
+static constexpr char top_message[] =
+                                             "Optional. Number of predicted bottleneck layers to report. Default value: 10.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(d, "CPU", targetDeviceMessage);
+DEFINE_string(c, "", config_message);
+DEFINE_double(peak_gflops, 0.0, peak_gflops_message);
+DEFINE_double(peak_gbps, 0.0, peak_gbps_message);
+DEFINE_string(db, "", db_message);
+DEFINE_string(o, "", output_message);
+DEFINE_int32(top, 10, top_message);
+
+namespace {
+
+// Per-layer estimate computed from the post-fusion execution graph. The counts are
+// derived from the runtime shapes, so whatever the plugin fused into the layer
+// (activations, per-channel scales, sum post-ops) is attributed to it for free --
+// exactly as the fused kernel executes it.
+struct LayerEstimate {
+    int execOrder = -1;
+    std::string name;
+    std::string layerType;
+    std::string runtimePrecision;
+    double flops = 0.0;
+    double bytes = 0.0;
+    double computeUs = 0.0;
+    double memoryUs = 0.0;
+    double predictedUs = 0.0;
+    bool computeBound = false;
+};
+
+struct DeviceCapability {
+    double peakGflops = 0.0;
+    double peakGbps = 0.0;
+};
+
+std::string getRtInfoValue(const ov::Node& op, const char* key) {
+    const auto& rtInfo = op.get_rt_info();
+    const auto it = rtInfo.find(key);
+    if (it == rtInfo.end()) {
+        return {};
+    }
+    return it->second.as<std::string>();
+}
+
+double shapeBytes(const ov::Shape& shape, const ov::element::Type& type) {
+    return static_cast<double>(ov::shape_size(shape)) * type.size();
+}
+
+// FLOP estimates follow the standard conventions: one multiply-add is two FLOPs,
+// data-movement layers are zero. Layers without a dedicated formula are assumed to
+// perform one operation per output element, which keeps them on the memory-bound
+// side of the roofline where such layers belong.
+double estimateFlops(const std::shared_ptr<ov::Node>& op, const std::string& layerType) {
+    static const std::set<std::string> dataMovementTypes = {
+        "Reorder", "Transpose", "Concat", "Concatenation", "Split", "Gather",
+        "Pad", "Tile", "Reshape", "ShapeOf", "StridedSlice", "Broadcast", "DepthToSpace", "SpaceToDepth",
+    };
+    if (dataMovementTypes.count(layerType)) {
+        return 0.0;
+    }
+
+    double outElems = 0.0;
+    for (size_t i = 0; i < op->get_output_size(); i++) {
+        outElems += static_cast<double>(ov::shape_size(op->get_output_shape(i)));
+    }
+
+    if (layerType == "Convolution" || layerType == "Deconvolution" || layerType == "BinaryConvolution") {
+        // Each output point of one output channel consumes the whole per-channel filter,
+        // so flops = 2 * spatial_points * weight_elements, with the weights taken from the
+        // second input of the execution node.
+        if (op->get_input_size() > 1) {
+            const auto& outShape = op->get_output_shape(0);
+            const double weightElems = static_cast<double>(ov::shape_size(op->get_input_shape(1)));
+            if (outShape.size() > 1 && outShape[1] > 0) {
+                return 2.0 * (outElems / outShape[1]) * weightElems;
+            }
+        }
+    } else if (layerType == "FullyConnected" || layerType == "MatMul" || layerType == "Gemm") {
+        const auto& inShape = op->get_input_shape(0);
+        if (!inShape.empty()) {
+            return 2.0 * outElems * inShape.back();
+        }
+    }
+
+    return outElems;
+}
+
+DeviceCapability parseCapabilityDatabase(const std::string& path, const std::string& device) {
+    DeviceCapability capability;
+
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Cannot open the capability database file " + path);
+    }
+
+    const auto deviceKey = device.substr(0, device.find(':'));
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream entry(line);
+        std::string name;
+        DeviceCapability parsed;
+        if ((entry >> name >> parsed.peakGflops >> parsed.peakGbps) && name == deviceKey) {
+            capability = parsed;
+        }
+    }
+
+    return capability;
+}
+
+void dumpCsvReport(const std::string& path, const std::vector<LayerEstimate>& layers) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Output file " + path + " can't be opened for writing");
+    }
+    file << "exec_order;name;type;precision;flops;bytes;intensity;compute_us;memory_us;predicted_us;bound\n";
+    for (const auto& layer : layers) {
+        file << layer.execOrder << ";" << layer.name << ";" << layer.layerType << ";" << layer.runtimePrecision << ";"
+             << std::fixed << std::setprecision(0) << layer.flops << ";" << layer.bytes << ";"
+             << std::setprecision(3) << (layer.bytes > 0.0 ? layer.flops / layer.bytes : 0.0) << ";"
+             << layer.computeUs << ";" << layer.memoryUs << ";" << layer.predictedUs << ";"
+             << (layer.computeBound ? "compute" : "memory") << "\n";
+    }
+}
+
+}  // namespace
+
+static void showUsage() {
+    std::cout << "roofline_tool [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Common options:                             "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -d                           <value>     "   << targetDeviceMessage          << std::endl;
+    std::cout << "    -c                           <value>     "   << config_message               << std::endl;
+    std::cout << "    -peak_gflops                 <value>     "   << peak_gflops_message          << std::endl;
+    std::cout << "    -peak_gbps                   <value>     "   << peak_gbps_message            << std::endl;
+    std::cout << "    -db                          <value>     "   << db_message                   << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message               << std::endl;
+    std::cout << "    -top                         <value>     "   << top_message                  << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file is required");
+    }
+
+    if (FLAGS_db.empty() && (FLAGS_peak_gflops <= 0.0 || FLAGS_peak_gbps <= 0.0)) {
+        throw std::invalid_argument("Device peaks are required: pass -peak_gflops and -peak_gbps or -db");
+    }
+
+    if (FLAGS_top <= 0) {
+        throw std::invalid_argument("Number of bottleneck layers should be positive");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << argv[arg];
+            if (arg < *argc) {
+                message << " ";
+            }
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static ov::AnyMap parseConfigFile(char comment = '#') {
+    ov::AnyMap config;
+
+    std::ifstream file(FLAGS_c);
+    if (file.is_open()) {
+        std::string option;
+        while (std::getline(file, option)) {
+            if (option.empty() || option[0] == comment) {
+                continue;
+            }
+            size_t spacePos = option.find(' ');
+            if (spacePos != std::string::npos) {
+                config[option.substr(0, spacePos)] = option.substr(spacePos + 1);
+            }
+        }
+    }
+    return config;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        const auto& version = ov::get_openvino_version();
+        std::cout << version.description << " version ......... ";
+        std::cout << OPENVINO_VERSION_MAJOR << "." << OPENVINO_VERSION_MINOR << "." << OPENVINO_VERSION_PATCH << std::endl;
+
+        std::cout << "Build ........... ";
+        std::cout << version.buildNumber << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        DeviceCapability capability;
+        if (!FLAGS_db.empty()) {
+            capability = parseCapabilityDatabase(FLAGS_db, FLAGS_d);
+        }
+        if (FLAGS_peak_gflops > 0.0) {
+            capability.peakGflops = FLAGS_peak_gflops;
+        }
+        if (FLAGS_peak_gbps > 0.0) {
+            capability.peakGbps = FLAGS_peak_gbps;
+        }
+        if (capability.peakGflops <= 0.0 || capability.peakGbps <= 0.0) {
+            throw std::logic_error("No capability database entry for device " + FLAGS_d +
+                                   " and no peaks given on the command line");
+        }
+
+        ov::Core core;
+        auto compiledModel = core.compile_model(FLAGS_m, FLAGS_d, parseConfigFile());
+
+        // The estimate walks the runtime (execution) graph rather than the original model:
+        // after the plugin transformations a layer of the source IR may be fused away, split
+        // or converted to another precision, and only the execution graph reflects the kernels
+        // that actually run.
+        auto runtimeModel = compiledModel.get_runtime_model();
+
+        std::vector<LayerEstimate> layers;
+        size_t skippedDynamic = 0;
+        for (const auto& op : runtimeModel->get_ordered_ops()) {
+            const auto layerType = getRtInfoValue(*op, ExecGraphInfoSerialization::LAYER_TYPE);
+            if (layerType.empty() || layerType == "Input" || layerType == "Output" ||
+                layerType == "Const" || layerType == "Parameter" || layerType == "Result") {
+                continue;
+            }
+
+            bool isStatic = true;
+            for (size_t i = 0; i < op->get_input_size() && isStatic; i++) {
+                isStatic = op->get_input_partial_shape(i).is_static();
+            }
+            for (size_t i = 0; i < op->get_output_size() && isStatic; i++) {
+                isStatic = op->get_output_partial_shape(i).is_static();
+            }
+            if (!isStatic) {
+                skippedDynamic++;
+                continue;
+            }
+
+            LayerEstimate layer;
+            layer.name = op->get_friendly_name();
+            layer.layerType = layerType;
+            layer.runtimePrecision = getRtInfoValue(*op, ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            const auto orderStr = getRtInfoValue(*op, ExecGraphInfoSerialization::EXECUTION_ORDER);
+            if (!orderStr.empty()) {
+                layer.execOrder = std::stoi(orderStr);
+            }
+
+            for (size_t i = 0; i < op->get_input_size(); i++) {
+                layer.bytes += shapeBytes(op->get_input_shape(i), op->get_input_element_type(i));
+            }
+            for (size_t i = 0; i < op->get_output_size(); i++) {
+                layer.bytes += shapeBytes(op->get_output_shape(i), op->get_output_element_type(i));
+            }
+            layer.flops = estimateFlops(op, layerType);
+
+            layer.computeUs = layer.flops / capability.peakGflops / 1e3;
+            layer.memoryUs = layer.bytes / capability.peakGbps / 1e3;
+            layer.predictedUs = std::max(layer.computeUs, layer.memoryUs);
+            layer.computeBound = layer.computeUs >= layer.memoryUs;
+            layers.push_back(std::move(layer));
+        }
+
+        if (layers.empty()) {
+            throw std::logic_error("The execution graph contains no executable layers to estimate");
+        }
+
+        double totalFlops = 0.0, totalBytes = 0.0, totalUs = 0.0;
+        size_t computeBoundCount = 0;
+        for (const auto& layer : layers) {
+            totalFlops += layer.flops;
+            totalBytes += layer.bytes;
+            totalUs += layer.predictedUs;
+            computeBoundCount += layer.computeBound ? 1 : 0;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Device: " << FLAGS_d << ", peak " << capability.peakGflops << " GFLOP/s, peak "
+                  << capability.peakGbps << " GB/s, ridge point "
+                  << std::fixed << std::setprecision(2) << capability.peakGflops / capability.peakGbps
+                  << " FLOP/byte" << std::endl;
+        std::cout << "Execution graph: " << layers.size() << " layers ("
+                  << computeBoundCount << " compute-bound, " << layers.size() - computeBoundCount
+                  << " memory-bound";
+        if (skippedDynamic) {
+            std::cout << ", " << skippedDynamic << " dynamic layers skipped";
+        }
+        std::cout << ")" << std::endl;
+        std::cout << "Total: " << std::setprecision(1) << totalFlops / 1e9 << " GFLOP, "
+                  << totalBytes / 1e6 << " MB moved, arithmetic intensity "
+                  << std::setprecision(2) << (totalBytes > 0.0 ? totalFlops / totalBytes : 0.0)
+                  << " FLOP/byte" << std::endl;
+        std::cout << "Predicted lower-bound latency: " << std::setprecision(3) << totalUs / 1e3
+                  << " ms (" << std::setprecision(1) << 1e6 / totalUs << " FPS)" << std::endl;
+
+        auto bottlenecks = layers;
+        std::sort(bottlenecks.begin(), bottlenecks.end(), [](const LayerEstimate& a, const LayerEstimate& b) {
+            return a.predictedUs > b.predictedUs;
+        });
+        bottlenecks.resize(std::min<size_t>(bottlenecks.size(), static_cast<size_t>(FLAGS_top)));
+
+        std::cout << std::endl;
+        std::cout << "Predicted bottleneck layers:" << std::endl;
+        std::cout << "    " << std::left
+                  << std::setw(40) << "name" << std::setw(18) << "type" << std::setw(11) << "MFLOP"
+                  << std::setw(11) << "KB" << std::setw(12) << "FLOP/byte" << std::setw(14) << "predicted us"
+                  << "bound" << std::right << std::endl;
+        for (const auto& layer : bottlenecks) {
+            std::cout << "    " << std::left
+                      << std::setw(40) << layer.name.substr(0, 39)
+                      << std::setw(18) << layer.layerType
+                      << std::setw(11) << std::setprecision(2) << layer.flops / 1e6
+                      << std::setw(11) << std::setprecision(1) << layer.bytes / 1e3
+                      << std::setw(12) << std::setprecision(2) << (layer.bytes > 0.0 ? layer.flops / layer.bytes : 0.0)
+                      << std::setw(14) << std::setprecision(2) << layer.predictedUs
+                      << (layer.computeBound ? "compute" : "memory") << std::right << std::endl;
+        }
+
+        if (!FLAGS_o.empty()) {
+            dumpCsvReport(FLAGS_o, layers);
+            std::cout << std::endl << "Full per-layer report is written to " << FLAGS_o << std::endl;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}